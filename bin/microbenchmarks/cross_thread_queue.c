@@ -0,0 +1,185 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+#include "microbenchmarks.h"
+
+#include <aws/common/atomics.h>
+#include <aws/common/clock.h>
+#include <aws/common/linked_list.h>
+#include <aws/common/mutex.h>
+#include <aws/common/thread.h>
+#include <aws/http/private/mpsc_queue.h>
+
+#include <inttypes.h>
+#include <stdio.h>
+
+enum {
+    /* Like many user threads making requests on one shared connection */
+    BENCHMARK_PRODUCER_COUNT = 32,
+    BENCHMARK_ITEMS_PER_PRODUCER = 100000,
+};
+
+struct benchmark_item {
+    struct aws_linked_list_node list_node;
+    struct aws_mpsc_queue_node queue_node;
+};
+
+/* The hand-off between user threads and a connection's event-loop thread, done both ways */
+struct benchmark_handoff {
+    bool use_mpsc_queue;
+
+    /* The way H1 connections, and H2 connections before the MPSC queue, do it */
+    struct aws_mutex lock;
+    struct aws_linked_list pending_list;
+    bool is_scheduled;
+
+    struct aws_mpsc_queue queue;
+    struct aws_atomic_var is_scheduled_atomic;
+
+    struct aws_atomic_var producers_ready;
+    struct aws_atomic_var go;
+};
+
+struct benchmark_producer {
+    struct benchmark_handoff *handoff;
+    struct benchmark_item *items;
+    /* Times this producer would have scheduled the cross-thread task */
+    uint64_t schedule_count;
+};
+
+static void s_producer_fn(void *arg) {
+    struct benchmark_producer *producer = arg;
+    struct benchmark_handoff *handoff = producer->handoff;
+
+    /* Start everyone at once, to get the contention */
+    aws_atomic_fetch_add(&handoff->producers_ready, 1);
+    while (!aws_atomic_load_int(&handoff->go)) {
+        /* spin */
+    }
+
+    for (size_t i = 0; i < BENCHMARK_ITEMS_PER_PRODUCER; ++i) {
+        struct benchmark_item *item = &producer->items[i];
+        bool was_scheduled;
+        if (handoff->use_mpsc_queue) {
+            aws_mpsc_queue_try_push(&handoff->queue, &item->queue_node);
+            was_scheduled = aws_atomic_exchange_int(&handoff->is_scheduled_atomic, true);
+        } else {
+            aws_mutex_lock(&handoff->lock);
+            aws_linked_list_push_back(&handoff->pending_list, &item->list_node);
+            was_scheduled = handoff->is_scheduled;
+            handoff->is_scheduled = true;
+            aws_mutex_unlock(&handoff->lock);
+        }
+
+        if (!was_scheduled) {
+            ++producer->schedule_count;
+        }
+    }
+}
+
+/* Like the cross-thread work task, except it polls instead of being scheduled. Returns number of items taken */
+static size_t s_consume(struct benchmark_handoff *handoff) {
+    size_t count = 0;
+    if (handoff->use_mpsc_queue) {
+        aws_atomic_store_int(&handoff->is_scheduled_atomic, false);
+        while (aws_mpsc_queue_pop(&handoff->queue) != NULL) {
+            ++count;
+        }
+    } else {
+        struct aws_linked_list taken;
+        aws_linked_list_init(&taken);
+
+        aws_mutex_lock(&handoff->lock);
+        handoff->is_scheduled = false;
+        aws_linked_list_swap_contents(&handoff->pending_list, &taken);
+        aws_mutex_unlock(&handoff->lock);
+
+        while (!aws_linked_list_empty(&taken)) {
+            aws_linked_list_pop_front(&taken);
+            ++count;
+        }
+    }
+    return count;
+}
+
+static int s_run_handoff(struct aws_allocator *allocator, const char *label, bool use_mpsc_queue) {
+    const size_t total_items = (size_t)BENCHMARK_PRODUCER_COUNT * BENCHMARK_ITEMS_PER_PRODUCER;
+    struct benchmark_item *items = aws_mem_calloc(allocator, total_items, sizeof(struct benchmark_item));
+    if (!items) {
+        return AWS_OP_ERR;
+    }
+
+    struct benchmark_handoff handoff;
+    AWS_ZERO_STRUCT(handoff);
+    handoff.use_mpsc_queue = use_mpsc_queue;
+    aws_mutex_init(&handoff.lock);
+    aws_linked_list_init(&handoff.pending_list);
+    aws_mpsc_queue_init(&handoff.queue);
+    aws_atomic_init_int(&handoff.is_scheduled_atomic, false);
+    aws_atomic_init_int(&handoff.producers_ready, 0);
+    aws_atomic_init_int(&handoff.go, false);
+
+    struct benchmark_producer producers[BENCHMARK_PRODUCER_COUNT];
+    struct aws_thread threads[BENCHMARK_PRODUCER_COUNT];
+    size_t threads_launched = 0;
+
+    for (size_t i = 0; i < BENCHMARK_PRODUCER_COUNT; ++i) {
+        producers[i].handoff = &handoff;
+        producers[i].items = items + i * BENCHMARK_ITEMS_PER_PRODUCER;
+        producers[i].schedule_count = 0;
+
+        aws_thread_init(&threads[i], allocator);
+        if (aws_thread_launch(&threads[i], s_producer_fn, &producers[i], NULL)) {
+            aws_thread_clean_up(&threads[i]);
+            break;
+        }
+        ++threads_launched;
+    }
+
+    while (aws_atomic_load_int(&handoff.producers_ready) != threads_launched) {
+        /* spin */
+    }
+
+    uint64_t start_ns = 0;
+    aws_high_res_clock_get_ticks(&start_ns);
+    aws_atomic_store_int(&handoff.go, true);
+
+    if (threads_launched == BENCHMARK_PRODUCER_COUNT) {
+        size_t consumed = 0;
+        while (consumed < total_items) {
+            consumed += s_consume(&handoff);
+        }
+    }
+
+    uint64_t elapsed_ns = aws_http_microbenchmark_elapsed_ns(start_ns);
+
+    uint64_t schedule_count = 0;
+    for (size_t i = 0; i < threads_launched; ++i) {
+        aws_thread_join(&threads[i]);
+        aws_thread_clean_up(&threads[i]);
+        schedule_count += producers[i].schedule_count;
+    }
+
+    int result = AWS_OP_ERR;
+    if (threads_launched == BENCHMARK_PRODUCER_COUNT) {
+        /* iterations are items handed from producer threads to the consumer thread */
+        aws_http_microbenchmark_report(label, total_items, elapsed_ns);
+        printf("  %-40s %12" PRIu64 " times\n", "  cross-thread task would be scheduled", schedule_count);
+        result = AWS_OP_SUCCESS;
+    }
+
+    aws_mem_release(allocator, items);
+    aws_mutex_clean_up(&handoff.lock);
+    return result;
+}
+
+int aws_http_microbenchmark_cross_thread_queue(struct aws_allocator *allocator) {
+    if (s_run_handoff(allocator, "32 threads, mutex + linked list", false /*use_mpsc_queue*/)) {
+        return AWS_OP_ERR;
+    }
+    if (s_run_handoff(allocator, "32 threads, lock-free MPSC queue", true /*use_mpsc_queue*/)) {
+        return AWS_OP_ERR;
+    }
+    return AWS_OP_SUCCESS;
+}
@@ -0,0 +1,145 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+#include "microbenchmarks.h"
+
+#include <aws/common/clock.h>
+#include <aws/common/linked_list.h>
+#include <aws/http/private/h1_encoder.h>
+#include <aws/io/stream.h>
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+enum {
+    /* Size of a typical pooled aws_io_message that the encoder copies into */
+    BENCHMARK_MESSAGE_SIZE = 16 * 1024,
+    /* Matches the size of by-reference messages in h1_connection.c */
+    BENCHMARK_REFERENCE_SIZE = 1024 * 1024,
+};
+
+static const size_t s_body_size = (size_t)1024 * 1024 * 1024; /* 1 GiB */
+
+/* Encode one PUT with the whole body, the way the connection's outgoing-stream-task would.
+ * Returns number of messages the connection would have sent */
+static int s_encode_upload(
+    struct aws_allocator *allocator,
+    struct aws_input_stream *body,
+    bool send_body_by_reference,
+    uint64_t *out_messages) {
+
+    int result = AWS_OP_ERR;
+    char content_length[32];
+    snprintf(content_length, sizeof(content_length), "%zu", s_body_size);
+    struct aws_http_header header = {
+        .name = aws_byte_cursor_from_c_str("Content-Length"),
+        .value = aws_byte_cursor_from_c_str(content_length),
+    };
+
+    struct aws_http_message *request = aws_http_message_new_request(allocator);
+    aws_http_message_set_request_method(request, aws_byte_cursor_from_c_str("PUT"));
+    aws_http_message_set_request_path(request, aws_byte_cursor_from_c_str("/upload"));
+    aws_http_message_add_header(request, header);
+    aws_http_message_set_body_stream(request, body);
+
+    struct aws_linked_list chunk_list;
+    aws_linked_list_init(&chunk_list);
+
+    struct aws_h1_encoder_message message;
+    struct aws_h1_encoder encoder;
+    struct aws_byte_buf message_buf;
+    aws_byte_buf_init(&message_buf, allocator, BENCHMARK_MESSAGE_SIZE);
+    aws_h1_encoder_init(&encoder, allocator);
+    encoder.send_body_by_reference = send_body_by_reference;
+
+    if (aws_h1_encoder_message_init_from_request(&message, allocator, request, &chunk_list)) {
+        goto done;
+    }
+    if (aws_h1_encoder_start_message(&encoder, &message, NULL)) {
+        goto clean_up_message;
+    }
+
+    uint64_t messages = 0;
+    while (aws_h1_encoder_is_message_in_progress(&encoder)) {
+        struct aws_byte_cursor body_data;
+        struct aws_input_stream *body_ref;
+        if (aws_h1_encoder_take_body_reference(&encoder, BENCHMARK_REFERENCE_SIZE, &body_data, &body_ref)) {
+            ++messages;
+            continue;
+        }
+
+        message_buf.len = 0;
+        if (aws_h1_encoder_process(&encoder, &message_buf)) {
+            goto clean_up_message;
+        }
+        if (message_buf.len > 0) {
+            ++messages;
+        }
+    }
+
+    *out_messages = messages;
+    result = AWS_OP_SUCCESS;
+
+clean_up_message:
+    aws_h1_encoder_message_clean_up(&message);
+done:
+    aws_h1_encoder_clean_up(&encoder);
+    aws_byte_buf_clean_up(&message_buf);
+    aws_http_message_release(request);
+    return result;
+}
+
+static int s_run_upload(
+    struct aws_allocator *allocator,
+    const char *label,
+    struct aws_input_stream *body,
+    bool send_body_by_reference) {
+
+    uint64_t messages = 0;
+    uint64_t start_ns = 0;
+    aws_high_res_clock_get_ticks(&start_ns);
+    int err = s_encode_upload(allocator, body, send_body_by_reference, &messages);
+    uint64_t elapsed_ns = aws_http_microbenchmark_elapsed_ns(start_ns);
+    if (err) {
+        return AWS_OP_ERR;
+    }
+
+    aws_http_microbenchmark_report(label, messages, elapsed_ns);
+    double seconds = (double)elapsed_ns / (double)AWS_TIMESTAMP_NANOS;
+    printf("  %-40s %12.2f GiB/s\n", "", seconds > 0.0 ? 1.0 / seconds : 0.0);
+    return AWS_OP_SUCCESS;
+}
+
+int aws_http_microbenchmark_h1_body_send(struct aws_allocator *allocator) {
+    uint8_t *body_data = aws_mem_acquire(allocator, s_body_size);
+    if (!body_data) {
+        return AWS_OP_ERR;
+    }
+    /* Touch every page up front, so neither run pays for faulting them in */
+    memset(body_data, 'a', s_body_size);
+    struct aws_byte_cursor body_cursor = aws_byte_cursor_from_array(body_data, s_body_size);
+
+    int result = AWS_OP_ERR;
+    struct aws_input_stream *copied_body = aws_input_stream_new_from_cursor(allocator, &body_cursor);
+    struct aws_input_stream *memory_body = aws_http_body_stream_new_from_memory(allocator, body_cursor, NULL, NULL);
+    if (!copied_body || !memory_body) {
+        goto done;
+    }
+
+    /* iterations are aws_io_messages sent */
+    if (s_run_upload(allocator, "1 GiB PUT, body copied into messages", copied_body, false)) {
+        goto done;
+    }
+    if (s_run_upload(allocator, "1 GiB PUT, body sent by reference", memory_body, true)) {
+        goto done;
+    }
+
+    result = AWS_OP_SUCCESS;
+done:
+    aws_input_stream_release(copied_body);
+    aws_input_stream_release(memory_body);
+    aws_mem_release(allocator, body_data);
+    return result;
+}
@@ -0,0 +1,249 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+#include "microbenchmarks.h"
+
+#include <aws/common/clock.h>
+#include <aws/http/private/h2_decoder.h>
+#include <aws/http/private/h2_frames.h>
+#include <aws/http/request_response.h>
+#include <aws/io/stream.h>
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+enum {
+    /* What a client receives from a server while downloading a batch of responses */
+    BENCHMARK_STREAM_COUNT = 256,
+    BENCHMARK_DATA_FRAMES_PER_STREAM = 4,
+    BENCHMARK_DATA_FRAME_SIZE = 4096,
+    BENCHMARK_STREAMS_PER_PING = 16,
+    BENCHMARK_PASSES = 50,
+};
+
+struct recorded_traffic {
+    struct aws_byte_buf buf;
+    uint64_t frame_count;
+};
+
+static int s_record_frame(
+    struct aws_h2_frame_encoder *encoder,
+    struct aws_h2_frame *frame,
+    struct recorded_traffic *traffic) {
+
+    if (!frame) {
+        return AWS_OP_ERR;
+    }
+
+    bool frame_complete = false;
+    int result = aws_h2_encode_frame(encoder, frame, &traffic->buf, &frame_complete);
+    aws_h2_frame_destroy(frame);
+    if (result || !frame_complete) {
+        return aws_raise_error(AWS_ERROR_SHORT_BUFFER);
+    }
+
+    ++traffic->frame_count;
+    return AWS_OP_SUCCESS;
+}
+
+static int s_record_data_frame(
+    struct aws_allocator *allocator,
+    struct aws_h2_frame_encoder *encoder,
+    uint32_t stream_id,
+    struct aws_byte_cursor body_src,
+    bool ends_stream,
+    struct recorded_traffic *traffic) {
+
+    struct aws_input_stream *body = aws_input_stream_new_from_cursor(allocator, &body_src);
+    if (!body) {
+        return AWS_OP_ERR;
+    }
+
+    bool body_complete = false;
+    bool body_stalled = false;
+    int32_t stream_window_size_peer = AWS_H2_WINDOW_UPDATE_MAX;
+    size_t connection_window_size_peer = AWS_H2_WINDOW_UPDATE_MAX;
+    int result = aws_h2_encode_data_frame(
+        encoder,
+        stream_id,
+        body,
+        ends_stream,
+        0 /*pad_length*/,
+        &stream_window_size_peer,
+        &connection_window_size_peer,
+        &traffic->buf,
+        &body_complete,
+        &body_stalled);
+    aws_input_stream_release(body);
+    if (result || !body_complete) {
+        return aws_raise_error(AWS_ERROR_SHORT_BUFFER);
+    }
+
+    ++traffic->frame_count;
+    return AWS_OP_SUCCESS;
+}
+
+/* Stand-in for a capture of real traffic: the frames a server sends while answering a batch of GETs.
+ * Uses the real encoder, so header-blocks are HPACK compressed just like they'd be on the wire. */
+static int s_record_traffic(struct aws_allocator *allocator, struct recorded_traffic *traffic) {
+    const size_t per_stream_size = 256 + BENCHMARK_DATA_FRAMES_PER_STREAM * (9 + BENCHMARK_DATA_FRAME_SIZE);
+    if (aws_byte_buf_init(&traffic->buf, allocator, 1024 + BENCHMARK_STREAM_COUNT * per_stream_size)) {
+        return AWS_OP_ERR;
+    }
+    traffic->frame_count = 0;
+
+    int result = AWS_OP_ERR;
+    struct aws_h2_frame_encoder encoder;
+    if (aws_h2_frame_encoder_init(&encoder, allocator, NULL /*logging_id*/)) {
+        aws_byte_buf_clean_up(&traffic->buf);
+        return AWS_OP_ERR;
+    }
+
+    uint8_t body_bytes[BENCHMARK_DATA_FRAME_SIZE];
+    memset(body_bytes, 'x', sizeof(body_bytes));
+    struct aws_byte_cursor body_src = aws_byte_cursor_from_array(body_bytes, sizeof(body_bytes));
+
+    char content_length[32];
+    snprintf(
+        content_length, sizeof(content_length), "%d", BENCHMARK_DATA_FRAMES_PER_STREAM * BENCHMARK_DATA_FRAME_SIZE);
+    struct aws_http_header response_headers[] = {
+        {.name = aws_byte_cursor_from_c_str(":status"), .value = aws_byte_cursor_from_c_str("200")},
+        {.name = aws_byte_cursor_from_c_str("content-type"), .value = aws_byte_cursor_from_c_str("application/json")},
+        {.name = aws_byte_cursor_from_c_str("content-length"), .value = aws_byte_cursor_from_c_str(content_length)},
+        {.name = aws_byte_cursor_from_c_str("server"), .value = aws_byte_cursor_from_c_str("benchmark")},
+        {.name = aws_byte_cursor_from_c_str("cache-control"), .value = aws_byte_cursor_from_c_str("no-cache")},
+    };
+    struct aws_http_headers *headers = aws_http_headers_new(allocator);
+    if (!headers) {
+        goto done;
+    }
+    for (size_t i = 0; i < AWS_ARRAY_SIZE(response_headers); ++i) {
+        if (aws_http_headers_add_header(headers, &response_headers[i])) {
+            goto done;
+        }
+    }
+
+    struct aws_http2_setting settings[] = {
+        {.id = AWS_HTTP2_SETTINGS_MAX_CONCURRENT_STREAMS, .value = 100},
+        {.id = AWS_HTTP2_SETTINGS_INITIAL_WINDOW_SIZE, .value = 1024 * 1024},
+    };
+    if (s_record_frame(
+            &encoder,
+            aws_h2_frame_new_settings(allocator, settings, AWS_ARRAY_SIZE(settings), false /*ack*/),
+            traffic) ||
+        s_record_frame(&encoder, aws_h2_frame_new_settings(allocator, NULL, 0, true /*ack*/), traffic) ||
+        s_record_frame(&encoder, aws_h2_frame_new_window_update(allocator, 0 /*stream_id*/, 1024 * 1024), traffic)) {
+        goto done;
+    }
+
+    uint8_t opaque_data[AWS_HTTP2_PING_DATA_SIZE] = {0};
+    for (uint32_t i = 0; i < BENCHMARK_STREAM_COUNT; ++i) {
+        const uint32_t stream_id = 1 + 2 * i;
+        if (s_record_frame(
+                &encoder,
+                aws_h2_frame_new_headers(
+                    allocator, stream_id, headers, false /*end_stream*/, 0 /*pad_length*/, NULL /*priority*/),
+                traffic)) {
+            goto done;
+        }
+
+        for (int frame_i = 0; frame_i < BENCHMARK_DATA_FRAMES_PER_STREAM; ++frame_i) {
+            const bool ends_stream = frame_i == BENCHMARK_DATA_FRAMES_PER_STREAM - 1;
+            if (s_record_data_frame(allocator, &encoder, stream_id, body_src, ends_stream, traffic)) {
+                goto done;
+            }
+        }
+
+        if ((i + 1) % BENCHMARK_STREAMS_PER_PING == 0) {
+            if (s_record_frame(&encoder, aws_h2_frame_new_ping(allocator, true /*ack*/, opaque_data), traffic)) {
+                goto done;
+            }
+        }
+    }
+
+    result = AWS_OP_SUCCESS;
+done:
+    aws_http_headers_release(headers);
+    aws_h2_frame_encoder_clean_up(&encoder);
+    if (result) {
+        aws_byte_buf_clean_up(&traffic->buf);
+    }
+    return result;
+}
+
+/* Decode the recorded traffic, handing it to the decoder `read_size` bytes at a time, like socket reads would */
+static int s_run_decode(
+    struct aws_allocator *allocator,
+    const char *label,
+    const struct recorded_traffic *traffic,
+    size_t read_size) {
+
+    /* The benchmark is about the decoder itself, so nobody is listening */
+    static const struct aws_h2_decoder_vtable s_vtable;
+
+    struct aws_h2_decoder_params params = {
+        .alloc = allocator,
+        .vtable = &s_vtable,
+        .is_server = false,
+    };
+
+    uint64_t start_ns = 0;
+    aws_high_res_clock_get_ticks(&start_ns);
+
+    for (int pass = 0; pass < BENCHMARK_PASSES; ++pass) {
+        /* Each pass is a new connection, so the HPACK table matches what the encoder saw */
+        struct aws_h2_decoder *decoder = aws_h2_decoder_new(&params);
+        if (!decoder) {
+            return AWS_OP_ERR;
+        }
+
+        struct aws_byte_cursor input = aws_byte_cursor_from_buf(&traffic->buf);
+        while (input.len) {
+            struct aws_byte_cursor chunk = aws_byte_cursor_advance(&input, aws_min_size(read_size, input.len));
+            struct aws_h2err err = aws_h2_decode(decoder, &chunk);
+            if (aws_h2err_failed(err)) {
+                aws_h2_decoder_destroy(decoder);
+                return aws_raise_error(err.aws_code);
+            }
+        }
+
+        aws_h2_decoder_destroy(decoder);
+    }
+
+    uint64_t elapsed_ns = aws_http_microbenchmark_elapsed_ns(start_ns);
+
+    /* iterations are frames decoded */
+    aws_http_microbenchmark_report(label, traffic->frame_count * BENCHMARK_PASSES, elapsed_ns);
+    double bytes = (double)traffic->buf.len * BENCHMARK_PASSES;
+    double seconds = (double)elapsed_ns / 1e9;
+    printf("  %-40s %12.1f MiB/s\n", "", seconds > 0 ? bytes / (1024.0 * 1024.0) / seconds : 0.0);
+    return AWS_OP_SUCCESS;
+}
+
+int aws_http_microbenchmark_h2_decode(struct aws_allocator *allocator) {
+    struct recorded_traffic traffic;
+    if (s_record_traffic(allocator, &traffic)) {
+        return AWS_OP_ERR;
+    }
+
+    int result = AWS_OP_ERR;
+
+    /* Reads smaller than a frame prefix never hold a whole frame, so everything goes through the state machine */
+    if (s_run_decode(allocator, "7 byte reads (state machine only)", &traffic, 7)) {
+        goto done;
+    }
+    /* Frames that straddle a read boundary fall back to the state machine, the rest are decoded in place */
+    if (s_run_decode(allocator, "16 KiB reads", &traffic, 16 * 1024)) {
+        goto done;
+    }
+    if (s_run_decode(allocator, "whole capture in one read", &traffic, traffic.buf.len)) {
+        goto done;
+    }
+
+    result = AWS_OP_SUCCESS;
+done:
+    aws_byte_buf_clean_up(&traffic.buf);
+    return result;
+}
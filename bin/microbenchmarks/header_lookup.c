@@ -0,0 +1,115 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+#include "microbenchmarks.h"
+
+#include <aws/common/clock.h>
+#include <aws/common/hash_table.h>
+#include <aws/http/private/http_impl.h>
+
+/* Mix of header names seen on typical requests/responses, in the casing they're usually sent */
+static const struct aws_byte_cursor s_names[] = {
+    AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("Host"),
+    AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("Content-Length"),
+    AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("Content-Type"),
+    AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("Connection"),
+    AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("Transfer-Encoding"),
+    AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("Authorization"),
+    AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("Date"),
+    AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("X-Amz-Date"),
+    AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("X-Amz-Content-Sha256"),
+    AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("X-Amz-Request-Id"),
+    AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("ETag"),
+    AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("Server"),
+    AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("Accept"),
+    AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("User-Agent"),
+    AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("Expect"),
+    AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("Cache-Control"),
+};
+
+/* The names recognized by aws_http_str_to_header_name(), to build the hash table it used to be based on */
+static const struct aws_byte_cursor s_known_names[] = {
+    AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL(":method"),
+    AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL(":scheme"),
+    AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL(":authority"),
+    AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL(":path"),
+    AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL(":status"),
+    AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("cookie"),
+    AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("set-cookie"),
+    AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("host"),
+    AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("connection"),
+    AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("content-length"),
+    AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("expect"),
+    AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("transfer-encoding"),
+    AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("cache-control"),
+    AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("max-forwards"),
+    AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("pragma"),
+    AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("range"),
+    AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("te"),
+    AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("content-encoding"),
+    AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("content-type"),
+    AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("content-range"),
+    AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("trailer"),
+    AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("www-authenticate"),
+    AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("authorization"),
+    AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("proxy-authenticate"),
+    AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("proxy-authorization"),
+    AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("age"),
+    AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("expires"),
+    AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("date"),
+    AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("location"),
+    AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("retry-after"),
+    AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("vary"),
+    AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("warning"),
+    AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("upgrade"),
+    AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("keep-alive"),
+    AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("proxy-connection"),
+};
+
+enum { s_iterations = 10000000 };
+
+int aws_http_microbenchmark_header_lookup(struct aws_allocator *allocator) {
+    /* Sum results so the compiler can't optimize the lookups away */
+    volatile uint64_t sum = 0;
+    uint64_t start_ns = 0;
+
+    /* Perfect hash (what aws_http_str_to_header_name() uses) */
+    aws_high_res_clock_get_ticks(&start_ns);
+    for (size_t i = 0; i < s_iterations; ++i) {
+        sum += aws_http_str_to_header_name(s_names[i % AWS_ARRAY_SIZE(s_names)]);
+    }
+    aws_http_microbenchmark_report("perfect hash", s_iterations, aws_http_microbenchmark_elapsed_ns(start_ns));
+
+    /* Generic case-insensitive aws_hash_table */
+    struct aws_hash_table table;
+    if (aws_hash_table_init(
+            &table,
+            allocator,
+            AWS_ARRAY_SIZE(s_known_names),
+            aws_hash_byte_cursor_ptr_ignore_case,
+            (aws_hash_callback_eq_fn *)aws_byte_cursor_eq_ignore_case,
+            NULL,
+            NULL)) {
+        return AWS_OP_ERR;
+    }
+
+    for (size_t i = 0; i < AWS_ARRAY_SIZE(s_known_names); ++i) {
+        if (aws_hash_table_put(&table, &s_known_names[i], (void *)(i + 1), NULL)) {
+            aws_hash_table_clean_up(&table);
+            return AWS_OP_ERR;
+        }
+    }
+
+    aws_high_res_clock_get_ticks(&start_ns);
+    for (size_t i = 0; i < s_iterations; ++i) {
+        struct aws_hash_element *elem = NULL;
+        aws_hash_table_find(&table, &s_names[i % AWS_ARRAY_SIZE(s_names)], &elem);
+        sum += elem ? (uint64_t)(size_t)elem->value : 0;
+    }
+    aws_http_microbenchmark_report("aws_hash_table", s_iterations, aws_http_microbenchmark_elapsed_ns(start_ns));
+
+    aws_hash_table_clean_up(&table);
+    (void)sum;
+    return AWS_OP_SUCCESS;
+}
@@ -0,0 +1,109 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+#include "microbenchmarks.h"
+
+#include <aws/common/clock.h>
+#include <aws/http/private/hpack.h>
+
+enum {
+    BENCHMARK_PASSES = 200000,
+};
+
+/* Header values that don't hit the static table, so they're sent as literal strings */
+static const struct aws_byte_cursor s_values[] = {
+    AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("my-bucket.s3.us-west-2.amazonaws.com"),
+    AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("/photos/2024/summer/IMG_0042.jpg?versionId=3HL4kqtJlcpXroDTDmJ"),
+    AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("20240601T120000Z"),
+    AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855"),
+    AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("aws-sdk-cpp/1.11.0 Linux/6.1 x86_64 GCC/12.2.0"),
+    AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("application/octet-stream"),
+    AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("\"9b2cf535f27731c974343645a3985328\""),
+    AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("bytes=0-8388607"),
+};
+
+static uint64_t s_iterations(void) {
+    return (uint64_t)BENCHMARK_PASSES * AWS_ARRAY_SIZE(s_values);
+}
+
+/* Encode each value in SMALLEST mode, which has to figure out the Huffman length of every string */
+static int s_run_encode(struct aws_allocator *allocator, struct aws_byte_buf *encoded) {
+    struct aws_hpack_encoder encoder;
+    aws_hpack_encoder_init(&encoder, allocator, NULL /*log_id*/);
+    aws_hpack_encoder_set_huffman_mode(&encoder, AWS_HPACK_HUFFMAN_SMALLEST);
+
+    int result = AWS_OP_ERR;
+    uint64_t start_ns = 0;
+    aws_high_res_clock_get_ticks(&start_ns);
+
+    for (int pass = 0; pass < BENCHMARK_PASSES; ++pass) {
+        encoded->len = 0;
+        for (size_t i = 0; i < AWS_ARRAY_SIZE(s_values); ++i) {
+            if (aws_hpack_encode_string(&encoder, s_values[i], encoded)) {
+                goto done;
+            }
+        }
+    }
+
+    /* iterations are strings encoded */
+    uint64_t elapsed_ns = aws_http_microbenchmark_elapsed_ns(start_ns);
+    aws_http_microbenchmark_report("encode, SMALLEST mode", s_iterations(), elapsed_ns);
+    result = AWS_OP_SUCCESS;
+done:
+    aws_hpack_encoder_clean_up(&encoder);
+    return result;
+}
+
+/* Decode what s_run_encode() produced */
+static int s_run_decode(struct aws_allocator *allocator, const struct aws_byte_buf *encoded) {
+    struct aws_hpack_decoder decoder;
+    aws_hpack_decoder_init(&decoder, allocator, NULL /*log_id*/);
+
+    struct aws_byte_buf output;
+    if (aws_byte_buf_init(&output, allocator, 256)) {
+        aws_hpack_decoder_clean_up(&decoder);
+        return AWS_OP_ERR;
+    }
+
+    int result = AWS_OP_ERR;
+    uint64_t start_ns = 0;
+    aws_high_res_clock_get_ticks(&start_ns);
+
+    for (int pass = 0; pass < BENCHMARK_PASSES; ++pass) {
+        struct aws_byte_cursor to_decode = aws_byte_cursor_from_buf(encoded);
+        while (to_decode.len) {
+            output.len = 0;
+            bool complete = false;
+            if (aws_hpack_decode_string(&decoder, &to_decode, &output, &complete) || !complete) {
+                goto done;
+            }
+        }
+    }
+
+    /* iterations are strings decoded */
+    uint64_t elapsed_ns = aws_http_microbenchmark_elapsed_ns(start_ns);
+    aws_http_microbenchmark_report("decode", s_iterations(), elapsed_ns);
+    result = AWS_OP_SUCCESS;
+done:
+    aws_byte_buf_clean_up(&output);
+    aws_hpack_decoder_clean_up(&decoder);
+    return result;
+}
+
+int aws_http_microbenchmark_hpack_string(struct aws_allocator *allocator) {
+    struct aws_byte_buf encoded;
+    if (aws_byte_buf_init(&encoded, allocator, 1024)) {
+        return AWS_OP_ERR;
+    }
+
+    int result = AWS_OP_ERR;
+    if (s_run_encode(allocator, &encoded) || s_run_decode(allocator, &encoded)) {
+        goto done;
+    }
+
+    result = AWS_OP_SUCCESS;
+done:
+    aws_byte_buf_clean_up(&encoded);
+    return result;
+}
@@ -0,0 +1,106 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+#include "microbenchmarks.h"
+
+#include <aws/common/clock.h>
+#include <aws/http/http.h>
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+static struct aws_http_microbenchmark s_benchmarks[] = {
+    {
+        .name = "header_lookup",
+        .description = "Header name -> enum lookup, compared against a generic aws_hash_table",
+        .fn = aws_http_microbenchmark_header_lookup,
+    },
+    {
+        .name = "h1_body_send",
+        .description = "Encoding a 1 GiB HTTP/1.1 upload, copying the body vs sending it by reference",
+        .fn = aws_http_microbenchmark_h1_body_send,
+    },
+    {
+        .name = "cross_thread_queue",
+        .description = "32 threads handing work to one connection thread, mutex + list vs lock-free MPSC queue",
+        .fn = aws_http_microbenchmark_cross_thread_queue,
+    },
+    {
+        .name = "h2_decode",
+        .description = "Decoding a recorded HTTP/2 download, whole frames in place vs the resumable state machine",
+        .fn = aws_http_microbenchmark_h2_decode,
+    },
+    {
+        .name = "hpack_string",
+        .description = "HPACK string literals, Huffman encoded word-at-a-time and decoded a nibble at a time",
+        .fn = aws_http_microbenchmark_hpack_string,
+    },
+};
+
+uint64_t aws_http_microbenchmark_elapsed_ns(uint64_t start_ns) {
+    uint64_t now_ns = 0;
+    aws_high_res_clock_get_ticks(&now_ns);
+    return now_ns - start_ns;
+}
+
+void aws_http_microbenchmark_report(const char *label, uint64_t iterations, uint64_t elapsed_ns) {
+    double ns_per_iteration = iterations ? (double)elapsed_ns / (double)iterations : 0.0;
+    printf("  %-40s %12" PRIu64 " iterations %10.2f ns/iteration\n", label, iterations, ns_per_iteration);
+}
+
+static void s_usage(void) {
+    fprintf(stderr, "usage: aws-c-http-microbenchmarks [benchmark-name ...]\n");
+    fprintf(stderr, "Runs all benchmarks if none are named. Available benchmarks:\n");
+    for (size_t i = 0; i < AWS_ARRAY_SIZE(s_benchmarks); ++i) {
+        fprintf(stderr, "  %-24s %s\n", s_benchmarks[i].name, s_benchmarks[i].description);
+    }
+}
+
+static int s_run(struct aws_allocator *allocator, const struct aws_http_microbenchmark *benchmark) {
+    printf("%s:\n", benchmark->name);
+    if (benchmark->fn(allocator)) {
+        fprintf(stderr, "%s failed: %s\n", benchmark->name, aws_error_name(aws_last_error()));
+        return AWS_OP_ERR;
+    }
+    return AWS_OP_SUCCESS;
+}
+
+int main(int argc, char **argv) {
+    struct aws_allocator *allocator = aws_default_allocator();
+    aws_http_library_init(allocator);
+
+    int result = 0;
+    if (argc <= 1) {
+        for (size_t i = 0; i < AWS_ARRAY_SIZE(s_benchmarks); ++i) {
+            if (s_run(allocator, &s_benchmarks[i])) {
+                result = 1;
+            }
+        }
+    } else {
+        for (int arg_i = 1; arg_i < argc; ++arg_i) {
+            const struct aws_http_microbenchmark *benchmark = NULL;
+            for (size_t i = 0; i < AWS_ARRAY_SIZE(s_benchmarks); ++i) {
+                if (strcmp(argv[arg_i], s_benchmarks[i].name) == 0) {
+                    benchmark = &s_benchmarks[i];
+                    break;
+                }
+            }
+
+            if (!benchmark) {
+                fprintf(stderr, "unknown benchmark: %s\n", argv[arg_i]);
+                s_usage();
+                result = 1;
+                break;
+            }
+
+            if (s_run(allocator, benchmark)) {
+                result = 1;
+            }
+        }
+    }
+
+    aws_http_library_clean_up();
+    return result;
+}
@@ -0,0 +1,35 @@
+#ifndef AWS_HTTP_MICROBENCHMARKS_H
+#define AWS_HTTP_MICROBENCHMARKS_H
+
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/common/common.h>
+
+/**
+ * A microbenchmark runs some internal piece of aws-c-http in a tight loop and prints its results.
+ * Returns AWS_OP_SUCCESS, or AWS_OP_ERR if the benchmark could not run.
+ */
+typedef int(aws_http_microbenchmark_fn)(struct aws_allocator *allocator);
+
+struct aws_http_microbenchmark {
+    const char *name;
+    const char *description;
+    aws_http_microbenchmark_fn *fn;
+};
+
+/* Time elapsed since start_ns, in nanoseconds */
+uint64_t aws_http_microbenchmark_elapsed_ns(uint64_t start_ns);
+
+/* Print one result line: name, iterations, ns per iteration */
+void aws_http_microbenchmark_report(const char *label, uint64_t iterations, uint64_t elapsed_ns);
+
+int aws_http_microbenchmark_header_lookup(struct aws_allocator *allocator);
+int aws_http_microbenchmark_h1_body_send(struct aws_allocator *allocator);
+int aws_http_microbenchmark_cross_thread_queue(struct aws_allocator *allocator);
+int aws_http_microbenchmark_h2_decode(struct aws_allocator *allocator);
+int aws_http_microbenchmark_hpack_string(struct aws_allocator *allocator);
+
+#endif /* AWS_HTTP_MICROBENCHMARKS_H */
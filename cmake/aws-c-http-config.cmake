@@ -2,6 +2,7 @@ include(CMakeFindDependencyMacro)
 
 find_dependency(aws-c-io)
 find_dependency(aws-c-compression)
+@AWS_HTTP_ZLIB_DEPENDENCY@
 
 macro(aws_load_targets type)
     include(${CMAKE_CURRENT_LIST_DIR}/${type}/@PROJECT_NAME@-targets.cmake)
@@ -191,14 +191,14 @@ struct aws_http2_connection_options {
 
     /**
      * Optional
-     * The max number of recently-closed streams to remember.
+     * The number of recent stream ids, per initiator, whose closed state is remembered.
      * Set it to zero to use the default setting, AWS_HTTP2_DEFAULT_MAX_CLOSED_STREAMS
      *
      * If the connection receives a frame for a closed stream,
      * the frame will be ignored or cause a connection error,
      * depending on the frame type and how the stream was closed.
      * Remembering more streams reduces the chances that a late frame causes
-     * a connection error, but costs some memory.
+     * a connection error, but costs some memory (2 bits per stream id).
      */
     size_t max_closed_streams;
 
@@ -235,6 +235,36 @@ struct aws_http2_connection_options {
      * But, the client will always automatically update the window for padding even for manual window update.
      */
     bool conn_manual_window_management;
+
+    /**
+     * Optional.
+     * Set to true to grow the stream flow-control windows this side advertises, so they fit the
+     * bandwidth-delay product of the network path.
+     *
+     * While DATA is being received, the connection keeps a PING in flight to measure the round-trip time,
+     * and counts how much DATA arrives per round trip. If that's close to the window, the window is what limits
+     * throughput, so SETTINGS_INITIAL_WINDOW_SIZE is raised to twice that amount (up to the 2^31-1 maximum).
+     * Windows only grow, they never shrink.
+     *
+     * Has no effect on streams with manual window management.
+     * The connection's own window is already as big as possible, unless `conn_manual_window_management` is true.
+     */
+    bool window_auto_tuning;
+
+    /**
+     * Optional.
+     * Set to true to deliver the payloads of consecutive DATA frames for the same stream, that arrive in the same
+     * read, through a single call to the stream's incoming body callback (ex: `on_response_body`).
+     *
+     * Peers often send a large body as many back-to-back DATA frames, no bigger than SETTINGS_MAX_FRAME_SIZE
+     * (16 KiB by default), and a single read from the socket can hold dozens of them.
+     * Since DATA payloads aren't contiguous in the read, the payloads are copied into one buffer, so this trades
+     * a copy for fewer callbacks. It's worthwhile when the per-callback cost is high.
+     *
+     * Body data is never held back across reads, and is always delivered before the stream completes,
+     * and before any trailing headers.
+     */
+    bool coalesce_incoming_body;
 };
 
 /**
@@ -421,7 +451,7 @@ struct aws_http2_setting {
 /**
  * HTTP/2: Default value for max closed streams we will keep in memory.
  */
-#define AWS_HTTP2_DEFAULT_MAX_CLOSED_STREAMS (32)
+#define AWS_HTTP2_DEFAULT_MAX_CLOSED_STREAMS (1024)
 
 /**
  * HTTP/2: The size of payload for HTTP/2 PING frame.
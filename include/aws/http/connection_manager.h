@@ -88,6 +88,7 @@ struct aws_http_connection_manager_options {
     size_t num_initial_settings;
     size_t max_closed_streams;
     bool http2_conn_manual_window_management;
+    bool http2_window_auto_tuning;
 
     /* Proxy configuration for http connection */
     const struct aws_http_proxy_options *proxy_options;
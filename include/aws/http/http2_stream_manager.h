@@ -78,11 +78,14 @@ struct aws_http2_stream_manager_options {
      * inital window size is not controllable.
      * - For stream level window control, `enable_read_back_pressure` will enable manual control. The initial window
      * size needs to be set through `initial_settings_array`.
+     * - `window_auto_tuning` grows the initial stream window to fit the network's bandwidth-delay product, for
+     * streams without read back pressure.
      */
     struct aws_http2_setting *initial_settings_array;
     size_t num_initial_settings;
     size_t max_closed_streams;
     bool conn_manual_window_management;
+    bool window_auto_tuning;
 
     /**
      * HTTP/2 Stream window control.
@@ -36,6 +36,13 @@ struct aws_http_connection_vtable {
         struct aws_http_connection *client_connection,
         const struct aws_http_make_request_options *options);
 
+    /* Optional. Activate streams that were just created by make_request(), and not given to the user yet.
+     * Either all are activated or none are. If NULL, each stream is activated separately. */
+    int (*activate_streams)(
+        struct aws_http_connection *client_connection,
+        struct aws_http_stream **streams,
+        size_t count);
+
     struct aws_http_stream *(*new_server_request_handler_stream)(
         const struct aws_http_request_handler_options *options);
     int (*stream_send_response)(struct aws_http_stream *stream, struct aws_http_message *response);
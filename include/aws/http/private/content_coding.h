@@ -0,0 +1,86 @@
+#ifndef AWS_HTTP_CONTENT_CODING_H
+#define AWS_HTTP_CONTENT_CODING_H
+
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/http/request_response.h>
+
+struct aws_input_stream;
+
+/**
+ * Incrementally inflates a gzip or deflate encoded body.
+ * Only available when aws-c-http is built with zlib, see aws_http_content_coding_is_supported().
+ */
+struct aws_http_content_decoder;
+
+/**
+ * Invoked with each piece of decoded output.
+ * The data is only valid for the duration of the callback.
+ * Return AWS_OP_ERR to stop decoding.
+ */
+typedef int(aws_http_content_decoder_on_output_fn)(const struct aws_byte_cursor *data, void *user_data);
+
+AWS_EXTERN_C_BEGIN
+
+/**
+ * Returns whether gzip and deflate content-codings can be encoded and decoded.
+ */
+AWS_HTTP_API
+bool aws_http_content_coding_is_supported(void);
+
+/**
+ * Parse a single content-coding token (ex: "gzip", "x-gzip", "deflate", "identity").
+ * Returns false if the coding is not one that can be decoded.
+ */
+AWS_HTTP_API
+bool aws_http_content_coding_from_token(struct aws_byte_cursor token, enum aws_http_content_coding *out_coding);
+
+/**
+ * Returns a decoder for the given coding.
+ * Returns NULL and raises AWS_ERROR_UNSUPPORTED_OPERATION if the coding can't be decoded.
+ */
+AWS_HTTP_API
+struct aws_http_content_decoder *aws_http_content_decoder_new(
+    struct aws_allocator *alloc,
+    enum aws_http_content_coding coding);
+
+AWS_HTTP_API
+void aws_http_content_decoder_destroy(struct aws_http_content_decoder *decoder);
+
+/**
+ * Decode as much of the encoded data as possible, invoking `on_output` zero or more times.
+ * All input is consumed. Raises AWS_ERROR_HTTP_CONTENT_DECODING_FAILURE if the data is malformed.
+ */
+AWS_HTTP_API
+int aws_http_content_decoder_process(
+    struct aws_http_content_decoder *decoder,
+    struct aws_byte_cursor encoded,
+    aws_http_content_decoder_on_output_fn *on_output,
+    void *user_data);
+
+/**
+ * Call when the body is done.
+ * Raises AWS_ERROR_HTTP_CONTENT_DECODING_FAILURE if the encoded data was truncated.
+ */
+AWS_HTTP_API
+int aws_http_content_decoder_finish(struct aws_http_content_decoder *decoder);
+
+/**
+ * Returns an input stream that compresses everything read from `source`.
+ * If `buffer_entire_body` is true, `source` is compressed to completion now, so that the stream's length is known.
+ * Otherwise, compression happens as the stream is read, and the stream's length is unknown.
+ * The new stream holds a reference to `source`.
+ */
+AWS_HTTP_API
+struct aws_input_stream *aws_http_content_encoder_stream_new(
+    struct aws_allocator *alloc,
+    struct aws_input_stream *source,
+    enum aws_http_content_coding coding,
+    bool buffer_entire_body);
+
+AWS_EXTERN_C_END
+
+#endif /* AWS_HTTP_CONTENT_CODING_H */
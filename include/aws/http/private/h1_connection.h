@@ -72,9 +72,15 @@ struct aws_h1_connection {
          * The `aws_io_message.copy_mark` is used to track progress on partially processed messages.
          * `pending_bytes` is the sum of all unprocessed bytes across all queued messages.
          * `capacity` is the limit for how many unprocessed bytes we'd like in the queue.
+         *
+         * `retained_messages` holds fully processed messages whose data is still referenced by the decoder,
+         * because a line began in them and hasn't ended yet. This lets the decoder avoid copying partial lines.
+         * They are released as soon as the decoder stops referencing them.
          */
         struct {
             struct aws_linked_list messages;
+            struct aws_linked_list retained_messages;
+            size_t num_retained_messages;
             size_t pending_bytes;
             size_t capacity;
         } read_buffer;
@@ -135,6 +141,11 @@ struct aws_h1_connection {
         bool is_open : 1;
 
     } synced_data;
+
+    /* Recycles chunks written by users, so streaming a body doesn't allocate per chunk.
+     * Chunks are acquired by user threads while holding `synced_data.lock`,
+     * and returned on the connection's thread. See aws_h1_chunk_pool for which half needs which. */
+    struct aws_h1_chunk_pool chunk_pool;
 };
 
 /* Allow tests to check current window stats */
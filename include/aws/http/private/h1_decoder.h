@@ -59,18 +59,50 @@ struct aws_h1_decoder_params {
     size_t scratch_space_initial_size;
     /* Set false if decoding responses */
     bool is_decoding_requests;
+    /**
+     * Set true if data passed to aws_h1_decode() will remain valid until aws_h1_decoder_is_referencing_input()
+     * returns false. Then, a line split across multiple inputs is tracked by reference,
+     * and only copied into the scratch space once it's complete and must be made contiguous.
+     */
+    bool retain_input;
     void *user_data;
     struct aws_h1_decoder_vtable vtable;
 };
 
+/**
+ * Counters describing how much work the decoder did to assemble lines split across multiple inputs.
+ */
+struct aws_h1_decoder_stats {
+    /* Number of bytes copied into the scratch space */
+    uint64_t scratch_bytes_copied;
+
+    /* Number of lines that spanned multiple inputs */
+    uint64_t split_lines;
+};
+
 struct aws_h1_decoder;
 
+/**
+ * Max number of previous inputs that the decoder references when `retain_input` is set.
+ * Only the most recent inputs are ever referenced. If a line spans more inputs than this,
+ * the older parts are copied into the scratch space.
+ */
+#define AWS_H1_DECODER_MAX_REFERENCED_INPUTS 4
+
 AWS_EXTERN_C_BEGIN
 
 AWS_HTTP_API struct aws_h1_decoder *aws_h1_decoder_new(struct aws_h1_decoder_params *params);
 AWS_HTTP_API void aws_h1_decoder_destroy(struct aws_h1_decoder *decoder);
 AWS_HTTP_API int aws_h1_decode(struct aws_h1_decoder *decoder, struct aws_byte_cursor *data);
 
+/**
+ * Returns true if the decoder holds references to data from previous aws_h1_decode() calls.
+ * Only possible if `aws_h1_decoder_params.retain_input` was set.
+ */
+AWS_HTTP_API bool aws_h1_decoder_is_referencing_input(const struct aws_h1_decoder *decoder);
+
+AWS_HTTP_API struct aws_h1_decoder_stats aws_h1_decoder_get_stats(const struct aws_h1_decoder *decoder);
+
 AWS_HTTP_API void aws_h1_decoder_set_logging_id(struct aws_h1_decoder *decoder, const void *id);
 AWS_HTTP_API void aws_h1_decoder_set_body_headers_ignored(struct aws_h1_decoder *decoder, bool body_headers_ignored);
 
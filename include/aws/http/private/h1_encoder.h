@@ -8,6 +8,16 @@
 #include <aws/http/private/http_impl.h>
 #include <aws/http/private/request_response_impl.h>
 
+enum {
+    /* Chunk-lines up to this size are stored inline in the aws_h1_chunk.
+     * Enough for the chunk-size and CRLF, plus a modest chunk-ext */
+    AWS_H1_CHUNK_LINE_INLINE_SIZE = 64,
+    /* Most chunks an aws_h1_chunk_pool will keep for reuse */
+    AWS_H1_CHUNK_POOL_MAX_SIZE = 64,
+};
+
+struct aws_h1_chunk_pool;
+
 struct aws_h1_chunk {
     struct aws_allocator *allocator;
     struct aws_input_stream *data;
@@ -17,6 +27,28 @@ struct aws_h1_chunk {
     struct aws_linked_list_node node;
     /* Buffer containing pre-encoded start line: chunk-size [chunk-ext] CRLF */
     struct aws_byte_buf chunk_line;
+    /* If set, the chunk goes back to this pool when destroyed, instead of being freed */
+    struct aws_h1_chunk_pool *pool;
+    /* Storage for chunk_line, if it fits */
+    uint8_t chunk_line_storage[AWS_H1_CHUNK_LINE_INLINE_SIZE];
+};
+
+/**
+ * Recycles chunks for a connection, so that a steady stream of chunks doesn't go through the allocator.
+ * Chunks are acquired by whichever thread the user writes them from, but destroyed on the connection's thread.
+ * So destroyed chunks collect in `returned`, which only the connection's thread touches,
+ * until aws_h1_chunk_pool_reclaim() moves them to `available`, which is guarded by the connection's lock.
+ */
+struct aws_h1_chunk_pool {
+    struct aws_allocator *allocator;
+
+    /* Connection's lock must be held */
+    struct aws_linked_list available;
+    size_t num_available;
+
+    /* Connection's thread only */
+    struct aws_linked_list returned;
+    size_t num_returned;
 };
 
 struct aws_h1_trailer {
@@ -24,6 +56,17 @@ struct aws_h1_trailer {
     struct aws_byte_buf trailer_data;
 };
 
+/* What the encoder learns while validating a message's headers */
+struct aws_h1_header_scan {
+    /* Total length of the header-lines: "{name}: {value}\r\n" */
+    size_t header_lines_len;
+    uint64_t content_length;
+    bool has_content_length_header;
+    bool has_transfer_encoding_header;
+    bool has_chunked_encoding_header;
+    bool has_connection_close_header;
+};
+
 /**
  * Message to be submitted to encoder.
  * Contains data necessary for encoder to write an outgoing request or response.
@@ -76,6 +119,10 @@ struct aws_h1_encoder {
     size_t chunk_count;
     /* Encoder logs with this stream ptr as the ID, and passes this ptr to the chunk_complete callback */
     struct aws_http_stream *current_stream;
+    /* If true, an unchunked body backed by memory (see aws_http_body_stream_new_from_memory()) is not copied
+     * by aws_h1_encoder_process() once it no longer fits in the output buffer.
+     * The encoder waits for the body to be taken via aws_h1_encoder_take_body_reference() instead. */
+    bool send_body_by_reference;
 };
 
 struct aws_h1_chunk *aws_h1_chunk_new(struct aws_allocator *allocator, const struct aws_http1_chunk_options *options);
@@ -85,8 +132,6 @@ struct aws_h1_trailer *aws_h1_trailer_new(
 
 void aws_h1_trailer_destroy(struct aws_h1_trailer *trailer);
 
-/* Just destroy the chunk (don't fire callback) */
-void aws_h1_chunk_destroy(struct aws_h1_chunk *chunk);
 
 /* Destroy chunk and fire its completion callback */
 void aws_h1_chunk_complete_and_destroy(struct aws_h1_chunk *chunk, struct aws_http_stream *http_stream, int error_code);
@@ -95,6 +140,35 @@ int aws_chunk_line_from_options(struct aws_http1_chunk_options *options, struct
 
 AWS_EXTERN_C_BEGIN
 
+/* Just destroy the chunk (don't fire callback).
+ * Pooled chunks must be destroyed on the connection's thread, or passed to aws_h1_chunk_pool_put_back() instead */
+AWS_HTTP_API
+void aws_h1_chunk_destroy(struct aws_h1_chunk *chunk);
+
+AWS_HTTP_API
+void aws_h1_chunk_pool_init(struct aws_h1_chunk_pool *pool, struct aws_allocator *allocator);
+
+/* Free all pooled chunks. No chunk acquired from the pool may still be in use */
+AWS_HTTP_API
+void aws_h1_chunk_pool_clean_up(struct aws_h1_chunk_pool *pool);
+
+/* Like aws_h1_chunk_new(), but reuses a chunk from the pool when possible.
+ * The lock guarding `available` must be held */
+AWS_HTTP_API
+struct aws_h1_chunk *aws_h1_chunk_pool_acquire(
+    struct aws_h1_chunk_pool *pool,
+    const struct aws_http1_chunk_options *options);
+
+/* Return a chunk that was acquired but never used, from any thread.
+ * The lock guarding `available` must be held */
+AWS_HTTP_API
+void aws_h1_chunk_pool_put_back(struct aws_h1_chunk_pool *pool, struct aws_h1_chunk *chunk);
+
+/* Make chunks destroyed on the connection's thread available for reuse.
+ * Must be called on the connection's thread, with the lock guarding `available` held */
+AWS_HTTP_API
+void aws_h1_chunk_pool_reclaim(struct aws_h1_chunk_pool *pool);
+
 /* Validate request and cache any info the encoder will need later in the "encoder message". */
 AWS_HTTP_API
 int aws_h1_encoder_message_init_from_request(
@@ -110,6 +184,18 @@ int aws_h1_encoder_message_init_from_response(
     bool body_headers_ignored,
     struct aws_linked_list *pending_chunk_list);
 
+/**
+ * Validate headers and write them out as header-lines, so they can be copied as-is into many requests
+ * (see aws_http_request_template). `out_lines` is initialized to exactly the size needed.
+ * `out_scan` is what the encoder would learn from these headers, and is picked up again for each request.
+ */
+AWS_HTTP_API
+int aws_h1_encoder_encode_template_header_lines(
+    struct aws_allocator *allocator,
+    const struct aws_http_headers *headers,
+    struct aws_h1_header_scan *out_scan,
+    struct aws_byte_buf *out_lines);
+
 AWS_HTTP_API
 void aws_h1_encoder_message_clean_up(struct aws_h1_encoder_message *message);
 
@@ -128,6 +214,20 @@ int aws_h1_encoder_start_message(
 AWS_HTTP_API
 int aws_h1_encoder_process(struct aws_h1_encoder *encoder, struct aws_byte_buf *out_buf);
 
+/**
+ * If the encoder is waiting for its memory-backed body to be sent by reference (see `send_body_by_reference`),
+ * set `out_data` to the next piece of body, at most `max_size` bytes, and return true.
+ * The encoder considers this data sent, and `out_body` is set to the stream that owns the memory.
+ * The caller must keep `out_body` alive until it is done with the data.
+ * Returns false if the encoder isn't waiting on such a body, in which case aws_h1_encoder_process() should be used.
+ */
+AWS_HTTP_API
+bool aws_h1_encoder_take_body_reference(
+    struct aws_h1_encoder *encoder,
+    size_t max_size,
+    struct aws_byte_cursor *out_data,
+    struct aws_input_stream **out_body);
+
 AWS_HTTP_API
 bool aws_h1_encoder_is_message_in_progress(const struct aws_h1_encoder *encoder);
 
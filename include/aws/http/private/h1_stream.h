@@ -105,6 +105,9 @@ struct aws_h1_stream {
 
         /* Whether the chunked trailer has already been sent */
         bool has_added_trailer : 1;
+
+        /* Whether aws_http_stream_notify_body_ready() was called since the cross-thread work task last ran */
+        bool is_body_ready : 1;
     } synced_data;
 };
 
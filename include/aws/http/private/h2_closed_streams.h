@@ -0,0 +1,81 @@
+#ifndef AWS_HTTP_H2_CLOSED_STREAMS_H
+#define AWS_HTTP_H2_CLOSED_STREAMS_H
+
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/http/http.h>
+
+/**
+ * The action which caused the stream to close.
+ * Fits in 2 bits, see aws_h2_closed_streams.
+ */
+enum aws_h2_stream_closed_when {
+    AWS_H2_STREAM_CLOSED_UNKNOWN,
+    AWS_H2_STREAM_CLOSED_WHEN_BOTH_SIDES_END_STREAM,
+    AWS_H2_STREAM_CLOSED_WHEN_RST_STREAM_RECEIVED,
+    AWS_H2_STREAM_CLOSED_WHEN_RST_STREAM_SENT,
+};
+
+/**
+ * Remembers how recently-closed streams were closed, so frames that trickle in afterwards can be handled correctly.
+ *
+ * Stream ids only go up, so rather than remembering the last N streams to close, this remembers every stream
+ * closed among the last N ids (per initiator, since client and server ids are interleaved odd and even).
+ * That's a 2-bit aws_h2_stream_closed_when per id, in a circular bitmap that slides forward with the highest id.
+ * Lookups are a shift and a mask, nothing is allocated after init, and remembering 1024 streams costs 256 bytes.
+ *
+ * A stream still open when its id slides out of the window isn't remembered when it finally closes.
+ */
+struct aws_h2_closed_streams {
+    struct aws_allocator *allocator;
+
+    /* Number of ids remembered per initiator. Power of 2, and a multiple of the 32 ids that fit in a word */
+    size_t window_size;
+
+    /* [0] for even (server-initiated) ids, [1] for odd (client-initiated) ids */
+    struct aws_h2_closed_streams_window {
+        /* window_size 2-bit entries. The entry for id is at slot ((id / 2) % window_size) */
+        uint64_t *words;
+        /* 1 past the (id / 2) of the highest id recorded. Entries for (id / 2) in [next_index - window_size,
+         * next_index) are valid, and ids in that range that aren't closed yet are AWS_H2_STREAM_CLOSED_UNKNOWN */
+        uint32_t next_index;
+    } windows[2];
+};
+
+AWS_EXTERN_C_BEGIN
+
+/**
+ * Initialize, remembering up to `max_closed_streams` ids per initiator (rounded up).
+ */
+AWS_HTTP_API
+int aws_h2_closed_streams_init(
+    struct aws_h2_closed_streams *closed_streams,
+    struct aws_allocator *allocator,
+    size_t max_closed_streams);
+
+AWS_HTTP_API
+void aws_h2_closed_streams_clean_up(struct aws_h2_closed_streams *closed_streams);
+
+/**
+ * Remember how a stream closed. Ids that already slid out of the window are ignored.
+ */
+AWS_HTTP_API
+void aws_h2_closed_streams_record(
+    struct aws_h2_closed_streams *closed_streams,
+    uint32_t stream_id,
+    enum aws_h2_stream_closed_when closed_when);
+
+/**
+ * Returns how the stream closed, or AWS_H2_STREAM_CLOSED_UNKNOWN if it's not remembered.
+ */
+AWS_HTTP_API
+enum aws_h2_stream_closed_when aws_h2_closed_streams_find(
+    const struct aws_h2_closed_streams *closed_streams,
+    uint32_t stream_id);
+
+AWS_EXTERN_C_END
+
+#endif /* AWS_HTTP_H2_CLOSED_STREAMS_H */
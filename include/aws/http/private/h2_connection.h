@@ -7,12 +7,16 @@
  */
 
 #include <aws/common/atomics.h>
-#include <aws/common/fifo_cache.h>
 #include <aws/common/hash_table.h>
 #include <aws/common/mutex.h>
 
 #include <aws/http/private/connection_impl.h>
+#include <aws/http/private/h2_closed_streams.h>
+#include <aws/http/private/h2_frame_pool.h>
 #include <aws/http/private/h2_frames.h>
+#include <aws/http/private/h2_priority_scheduler.h>
+#include <aws/http/private/h2_stream_table.h>
+#include <aws/http/private/mpsc_queue.h>
 #include <aws/http/statistics.h>
 
 struct aws_h2_decoder;
@@ -27,6 +31,15 @@ struct aws_h2_connection {
     struct aws_channel_task cross_thread_work_task;
     struct aws_channel_task outgoing_frames_task;
 
+    /* True while `cross_thread_work_task` is scheduled. Any thread handing work to the event-loop thread
+     * sets this AFTER the work is visible, and schedules the task only if it was false.
+     * The task clears it BEFORE collecting work, so nothing handed over can be missed. */
+    struct aws_atomic_var is_cross_thread_work_task_scheduled;
+
+    /* `aws_h2_cross_thread_work` (user-requested SETTINGS, PING, and GOAWAY) that hasn't moved to the
+     * event-loop thread yet. Any thread may push without holding the lock. Closed by s_stop(). */
+    struct aws_mpsc_queue cross_thread_work_queue;
+
     bool conn_manual_window_management;
 
     /* Only the event-loop thread may touch this data */
@@ -59,12 +72,12 @@ struct aws_h2_connection {
         /* Maps stream-id to aws_h2_stream*.
          * Contains all streams in the open, reserved, and half-closed states (terms from RFC-7540 5.1).
          * Once a stream enters closed state, it is removed from this map. */
-        struct aws_hash_table active_streams_map;
+        struct aws_h2_stream_table active_streams;
 
-        /* List using aws_h2_stream.node.
+        /* Holds aws_h2_stream.node, in priority order.
          * Contains all streams with DATA frames to send.
-         * Any stream in this list is also in the active_streams_map. */
-        struct aws_linked_list outgoing_streams_list;
+         * Any stream in this scheduler is also in active_streams. */
+        struct aws_h2_priority_scheduler outgoing_streams;
 
         /* List using aws_h2_stream.node.
          * Contains all streams with DATA frames to send, and cannot send now due to flow control.
@@ -74,20 +87,22 @@ struct aws_h2_connection {
         /* List using aws_h2_stream.node.
          * Contains all streams that are open, but are only sending data when notified, rather than polling
          * for it (e.g. event streams)
-         * Streams are moved to the outgoing_streams_list until they send pending data, then are moved back
+         * Streams are moved to the outgoing_streams until they send pending data, then are moved back
          * to this list to sleep until more data comes in
          */
         struct aws_linked_list waiting_streams_list;
 
         /* List using aws_h2_frame.node.
          * Queues all frames (except DATA frames) for connection to send.
-         * When queue is empty, then we send DATA frames from the outgoing_streams_list */
+         * When queue is empty, then we send DATA frames from the outgoing_streams */
         struct aws_linked_list outgoing_frames_queue;
 
-        /* FIFO cache for closed stream, key: stream-id, value: aws_h2_stream_closed_when.
-         * Contains data about streams that were recently closed.
-         * The oldest entry will be removed if the cache is full */
-        struct aws_cache *closed_streams;
+        /* Recycles memory for frames created on the event-loop thread.
+         * Frames created on other threads (by user API calls) use the connection's regular allocator */
+        struct aws_h2_frame_pool frame_pool;
+
+        /* Remembers how recently closed streams were closed */
+        struct aws_h2_closed_streams closed_streams;
 
         /* Flow-control of connection from peer. Indicating the buffer capacity of our peer.
          * Reduce the space after sending a flow-controlled frame. Increment after receiving WINDOW_UPDATE for
@@ -99,6 +114,43 @@ struct aws_h2_connection {
          * connection */
         size_t window_size_self;
 
+        /* Flow-control window increments owed to peer. They're accumulated as DATA is consumed and the user updates
+         * windows, and turned into WINDOW_UPDATE frames when outgoing frames are next written:
+         * at most one for the connection and one per stream. Small increments are held back until they're worth
+         * a frame, see s_flush_window_updates() */
+        struct {
+            uint64_t connection_increment;
+            bool connection_forced;
+            /* List using aws_h2_stream.thread_data.window_update_node */
+            struct aws_linked_list streams;
+        } pending_window_updates;
+
+        /* Bandwidth-delay product estimator, see aws_http2_connection_options.window_auto_tuning.
+         * While DATA arrives, one PING is kept in flight. DATA received between sending it and getting the ACK
+         * is about one round trip's worth: the bandwidth-delay product, as far as the window allows. */
+        struct {
+            bool enabled;
+            bool ping_in_flight;
+            /* DATA payload bytes received since the PING in flight was sent */
+            uint64_t bytes_since_ping;
+            /* Highest bandwidth measured so far, in bytes per nanosecond */
+            double max_bandwidth;
+            /* Largest SETTINGS_INITIAL_WINDOW_SIZE sent to peer, whether or not it's been ACKed yet */
+            uint32_t initial_window_size;
+        } window_tuning;
+
+        /* DATA payloads held back so consecutive DATA frames for the same stream reach the user as one body
+         * callback, see aws_http2_connection_options.coalesce_incoming_body.
+         * Everything held back is delivered before aws_h2_decode() returns, so `data` may point into the message
+         * being decoded until a second payload arrives, when both are gathered into `buffer`. */
+        struct {
+            bool enabled;
+            /* Stream the held back data belongs to, or NULL if nothing is held back */
+            struct aws_h2_stream *stream;
+            struct aws_byte_cursor data;
+            struct aws_byte_buf buffer;
+        } incoming_body;
+
         /* Highest self-initiated stream-id that peer might have processed.
          * Defaults to max stream-id, may be lowered when GOAWAY frame received. */
         uint32_t goaway_received_last_stream_id;
@@ -131,23 +183,10 @@ struct aws_h2_connection {
     struct {
         struct aws_mutex lock;
 
-        /* New `aws_h2_stream *` that haven't moved to `thread_data` yet */
+        /* New `aws_h2_stream *` that haven't moved to `thread_data` yet.
+         * Streams still go through the lock, because ids must be assigned in the same order they're sent. */
         struct aws_linked_list pending_stream_list;
 
-        /* New `aws_h2_frames *`, connection control frames created by user that haven't moved to `thread_data` yet */
-        struct aws_linked_list pending_frame_list;
-
-        /* New `aws_h2_pending_settings *` created by user that haven't moved to `thread_data` yet */
-        struct aws_linked_list pending_settings_list;
-
-        /* New `aws_h2_pending_ping *` created by user that haven't moved to `thread_data` yet */
-        struct aws_linked_list pending_ping_list;
-
-        /* New `aws_h2_pending_goaway *` created by user that haven't sent yet */
-        struct aws_linked_list pending_goaway_list;
-
-        bool is_cross_thread_work_task_scheduled;
-
         /* The window_update value for `thread_data.window_size_self` that haven't applied yet */
         size_t window_update_size;
 
@@ -178,7 +217,23 @@ struct aws_h2_connection {
     } synced_data;
 };
 
+enum aws_h2_cross_thread_work_type {
+    AWS_H2_CROSS_THREAD_WORK_SETTINGS,
+    AWS_H2_CROSS_THREAD_WORK_PING,
+    AWS_H2_CROSS_THREAD_WORK_GOAWAY,
+};
+
+/* Header for user-requested work passed through `cross_thread_work_queue`.
+ * One queue for all types keeps each frame in the same order as its bookkeeping. */
+struct aws_h2_cross_thread_work {
+    struct aws_mpsc_queue_node node;
+    enum aws_h2_cross_thread_work_type type;
+    /* Frame to send. NULL for GOAWAY, which is built on the event-loop thread */
+    struct aws_h2_frame *frame;
+};
+
 struct aws_h2_pending_settings {
+    struct aws_h2_cross_thread_work cross_thread_work;
     struct aws_http2_setting *settings_array;
     size_t num_settings;
     struct aws_linked_list_node node;
@@ -188,6 +243,7 @@ struct aws_h2_pending_settings {
 };
 
 struct aws_h2_pending_ping {
+    struct aws_h2_cross_thread_work cross_thread_work;
     uint8_t opaque_data[AWS_HTTP2_PING_DATA_SIZE];
     /* For calculating round-trip time */
     uint64_t started_time;
@@ -198,22 +254,13 @@ struct aws_h2_pending_ping {
 };
 
 struct aws_h2_pending_goaway {
+    struct aws_h2_cross_thread_work cross_thread_work;
     bool allow_more_streams;
     uint32_t http2_error;
     struct aws_byte_cursor debug_data;
     struct aws_linked_list_node node;
 };
 
-/**
- * The action which caused the stream to close.
- */
-enum aws_h2_stream_closed_when {
-    AWS_H2_STREAM_CLOSED_UNKNOWN,
-    AWS_H2_STREAM_CLOSED_WHEN_BOTH_SIDES_END_STREAM,
-    AWS_H2_STREAM_CLOSED_WHEN_RST_STREAM_RECEIVED,
-    AWS_H2_STREAM_CLOSED_WHEN_RST_STREAM_SENT,
-};
-
 enum aws_h2_data_encode_status {
     AWS_H2_DATA_ENCODE_COMPLETE,
     AWS_H2_DATA_ENCODE_ONGOING,
@@ -276,6 +323,22 @@ int aws_h2_connection_send_rst_and_close_reserved_stream(
     uint32_t stream_id,
     uint32_t h2_error_code);
 
+/**
+ * Allocator for frames created on the event-loop thread, which recycles their memory. See aws_h2_frame_pool.
+ */
+struct aws_allocator *aws_h2_connection_get_frame_allocator(struct aws_h2_connection *connection);
+
+/**
+ * Add to the stream's flow-control window increment owed to peer.
+ * Increments are coalesced into one WINDOW_UPDATE frame when outgoing frames are next written.
+ * Unless `forced` is set, small increments are held back until enough of the window has been consumed.
+ */
+void aws_h2_connection_add_stream_window_update(
+    struct aws_h2_connection *connection,
+    struct aws_h2_stream *stream,
+    uint32_t increment_size,
+    bool forced);
+
 /**
  * Error happens while writing into channel, shutdown the connection. Only called within the eventloop thread
  */
@@ -0,0 +1,64 @@
+#ifndef AWS_HTTP_H2_FRAME_POOL_H
+#define AWS_HTTP_H2_FRAME_POOL_H
+
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/http/http.h>
+
+#include <aws/common/linked_list.h>
+
+#define AWS_H2_FRAME_POOL_SIZE_CLASS_COUNT 4
+
+/**
+ * Recycles memory for the short-lived objects a connection creates on its event-loop thread,
+ * like WINDOW_UPDATE, PING, RST_STREAM and HEADERS frames.
+ *
+ * The pool is an aws_allocator, so objects created with it need no special handling:
+ * when they're released in the usual way, their memory goes back into a free list for the next one.
+ * Blocks are sorted into a few size classes. Anything bigger than the largest class,
+ * or beyond what each free list keeps, goes straight to the parent allocator.
+ *
+ * Not thread-safe. Only use the pool on the connection's event-loop thread,
+ * and release everything allocated from it before cleaning it up.
+ */
+struct aws_h2_frame_pool {
+    /* Pass this to aws_h2_frame_new_XYZ() and friends */
+    struct aws_allocator allocator;
+
+    struct aws_allocator *parent;
+
+    /* Free blocks for each size class, using an aws_linked_list_node stored in the block itself */
+    struct aws_h2_frame_pool_free_list {
+        struct aws_linked_list blocks;
+        size_t count;
+    } free_lists[AWS_H2_FRAME_POOL_SIZE_CLASS_COUNT];
+
+    struct aws_h2_frame_pool_stats {
+        /* Allocations passed to the parent allocator, because a free list was empty or the size too big.
+         * Once a connection settles into a steady state, this stops going up. */
+        uint64_t parent_acquire_count;
+        /* Allocations served from a free list */
+        uint64_t recycled_count;
+        /* Allocations not released yet */
+        uint64_t live_count;
+    } stats;
+};
+
+AWS_EXTERN_C_BEGIN
+
+AWS_HTTP_API
+void aws_h2_frame_pool_init(struct aws_h2_frame_pool *pool, struct aws_allocator *parent);
+
+/**
+ * Return all free blocks to the parent allocator. Everything allocated from the pool must already be released.
+ * Safe to call on a zeroed-out pool.
+ */
+AWS_HTTP_API
+void aws_h2_frame_pool_clean_up(struct aws_h2_frame_pool *pool);
+
+AWS_EXTERN_C_END
+
+#endif /* AWS_HTTP_H2_FRAME_POOL_H */
@@ -239,6 +239,20 @@ struct aws_h2_frame *aws_h2_frame_new_headers(
     uint8_t pad_length,
     const struct aws_h2_frame_priority_settings *optional_priority);
 
+/**
+ * Like aws_h2_frame_new_headers(), but the header-block also contains the template's pre-encoded headers.
+ * `headers` are only the request's own headers. The frame keeps a hold on the template.
+ */
+AWS_HTTP_API
+struct aws_h2_frame *aws_h2_frame_new_headers_from_template(
+    struct aws_allocator *allocator,
+    uint32_t stream_id,
+    const struct aws_http_headers *headers,
+    struct aws_http_request_template *request_template,
+    bool end_stream,
+    uint8_t pad_length,
+    const struct aws_h2_frame_priority_settings *optional_priority);
+
 AWS_HTTP_API
 struct aws_h2_frame *aws_h2_frame_new_priority(
     struct aws_allocator *allocator,
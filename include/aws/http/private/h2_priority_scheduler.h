@@ -0,0 +1,66 @@
+#ifndef AWS_HTTP_H2_PRIORITY_SCHEDULER_H
+#define AWS_HTTP_H2_PRIORITY_SCHEDULER_H
+
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/http/request_response.h>
+
+#include <aws/common/linked_list.h>
+
+struct aws_h2_stream;
+
+/* Bytes an incremental stream of default weight may send per turn. Same as the default max DATA frame payload,
+ * so streams of equal weight take turns about once per frame. */
+#define AWS_H2_PRIORITY_QUANTUM_DEFAULT (16384)
+
+/**
+ * Decides which stream on a connection sends the next DATA frame, see `aws_http2_stream_priority`.
+ * More urgent streams always go first. Within an urgency level, non-incremental streams go one at a time,
+ * then incremental streams take turns using deficit round-robin (each turn, a stream may send its weighted
+ * quantum of bytes, and any overshoot is deducted from its next turn).
+ *
+ * Streams are held by aws_h2_stream.node, so a stream may leave the scheduler at any time via
+ * aws_linked_list_remove() (ex: when it completes).
+ *
+ * Priority is set locally when a stream is created and never changes. Every operation is constant time,
+ * give or take a walk over the 8 urgency levels. There's no dependency tree for the peer to churn
+ * with PRIORITY frames (which we ignore), so the CVE-2019-9513 "resource loop" attack has nothing to work on.
+ */
+struct aws_h2_priority_scheduler {
+    struct aws_h2_priority_level {
+        /* List using aws_h2_stream.node. Front stream sends until it's done or can't send any more */
+        struct aws_linked_list non_incremental;
+        /* List using aws_h2_stream.node. Front stream sends until its turn is over, then goes to the back */
+        struct aws_linked_list incremental;
+    } levels[AWS_HTTP2_PRIORITY_URGENCY_MAX + 1];
+};
+
+void aws_h2_priority_scheduler_init(struct aws_h2_priority_scheduler *scheduler);
+
+bool aws_h2_priority_scheduler_is_empty(const struct aws_h2_priority_scheduler *scheduler);
+
+/**
+ * Add a stream that has DATA ready to send.
+ * It goes behind other streams of the same urgency and kind, and starts a fresh turn.
+ */
+void aws_h2_priority_scheduler_push(struct aws_h2_priority_scheduler *scheduler, struct aws_h2_stream *stream);
+
+/**
+ * Remove and return the stream that should send the next DATA frame, or NULL if the scheduler is empty.
+ * If the stream still has DATA to send afterwards, return it with aws_h2_priority_scheduler_put_back().
+ */
+struct aws_h2_stream *aws_h2_priority_scheduler_pop(struct aws_h2_priority_scheduler *scheduler);
+
+/**
+ * Return a stream from aws_h2_priority_scheduler_pop() that is still ready to send, after it sent `bytes_sent`.
+ * It stays at the front of the line if its turn isn't over.
+ */
+void aws_h2_priority_scheduler_put_back(
+    struct aws_h2_priority_scheduler *scheduler,
+    struct aws_h2_stream *stream,
+    size_t bytes_sent);
+
+#endif /* AWS_HTTP_H2_PRIORITY_SCHEDULER_H */
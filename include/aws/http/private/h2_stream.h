@@ -97,9 +97,21 @@ struct aws_h2_stream {
         /* The total length of payload of data frame received */
         uint64_t incoming_data_length;
         /* Indicates that the stream is currently in the waiting_streams_list and is
-         * asleep. When stream needs to be awaken, moving the stream back to the outgoing_streams_list and set this bool
+         * asleep. When stream needs to be awaken, moving the stream back to the outgoing_streams and set this bool
          * to false */
         bool waiting_for_writes;
+        /* Indicates that the stream is in the waiting_streams_list because its body stream had no data,
+         * and the user asked us to wait for aws_http_stream_notify_body_ready() instead of polling it */
+        bool waiting_for_body_ready;
+        /* Bytes an incremental stream may still send in its current turn, see aws_h2_priority_scheduler.
+         * Goes negative if the last frame overshot, and the overshoot is deducted from the next turn */
+        int64_t priority_deficit;
+        /* Flow-control window increment not sent to peer yet, see aws_h2_connection_add_stream_window_update() */
+        uint64_t pending_window_update;
+        /* Send pending_window_update next time frames are written, however small it is */
+        bool pending_window_update_forced;
+        /* Node in the connection's list of streams with a pending_window_update */
+        struct aws_linked_list_node window_update_node;
     } thread_data;
 
     /* Any thread may touch this data, but the lock must be held (unless it's an atomic) */
@@ -116,6 +128,8 @@ struct aws_h2_stream {
         struct aws_h2err reset_error;
         bool reset_called;
         bool manual_write_ended;
+        /* aws_http_stream_notify_body_ready() was called since the cross-thread work task last ran */
+        bool is_body_ready;
 
         /* Simplified stream state. */
         enum aws_h2_stream_api_state api_state;
@@ -125,6 +139,14 @@ struct aws_h2_stream {
     } synced_data;
     bool manual_write;
 
+    /* Priority of outgoing DATA, fixed when the stream is created. See aws_h2_priority_scheduler */
+    struct {
+        uint8_t urgency;
+        bool incremental;
+        /* Bytes an incremental stream may send per turn, in proportion to its weight */
+        uint32_t quantum;
+    } priority;
+
     /* Store the sent reset HTTP/2 error code, set to -1, if none has sent so far */
     int64_t sent_reset_error_code;
 
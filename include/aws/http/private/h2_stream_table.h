@@ -0,0 +1,119 @@
+#ifndef AWS_HTTP_H2_STREAM_TABLE_H
+#define AWS_HTTP_H2_STREAM_TABLE_H
+
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/common/hash_table.h>
+#include <aws/http/http.h>
+
+struct aws_h2_stream;
+
+/**
+ * Maps stream-id to aws_h2_stream*, for the streams that are active on a connection.
+ *
+ * Streams we initiate get ids that go up by 2 each time, and mostly finish in about the order they started.
+ * So those live in a ring buffer that slides along with them, indexed by `(id - base_id) / 2`.
+ * Streams that don't fit (peer-initiated ids, or one that's still open long after the streams around it finished)
+ * go in a hash table instead. Looking up a stream in the ring is a bounds-check and an array index.
+ */
+struct aws_h2_stream_table {
+    struct aws_allocator *allocator;
+
+    /* Ids with this parity go in the ring (1 for odd client-initiated ids, 0 for even server-initiated ids) */
+    uint32_t ring_id_parity;
+
+    struct {
+        /* Power of 2 number of slots. NULL until the first insert */
+        struct aws_h2_stream **slots;
+        size_t capacity;
+        /* Slot holding base_id */
+        size_t head;
+        /* Id in the head slot. Only meaningful while len > 0 */
+        uint32_t base_id;
+        /* Number of slots from head through the last one in use. The head slot is always in use, if len > 0 */
+        size_t len;
+        /* Number of streams in the ring */
+        size_t count;
+    } ring;
+
+    /* Maps stream-id to aws_h2_stream* for streams that don't fit in the ring.
+     * While iterating, removed entries are set NULL instead, so the hash-table iterator stays valid. */
+    struct aws_hash_table outliers;
+    size_t outliers_removed_while_iterating;
+    bool is_iterating;
+};
+
+/**
+ * Iterates over streams in a table. Streams may be removed from the table during iteration,
+ * but not added. Only one iteration may be in progress at a time.
+ * An iteration ends when aws_h2_stream_table_iter_next() returns NULL.
+ * To stop before then, call aws_h2_stream_table_iter_clean_up().
+ */
+struct aws_h2_stream_table_iter {
+    struct aws_h2_stream_table *table;
+    /* Ring ids still to visit are [next_id, end_id) */
+    uint64_t next_id;
+    uint64_t end_id;
+    struct aws_hash_iter outliers_iter;
+    bool outliers_started;
+};
+
+AWS_EXTERN_C_BEGIN
+
+/**
+ * Initialize an empty table.
+ * `local_first_id` is the first id of streams this side initiates (1 for clients, 2 for servers),
+ * those are the ids kept in the ring.
+ */
+AWS_HTTP_API
+int aws_h2_stream_table_init(
+    struct aws_h2_stream_table *table,
+    struct aws_allocator *allocator,
+    uint32_t local_first_id);
+
+AWS_HTTP_API
+void aws_h2_stream_table_clean_up(struct aws_h2_stream_table *table);
+
+AWS_HTTP_API
+size_t aws_h2_stream_table_count(const struct aws_h2_stream_table *table);
+
+/**
+ * Returns the stream with this id, or NULL if there's none.
+ */
+AWS_HTTP_API
+struct aws_h2_stream *aws_h2_stream_table_find(const struct aws_h2_stream_table *table, uint32_t stream_id);
+
+/**
+ * Add a stream. There must not already be a stream with this id.
+ */
+AWS_HTTP_API
+int aws_h2_stream_table_insert(struct aws_h2_stream_table *table, uint32_t stream_id, struct aws_h2_stream *stream);
+
+/**
+ * Remove the stream with this id, if there is one.
+ */
+AWS_HTTP_API
+void aws_h2_stream_table_remove(struct aws_h2_stream_table *table, uint32_t stream_id);
+
+AWS_HTTP_API
+void aws_h2_stream_table_iter_init(struct aws_h2_stream_table_iter *iter, struct aws_h2_stream_table *table);
+
+/**
+ * Returns the next stream, or NULL when all have been visited.
+ */
+AWS_HTTP_API
+struct aws_h2_stream *aws_h2_stream_table_iter_next(struct aws_h2_stream_table_iter *iter);
+
+/**
+ * End an iteration that's stopping before aws_h2_stream_table_iter_next() returned NULL.
+ * Safe to call after it returned NULL too.
+ */
+AWS_HTTP_API
+void aws_h2_stream_table_iter_clean_up(struct aws_h2_stream_table_iter *iter);
+
+AWS_EXTERN_C_END
+
+#endif /* AWS_HTTP_H2_STREAM_TABLE_H */
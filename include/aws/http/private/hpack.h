@@ -7,8 +7,8 @@
  */
 #include <aws/http/request_response.h>
 
+#include <aws/common/array_list.h>
 #include <aws/common/hash_table.h>
-#include <aws/compression/huffman.h>
 
 /**
  * Result of aws_hpack_decode() call.
@@ -29,6 +29,11 @@ struct aws_hpack_decode_result {
         /* If type is AWS_HPACK_DECODE_T_DYNAMIC_TABLE_RESIZE */
         size_t dynamic_table_resize;
     } data;
+
+    /* If type is AWS_HPACK_DECODE_T_HEADER_FIELD, whether the name or value came from the dynamic table.
+     * Such strings are only valid until the next call to aws_hpack_decode(), see aws_hpack_decoder_keep_string() */
+    bool name_is_transient;
+    bool value_is_transient;
 };
 
 /**
@@ -45,6 +50,117 @@ enum aws_hpack_huffman_mode {
     AWS_HPACK_HUFFMAN_ALWAYS,
 };
 
+/**
+ * Flags for an entry in aws_hpack_huffman_decode_table.
+ * Must match the values in scripts/generate_hpack_tables.py.
+ */
+enum aws_hpack_huffman_decode_flags {
+    /* A symbol was completed by this nibble, it's in the entry's symbol field */
+    AWS_HPACK_HUFFMAN_DECODE_F_SYMBOL = 0x1,
+    /* The string may legally end here: the bits since the last symbol are valid padding */
+    AWS_HPACK_HUFFMAN_DECODE_F_ACCEPT = 0x2,
+    /* This nibble completes the EOS symbol, which HPACK treats as an error */
+    AWS_HPACK_HUFFMAN_DECODE_F_FAIL = 0x4,
+};
+
+/**
+ * One transition of the Huffman decoding state machine.
+ * States are the internal nodes of the Huffman tree, with state 0 being the root.
+ */
+struct aws_hpack_huffman_decode_entry {
+    uint8_t state;
+    uint8_t flags;
+    uint8_t symbol;
+};
+
+/**
+ * Huffman decoding state machine, indexed by [state][next 4 bits of input].
+ * Every code is at least 5 bits, so 4 bits of input complete at most 1 symbol.
+ * Generated by scripts/generate_hpack_tables.py
+ */
+extern const struct aws_hpack_huffman_decode_entry aws_hpack_huffman_decode_table[256][16];
+
+/* Number of entries in the static table (RFC-7541 Appendix A). Indices above this are in the dynamic table */
+#define AWS_HPACK_STATIC_TABLE_SIZE 61
+
+/* Perfect hash for the static table's names, multipliers found by scripts/generate_hpack_tables.py */
+#define AWS_HPACK_STATIC_NAME_HASH_SIZE 256
+#define AWS_HPACK_STATIC_NAME_HASH(LEN, FIRST, LAST)                                                                   \
+    (((size_t)(LEN) + 10 * (size_t)(FIRST) + 4 * (size_t)(LAST)) & (AWS_HPACK_STATIC_NAME_HASH_SIZE - 1))
+
+struct aws_hpack_static_name_bucket {
+    /* Index of the first static table entry with this name, or 0 if the bucket is empty */
+    uint8_t index;
+    /* Number of entries in a row that have this name */
+    uint8_t num_entries;
+};
+
+/**
+ * Static table names, indexed by AWS_HPACK_STATIC_NAME_HASH().
+ * Generated by scripts/generate_hpack_tables.py
+ */
+extern const struct aws_hpack_static_name_bucket aws_hpack_static_name_buckets[AWS_HPACK_STATIC_NAME_HASH_SIZE];
+
+/**
+ * What an indexing policy says to do with a header that's about to be sent as a literal,
+ * and that its compression setting (AWS_HTTP_HEADER_COMPRESSION_USE_CACHE) allows to be indexed.
+ */
+enum aws_hpack_indexing_decision {
+    /* Add it to the dynamic table, unless adaptive indexing has learned that values for this name aren't reused */
+    AWS_HPACK_INDEXING_AUTO,
+    /* Add it to the dynamic table */
+    AWS_HPACK_INDEXING_ALWAYS,
+    /* Don't add it to the dynamic table */
+    AWS_HPACK_INDEXING_NEVER,
+};
+
+typedef enum aws_hpack_indexing_decision(
+    aws_hpack_indexing_policy_fn)(const struct aws_http_header *header, void *user_data);
+
+/**
+ * Counts for a header name, used by adaptive indexing to learn which names' values get reused.
+ * Names are only identified by hash, so names that collide share counts.
+ */
+struct aws_hpack_name_stats {
+    uint32_t name_hash;
+    /* Times a value for this name was added to the dynamic table */
+    uint16_t inserts;
+    /* Times a value for this name was found in the dynamic table */
+    uint16_t hits;
+    /* Times a value for this name wasn't added, because of these stats */
+    uint16_t skips;
+};
+
+#define AWS_HPACK_NAME_STATS_COUNT 64
+
+/**
+ * Counts of what an encoder has done, to judge how well it's compressing.
+ */
+struct aws_hpack_encoder_metrics {
+    /* Bytes of header names and values given to the encoder */
+    uint64_t header_bytes;
+    /* Bytes the encoder turned them into */
+    uint64_t encoded_bytes;
+    /* Headers sent as an index into the static or dynamic table */
+    uint64_t num_indexed;
+    /* Headers added to the dynamic table */
+    uint64_t num_inserted;
+    /* Headers that could have been added to the dynamic table, but the indexing policy said not to */
+    uint64_t num_not_inserted;
+    /* Entries evicted from the dynamic table */
+    uint64_t num_evicted;
+};
+
+/**
+ * Slot in one of the dynamic table's open-addressing reverse lookups.
+ * Maps a hash to the position of an entry in the dynamic table's buffer.
+ */
+struct aws_hpack_lookup_slot {
+    uint32_t hash;
+    /* UINT32_MAX if slot is empty */
+    uint32_t position;
+};
+
 /**
  * Maintains the dynamic table.
  * Insertion is backwards, indexing is forwards
@@ -56,8 +172,7 @@ struct aws_hpack_context {
     const void *log_id;
 
     struct {
-        /* Array of headers, pointers to memory we alloced, which needs to be cleaned up whenever we move an entry out
-         */
+        /* Ring of headers. Their name and value point into the arena */
         struct aws_http_header *buffer;
         size_t buffer_capacity; /* Number of http_headers that can fit in buffer */
 
@@ -68,10 +183,21 @@ struct aws_hpack_context {
         size_t size;
         size_t max_size;
 
-        /* aws_http_header * -> size_t */
-        struct aws_hash_table reverse_lookup;
-        /* aws_byte_cursor * -> size_t */
-        struct aws_hash_table reverse_lookup_name_only;
+        /* Count of entries ever evicted */
+        uint64_t num_evicted;
+
+        /* Ring of bytes holding each entry's name, followed by its value.
+         * New entries go at the head, eviction frees space at the oldest entry.
+         * An entry is never split across the end, if it doesn't fit there it goes at the start instead. */
+        uint8_t *arena;
+        size_t arena_capacity;
+        size_t arena_head;
+
+        /* Open-addressing (linear probing) tables, from name+value, or name-only, to the newest matching entry.
+         * Capacity is a power of 2, at least twice buffer_capacity, so they're never more than half full. */
+        struct aws_hpack_lookup_slot *reverse_lookup;
+        struct aws_hpack_lookup_slot *reverse_lookup_name_only;
+        size_t lookup_capacity;
     } dynamic_table;
 };
 
@@ -81,7 +207,6 @@ struct aws_hpack_context {
 struct aws_hpack_encoder {
     const void *log_id;
 
-    struct aws_huffman_encoder huffman_encoder;
     enum aws_hpack_huffman_mode huffman_mode;
 
     struct aws_hpack_context context;
@@ -91,6 +216,19 @@ struct aws_hpack_encoder {
         size_t smallest_value;
         bool pending;
     } dynamic_table_size_update;
+
+    struct {
+        /* If NULL, every decision is AWS_HPACK_INDEXING_AUTO */
+        aws_hpack_indexing_policy_fn *policy_fn;
+        void *policy_user_data;
+
+        /* If false, AWS_HPACK_INDEXING_AUTO is the same as AWS_HPACK_INDEXING_ALWAYS */
+        bool adaptive;
+        /* Direct-mapped by name hash */
+        struct aws_hpack_name_stats name_stats[AWS_HPACK_NAME_STATS_COUNT];
+    } indexing;
+
+    struct aws_hpack_encoder_metrics metrics;
 };
 
 /**
@@ -99,8 +237,6 @@ struct aws_hpack_encoder {
 struct aws_hpack_decoder {
     const void *log_id;
 
-    struct aws_huffman_decoder huffman_decoder;
-
     struct aws_hpack_context context;
 
     /* TODO: check the new (RFC 9113 - 4.3.1) to make sure we did it right */
@@ -123,6 +259,9 @@ struct aws_hpack_decoder {
             HPACK_STRING_STATE_VALUE,
         } state;
         bool use_huffman;
+        /* Position in aws_hpack_huffman_decode_table, and whether the string could legally end there */
+        uint8_t huffman_state;
+        bool huffman_accepting;
         uint64_t length;
     } progress_string;
 
@@ -150,7 +289,8 @@ struct aws_hpack_decoder {
                 uint8_t prefix_size;
                 enum aws_http_header_compression compression;
                 uint64_t name_index;
-                size_t name_length;
+                struct aws_byte_cursor name;
+                bool name_is_transient;
             } literal;
 
             struct {
@@ -160,17 +300,27 @@ struct aws_hpack_decoder {
 
         enum aws_hpack_decode_type type;
 
-        /* Scratch holds header name and value while decoding */
-        struct aws_byte_buf scratch;
+        /* String being decoded, in the block arena */
+        struct aws_byte_buf string;
+
+        /* Copy of a header-name from the dynamic table. Reused by each entry, instead of growing the block arena */
+        struct aws_byte_buf indexed_name;
     } progress_entry;
+
+    /* Holds the header names and values decoded from the current header-block.
+     * A finished string never moves, so cursors to it stay valid until aws_hpack_decoder_end_header_block().
+     * Strings from the dynamic table are only copied here by aws_hpack_decoder_keep_string(), so this grows with
+     * the size of the encoded header-block, not with how many times it references the table. */
+    struct aws_hpack_block_arena {
+        /* Strings are decoded to the end of this buffer. It's never resized, a bigger one is started instead */
+        struct aws_byte_buf current;
+        /* Buffers that filled up during this header-block (struct aws_byte_buf) */
+        struct aws_array_list full;
+    } block_arena;
 };
 
 AWS_EXTERN_C_BEGIN
 
-/* Library-level init and shutdown */
-void aws_hpack_static_table_init(struct aws_allocator *allocator);
-void aws_hpack_static_table_clean_up(void);
-
 AWS_HTTP_API
 void aws_hpack_context_init(
     struct aws_hpack_context *aws_hpack_context,
@@ -226,6 +376,41 @@ void aws_hpack_encoder_update_max_table_size(struct aws_hpack_encoder *encoder,
 AWS_HTTP_API
 void aws_hpack_encoder_set_huffman_mode(struct aws_hpack_encoder *encoder, enum aws_hpack_huffman_mode mode);
 
+/**
+ * Set the policy that decides which headers get added to the dynamic table.
+ * By default there's no policy, and every header whose compression setting allows it is added.
+ */
+AWS_HTTP_API
+void aws_hpack_encoder_set_indexing_policy(
+    struct aws_hpack_encoder *encoder,
+    aws_hpack_indexing_policy_fn *policy_fn,
+    void *user_data);
+
+/**
+ * Built-in indexing policy.
+ * Never indexes names whose values are unique to each message (dates, signatures, request IDs, etc),
+ * since they'd just push reusable entries out of the dynamic table.
+ * Always indexes names whose values rarely change over a connection (user-agent, content-type, etc).
+ * Everything else is AWS_HPACK_INDEXING_AUTO.
+ */
+AWS_HTTP_API
+enum aws_hpack_indexing_decision aws_hpack_indexing_policy_builtin(
+    const struct aws_http_header *header,
+    void *user_data);
+
+/**
+ * If enabled, the encoder tracks how often each header name's values are found in the dynamic table.
+ * Names whose values keep getting added but are rarely found again stop being added,
+ * when the policy's decision is AWS_HPACK_INDEXING_AUTO. Disabled by default.
+ */
+AWS_HTTP_API
+void aws_hpack_encoder_set_adaptive_indexing(struct aws_hpack_encoder *encoder, bool enabled);
+
+AWS_HTTP_API
+void aws_hpack_encoder_get_metrics(
+    const struct aws_hpack_encoder *encoder,
+    struct aws_hpack_encoder_metrics *out_metrics);
+
 /**
  * Encode header-block into the output.
  * This function will mutate hpack, so an error means hpack can no longer be used.
@@ -237,6 +422,29 @@ int aws_hpack_encode_header_block(
     const struct aws_http_headers *headers,
     struct aws_byte_buf *output);
 
+/**
+ * Like aws_hpack_encode_header_block(), but the header-block also contains `pre_encoded`,
+ * which came from aws_hpack_encode_header_block_without_indexing().
+ * The pre-encoded block goes after the pseudo-headers in `headers`, and before the rest of `headers`.
+ */
+AWS_HTTP_API
+int aws_hpack_encode_header_block_with_prefix(
+    struct aws_hpack_encoder *encoder,
+    const struct aws_http_headers *headers,
+    struct aws_byte_cursor pre_encoded,
+    struct aws_byte_buf *output);
+
+/**
+ * Encode headers without adding them to the dynamic table, or referring to anything in it.
+ * The result only depends on the static table, so it can be copied into header-blocks on any connection.
+ * The encoder's dynamic table must be empty, and is not changed.
+ */
+AWS_HTTP_API
+int aws_hpack_encode_header_block_without_indexing(
+    struct aws_hpack_encoder *encoder,
+    const struct aws_http_headers *headers,
+    struct aws_byte_buf *output);
+
 AWS_HTTP_API
 void aws_hpack_decoder_init(struct aws_hpack_decoder *decoder, struct aws_allocator *allocator, const void *log_id);
 
@@ -254,6 +462,11 @@ void aws_hpack_decoder_update_max_table_size(struct aws_hpack_decoder *decoder,
  * If result->type is ONGOING, then call decode() again with more data to resume decoding.
  * Otherwise, type is either a HEADER_FIELD or a DYNAMIC_TABLE_RESIZE.
  *
+ * A HEADER_FIELD's name and value stay valid until aws_hpack_decoder_end_header_block() is called,
+ * so they can be held onto without copying while the rest of the header-block is decoded.
+ * The exception is strings from the dynamic table (see result->name_is_transient and result->value_is_transient),
+ * which are only valid until the next call to decode().
+ *
  * If an error occurs, the decoder is broken and decode() must not be called again.
  */
 AWS_HTTP_API
@@ -262,6 +475,21 @@ int aws_hpack_decode(
     struct aws_byte_cursor *to_decode,
     struct aws_hpack_decode_result *result);
 
+/**
+ * Call when a header-block is done.
+ * Frees the memory that the header-block's decoded names and values were in.
+ */
+AWS_HTTP_API
+void aws_hpack_decoder_end_header_block(struct aws_hpack_decoder *decoder);
+
+/**
+ * Copy a transient string from the last HEADER_FIELD into the header-block's memory,
+ * so it stays valid until aws_hpack_decoder_end_header_block() is called.
+ * `string` is updated to point at the copy.
+ */
+AWS_HTTP_API
+int aws_hpack_decoder_keep_string(struct aws_hpack_decoder *decoder, struct aws_byte_cursor *string);
+
 /*******************************************************************************
  * Private functions for encoder/decoder, but public for testing purposes
  ******************************************************************************/
@@ -50,6 +50,8 @@ struct aws_h2_sm_pending_stream_acquisition {
     struct aws_allocator *allocator;
     struct aws_linked_list_node node;
     struct aws_http_make_request_options options;
+    /* Copy of what options.http2_priority pointed to. If set, options.http2_priority points here */
+    struct aws_http2_stream_priority priority;
     struct aws_h2_sm_connection *sm_connection; /* The connection to make request to. Keep
                                                NULL, until find available one and move it to the pending_make_requests
                                                list. */
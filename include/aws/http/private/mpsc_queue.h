@@ -0,0 +1,76 @@
+#ifndef AWS_HTTP_MPSC_QUEUE_H
+#define AWS_HTTP_MPSC_QUEUE_H
+
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/http/http.h>
+
+#include <aws/common/atomics.h>
+
+/**
+ * Put one of these in anything you want to pass through an aws_mpsc_queue,
+ * and use AWS_CONTAINER_OF() to get back to it after popping.
+ */
+struct aws_mpsc_queue_node {
+    struct aws_atomic_var next;
+};
+
+/**
+ * Intrusive, lock-free, multi-producer single-consumer FIFO queue (Dmitry Vyukov's design).
+ *
+ * Any thread may push, and a push is one atomic exchange plus one store. Only one thread may pop,
+ * and popping never allocates or blocks. If a push is caught half-way, pop returns NULL until it finishes,
+ * so pair the queue with a "task scheduled" flag that producers set AFTER pushing, and the consumer clears
+ * BEFORE popping. Then every item is either seen by the current pass, or its producer schedules the next one.
+ *
+ * The queue can be closed, after which pushes fail. Once aws_mpsc_queue_close() returns, no more items can appear,
+ * so the consumer can drain the queue for the last time.
+ *
+ * Not movable once initialized, since the first node pushed links to the stub inside the queue.
+ */
+struct aws_mpsc_queue {
+    /* Most recently pushed node. Producers swap themselves in here */
+    struct aws_atomic_var head;
+
+    /* Oldest node. Only the consumer touches this */
+    struct aws_mpsc_queue_node *tail;
+
+    /* Keeps the queue from ever being truly empty, so producers never have to touch `tail` */
+    struct aws_mpsc_queue_node stub;
+
+    /* Bit 0 is set once the queue is closed. The rest counts pushes in progress, in steps of 2 */
+    struct aws_atomic_var state;
+};
+
+AWS_EXTERN_C_BEGIN
+
+AWS_HTTP_API
+void aws_mpsc_queue_init(struct aws_mpsc_queue *queue);
+
+/**
+ * Push a node, from any thread.
+ * Returns false if the queue is closed, in which case the node is not pushed and still belongs to the caller.
+ */
+AWS_HTTP_API
+bool aws_mpsc_queue_try_push(struct aws_mpsc_queue *queue, struct aws_mpsc_queue_node *node);
+
+/**
+ * Pop the oldest node, from the consumer thread only.
+ * Returns NULL if the queue is empty, or if the next node's push hasn't finished yet.
+ */
+AWS_HTTP_API
+struct aws_mpsc_queue_node *aws_mpsc_queue_pop(struct aws_mpsc_queue *queue);
+
+/**
+ * Stop accepting pushes. Safe to call from any thread, and more than once.
+ * Waits for pushes already in progress to finish, which takes a handful of instructions.
+ */
+AWS_HTTP_API
+void aws_mpsc_queue_close(struct aws_mpsc_queue *queue);
+
+AWS_EXTERN_C_END
+
+#endif /* AWS_HTTP_MPSC_QUEUE_H */
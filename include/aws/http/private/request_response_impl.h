@@ -10,14 +10,22 @@
 
 #include <aws/http/private/http_impl.h>
 
+#include <aws/common/array_list.h>
 #include <aws/common/atomics.h>
 
+struct aws_http_content_decoder;
+
 struct aws_http_stream_vtable {
     void (*destroy)(struct aws_http_stream *stream);
     void (*update_window)(struct aws_http_stream *stream, size_t increment_size);
+    void (*notify_body_ready)(struct aws_http_stream *stream);
     int (*activate)(struct aws_http_stream *stream);
 
     int (*http1_write_chunk)(struct aws_http_stream *http1_stream, const struct aws_http1_chunk_options *options);
+    int (*http1_write_chunks)(
+        struct aws_http_stream *http1_stream,
+        const struct aws_http1_chunk_options *options_array,
+        size_t num_chunks);
     int (*http1_add_trailer)(struct aws_http_stream *http1_stream, const struct aws_http_headers *trailing_headers);
 
     int (*http2_reset_stream)(struct aws_http_stream *http2_stream, uint32_t http2_error);
@@ -49,6 +57,37 @@ struct aws_http_stream {
     struct aws_atomic_var refcount;
     enum aws_http_method request_method;
 
+    /* If true, an outgoing body that stalls isn't read again until aws_http_stream_notify_body_ready() is called,
+     * rather than being polled every tick */
+    bool wait_for_body_ready;
+
+    /* Only used when the user asked for whole header blocks to be delivered in one on_incoming_headers call.
+     * Only touched from the connection's thread. */
+    struct aws_http_incoming_header_batch {
+        bool enabled;
+        /* struct aws_http_header. While collecting, cursors have their length set but no pointer. */
+        struct aws_array_list headers;
+        /* Names and values of the headers being collected, stored back to back. */
+        struct aws_byte_buf storage;
+        /* struct aws_byte_buf. Storage of delivered blocks, kept until the stream is destroyed. */
+        struct aws_array_list delivered_storage;
+    } incoming_header_batch;
+
+    /* Only used when the user asked for the incoming body to be decompressed.
+     * Only touched from the connection's thread. */
+    struct aws_http_incoming_body_decompression {
+        bool enabled;
+        /* Coding named by the headers. Body passes through untouched if this is IDENTITY */
+        enum aws_http_content_coding coding;
+        /* Headers named a coding we can't decode, or more than one coding */
+        bool passthrough;
+        /* Once the body starts, headers can no longer change how it's decoded */
+        bool received_body;
+        /* Created when the first compressed data arrives */
+        struct aws_http_content_decoder *decoder;
+        uint64_t compressed_size;
+    } incoming_body_decompression;
+
     union {
         struct aws_http_stream_client_data {
             int response_status;
@@ -66,4 +105,65 @@ struct aws_http_stream {
     struct aws_http_stream_server_data *server_data;
 };
 
+AWS_EXTERN_C_BEGIN
+
+/**
+ * Deliver a decoded header to the user, or collect it if the user asked for batched delivery.
+ * Raises an error if the user's callback fails.
+ */
+AWS_HTTP_API
+int aws_http_stream_on_incoming_header(
+    struct aws_http_stream *stream,
+    enum aws_http_header_block header_block,
+    const struct aws_http_header *header);
+
+/**
+ * Deliver any collected headers to the user in a single call.
+ * Must be called when a header block is done, before on_incoming_header_block_done is invoked.
+ * Does nothing unless batched delivery is enabled and headers have been collected.
+ */
+AWS_HTTP_API
+int aws_http_stream_flush_incoming_headers(struct aws_http_stream *stream, enum aws_http_header_block header_block);
+
+/**
+ * Inspect the value of an incoming Content-Encoding or Transfer-Encoding header from the main header block,
+ * to learn how the body must be decompressed. Does nothing unless decompression is enabled.
+ */
+AWS_HTTP_API
+void aws_http_stream_on_incoming_coding_header(
+    struct aws_http_stream *stream,
+    struct aws_byte_cursor value,
+    bool is_transfer_encoding);
+
+/**
+ * Deliver incoming body data to the user, decompressing it first if necessary.
+ * Raises an error if decompression or the user's callback fails.
+ */
+AWS_HTTP_API
+int aws_http_stream_on_incoming_body(struct aws_http_stream *stream, const struct aws_byte_cursor *data);
+
+/**
+ * Call when the incoming body is complete.
+ * Raises AWS_ERROR_HTTP_CONTENT_DECODING_FAILURE if the compressed body was truncated.
+ */
+AWS_HTTP_API
+int aws_http_stream_on_incoming_body_done(struct aws_http_stream *stream);
+
+/**
+ * If `body` was created by aws_http_body_stream_new_from_memory() or aws_http_body_stream_new_from_file(),
+ * set `out_unread` to the memory that hasn't been read yet and return true.
+ * Otherwise return false.
+ */
+AWS_HTTP_API
+bool aws_http_body_stream_get_unread_memory(struct aws_input_stream *body, struct aws_byte_cursor *out_unread);
+
+/**
+ * Advance a memory-backed body stream past `amount` bytes, as if they had been read.
+ * `amount` must not exceed what aws_http_body_stream_get_unread_memory() reports.
+ */
+AWS_HTTP_API
+void aws_http_body_stream_skip_memory(struct aws_input_stream *body, size_t amount);
+
+AWS_EXTERN_C_END
+
 #endif /* AWS_HTTP_REQUEST_RESPONSE_IMPL_H */
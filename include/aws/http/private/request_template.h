@@ -0,0 +1,36 @@
+#ifndef AWS_HTTP_REQUEST_TEMPLATE_H
+#define AWS_HTTP_REQUEST_TEMPLATE_H
+
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/http/private/h1_encoder.h>
+
+#include <aws/common/atomics.h>
+
+struct aws_string;
+
+struct aws_http_request_template {
+    struct aws_allocator *allocator;
+    struct aws_atomic_var refcount;
+
+    /* Requests made from this template have the same version as the prototype */
+    enum aws_http_version version;
+    struct aws_string *method;
+
+    /* Headers that every request made from this template starts with.
+     * For HTTP/2, this includes all pseudo-headers except :path */
+    struct aws_http_headers *headers;
+
+    /* `headers`, already encoded.
+     * HTTP/1.1: validated header-lines, ready to copy into the head of each request.
+     * HTTP/2: HPACK that only references the static table, ready to copy into each header-block. */
+    struct aws_byte_buf encoded_headers;
+
+    /* HTTP/1.1 only. What validating `headers` found, each request's encoder message starts from this */
+    struct aws_h1_header_scan h1_scan;
+};
+
+#endif /* AWS_HTTP_REQUEST_TEMPLATE_H */
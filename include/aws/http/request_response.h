@@ -91,6 +91,17 @@ enum aws_http_header_block {
     AWS_HTTP_HEADER_BLOCK_TRAILING,
 };
 
+/**
+ * Content-codings that aws-c-http can compress and decompress.
+ * See aws_http_make_request_options.decompress_response_body and aws_http_message_compress_body().
+ * Support requires aws-c-http to be built with zlib, otherwise AWS_ERROR_UNSUPPORTED_OPERATION is raised.
+ */
+enum aws_http_content_coding {
+    AWS_HTTP_CONTENT_CODING_IDENTITY,
+    AWS_HTTP_CONTENT_CODING_GZIP,
+    AWS_HTTP_CONTENT_CODING_DEFLATE,
+};
+
 /**
  * The definition for an outgoing HTTP request or response.
  * The message may be transformed (ex: signing the request) before its data is eventually sent.
@@ -103,6 +114,14 @@ enum aws_http_header_block {
  */
 struct aws_http_message;
 
+/**
+ * The parts of a request that stay the same across many requests (method and leading headers),
+ * validated and encoded once so that each request made from it only encodes what varies.
+ * See aws_http_request_template_new() and aws_http_message_new_request_from_template().
+ * A template is immutable once created, and may be shared across threads and connections.
+ */
+struct aws_http_request_template;
+
 /**
  * Function to invoke when a message transformation completes.
  * This function MUST be invoked or the application will soft-lock.
@@ -194,6 +213,48 @@ typedef void(aws_http_on_stream_complete_fn)(struct aws_http_stream *stream, int
  */
 typedef void(aws_http_on_stream_destroy_fn)(void *user_data);
 
+/**
+ * HTTP/2: Most and least urgent values for aws_http2_stream_priority.urgency, and the default (RFC-9218 4.1).
+ */
+#define AWS_HTTP2_PRIORITY_URGENCY_MIN (0)
+#define AWS_HTTP2_PRIORITY_URGENCY_MAX (7)
+#define AWS_HTTP2_PRIORITY_URGENCY_DEFAULT (3)
+
+/**
+ * HTTP/2: Largest value for aws_http2_stream_priority.weight, and the value used when it's 0.
+ */
+#define AWS_HTTP2_PRIORITY_WEIGHT_MAX (256)
+#define AWS_HTTP2_PRIORITY_WEIGHT_DEFAULT (16)
+
+/**
+ * HTTP/2: How a stream's outgoing DATA is scheduled relative to other streams on the connection,
+ * using the urgency and incremental parameters of Extensible Priorities (RFC-9218).
+ *
+ * DATA from more urgent streams is always sent first.
+ * Among streams of the same urgency, non-incremental streams are sent one at a time, in the order they
+ * became ready to send. Once those are done, incremental streams share the connection in proportion to their weight.
+ *
+ * This only affects what the client sends. To tell the server how to prioritize its response,
+ * send a "priority" header (ex: "u=0, i") with the request.
+ */
+struct aws_http2_stream_priority {
+    /**
+     * 0 (most urgent) to 7 (least urgent).
+     */
+    uint8_t urgency;
+
+    /**
+     * Set true if the stream's DATA is useful to the peer in pieces, so it may be interleaved with other streams.
+     */
+    bool incremental;
+
+    /**
+     * Share of bandwidth relative to other incremental streams of the same urgency, 1 to 256.
+     * If 0, AWS_HTTP2_PRIORITY_WEIGHT_DEFAULT is used.
+     */
+    uint16_t weight;
+};
+
 /**
  * Options for creating a stream which sends a request from the client and receives a response from the server.
  */
@@ -249,6 +310,48 @@ struct aws_http_make_request_options {
      * when data has been supplied via `aws_http2_stream_write_data`
      */
     bool http2_use_manual_data_writes;
+
+    /**
+     * When true, `on_response_headers` is invoked once per header block, with every header in the block,
+     * just before `on_response_header_block_done`. Otherwise it is invoked as headers are decoded.
+     * In batched mode, the name and value of each header remain valid until the stream is destroyed,
+     * so they need not be copied. The array itself is only valid for the duration of the callback.
+     * Optional.
+     */
+    bool batch_response_headers;
+
+    /**
+     * When true, a response body with a gzip or deflate Content-Encoding (or, for HTTP/1.1, Transfer-Encoding)
+     * is decompressed as it arrives, and `on_response_body` receives the decompressed data.
+     * Bodies with other codings, or with several codings applied, are delivered as-is.
+     * Remember to send an Accept-Encoding header, the request is not modified.
+     *
+     * Flow control still applies to the compressed data on the wire. With manual window management,
+     * the window shrinks by the compressed size, which aws_http_stream_get_incoming_body_compressed_size() reports.
+     *
+     * Making the request fails with AWS_ERROR_UNSUPPORTED_OPERATION if aws-c-http was built without zlib.
+     * Optional.
+     */
+    bool decompress_response_body;
+
+    /**
+     * When true, if reading the request body (or an HTTP/1.1 chunk's data) produces nothing
+     * but the end of the stream hasn't been reached, the connection stops reading from it
+     * until aws_http_stream_notify_body_ready() is called.
+     * When false, the connection tries again on the next tick of the event-loop,
+     * which keeps the event-loop thread busy while a slow body stream waits for data.
+     * Optional.
+     */
+    bool wait_for_body_ready;
+
+    /**
+     * HTTP/2 only. Priority of the request's outgoing DATA, see `aws_http2_stream_priority`.
+     * The data is copied, it need not outlive the call.
+     * Making the request fails with AWS_ERROR_INVALID_ARGUMENT if urgency or weight are out of range.
+     * Optional. If NULL, the stream has default urgency and is incremental, sharing the connection equally
+     * with other such streams.
+     */
+    const struct aws_http2_stream_priority *http2_priority;
 };
 
 struct aws_http_request_handler_options {
@@ -303,6 +406,21 @@ struct aws_http_request_handler_options {
 
     /* Callback for when the request/response stream is completely destroyed. */
     aws_http_on_stream_destroy_fn *on_destroy;
+
+    /**
+     * When true, `on_request_headers` is invoked once per header block, with every header in the block.
+     * See `aws_http_make_request_options.batch_response_headers`.
+     * Optional.
+     */
+    bool batch_request_headers;
+
+    /**
+     * When true, a response body that has no data available is not read again
+     * until aws_http_stream_notify_body_ready() is called.
+     * See `aws_http_make_request_options.wait_for_body_ready`.
+     * Optional.
+     */
+    bool wait_for_body_ready;
 };
 
 /**
@@ -702,6 +820,50 @@ struct aws_http_message *aws_http2_message_new_from_http1(
     struct aws_allocator *alloc,
     const struct aws_http_message *http1_msg);
 
+/**
+ * Create a request template from a prototype request.
+ * The prototype's method and headers are copied into the template and validated now.
+ * The prototype's path and body are ignored, they're expected to differ between requests.
+ *
+ * For an HTTP/1.1 prototype, the headers are pre-encoded as HTTP/1.1 header-lines.
+ * For an HTTP/2 prototype, the headers (including pseudo-headers such as :method, :scheme, and :authority,
+ * but not :path) are pre-encoded with HPACK, using only the static table so the encoding fits any connection.
+ *
+ * Returns NULL and raises an error if the prototype isn't a valid request.
+ * The caller has a hold on the object and must call aws_http_request_template_release() when done with it.
+ */
+AWS_HTTP_API
+struct aws_http_request_template *aws_http_request_template_new(
+    struct aws_allocator *allocator,
+    const struct aws_http_message *prototype);
+
+AWS_HTTP_API
+struct aws_http_request_template *aws_http_request_template_acquire(struct aws_http_request_template *request_template);
+
+AWS_HTTP_API
+struct aws_http_request_template *aws_http_request_template_release(struct aws_http_request_template *request_template);
+
+/**
+ * Create a request that starts from a template, with the same protocol version as the template's prototype.
+ * The request's method comes from the template. Its path must still be set.
+ *
+ * The template's headers are sent first, followed by any headers added to the request.
+ * They are NOT copied into the request's own headers, so aws_http_message_get_headers() only has the request's
+ * additional headers. The request keeps a hold on the template until the request is destroyed.
+ *
+ * The caller has a hold on the object and must call aws_http_message_release() when they are done with it.
+ */
+AWS_HTTP_API
+struct aws_http_message *aws_http_message_new_request_from_template(
+    struct aws_allocator *allocator,
+    struct aws_http_request_template *request_template);
+
+/**
+ * Get the template this request was made from, or NULL if it wasn't made from a template.
+ */
+AWS_HTTP_API
+struct aws_http_request_template *aws_http_message_get_request_template(const struct aws_http_message *message);
+
 /**
  * Acquire a hold on the object, preventing it from being deleted until
  * aws_http_message_release() is called by all those with a hold on it.
@@ -796,6 +958,46 @@ struct aws_input_stream *aws_http_message_get_body_stream(const struct aws_http_
 AWS_HTTP_API
 void aws_http_message_set_body_stream(struct aws_http_message *message, struct aws_input_stream *body_stream);
 
+/**
+ * Compress the message's body with the given content-coding and set the Content-Encoding header.
+ * The body stream is replaced by one that compresses the original stream, and holds a reference to it.
+ *
+ * For HTTP/1 messages, the body is compressed now, so that Content-Length can be set to the compressed size.
+ * The original body stream must therefore produce all of its data synchronously.
+ * For HTTP/2 messages, the body is compressed as it is sent and any content-length header is removed.
+ *
+ * Does nothing if the message has no body, or coding is AWS_HTTP_CONTENT_CODING_IDENTITY.
+ * Raises AWS_ERROR_INVALID_STATE if the message already has a Content-Encoding header,
+ * or AWS_ERROR_UNSUPPORTED_OPERATION if aws-c-http was built without zlib.
+ */
+AWS_HTTP_API
+int aws_http_message_compress_body(struct aws_http_message *message, enum aws_http_content_coding coding);
+
+/**
+ * Create a body stream that reads from memory.
+ * The memory must remain valid, and unchanged, until the stream is destroyed.
+ * `on_release` (optional) is invoked with `user_data` when the stream is destroyed,
+ * after which the memory may be freed.
+ *
+ * This works like any other aws_input_stream, but an HTTP/1 connection can send it without copying:
+ * large bodies are passed down the channel in messages that point directly into this memory.
+ */
+AWS_HTTP_API
+struct aws_input_stream *aws_http_body_stream_new_from_memory(
+    struct aws_allocator *allocator,
+    struct aws_byte_cursor data,
+    aws_simple_completion_callback *on_release,
+    void *user_data);
+
+/**
+ * Create a body stream that reads the contents of a file, mapped into memory so that it can be sent without copying.
+ * See aws_http_body_stream_new_from_memory().
+ * The file must not change size while the stream exists.
+ * On platforms where files are not mapped, this is an ordinary file stream.
+ */
+AWS_HTTP_API
+struct aws_input_stream *aws_http_body_stream_new_from_file(struct aws_allocator *allocator, const char *path);
+
 /**
  * Submit a chunk of data to be sent on an HTTP/1.1 stream.
  * The stream must have specified "chunked" in a "transfer-encoding" header.
@@ -818,6 +1020,20 @@ AWS_HTTP_API int aws_http1_stream_write_chunk(
     struct aws_http_stream *http1_stream,
     const struct aws_http1_chunk_options *options);
 
+/**
+ * Submit several chunks of data to be sent, in order, on an HTTP/1.1 stream.
+ * Behaves like calling aws_http1_stream_write_chunk() once per chunk,
+ * but the HTTP-stream is only locked and woken once for the whole array.
+ * Only the last chunk in the array may be the final chunk with size 0.
+ *
+ * The chunks are submitted all or nothing. If AWS_OP_ERR is returned,
+ * none of the chunks were submitted and none of their completion callbacks will be invoked.
+ */
+AWS_HTTP_API int aws_http1_stream_write_chunks(
+    struct aws_http_stream *http1_stream,
+    const struct aws_http1_chunk_options *options_array,
+    size_t num_chunks);
+
 /**
  * The stream must have specified `http2_use_manual_data_writes` during request creation.
  * For client streams, activate() must be called before any frames are submitted.
@@ -945,6 +1161,27 @@ struct aws_http_stream *aws_http_connection_make_request(
     struct aws_http_connection *client_connection,
     const struct aws_http_make_request_options *options);
 
+/**
+ * Create and activate several request streams at once.
+ * This is the same as calling aws_http_connection_make_request() and aws_http_stream_activate() for each request,
+ * but an HTTP/2 connection activates the whole batch under one lock and wakes its thread once,
+ * then sends all the HEADERS frames together.
+ *
+ * On success, `out_streams` (which must have room for `count` streams) holds the streams, in the same order
+ * as `options_array`. They're all activated, and you must release each one when you're done with it.
+ *
+ * On failure, an error is raised, `out_streams` is all NULL, and any streams created have been released.
+ * For HTTP/2, none of them were activated, so none of their callbacks fire except on_destroy.
+ * For HTTP/1.1, activation can fail part way through (only if the connection is closing),
+ * in which case the streams activated before the failure still complete with an error.
+ */
+AWS_HTTP_API
+int aws_http_connection_make_requests(
+    struct aws_http_connection *client_connection,
+    const struct aws_http_make_request_options *options_array,
+    size_t count,
+    struct aws_http_stream **out_streams);
+
 /**
  * Create a stream, with a server connection receiving and responding to a request.
  * This function can only be called from the `aws_http_on_incoming_request_fn` callback.
@@ -979,6 +1216,15 @@ struct aws_http_connection *aws_http_stream_get_connection(const struct aws_http
 AWS_HTTP_API
 int aws_http_stream_get_incoming_response_status(const struct aws_http_stream *stream, int *out_status);
 
+/**
+ * Get the number of compressed body bytes received so far, on a stream that is decompressing its incoming body.
+ * Compare this against the decompressed data seen by the body callback when managing the flow-control window.
+ * Only call this from the connection's event-loop thread (ex: from within the body callback).
+ * Returns 0 if the incoming body is not being decompressed.
+ */
+AWS_HTTP_API
+uint64_t aws_http_stream_get_incoming_body_compressed_size(const struct aws_http_stream *stream);
+
 /* Only valid in "request handler" streams, once request headers start arriving */
 AWS_HTTP_API
 int aws_http_stream_get_incoming_request_method(
@@ -995,6 +1241,15 @@ int aws_http_stream_get_incoming_request_uri(const struct aws_http_stream *strea
 AWS_HTTP_API
 int aws_http_stream_send_response(struct aws_http_stream *stream, struct aws_http_message *response);
 
+/**
+ * Tell the connection that the stream's outgoing body has data available again.
+ * This is only necessary for streams created with `wait_for_body_ready`,
+ * after their body stream has been read but had no data. Calling it at other times is harmless.
+ * Call it after the data becomes readable. This may be called from any thread.
+ */
+AWS_HTTP_API
+void aws_http_stream_notify_body_ready(struct aws_http_stream *stream);
+
 /**
  * Increment the stream's flow-control window to keep data flowing.
  *
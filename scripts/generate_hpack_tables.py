@@ -0,0 +1,206 @@
+#!/usr/bin/env python3
+# Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+# SPDX-License-Identifier: Apache-2.0.
+"""
+Generates the HPACK lookup tables that are checked into source/, from the .def files in include/aws/http/private/.
+Run from the repo root after changing a .def file:
+
+    python3 scripts/generate_hpack_tables.py
+"""
+
+import os
+import re
+
+REPO_ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+PRIVATE_INCLUDE_DIR = os.path.join(REPO_ROOT, 'include', 'aws', 'http', 'private')
+SOURCE_DIR = os.path.join(REPO_ROOT, 'source')
+
+FILE_HEADER = """/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+/* WARNING: THIS FILE WAS AUTOMATICALLY GENERATED BY scripts/generate_hpack_tables.py. DO NOT EDIT. */
+/* clang-format off */
+"""
+
+# Must match AWS_HPACK_STATIC_NAME_HASH() in hpack.h
+STATIC_NAME_HASH_SIZE = 256
+STATIC_NAME_HASH_MULTIPLIERS = (1, 10, 4)
+
+
+def static_name_hash(name, multipliers=STATIC_NAME_HASH_MULTIPLIERS):
+    """Hash of length, first char, and last char"""
+    len_mul, first_mul, last_mul = multipliers
+    return (len_mul * len(name) + first_mul * ord(name[0]) + last_mul * ord(name[-1])) & (STATIC_NAME_HASH_SIZE - 1)
+
+
+# RFC-7541 Appendix B: EOS is 30 1-bits. It's not in the .def because it's never encoded.
+EOS_SYMBOL = 256
+EOS_BITS = '1' * 30
+
+# Must match enum aws_hpack_huffman_decode_flags in hpack.h
+DECODE_F_SYMBOL = 0x1
+DECODE_F_ACCEPT = 0x2
+DECODE_F_FAIL = 0x4
+
+
+def read_huffman_codes():
+    """Return list of (symbol, bit-string) from hpack_huffman_static_table.def, plus EOS"""
+    codes = []
+    pattern = re.compile(r'^HUFFMAN_CODE\(\s*(\d+),\s*"([01]+)",\s*(0x[0-9a-fA-F]+),\s*(\d+)\)')
+    with open(os.path.join(PRIVATE_INCLUDE_DIR, 'hpack_huffman_static_table.def')) as f:
+        for line in f:
+            match = pattern.match(line)
+            if match:
+                symbol, bits, code, length = match.groups()
+                assert int(code, 16) == int(bits, 2) and int(length) == len(bits)
+                codes.append((int(symbol), bits))
+    assert [symbol for symbol, _ in codes] == list(range(256))
+    codes.append((EOS_SYMBOL, EOS_BITS))
+    return codes
+
+
+class Node:
+    def __init__(self, path):
+        self.path = path
+        self.children = [None, None]
+        self.symbol = None
+        self.id = None
+
+
+def build_huffman_tree(codes):
+    """Return list of internal nodes, root first. Each gets an id, which is its state number in the decoder"""
+    root = Node('')
+    for symbol, bits in codes:
+        node = root
+        for bit in bits:
+            b = int(bit)
+            if node.children[b] is None:
+                node.children[b] = Node(node.path + bit)
+            node = node.children[b]
+        node.symbol = symbol
+
+    internal_nodes = []
+    queue = [root]
+    while queue:
+        node = queue.pop(0)
+        if node.symbol is None:
+            assert node.children[0] and node.children[1], 'Huffman code must be complete'
+            node.id = len(internal_nodes)
+            internal_nodes.append(node)
+            queue.extend(node.children)
+    return root, internal_nodes
+
+
+def is_accepting(node):
+    """A string may end here if the bits since the last symbol could be padding: fewer than 8, and all 1s"""
+    return len(node.path) < 8 and '0' not in node.path
+
+
+def generate_huffman_decode_table():
+    root, states = build_huffman_tree(read_huffman_codes())
+    assert len(states) == 256, 'state number must fit in a uint8_t'
+
+    lines = [FILE_HEADER]
+    lines.append('#include <aws/http/private/hpack.h>\n')
+    lines.append('/* Each state is a node in the Huffman tree, where the bits decoded since the last symbol lead.')
+    lines.append(' * Each entry is what happens when the next 4 bits are fed in. Codes are at least 5 bits,')
+    lines.append(' * so 4 bits can complete at most 1 symbol. */')
+    lines.append('const struct aws_hpack_huffman_decode_entry aws_hpack_huffman_decode_table[256][16] = {')
+    for state in states:
+        lines.append('    /* state %d: "%s" */' % (state.id, state.path))
+        lines.append('    {')
+        entries = []
+        for nibble in range(16):
+            node = state
+            flags = 0
+            symbol = 0
+            for shift in (3, 2, 1, 0):
+                node = node.children[(nibble >> shift) & 1]
+                if node.symbol is not None:
+                    if node.symbol == EOS_SYMBOL:
+                        flags = DECODE_F_FAIL
+                        break
+                    flags |= DECODE_F_SYMBOL
+                    symbol = node.symbol
+                    node = root
+            if flags & DECODE_F_FAIL:
+                entries.append('{0, 0x%x, 0}' % flags)
+                continue
+            if is_accepting(node):
+                flags |= DECODE_F_ACCEPT
+            entries.append('{%d, 0x%x, %d}' % (node.id, flags, symbol))
+        for row in range(0, 16, 4):
+            lines.append('        ' + ', '.join(entries[row:row + 4]) + ',')
+        lines.append('    },')
+    lines.append('};')
+
+    with open(os.path.join(SOURCE_DIR, 'hpack_huffman_decode_table.c'), 'w') as f:
+        f.write('\n'.join(lines) + '\n')
+
+
+def read_static_table_names():
+    """Return list of (index, name) from hpack_header_static_table.def"""
+    entries = []
+    pattern = re.compile(r'^HEADER(?:_WITH_VALUE)?\(\s*(\d+),\s*"([^"]+)"')
+    with open(os.path.join(PRIVATE_INCLUDE_DIR, 'hpack_header_static_table.def')) as f:
+        for line in f:
+            match = pattern.match(line)
+            if match:
+                entries.append((int(match.group(1)), match.group(2)))
+    assert [index for index, _ in entries] == list(range(1, len(entries) + 1))
+    return entries
+
+
+def find_static_name_hash_multipliers(names):
+    """Brute-force multipliers that give every name its own bucket"""
+    candidates = []
+    for len_mul in range(0, 32):
+        for first_mul in range(1, 32):
+            for last_mul in range(1, 32):
+                multipliers = (len_mul, first_mul, last_mul)
+                if len(set(static_name_hash(name, multipliers) for name in names)) == len(names):
+                    candidates.append((sum(multipliers), multipliers))
+    return min(candidates)[1] if candidates else None
+
+
+def generate_static_name_table():
+    entries = read_static_table_names()
+
+    # Each name maps to its first index, and how many entries in a row share that name
+    first_index = {}
+    num_entries = {}
+    for index, name in entries:
+        if name in first_index:
+            assert first_index[name] + num_entries[name] == index, 'entries with the same name must be adjacent'
+            num_entries[name] += 1
+        else:
+            first_index[name] = index
+            num_entries[name] = 1
+
+    buckets = {}
+    for name in first_index:
+        bucket = static_name_hash(name)
+        if bucket in buckets:
+            raise SystemExit('"%s" and "%s" hash to the same bucket. Change AWS_HPACK_STATIC_NAME_HASH() in hpack.h '
+                             'and STATIC_NAME_HASH_MULTIPLIERS in this script to: %s' %
+                             (name, buckets[bucket], find_static_name_hash_multipliers(list(first_index))))
+        buckets[bucket] = name
+
+    lines = [FILE_HEADER]
+    lines.append('#include <aws/http/private/hpack.h>\n')
+    lines.append('const struct aws_hpack_static_name_bucket')
+    lines.append('    aws_hpack_static_name_buckets[AWS_HPACK_STATIC_NAME_HASH_SIZE] = {')
+    for bucket in sorted(buckets):
+        name = buckets[bucket]
+        lines.append('    [%d] = {%d, %d}, /* %s */' % (bucket, first_index[name], num_entries[name], name))
+    lines.append('};')
+
+    with open(os.path.join(SOURCE_DIR, 'hpack_static_name_table.c'), 'w') as f:
+        f.write('\n'.join(lines) + '\n')
+
+
+if __name__ == '__main__':
+    generate_huffman_decode_table()
+    generate_static_name_table()
@@ -0,0 +1,191 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/http/private/request_response_impl.h>
+
+#include <aws/common/file.h>
+#include <aws/io/stream.h>
+
+#ifndef _WIN32
+#    include <errno.h>
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#endif
+
+/* Body stream that reads from memory it doesn't own.
+ * Connections recognize it by its vtable, so they can send its memory without copying */
+struct aws_http_memory_body_stream {
+    struct aws_input_stream base;
+    struct aws_allocator *alloc;
+    struct aws_byte_cursor data;
+    size_t position;
+    aws_simple_completion_callback *on_release;
+    void *user_data;
+};
+
+static int s_memory_body_stream_seek(
+    struct aws_input_stream *stream,
+    int64_t offset,
+    enum aws_stream_seek_basis basis) {
+
+    struct aws_http_memory_body_stream *impl = AWS_CONTAINER_OF(stream, struct aws_http_memory_body_stream, base);
+
+    const int64_t len = (int64_t)impl->data.len;
+    int64_t position = basis == AWS_SSB_BEGIN ? offset : len + offset;
+    if (position < 0 || position > len) {
+        return aws_raise_error(AWS_IO_STREAM_INVALID_SEEK_POSITION);
+    }
+
+    impl->position = (size_t)position;
+    return AWS_OP_SUCCESS;
+}
+
+static int s_memory_body_stream_read(struct aws_input_stream *stream, struct aws_byte_buf *dest) {
+    struct aws_http_memory_body_stream *impl = AWS_CONTAINER_OF(stream, struct aws_http_memory_body_stream, base);
+
+    size_t amount = aws_min_size(impl->data.len - impl->position, dest->capacity - dest->len);
+    aws_byte_buf_write(dest, impl->data.ptr + impl->position, amount);
+    impl->position += amount;
+    return AWS_OP_SUCCESS;
+}
+
+static int s_memory_body_stream_get_status(struct aws_input_stream *stream, struct aws_stream_status *status) {
+    struct aws_http_memory_body_stream *impl = AWS_CONTAINER_OF(stream, struct aws_http_memory_body_stream, base);
+    status->is_valid = true;
+    status->is_end_of_stream = impl->position == impl->data.len;
+    return AWS_OP_SUCCESS;
+}
+
+static int s_memory_body_stream_get_length(struct aws_input_stream *stream, int64_t *out_length) {
+    struct aws_http_memory_body_stream *impl = AWS_CONTAINER_OF(stream, struct aws_http_memory_body_stream, base);
+    *out_length = (int64_t)impl->data.len;
+    return AWS_OP_SUCCESS;
+}
+
+static void s_memory_body_stream_destroy(struct aws_http_memory_body_stream *impl) {
+    if (impl->on_release) {
+        impl->on_release(impl->user_data);
+    }
+    aws_mem_release(impl->alloc, impl);
+}
+
+static struct aws_input_stream_vtable s_memory_body_stream_vtable = {
+    .seek = s_memory_body_stream_seek,
+    .read = s_memory_body_stream_read,
+    .get_status = s_memory_body_stream_get_status,
+    .get_length = s_memory_body_stream_get_length,
+};
+
+struct aws_input_stream *aws_http_body_stream_new_from_memory(
+    struct aws_allocator *allocator,
+    struct aws_byte_cursor data,
+    aws_simple_completion_callback *on_release,
+    void *user_data) {
+
+    AWS_PRECONDITION(allocator);
+    AWS_PRECONDITION(aws_byte_cursor_is_valid(&data));
+
+    struct aws_http_memory_body_stream *impl = aws_mem_calloc(allocator, 1, sizeof(struct aws_http_memory_body_stream));
+    impl->alloc = allocator;
+    impl->data = data;
+    impl->on_release = on_release;
+    impl->user_data = user_data;
+    impl->base.vtable = &s_memory_body_stream_vtable;
+    aws_ref_count_init(&impl->base.ref_count, impl, (aws_simple_completion_callback *)s_memory_body_stream_destroy);
+    return &impl->base;
+}
+
+bool aws_http_body_stream_get_unread_memory(struct aws_input_stream *body, struct aws_byte_cursor *out_unread) {
+    if (body == NULL || body->vtable != &s_memory_body_stream_vtable) {
+        return false;
+    }
+
+    struct aws_http_memory_body_stream *impl = AWS_CONTAINER_OF(body, struct aws_http_memory_body_stream, base);
+    *out_unread = aws_byte_cursor_from_array(impl->data.ptr + impl->position, impl->data.len - impl->position);
+    return true;
+}
+
+void aws_http_body_stream_skip_memory(struct aws_input_stream *body, size_t amount) {
+    AWS_PRECONDITION(body->vtable == &s_memory_body_stream_vtable);
+
+    struct aws_http_memory_body_stream *impl = AWS_CONTAINER_OF(body, struct aws_http_memory_body_stream, base);
+    AWS_FATAL_ASSERT(amount <= impl->data.len - impl->position);
+    impl->position += amount;
+}
+
+#ifdef _WIN32
+
+struct aws_input_stream *aws_http_body_stream_new_from_file(struct aws_allocator *allocator, const char *path) {
+    return aws_input_stream_new_from_file(allocator, path);
+}
+
+#else
+
+struct aws_http_file_mapping {
+    struct aws_allocator *alloc;
+    void *addr;
+    size_t size;
+};
+
+static void s_file_mapping_release(void *user_data) {
+    struct aws_http_file_mapping *mapping = user_data;
+    if (mapping->addr) {
+        munmap(mapping->addr, mapping->size);
+    }
+    aws_mem_release(mapping->alloc, mapping);
+}
+
+struct aws_input_stream *aws_http_body_stream_new_from_file(struct aws_allocator *allocator, const char *path) {
+    AWS_PRECONDITION(path);
+
+    int fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        aws_translate_and_raise_io_error(errno);
+        return NULL;
+    }
+
+    struct stat file_stat;
+    if (fstat(fd, &file_stat)) {
+        aws_translate_and_raise_io_error(errno);
+        goto error;
+    }
+
+    if (!S_ISREG(file_stat.st_mode) || (uint64_t)file_stat.st_size > SIZE_MAX) {
+        aws_raise_error(AWS_ERROR_INVALID_ARGUMENT);
+        goto error;
+    }
+
+    struct aws_http_file_mapping *mapping = aws_mem_calloc(allocator, 1, sizeof(struct aws_http_file_mapping));
+    mapping->alloc = allocator;
+    mapping->size = (size_t)file_stat.st_size;
+
+    /* mmap() rejects empty mappings, an empty file is just an empty body */
+    if (mapping->size > 0) {
+        void *addr = mmap(NULL, mapping->size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (addr == MAP_FAILED) {
+            aws_translate_and_raise_io_error(errno);
+            aws_mem_release(allocator, mapping);
+            goto error;
+        }
+        mapping->addr = addr;
+
+        /* Bodies are read front to back, once */
+        madvise(addr, mapping->size, MADV_SEQUENTIAL);
+    }
+
+    /* The mapping stays valid after the descriptor is closed */
+    close(fd);
+
+    return aws_http_body_stream_new_from_memory(
+        allocator, aws_byte_cursor_from_array(mapping->addr, mapping->size), s_file_mapping_release, mapping);
+
+error:
+    close(fd);
+    return NULL;
+}
+
+#endif /* _WIN32 */
@@ -244,6 +244,7 @@ struct aws_http_connection_manager {
     struct aws_array_list *initial_settings;
     size_t max_closed_streams;
     bool http2_conn_manual_window_management;
+    bool http2_window_auto_tuning;
 
     /*
      * The maximum number of connections this manager should ever have at once.
@@ -895,6 +896,7 @@ struct aws_http_connection_manager *aws_http_connection_manager_new(
     }
     manager->max_closed_streams = options->max_closed_streams;
     manager->http2_conn_manual_window_management = options->http2_conn_manual_window_management;
+    manager->http2_window_auto_tuning = options->http2_window_auto_tuning;
 
     /* NOTHING can fail after here */
     s_schedule_connection_culling(manager);
@@ -1005,6 +1007,7 @@ static int s_aws_http_connection_manager_new_connection(struct aws_http_connecti
     }
     h2_options.max_closed_streams = manager->max_closed_streams;
     h2_options.conn_manual_window_management = manager->http2_conn_manual_window_management;
+    h2_options.window_auto_tuning = manager->http2_window_auto_tuning;
     /* The initial_settings_completed invoked after the other side acknowledges it, and will always be invoked if the
      * connection set up */
     h2_options.on_initial_settings_completed = s_aws_http_connection_manager_h2_on_initial_settings_completed;
@@ -0,0 +1,487 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/http/private/content_coding.h>
+
+#include <aws/common/logging.h>
+#include <aws/io/stream.h>
+
+#ifdef AWS_HTTP_HAVE_ZLIB
+#    include <limits.h>
+#    include <zlib.h>
+#endif
+
+#if _MSC_VER
+#    pragma warning(disable : 4204) /* non-constant aggregate initializer */
+#endif
+
+enum {
+    /* Size of the buffer that inflated output is written to, before being passed along */
+    AWS_HTTP_CONTENT_DECODER_OUTPUT_SIZE = 16 * 1024,
+    /* Size of the buffer that source data is read into, before being deflated */
+    AWS_HTTP_CONTENT_ENCODER_INPUT_SIZE = 16 * 1024,
+};
+
+bool aws_http_content_coding_from_token(struct aws_byte_cursor token, enum aws_http_content_coding *out_coding) {
+    /* RFC-9110 8.4.1.3: recipients SHOULD consider "x-gzip" to be equivalent to "gzip" */
+    if (aws_byte_cursor_eq_c_str_ignore_case(&token, "gzip") ||
+        aws_byte_cursor_eq_c_str_ignore_case(&token, "x-gzip")) {
+        *out_coding = AWS_HTTP_CONTENT_CODING_GZIP;
+        return true;
+    }
+    if (aws_byte_cursor_eq_c_str_ignore_case(&token, "deflate")) {
+        *out_coding = AWS_HTTP_CONTENT_CODING_DEFLATE;
+        return true;
+    }
+    if (aws_byte_cursor_eq_c_str_ignore_case(&token, "identity")) {
+        *out_coding = AWS_HTTP_CONTENT_CODING_IDENTITY;
+        return true;
+    }
+    return false;
+}
+
+#ifdef AWS_HTTP_HAVE_ZLIB
+
+bool aws_http_content_coding_is_supported(void) {
+    return true;
+}
+
+/* zlib allocates through the aws allocator, so memory is tracked like everything else */
+static voidpf s_zlib_alloc(voidpf opaque, uInt items, uInt size) {
+    return aws_mem_calloc(opaque, items, size);
+}
+
+static void s_zlib_free(voidpf opaque, voidpf address) {
+    aws_mem_release(opaque, address);
+}
+
+static int s_zlib_window_bits(enum aws_http_content_coding coding) {
+    /* Adding 16 tells zlib to use a gzip wrapper instead of a zlib wrapper */
+    return coding == AWS_HTTP_CONTENT_CODING_GZIP ? MAX_WBITS + 16 : MAX_WBITS;
+}
+
+struct aws_http_content_decoder {
+    struct aws_allocator *alloc;
+    enum aws_http_content_coding coding;
+    z_stream zs;
+
+    /* The "deflate" coding is supposed to have a zlib wrapper, but some servers send raw deflate data.
+     * If the first bytes don't look like a zlib header, we start over expecting raw deflate.
+     * The header's bytes may arrive in separate calls, so they're saved to be replayed. */
+    bool tried_raw_deflate;
+    uint8_t zlib_header[2];
+    size_t zlib_header_len;
+
+    /* Reached the end of the compressed data */
+    bool done;
+
+    uint8_t output[AWS_HTTP_CONTENT_DECODER_OUTPUT_SIZE];
+};
+
+struct aws_http_content_decoder *aws_http_content_decoder_new(
+    struct aws_allocator *alloc,
+    enum aws_http_content_coding coding) {
+
+    if (coding != AWS_HTTP_CONTENT_CODING_GZIP && coding != AWS_HTTP_CONTENT_CODING_DEFLATE) {
+        aws_raise_error(AWS_ERROR_UNSUPPORTED_OPERATION);
+        return NULL;
+    }
+
+    struct aws_http_content_decoder *decoder = aws_mem_calloc(alloc, 1, sizeof(struct aws_http_content_decoder));
+    decoder->alloc = alloc;
+    decoder->coding = coding;
+    decoder->zs.zalloc = s_zlib_alloc;
+    decoder->zs.zfree = s_zlib_free;
+    decoder->zs.opaque = alloc;
+
+    if (inflateInit2(&decoder->zs, s_zlib_window_bits(coding)) != Z_OK) {
+        aws_mem_release(alloc, decoder);
+        aws_raise_error(AWS_ERROR_OOM);
+        return NULL;
+    }
+
+    return decoder;
+}
+
+void aws_http_content_decoder_destroy(struct aws_http_content_decoder *decoder) {
+    if (!decoder) {
+        return;
+    }
+
+    inflateEnd(&decoder->zs);
+    aws_mem_release(decoder->alloc, decoder);
+}
+
+static int s_decoding_failure(struct aws_http_content_decoder *decoder, const char *reason) {
+    AWS_LOGF_ERROR(
+        AWS_LS_HTTP_STREAM,
+        "id=%p: Failed to decode body, %s (%s).",
+        (void *)decoder,
+        reason,
+        decoder->zs.msg ? decoder->zs.msg : "no details");
+    return aws_raise_error(AWS_ERROR_HTTP_CONTENT_DECODING_FAILURE);
+}
+
+int aws_http_content_decoder_process(
+    struct aws_http_content_decoder *decoder,
+    struct aws_byte_cursor encoded,
+    aws_http_content_decoder_on_output_fn *on_output,
+    void *user_data) {
+
+    while (encoded.len > 0) {
+        if (decoder->done) {
+            /* RFC-1952 2.2: a gzip file consists of a series of members, so start decoding the next one */
+            if (decoder->coding != AWS_HTTP_CONTENT_CODING_GZIP) {
+                return s_decoding_failure(decoder, "unexpected data after end of compressed data");
+            }
+            inflateReset(&decoder->zs);
+            decoder->done = false;
+        }
+
+        struct aws_byte_cursor input = aws_byte_cursor_advance(&encoded, aws_min_size(encoded.len, UINT_MAX));
+        decoder->zs.next_in = input.ptr;
+        decoder->zs.avail_in = (uInt)input.len;
+
+        /* Save the zlib header's bytes, in case they turn out to be raw deflate data */
+        const size_t prev_zlib_header_len = decoder->zlib_header_len;
+        if (decoder->coding == AWS_HTTP_CONTENT_CODING_DEFLATE && !decoder->tried_raw_deflate) {
+            const size_t num_to_save =
+                aws_min_size(sizeof(decoder->zlib_header) - decoder->zlib_header_len, input.len);
+            memcpy(decoder->zlib_header + decoder->zlib_header_len, input.ptr, num_to_save);
+            decoder->zlib_header_len += num_to_save;
+        }
+
+        do {
+            decoder->zs.next_out = decoder->output;
+            decoder->zs.avail_out = sizeof(decoder->output);
+
+            int zerr = inflate(&decoder->zs, Z_NO_FLUSH);
+
+            /* zlib reports a bad header once it has all of the header's bytes, and not after */
+            if (zerr == Z_DATA_ERROR && decoder->zs.total_in <= sizeof(decoder->zlib_header) &&
+                decoder->coding == AWS_HTTP_CONTENT_CODING_DEFLATE && !decoder->tried_raw_deflate) {
+
+                /* Start over, expecting raw deflate data with no zlib wrapper.
+                 * Replay header bytes from earlier calls, then this input from the beginning */
+                decoder->tried_raw_deflate = true;
+                if (inflateReset2(&decoder->zs, -MAX_WBITS) != Z_OK) {
+                    return s_decoding_failure(decoder, "failed to reset decoder");
+                }
+                struct aws_byte_cursor replay = aws_byte_cursor_from_array(decoder->zlib_header, prev_zlib_header_len);
+                if (aws_http_content_decoder_process(decoder, replay, on_output, user_data)) {
+                    return AWS_OP_ERR;
+                }
+                decoder->zs.next_in = input.ptr;
+                decoder->zs.avail_in = (uInt)input.len;
+                continue;
+            }
+
+            if (zerr != Z_OK && zerr != Z_STREAM_END && zerr != Z_BUF_ERROR) {
+                return s_decoding_failure(decoder, "malformed data");
+            }
+
+            struct aws_byte_cursor output =
+                aws_byte_cursor_from_array(decoder->output, sizeof(decoder->output) - decoder->zs.avail_out);
+            if (output.len > 0 && on_output(&output, user_data)) {
+                return AWS_OP_ERR;
+            }
+
+            if (zerr == Z_STREAM_END) {
+                decoder->done = true;
+                /* Anything left over belongs to the next gzip member, which is handled above */
+                aws_byte_cursor_advance(&input, input.len - decoder->zs.avail_in);
+                encoded.ptr = input.ptr;
+                encoded.len += input.len;
+                break;
+            }
+
+            if (zerr == Z_BUF_ERROR) {
+                /* No progress possible until more input arrives */
+                break;
+            }
+
+            /* Keep going while there's input left, or while output filled up and more might be pending */
+        } while (decoder->zs.avail_in > 0 || decoder->zs.avail_out == 0);
+    }
+
+    return AWS_OP_SUCCESS;
+}
+
+int aws_http_content_decoder_finish(struct aws_http_content_decoder *decoder) {
+    /* An empty body is fine, that's just a response with no content (ex: 204, or response to HEAD) */
+    if (!decoder->done && decoder->zs.total_in > 0) {
+        return s_decoding_failure(decoder, "compressed data is truncated");
+    }
+
+    return AWS_OP_SUCCESS;
+}
+
+struct aws_http_content_encoder_stream {
+    struct aws_input_stream base;
+    struct aws_allocator *alloc;
+    struct aws_input_stream *source;
+    z_stream zs;
+    bool zs_initialized;
+
+    /* Data read from source, that zlib's next_in points into */
+    struct aws_byte_buf source_buf;
+    bool source_done;
+
+    /* zlib has written everything, including the trailer */
+    bool encoding_done;
+
+    /* Only used when buffering the entire body */
+    bool is_buffered;
+    struct aws_byte_buf buffered_body;
+    struct aws_byte_cursor buffered_remaining;
+};
+
+/* Compress as much as possible into dest, reading from source as necessary */
+static int s_encoder_stream_compress(struct aws_http_content_encoder_stream *impl, struct aws_byte_buf *dest) {
+    while (!impl->encoding_done && dest->len < dest->capacity) {
+        if (impl->zs.avail_in == 0 && !impl->source_done) {
+            aws_byte_buf_reset(&impl->source_buf, false);
+            if (aws_input_stream_read(impl->source, &impl->source_buf)) {
+                return AWS_OP_ERR;
+            }
+
+            struct aws_stream_status status;
+            if (aws_input_stream_get_status(impl->source, &status)) {
+                return AWS_OP_ERR;
+            }
+            if (!status.is_valid) {
+                return aws_raise_error(AWS_IO_STREAM_READ_FAILED);
+            }
+            impl->source_done = status.is_end_of_stream;
+
+            if (impl->source_buf.len == 0 && !impl->source_done) {
+                /* Source has nothing for us right now, try again on the next read */
+                break;
+            }
+
+            impl->zs.next_in = impl->source_buf.buffer;
+            impl->zs.avail_in = (uInt)impl->source_buf.len;
+        }
+
+        uInt avail_out = (uInt)aws_min_size(dest->capacity - dest->len, UINT_MAX);
+        impl->zs.next_out = dest->buffer + dest->len;
+        impl->zs.avail_out = avail_out;
+
+        int flush = (impl->source_done && impl->zs.avail_in == 0) ? Z_FINISH : Z_NO_FLUSH;
+        int zerr = deflate(&impl->zs, flush);
+        if (zerr == Z_STREAM_ERROR) {
+            return aws_raise_error(AWS_ERROR_INVALID_STATE);
+        }
+
+        dest->len += avail_out - impl->zs.avail_out;
+        if (zerr == Z_STREAM_END) {
+            impl->encoding_done = true;
+        }
+    }
+
+    return AWS_OP_SUCCESS;
+}
+
+static int s_encoder_stream_read(struct aws_input_stream *stream, struct aws_byte_buf *dest) {
+    struct aws_http_content_encoder_stream *impl =
+        AWS_CONTAINER_OF(stream, struct aws_http_content_encoder_stream, base);
+    if (impl->is_buffered) {
+        size_t amount = aws_min_size(impl->buffered_remaining.len, dest->capacity - dest->len);
+        struct aws_byte_cursor chunk = aws_byte_cursor_advance(&impl->buffered_remaining, amount);
+        aws_byte_buf_write_from_whole_cursor(dest, chunk);
+        return AWS_OP_SUCCESS;
+    }
+
+    return s_encoder_stream_compress(impl, dest);
+}
+
+static int s_encoder_stream_seek(struct aws_input_stream *stream, int64_t offset, enum aws_stream_seek_basis basis) {
+    struct aws_http_content_encoder_stream *impl =
+        AWS_CONTAINER_OF(stream, struct aws_http_content_encoder_stream, base);
+    if (!impl->is_buffered) {
+        /* Compression can't be rewound */
+        return aws_raise_error(AWS_ERROR_UNSUPPORTED_OPERATION);
+    }
+
+    const int64_t len = (int64_t)impl->buffered_body.len;
+    int64_t position = basis == AWS_SSB_BEGIN ? offset : len + offset;
+    if (position < 0 || position > len) {
+        return aws_raise_error(AWS_IO_STREAM_INVALID_SEEK_POSITION);
+    }
+
+    impl->buffered_remaining = aws_byte_cursor_from_buf(&impl->buffered_body);
+    aws_byte_cursor_advance(&impl->buffered_remaining, (size_t)position);
+    return AWS_OP_SUCCESS;
+}
+
+static int s_encoder_stream_get_status(struct aws_input_stream *stream, struct aws_stream_status *status) {
+    struct aws_http_content_encoder_stream *impl =
+        AWS_CONTAINER_OF(stream, struct aws_http_content_encoder_stream, base);
+    status->is_valid = true;
+    status->is_end_of_stream = impl->is_buffered ? impl->buffered_remaining.len == 0 : impl->encoding_done;
+    return AWS_OP_SUCCESS;
+}
+
+static int s_encoder_stream_get_length(struct aws_input_stream *stream, int64_t *out_length) {
+    struct aws_http_content_encoder_stream *impl =
+        AWS_CONTAINER_OF(stream, struct aws_http_content_encoder_stream, base);
+    if (!impl->is_buffered) {
+        /* Length isn't known until the source is fully compressed */
+        return aws_raise_error(AWS_ERROR_UNSUPPORTED_OPERATION);
+    }
+
+    *out_length = (int64_t)impl->buffered_body.len;
+    return AWS_OP_SUCCESS;
+}
+
+static void s_encoder_stream_destroy(struct aws_http_content_encoder_stream *impl) {
+    if (impl->zs_initialized) {
+        deflateEnd(&impl->zs);
+    }
+    aws_byte_buf_clean_up(&impl->source_buf);
+    aws_byte_buf_clean_up(&impl->buffered_body);
+    aws_input_stream_release(impl->source);
+    aws_mem_release(impl->alloc, impl);
+}
+
+static struct aws_input_stream_vtable s_encoder_stream_vtable = {
+    .seek = s_encoder_stream_seek,
+    .read = s_encoder_stream_read,
+    .get_status = s_encoder_stream_get_status,
+    .get_length = s_encoder_stream_get_length,
+};
+
+struct aws_input_stream *aws_http_content_encoder_stream_new(
+    struct aws_allocator *alloc,
+    struct aws_input_stream *source,
+    enum aws_http_content_coding coding,
+    bool buffer_entire_body) {
+
+    AWS_PRECONDITION(source);
+    if (coding != AWS_HTTP_CONTENT_CODING_GZIP && coding != AWS_HTTP_CONTENT_CODING_DEFLATE) {
+        aws_raise_error(AWS_ERROR_UNSUPPORTED_OPERATION);
+        return NULL;
+    }
+
+    struct aws_http_content_encoder_stream *impl =
+        aws_mem_calloc(alloc, 1, sizeof(struct aws_http_content_encoder_stream));
+    impl->alloc = alloc;
+    impl->base.vtable = &s_encoder_stream_vtable;
+    aws_ref_count_init(&impl->base.ref_count, impl, (aws_simple_completion_callback *)s_encoder_stream_destroy);
+    impl->source = aws_input_stream_acquire(source);
+
+    impl->zs.zalloc = s_zlib_alloc;
+    impl->zs.zfree = s_zlib_free;
+    impl->zs.opaque = alloc;
+    int zerr = deflateInit2(
+        &impl->zs, Z_DEFAULT_COMPRESSION, Z_DEFLATED, s_zlib_window_bits(coding), 8 /*memLevel*/, Z_DEFAULT_STRATEGY);
+    if (zerr != Z_OK) {
+        aws_raise_error(AWS_ERROR_OOM);
+        goto error;
+    }
+    impl->zs_initialized = true;
+
+    if (aws_byte_buf_init(&impl->source_buf, alloc, AWS_HTTP_CONTENT_ENCODER_INPUT_SIZE)) {
+        goto error;
+    }
+
+    if (buffer_entire_body) {
+        if (aws_byte_buf_init(&impl->buffered_body, alloc, AWS_HTTP_CONTENT_ENCODER_INPUT_SIZE)) {
+            goto error;
+        }
+
+        while (!impl->encoding_done) {
+            if (impl->buffered_body.len == impl->buffered_body.capacity) {
+                if (aws_byte_buf_reserve_relative(&impl->buffered_body, impl->buffered_body.capacity)) {
+                    goto error;
+                }
+            }
+
+            size_t prev_len = impl->buffered_body.len;
+            if (s_encoder_stream_compress(impl, &impl->buffered_body)) {
+                goto error;
+            }
+
+            if (impl->buffered_body.len == prev_len && !impl->encoding_done && impl->zs.avail_in == 0 &&
+                !impl->source_done) {
+                /* The source must produce its data synchronously for the length to be known up front */
+                AWS_LOGF_ERROR(
+                    AWS_LS_HTTP_STREAM,
+                    "id=%p: Cannot compress body, source stream produced no data and did not end.",
+                    (void *)impl);
+                aws_raise_error(AWS_IO_STREAM_READ_FAILED);
+                goto error;
+            }
+        }
+
+        impl->is_buffered = true;
+        impl->buffered_remaining = aws_byte_cursor_from_buf(&impl->buffered_body);
+
+        /* Source is no longer needed */
+        aws_byte_buf_clean_up(&impl->source_buf);
+        aws_input_stream_release(impl->source);
+        impl->source = NULL;
+    }
+
+    return &impl->base;
+
+error:
+    s_encoder_stream_destroy(impl);
+    return NULL;
+}
+
+#else /* !AWS_HTTP_HAVE_ZLIB */
+
+bool aws_http_content_coding_is_supported(void) {
+    return false;
+}
+
+struct aws_http_content_decoder *aws_http_content_decoder_new(
+    struct aws_allocator *alloc,
+    enum aws_http_content_coding coding) {
+
+    (void)alloc;
+    (void)coding;
+    aws_raise_error(AWS_ERROR_UNSUPPORTED_OPERATION);
+    return NULL;
+}
+
+void aws_http_content_decoder_destroy(struct aws_http_content_decoder *decoder) {
+    (void)decoder;
+}
+
+int aws_http_content_decoder_process(
+    struct aws_http_content_decoder *decoder,
+    struct aws_byte_cursor encoded,
+    aws_http_content_decoder_on_output_fn *on_output,
+    void *user_data) {
+
+    (void)decoder;
+    (void)encoded;
+    (void)on_output;
+    (void)user_data;
+    return aws_raise_error(AWS_ERROR_UNSUPPORTED_OPERATION);
+}
+
+int aws_http_content_decoder_finish(struct aws_http_content_decoder *decoder) {
+    (void)decoder;
+    return aws_raise_error(AWS_ERROR_UNSUPPORTED_OPERATION);
+}
+
+struct aws_input_stream *aws_http_content_encoder_stream_new(
+    struct aws_allocator *alloc,
+    struct aws_input_stream *source,
+    enum aws_http_content_coding coding,
+    bool buffer_entire_body) {
+
+    (void)alloc;
+    (void)source;
+    (void)coding;
+    (void)buffer_entire_body;
+    aws_raise_error(AWS_ERROR_UNSUPPORTED_OPERATION);
+    return NULL;
+}
+
+#endif /* AWS_HTTP_HAVE_ZLIB */
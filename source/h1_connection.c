@@ -21,6 +21,9 @@
 
 enum {
     DECODER_INITIAL_SCRATCH_SIZE = 256,
+    /* Max size of an aws_io_message that references body memory directly (see s_send_body_reference()).
+     * Large enough to make copying pointless, small enough that one stream doesn't monopolize the network. */
+    BODY_REFERENCE_MAX_MESSAGE_SIZE = 1024 * 1024,
 };
 
 static int s_handler_process_read_message(
@@ -857,6 +860,72 @@ void aws_h1_connection_try_write_outgoing_stream(struct aws_h1_connection *conne
     s_write_outgoing_stream(connection, true /*first_try*/);
 }
 
+/* aws_io_message whose data points into the memory of a body stream, rather than a buffer of its own.
+ * The message's allocator is a shim, so that whoever releases the message also releases the body stream. */
+struct aws_h1_body_reference_message {
+    struct aws_io_message base;
+    struct aws_allocator shim_allocator;
+    struct aws_allocator *alloc;
+    struct aws_input_stream *body;
+};
+
+static void *s_body_reference_message_mem_acquire(struct aws_allocator *shim_allocator, size_t size) {
+    struct aws_h1_body_reference_message *message = shim_allocator->impl;
+    return aws_mem_acquire(message->alloc, size);
+}
+
+static void s_body_reference_message_mem_release(struct aws_allocator *shim_allocator, void *ptr) {
+    struct aws_h1_body_reference_message *message = shim_allocator->impl;
+    if (ptr != &message->base) {
+        aws_mem_release(message->alloc, ptr);
+        return;
+    }
+
+    aws_input_stream_release(message->body);
+    aws_mem_release(message->alloc, message);
+}
+
+/* Send a piece of body straight from the body stream's memory, without copying it into a pooled message */
+static int s_send_body_reference(
+    struct aws_h1_connection *connection,
+    struct aws_byte_cursor data,
+    struct aws_input_stream *body) {
+
+    struct aws_h1_body_reference_message *message =
+        aws_mem_calloc(connection->base.alloc, 1, sizeof(struct aws_h1_body_reference_message));
+    message->alloc = connection->base.alloc;
+    message->body = aws_input_stream_acquire(body);
+    message->shim_allocator.mem_acquire = s_body_reference_message_mem_acquire;
+    message->shim_allocator.mem_release = s_body_reference_message_mem_release;
+    message->shim_allocator.impl = message;
+
+    message->base.allocator = &message->shim_allocator;
+    message->base.message_type = AWS_IO_MESSAGE_APPLICATION_DATA;
+    message->base.message_data = aws_byte_buf_from_array(data.ptr, data.len);
+    message->base.on_completion = s_on_channel_write_complete;
+    message->base.user_data = connection;
+
+    AWS_LOGF_TRACE(
+        AWS_LS_HTTP_CONNECTION,
+        "id=%p: Outgoing stream task is sending %zu bytes of body by reference.",
+        (void *)&connection->base,
+        data.len);
+
+    if (aws_channel_slot_send_message(connection->base.channel_slot, &message->base, AWS_CHANNEL_DIR_WRITE)) {
+        AWS_LOGF_ERROR(
+            AWS_LS_HTTP_CONNECTION,
+            "id=%p: Failed to send message in write direction, error %d (%s). Closing connection.",
+            (void *)&connection->base,
+            aws_last_error(),
+            aws_error_name(aws_last_error()));
+
+        aws_mem_release(message->base.allocator, &message->base);
+        return AWS_OP_ERR;
+    }
+
+    return AWS_OP_SUCCESS;
+}
+
 /* Do the actual work of the outgoing-stream-task */
 static void s_write_outgoing_stream(struct aws_h1_connection *connection, bool first_try) {
     AWS_PRECONDITION(aws_channel_thread_is_callers_thread(connection->base.channel_slot->channel));
@@ -888,6 +957,18 @@ static void s_write_outgoing_stream(struct aws_h1_connection *connection, bool f
         AWS_LOGF_TRACE(AWS_LS_HTTP_CONNECTION, "id=%p: Outgoing stream task has begun.", (void *)&connection->base);
     }
 
+    /* Large in-memory bodies skip the pooled message, and its copy */
+    struct aws_byte_cursor body_data;
+    struct aws_input_stream *body = NULL;
+    if (aws_h1_encoder_take_body_reference(
+            &connection->thread_data.encoder, BODY_REFERENCE_MAX_MESSAGE_SIZE, &body_data, &body)) {
+
+        if (s_send_body_reference(connection, body_data, body)) {
+            s_shutdown_due_to_error(connection, aws_last_error());
+        }
+        return;
+    }
+
     struct aws_io_message *msg = aws_channel_slot_acquire_max_message_for_write(connection->base.channel_slot);
     if (!msg) {
         AWS_LOGF_ERROR(
@@ -930,11 +1011,25 @@ static void s_write_outgoing_stream(struct aws_h1_connection *connection, bool f
             goto error;
         }
 
+    } else if (
+        outgoing_stream->base.wait_for_body_ready &&
+        aws_h1_encoder_is_message_in_progress(&connection->thread_data.encoder)) {
+        /* Body isn't ready, so body streaming function has no data to write yet.
+         * End the task. It starts again when the user calls aws_http_stream_notify_body_ready() */
+        AWS_LOGF_TRACE(
+            AWS_LS_HTTP_CONNECTION,
+            "id=%p: Current outgoing stream %p sent no data, waiting for its body to be ready.",
+            (void *)&connection->base,
+            (void *)&outgoing_stream->base);
+
+        aws_mem_release(msg->allocator, msg);
+        connection->thread_data.is_outgoing_stream_task_active = false;
+
     } else {
         /* If message is empty, warn that no work is being done
          * and reschedule the task to try again next tick.
          * It's likely that body isn't ready, so body streaming function has no data to write yet.
-         * If this scenario turns out to be common we should implement a "pause" feature. */
+         * Streams created with `wait_for_body_ready` avoid this polling. */
         AWS_LOGF_WARN(
             AWS_LS_HTTP_CONNECTION,
             "id=%p: Current outgoing stream %p sent no data, will try again next tick.",
@@ -1069,14 +1164,21 @@ static int s_decoder_on_header(const struct aws_h1_decoded_header *header, void
         }
     }
 
+    if (header_block == AWS_HTTP_HEADER_BLOCK_MAIN &&
+        (header->name == AWS_HTTP_HEADER_CONTENT_ENCODING || header->name == AWS_HTTP_HEADER_TRANSFER_ENCODING)) {
+        aws_http_stream_on_incoming_coding_header(
+            &incoming_stream->base,
+            header->value_data,
+            header->name == AWS_HTTP_HEADER_TRANSFER_ENCODING /*is_transfer_encoding*/);
+    }
+
     if (incoming_stream->base.on_incoming_headers) {
         struct aws_http_header deliver = {
             .name = header->name_data,
             .value = header->value_data,
         };
 
-        int err = incoming_stream->base.on_incoming_headers(
-            &incoming_stream->base, header_block, &deliver, 1, incoming_stream->base.user_data);
+        int err = aws_http_stream_on_incoming_header(&incoming_stream->base, header_block, &deliver);
 
         if (err) {
             AWS_LOGF_ERROR(
@@ -1093,6 +1195,22 @@ static int s_decoder_on_header(const struct aws_h1_decoded_header *header, void
     return AWS_OP_SUCCESS;
 }
 
+/* Deliver headers collected for a user who asked for the whole block in one callback */
+static int s_flush_incoming_headers(struct aws_h1_stream *incoming_stream, enum aws_http_header_block header_block) {
+    if (aws_http_stream_flush_incoming_headers(&incoming_stream->base, header_block)) {
+        AWS_LOGF_ERROR(
+            AWS_LS_HTTP_STREAM,
+            "id=%p: Incoming header callback raised error %d (%s).",
+            (void *)&incoming_stream->base,
+            aws_last_error(),
+            aws_error_name(aws_last_error()));
+
+        return AWS_OP_ERR;
+    }
+
+    return AWS_OP_SUCCESS;
+}
+
 static int s_mark_head_done(struct aws_h1_stream *incoming_stream) {
     /* Bail out if we've already done this */
     if (incoming_stream->is_incoming_head_done) {
@@ -1105,6 +1223,10 @@ static int s_mark_head_done(struct aws_h1_stream *incoming_stream) {
     enum aws_http_header_block header_block =
         aws_h1_decoder_get_header_block(connection->thread_data.incoming_stream_decoder);
 
+    if (s_flush_incoming_headers(incoming_stream, header_block)) {
+        return AWS_OP_ERR;
+    }
+
     if (header_block == AWS_HTTP_HEADER_BLOCK_MAIN) {
         AWS_LOGF_TRACE(AWS_LS_HTTP_STREAM, "id=%p: Main header block done.", (void *)&incoming_stream->base);
         incoming_stream->is_incoming_head_done = true;
@@ -1180,18 +1302,16 @@ static int s_decoder_on_body(const struct aws_byte_cursor *data, bool finished,
         }
     }
 
-    if (incoming_stream->base.on_incoming_body) {
-        err = incoming_stream->base.on_incoming_body(&incoming_stream->base, data, incoming_stream->base.user_data);
-        if (err) {
-            AWS_LOGF_ERROR(
-                AWS_LS_HTTP_STREAM,
-                "id=%p: Incoming body callback raised error %d (%s).",
-                (void *)&incoming_stream->base,
-                aws_last_error(),
-                aws_error_name(aws_last_error()));
+    err = aws_http_stream_on_incoming_body(&incoming_stream->base, data);
+    if (err) {
+        AWS_LOGF_ERROR(
+            AWS_LS_HTTP_STREAM,
+            "id=%p: Incoming body callback raised error %d (%s).",
+            (void *)&incoming_stream->base,
+            aws_last_error(),
+            aws_error_name(aws_last_error()));
 
-            return AWS_OP_ERR;
-        }
+        return AWS_OP_ERR;
     }
 
     return AWS_OP_SUCCESS;
@@ -1210,10 +1330,27 @@ static int s_decoder_on_done(void *user_data) {
     /* If it is a informational response, we stop here, keep waiting for new response */
     enum aws_http_header_block header_block =
         aws_h1_decoder_get_header_block(connection->thread_data.incoming_stream_decoder);
+
+    /* Trailing headers have no block-done callback, deliver any that were collected now */
+    if (s_flush_incoming_headers(incoming_stream, header_block)) {
+        return AWS_OP_ERR;
+    }
     if (header_block == AWS_HTTP_HEADER_BLOCK_INFORMATIONAL) {
         return AWS_OP_SUCCESS;
     }
 
+    /* A compressed body must not end early */
+    if (aws_http_stream_on_incoming_body_done(&incoming_stream->base)) {
+        AWS_LOGF_ERROR(
+            AWS_LS_HTTP_STREAM,
+            "id=%p: Incoming body could not be decompressed, error %d (%s).",
+            (void *)&incoming_stream->base,
+            aws_last_error(),
+            aws_error_name(aws_last_error()));
+
+        return AWS_OP_ERR;
+    }
+
     /* Otherwise the incoming stream is finished decoding and we will update it if needed */
     incoming_stream->is_incoming_message_done = true;
 
@@ -1316,6 +1453,8 @@ static struct aws_h1_connection *s_connection_new(
     }
 
     aws_h1_encoder_init(&connection->thread_data.encoder, alloc);
+    connection->thread_data.encoder.send_body_by_reference = true;
+    aws_h1_chunk_pool_init(&connection->chunk_pool, alloc);
 
     aws_channel_task_init(
         &connection->outgoing_stream_task, s_outgoing_stream_task, connection, "http1_connection_outgoing_stream");
@@ -1326,6 +1465,7 @@ static struct aws_h1_connection *s_connection_new(
         "http1_connection_cross_thread_work");
     aws_linked_list_init(&connection->thread_data.stream_list);
     aws_linked_list_init(&connection->thread_data.read_buffer.messages);
+    aws_linked_list_init(&connection->thread_data.read_buffer.retained_messages);
     aws_crt_statistics_http1_channel_init(&connection->thread_data.stats);
 
     int err = aws_mutex_init(&connection->synced_data.lock);
@@ -1348,6 +1488,7 @@ static struct aws_h1_connection *s_connection_new(
         .user_data = connection,
         .vtable = s_h1_decoder_vtable,
         .scratch_space_initial_size = DECODER_INITIAL_SCRATCH_SIZE,
+        .retain_input = true, /* see read_buffer.retained_messages */
     };
     connection->thread_data.incoming_stream_decoder = aws_h1_decoder_new(&options);
     if (!connection->thread_data.incoming_stream_decoder) {
@@ -1404,6 +1545,32 @@ struct aws_http_connection *aws_http_connection_new_http1_1_client(
     return &connection->base;
 }
 
+/* Release fully-processed messages that were kept alive because the decoder referenced their data */
+static void s_release_retained_read_messages(struct aws_h1_connection *connection) {
+    while (!aws_linked_list_empty(&connection->thread_data.read_buffer.retained_messages)) {
+        struct aws_linked_list_node *node =
+            aws_linked_list_pop_front(&connection->thread_data.read_buffer.retained_messages);
+        struct aws_io_message *msg = AWS_CONTAINER_OF(node, struct aws_io_message, queueing_handle);
+        aws_mem_release(msg->allocator, msg);
+    }
+    connection->thread_data.read_buffer.num_retained_messages = 0;
+}
+
+/* Keep a fully-processed message alive because the decoder references its data.
+ * The decoder only references the most recent few inputs, so older retained messages can be released. */
+static void s_retain_read_message(struct aws_h1_connection *connection, struct aws_io_message *msg) {
+    aws_linked_list_push_back(&connection->thread_data.read_buffer.retained_messages, &msg->queueing_handle);
+    connection->thread_data.read_buffer.num_retained_messages++;
+
+    while (connection->thread_data.read_buffer.num_retained_messages > AWS_H1_DECODER_MAX_REFERENCED_INPUTS) {
+        struct aws_linked_list_node *node =
+            aws_linked_list_pop_front(&connection->thread_data.read_buffer.retained_messages);
+        struct aws_io_message *oldest = AWS_CONTAINER_OF(node, struct aws_io_message, queueing_handle);
+        aws_mem_release(oldest->allocator, oldest);
+        connection->thread_data.read_buffer.num_retained_messages--;
+    }
+}
+
 static void s_handler_destroy(struct aws_channel_handler *handler) {
     struct aws_h1_connection *connection = handler->impl;
 
@@ -1418,9 +1585,11 @@ static void s_handler_destroy(struct aws_channel_handler *handler) {
         struct aws_io_message *msg = AWS_CONTAINER_OF(node, struct aws_io_message, queueing_handle);
         aws_mem_release(msg->allocator, msg);
     }
+    s_release_retained_read_messages(connection);
 
     aws_h1_decoder_destroy(connection->thread_data.incoming_stream_decoder);
     aws_h1_encoder_clean_up(&connection->thread_data.encoder);
+    aws_h1_chunk_pool_clean_up(&connection->chunk_pool);
     aws_mutex_clean_up(&connection->synced_data.lock);
     aws_mem_release(connection->base.alloc, connection);
 }
@@ -1795,10 +1964,22 @@ static int s_try_process_next_stream_read_message(struct aws_h1_connection *conn
         queued_msg->message_data.len - queued_msg->copy_mark);
 
     /* If the last of queued_msg has been processed, it can be deleted now.
-     * Otherwise, it remains in the queue for further processing later. */
+     * Otherwise, it remains in the queue for further processing later.
+     * If the decoder still references its data (a line continues into the next message),
+     * keep it alive until the decoder is done with it. */
+    const bool is_decoder_referencing_input =
+        aws_h1_decoder_is_referencing_input(connection->thread_data.incoming_stream_decoder);
+    if (!is_decoder_referencing_input) {
+        s_release_retained_read_messages(connection);
+    }
+
     if (queued_msg->copy_mark == queued_msg->message_data.len) {
         aws_linked_list_remove(&queued_msg->queueing_handle);
-        aws_mem_release(queued_msg->allocator, queued_msg);
+        if (is_decoder_referencing_input) {
+            s_retain_read_message(connection, queued_msg);
+        } else {
+            aws_mem_release(queued_msg->allocator, queued_msg);
+        }
     }
 
     return AWS_OP_SUCCESS;
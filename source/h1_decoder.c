@@ -3,12 +3,19 @@
  * SPDX-License-Identifier: Apache-2.0.
  */
 
+#include <aws/common/math.h>
 #include <aws/common/string.h>
 #include <aws/http/private/h1_decoder.h>
 #include <aws/http/private/strutil.h>
 #include <aws/http/status_code.h>
 #include <aws/io/logging.h>
 
+/* SSE2 is part of the x86-64 baseline, so no runtime CPU check is required to use it */
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#    define AWS_H1_DECODER_SSE2
+#    include <emmintrin.h>
+#endif
+
 AWS_STATIC_STRING_FROM_LITERAL(s_transfer_coding_chunked, "chunked");
 AWS_STATIC_STRING_FROM_LITERAL(s_transfer_coding_compress, "compress");
 AWS_STATIC_STRING_FROM_LITERAL(s_transfer_coding_x_compress, "x-compress");
@@ -24,12 +31,40 @@ AWS_STATIC_STRING_FROM_LITERAL(s_transfer_coding_x_gzip, "x-gzip");
 typedef int(state_fn)(struct aws_h1_decoder *decoder, struct aws_byte_cursor *input);
 typedef int(linestate_fn)(struct aws_h1_decoder *decoder, struct aws_byte_cursor input);
 
+/* Sentinel for a delimiter that was not found in the current line */
+#define AWS_H1_DELIM_NOT_FOUND SIZE_MAX
+
+/* Offsets of the delimiters in the current line, recorded while scanning for CRLF,
+ * so that line states don't need to split the line again byte by byte.
+ * Offsets are relative to the start of the line (which may be stored in the scratch_space). */
+struct aws_h1_line_delims {
+    /* Offset of the first ':' */
+    size_t colon;
+    /* Offsets of the first few ' '. Start-lines need 2, the 3rd lets us detect too many spaces. */
+    size_t spaces[3];
+    size_t num_spaces;
+};
+
 struct aws_h1_decoder {
     /* Implementation data. */
     struct aws_allocator *alloc;
     struct aws_byte_buf scratch_space;
+
+    /* If `retain_input` is set, a partial line is tracked as cursors into previous inputs,
+     * instead of being copied into the scratch_space. The line is only made contiguous
+     * if it actually spans multiple inputs when its CRLF is found.
+     * Data in the scratch_space always precedes data in these segments. */
+    struct {
+        struct aws_byte_cursor segments[AWS_H1_DECODER_MAX_REFERENCED_INPUTS];
+        size_t num_segments;
+        size_t len;
+    } pending_line;
+    bool retain_input;
+    struct aws_h1_decoder_stats stats;
+
     state_fn *run_state;
     linestate_fn *process_line;
+    struct aws_h1_line_delims line_delims;
     int transfer_encoding;
     uint64_t content_processed;
     uint64_t content_length;
@@ -53,36 +88,126 @@ static int s_linestate_response(struct aws_h1_decoder *decoder, struct aws_byte_
 static int s_linestate_header(struct aws_h1_decoder *decoder, struct aws_byte_cursor input);
 static int s_linestate_chunk_size(struct aws_h1_decoder *decoder, struct aws_byte_cursor input);
 
+/* True for each octet that s_scan_for_crlf() needs to look at */
+static const bool s_line_delim_table[256] = {
+    ['\n'] = true,
+    [':'] = true,
+    [' '] = true,
+};
+
+/* Length of the current line's data from previous inputs */
+static size_t s_line_prefix_len(const struct aws_h1_decoder *decoder) {
+    return decoder->scratch_space.len + decoder->pending_line.len;
+}
+
+/* Last character of the current line's data from previous inputs, or 0 if there is none */
+static uint8_t s_line_prefix_last_char(const struct aws_h1_decoder *decoder) {
+    if (decoder->pending_line.num_segments > 0) {
+        const struct aws_byte_cursor *last = &decoder->pending_line.segments[decoder->pending_line.num_segments - 1];
+        return last->ptr[last->len - 1];
+    }
+
+    if (decoder->scratch_space.len > 0) {
+        return decoder->scratch_space.buffer[decoder->scratch_space.len - 1];
+    }
+
+    return 0;
+}
+
+/* Process one delimiter found by s_scan_for_crlf(). Returns true if it's the "\n" of a CRLF. */
+static bool s_scan_process_delim(
+    struct aws_h1_decoder *decoder,
+    struct aws_byte_cursor input,
+    const uint8_t *delim,
+    size_t *bytes_processed) {
+
+    struct aws_h1_line_delims *delims = &decoder->line_delims;
+
+    /* Offsets are relative to the start of the line, which may begin in previous input */
+    const size_t offset = s_line_prefix_len(decoder) + (size_t)(delim - input.ptr);
+
+    switch (*delim) {
+        case '\n': {
+            uint8_t prev_char;
+            if (delim == input.ptr) {
+                /* If "\n" is first character check previous input for previous character */
+                prev_char = s_line_prefix_last_char(decoder);
+            } else {
+                prev_char = *(delim - 1);
+            }
+
+            if (prev_char == '\r') {
+                *bytes_processed = 1 + (size_t)(delim - input.ptr);
+                return true;
+            }
+        } break;
+
+        case ':':
+            if (delims->colon == AWS_H1_DELIM_NOT_FOUND) {
+                delims->colon = offset;
+            }
+            break;
+
+        case ' ':
+            if (delims->num_spaces < AWS_ARRAY_SIZE(delims->spaces)) {
+                delims->spaces[delims->num_spaces++] = offset;
+            }
+            break;
+
+        default:
+            break;
+    }
+
+    return false;
+}
+
+/* Scan for the CRLF ending the current line.
+ * In the same pass, record offsets of the ':' and ' ' delimiters needed by the line states. */
 static bool s_scan_for_crlf(struct aws_h1_decoder *decoder, struct aws_byte_cursor input, size_t *bytes_processed) {
     AWS_ASSERT(input.len > 0);
 
-    /* In a loop, scan for "\n", then look one char back for "\r" */
-    uint8_t *ptr = input.ptr;
-    uint8_t *end = input.ptr + input.len;
-    while (ptr != end) {
-        uint8_t *newline = (uint8_t *)memchr(ptr, '\n', end - ptr);
-        if (!newline) {
-            break;
+    const uint8_t *ptr = input.ptr;
+    const uint8_t *end = input.ptr + input.len;
+
+#ifdef AWS_H1_DECODER_SSE2
+    /* Compare 16 bytes at a time against each delimiter, then visit only the bytes that matched.
+     * Once the delimiters a line state could need have been found, stop looking for them. */
+    const __m128i newline_vec = _mm_set1_epi8('\n');
+    const __m128i colon_vec = _mm_set1_epi8(':');
+    const __m128i space_vec = _mm_set1_epi8(' ');
+    const struct aws_h1_line_delims *delims = &decoder->line_delims;
+
+    while (end - ptr >= 16) {
+        const __m128i block = _mm_loadu_si128((const __m128i *)ptr);
+
+        uint32_t matches = (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(block, newline_vec));
+        if (delims->colon == AWS_H1_DELIM_NOT_FOUND) {
+            matches |= (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(block, colon_vec));
+        }
+        if (delims->num_spaces < AWS_ARRAY_SIZE(delims->spaces)) {
+            matches |= (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(block, space_vec));
         }
 
-        uint8_t prev_char;
-        if (newline == input.ptr) {
-            /* If "\n" is first character check scratch_space for previous character */
-            if (decoder->scratch_space.len > 0) {
-                prev_char = decoder->scratch_space.buffer[decoder->scratch_space.len - 1];
-            } else {
-                prev_char = 0;
+        while (matches) {
+            const uint8_t *delim = ptr + aws_ctz_u32(matches);
+            matches &= matches - 1; /* clear lowest set bit */
+
+            if (s_scan_process_delim(decoder, input, delim, bytes_processed)) {
+                return true;
             }
-        } else {
-            prev_char = *(newline - 1);
         }
 
-        if (prev_char == '\r') {
-            *bytes_processed = 1 + (newline - input.ptr);
-            return true;
-        }
+        ptr += 16;
+    }
+#endif /* AWS_H1_DECODER_SSE2 */
 
-        ptr = newline + 1;
+    /* Scalar fallback, also handles the tail that's too short for a full SIMD block */
+    for (; ptr != end; ++ptr) {
+        if (s_line_delim_table[*ptr]) {
+            if (s_scan_process_delim(decoder, input, ptr, bytes_processed)) {
+                return true;
+            }
+        }
     }
 
     *bytes_processed = input.len;
@@ -91,6 +216,7 @@ static bool s_scan_for_crlf(struct aws_h1_decoder *decoder, struct aws_byte_curs
 
 static int s_cat(struct aws_h1_decoder *decoder, struct aws_byte_cursor to_append) {
     struct aws_byte_buf *buffer = &decoder->scratch_space;
+    decoder->stats.scratch_bytes_copied += to_append.len;
     int op = AWS_OP_ERR;
     if (buffer->buffer != NULL) {
         if ((aws_byte_buf_append(buffer, &to_append) == AWS_OP_SUCCESS)) {
@@ -126,36 +252,78 @@ static int s_cat(struct aws_h1_decoder *decoder, struct aws_byte_cursor to_appen
     return op;
 }
 
+/* Copy segments of the pending line into the scratch_space */
+static int s_consolidate_pending_line(struct aws_h1_decoder *decoder) {
+    for (size_t i = 0; i < decoder->pending_line.num_segments; ++i) {
+        if (s_cat(decoder, decoder->pending_line.segments[i])) {
+            return AWS_OP_ERR;
+        }
+    }
+
+    decoder->pending_line.num_segments = 0;
+    decoder->pending_line.len = 0;
+    return AWS_OP_SUCCESS;
+}
+
+/* Stash the start of a line that didn't find its CRLF before the end of input */
+static int s_save_partial_line(struct aws_h1_decoder *decoder, struct aws_byte_cursor partial) {
+    if (!decoder->retain_input) {
+        return s_cat(decoder, partial);
+    }
+
+    /* Rather than copy, hold a cursor to the input (which the user promises will stay valid) */
+    if (decoder->pending_line.num_segments == AWS_H1_DECODER_MAX_REFERENCED_INPUTS) {
+        if (s_consolidate_pending_line(decoder)) {
+            return AWS_OP_ERR;
+        }
+    }
+
+    decoder->pending_line.segments[decoder->pending_line.num_segments++] = partial;
+    decoder->pending_line.len += partial.len;
+    return AWS_OP_SUCCESS;
+}
+
 /* This state consumes an entire line, then calls a linestate_fn to process the line. */
 static int s_state_getline(struct aws_h1_decoder *decoder, struct aws_byte_cursor *input) {
     /* If preceding runs of this state failed to find CRLF, their data is stored in the scratch_space
-     * and new data needs to be combined with the old data for processing. */
-    bool has_prev_data = decoder->scratch_space.len;
+     * (or referenced by pending_line segments) and new data needs to be combined with the old data for processing. */
+    const size_t prev_data_len = s_line_prefix_len(decoder);
 
     size_t line_length = 0;
     bool found_crlf = s_scan_for_crlf(decoder, *input, &line_length);
 
-    /* Found end of line! Run the line processor on it */
     struct aws_byte_cursor line = aws_byte_cursor_advance(input, line_length);
 
-    bool use_scratch = !found_crlf | has_prev_data;
-    if (AWS_UNLIKELY(use_scratch)) {
-        int err = s_cat(decoder, line);
-        if (err) {
-            AWS_LOGF_ERROR(
-                AWS_LS_HTTP_STREAM,
-                "id=%p: Internal buffer write failed with error code %d (%s)",
-                decoder->logging_id,
-                aws_last_error(),
-                aws_error_name(aws_last_error()));
-
-            return AWS_OP_ERR;
+    int err = AWS_OP_SUCCESS;
+    if (AWS_UNLIKELY(!found_crlf)) {
+        /* Didn't find crlf, we'll continue scanning when more data comes in */
+        err = s_save_partial_line(decoder, line);
+
+    } else if (AWS_UNLIKELY(prev_data_len > 0)) {
+        /* The line spans multiple inputs, it must be made contiguous before it can be processed */
+        decoder->stats.split_lines++;
+        if (aws_byte_buf_reserve(&decoder->scratch_space, prev_data_len + line.len) ||
+            s_consolidate_pending_line(decoder) || s_cat(decoder, line)) {
+            err = AWS_OP_ERR;
+        } else {
+            /* Line is actually the entire scratch buffer now */
+            line = aws_byte_cursor_from_buf(&decoder->scratch_space);
         }
-        /* Line is actually the entire scratch buffer now */
-        line = aws_byte_cursor_from_buf(&decoder->scratch_space);
+    }
+
+    if (err) {
+        AWS_LOGF_ERROR(
+            AWS_LS_HTTP_STREAM,
+            "id=%p: Internal buffer write failed with error code %d (%s)",
+            decoder->logging_id,
+            aws_last_error(),
+            aws_error_name(aws_last_error()));
+
+        return AWS_OP_ERR;
     }
 
     if (AWS_LIKELY(found_crlf)) {
+        /* Found end of line! Run the line processor on it */
         /* Backup so "\r\n" is not included. */
         /* RFC-7230 section 3 Message Format */
         AWS_ASSERT(line.len >= 2);
@@ -164,61 +332,25 @@ static int s_state_getline(struct aws_h1_decoder *decoder, struct aws_byte_curso
         return decoder->process_line(decoder, line);
     }
 
-    /* Didn't find crlf, we'll continue scanning when more data comes in */
-    return AWS_OP_SUCCESS;
-}
-
-static int s_cursor_split_impl(
-    struct aws_byte_cursor input,
-    char split_on,
-    struct aws_byte_cursor *cursor_array,
-    size_t num_cursors,
-    bool error_if_more_splits_possible) {
-
-    struct aws_byte_cursor split;
-    AWS_ZERO_STRUCT(split);
-    for (size_t i = 0; i < num_cursors; ++i) {
-        if (!aws_byte_cursor_next_split(&input, split_on, &split)) {
-            return aws_raise_error(AWS_ERROR_HTTP_PROTOCOL_ERROR);
-        }
-        cursor_array[i] = split;
-    }
-
-    if (error_if_more_splits_possible) {
-        if (aws_byte_cursor_next_split(&input, split_on, &split)) {
-            return aws_raise_error(AWS_ERROR_HTTP_PROTOCOL_ERROR);
-        }
-    } else {
-        /* Otherwise, the last cursor will contain the remainder of the string */
-        struct aws_byte_cursor *last_cursor = &cursor_array[num_cursors - 1];
-        last_cursor->len = (input.ptr + input.len) - last_cursor->ptr;
-    }
-
     return AWS_OP_SUCCESS;
 }
 
-/* Final cursor contains remainder of input. */
-static int s_cursor_split_first_n_times(
-    struct aws_byte_cursor input,
-    char split_on,
-    struct aws_byte_cursor *cursor_array,
-    size_t num_cursors) {
-
-    return s_cursor_split_impl(input, split_on, cursor_array, num_cursors, false);
+/* Return the part of the line between two offsets */
+static struct aws_byte_cursor s_line_slice(struct aws_byte_cursor line, size_t begin, size_t end) {
+    AWS_ASSERT(begin <= end && end <= line.len);
+    return aws_byte_cursor_from_array(line.ptr + begin, end - begin);
 }
 
-/* Error if input could have been split more times */
-static int s_cursor_split_exactly_n_times(
-    struct aws_byte_cursor input,
-    char split_on,
-    struct aws_byte_cursor *cursor_array,
-    size_t num_cursors) {
-
-    return s_cursor_split_impl(input, split_on, cursor_array, num_cursors, true);
+static void s_reset_line_delims(struct aws_h1_decoder *decoder) {
+    decoder->line_delims.colon = AWS_H1_DELIM_NOT_FOUND;
+    decoder->line_delims.num_spaces = 0;
 }
 
 static void s_set_state(struct aws_h1_decoder *decoder, state_fn *state) {
     decoder->scratch_space.len = 0;
+    decoder->pending_line.num_segments = 0;
+    decoder->pending_line.len = 0;
+    s_reset_line_delims(decoder);
     decoder->run_state = state;
     decoder->process_line = NULL;
 }
@@ -416,16 +548,15 @@ static int s_linestate_header(struct aws_h1_decoder *decoder, struct aws_byte_cu
     /* Each header field consists of a case-insensitive field name followed by a colon (":"),
      * optional leading whitespace, the field value, and optional trailing whitespace.
      * RFC-7230 3.2 */
-    struct aws_byte_cursor splits[2];
-    err = s_cursor_split_first_n_times(input, ':', splits, 2); /* value may contain more colons */
-    if (err) {
+    const size_t colon = decoder->line_delims.colon; /* value may contain more colons */
+    if (colon == AWS_H1_DELIM_NOT_FOUND) {
         AWS_LOGF_ERROR(AWS_LS_HTTP_STREAM, "id=%p: Invalid incoming header, missing colon.", decoder->logging_id);
         AWS_LOGF_DEBUG(
             AWS_LS_HTTP_STREAM, "id=%p: Bad header is: '" PRInSTR "'", decoder->logging_id, AWS_BYTE_CURSOR_PRI(input));
         return aws_raise_error(AWS_ERROR_HTTP_PROTOCOL_ERROR);
     }
 
-    struct aws_byte_cursor name = splits[0];
+    struct aws_byte_cursor name = s_line_slice(input, 0, colon);
     if (!aws_strutil_is_http_token(name)) {
         AWS_LOGF_ERROR(AWS_LS_HTTP_STREAM, "id=%p: Invalid incoming header, bad name.", decoder->logging_id);
         AWS_LOGF_DEBUG(
@@ -433,7 +564,7 @@ static int s_linestate_header(struct aws_h1_decoder *decoder, struct aws_byte_cu
         return aws_raise_error(AWS_ERROR_HTTP_PROTOCOL_ERROR);
     }
 
-    struct aws_byte_cursor value = aws_strutil_trim_http_whitespace(splits[1]);
+    struct aws_byte_cursor value = aws_strutil_trim_http_whitespace(s_line_slice(input, colon + 1, input.len));
     if (!aws_strutil_is_http_field_value(value)) {
         AWS_LOGF_ERROR(AWS_LS_HTTP_STREAM, "id=%p: Invalid incoming header, bad value.", decoder->logging_id);
         AWS_LOGF_DEBUG(
@@ -580,9 +711,9 @@ static int s_linestate_header(struct aws_h1_decoder *decoder, struct aws_byte_cu
 }
 
 static int s_linestate_request(struct aws_h1_decoder *decoder, struct aws_byte_cursor input) {
-    struct aws_byte_cursor cursors[3];
-    int err = s_cursor_split_exactly_n_times(input, ' ', cursors, 3); /* extra spaces not allowed */
-    if (err) {
+    /* extra spaces not allowed */
+    const struct aws_h1_line_delims *delims = &decoder->line_delims;
+    if (delims->num_spaces != 2) {
         AWS_LOGF_ERROR(
             AWS_LS_HTTP_STREAM, "id=%p: Incoming request line has wrong number of spaces.", decoder->logging_id);
         AWS_LOGF_DEBUG(
@@ -593,6 +724,12 @@ static int s_linestate_request(struct aws_h1_decoder *decoder, struct aws_byte_c
         return aws_raise_error(AWS_ERROR_HTTP_PROTOCOL_ERROR);
     }
 
+    struct aws_byte_cursor cursors[3] = {
+        s_line_slice(input, 0, delims->spaces[0]),
+        s_line_slice(input, delims->spaces[0] + 1, delims->spaces[1]),
+        s_line_slice(input, delims->spaces[1] + 1, input.len),
+    };
+
     for (size_t i = 0; i < AWS_ARRAY_SIZE(cursors); ++i) {
         if (cursors[i].len == 0) {
             AWS_LOGF_ERROR(AWS_LS_HTTP_STREAM, "id=%p: Incoming request line has empty values.", decoder->logging_id);
@@ -641,7 +778,7 @@ static int s_linestate_request(struct aws_h1_decoder *decoder, struct aws_byte_c
         return aws_raise_error(AWS_ERROR_HTTP_PROTOCOL_ERROR);
     }
 
-    err = decoder->vtable.on_request(aws_http_str_to_method(method), &method, &uri, decoder->user_data);
+    int err = decoder->vtable.on_request(aws_http_str_to_method(method), &method, &uri, decoder->user_data);
     if (err) {
         return AWS_OP_ERR;
     }
@@ -656,9 +793,9 @@ static bool s_check_info_response_status_code(int code_val) {
 }
 
 static int s_linestate_response(struct aws_h1_decoder *decoder, struct aws_byte_cursor input) {
-    struct aws_byte_cursor cursors[3];
-    int err = s_cursor_split_first_n_times(input, ' ', cursors, 3); /* phrase may contain spaces */
-    if (err) {
+    /* phrase may contain spaces */
+    const struct aws_h1_line_delims *delims = &decoder->line_delims;
+    if (delims->num_spaces < 2) {
         AWS_LOGF_ERROR(AWS_LS_HTTP_STREAM, "id=%p: Incoming response status line is invalid.", decoder->logging_id);
         AWS_LOGF_DEBUG(
             AWS_LS_HTTP_STREAM,
@@ -668,9 +805,9 @@ static int s_linestate_response(struct aws_h1_decoder *decoder, struct aws_byte_
         return aws_raise_error(AWS_ERROR_HTTP_PROTOCOL_ERROR);
     }
 
-    struct aws_byte_cursor version = cursors[0];
-    struct aws_byte_cursor code = cursors[1];
-    struct aws_byte_cursor phrase = cursors[2];
+    struct aws_byte_cursor version = s_line_slice(input, 0, delims->spaces[0]);
+    struct aws_byte_cursor code = s_line_slice(input, delims->spaces[0] + 1, delims->spaces[1]);
+    struct aws_byte_cursor phrase = s_line_slice(input, delims->spaces[1] + 1, input.len);
 
     struct aws_byte_cursor version_1_1_expected = aws_http_version_to_str(AWS_HTTP_VERSION_1_1);
     struct aws_byte_cursor version_1_0_expected = aws_http_version_to_str(AWS_HTTP_VERSION_1_0);
@@ -693,7 +830,7 @@ static int s_linestate_response(struct aws_h1_decoder *decoder, struct aws_byte_
 
     /* Status-code is a 3-digit integer. RFC7230 section 3.1.2 */
     uint64_t code_val_u64;
-    err = aws_byte_cursor_utf8_parse_u64(code, &code_val_u64);
+    int err = aws_byte_cursor_utf8_parse_u64(code, &code_val_u64);
     if (err || code.len != 3 || code_val_u64 > 999) {
         AWS_LOGF_ERROR(AWS_LS_HTTP_STREAM, "id=%p: Incoming response has invalid status code.", decoder->logging_id);
         AWS_LOGF_DEBUG(
@@ -736,6 +873,7 @@ struct aws_h1_decoder *aws_h1_decoder_new(struct aws_h1_decoder_params *params)
     decoder->user_data = params->user_data;
     decoder->vtable = params->vtable;
     decoder->is_decoding_requests = params->is_decoding_requests;
+    decoder->retain_input = params->retain_input;
 
     aws_byte_buf_init(&decoder->scratch_space, params->alloc, params->scratch_space_initial_size);
 
@@ -790,6 +928,14 @@ enum aws_http_header_block aws_h1_decoder_get_header_block(const struct aws_h1_d
     return decoder->header_block;
 }
 
+bool aws_h1_decoder_is_referencing_input(const struct aws_h1_decoder *decoder) {
+    return decoder->pending_line.num_segments > 0;
+}
+
+struct aws_h1_decoder_stats aws_h1_decoder_get_stats(const struct aws_h1_decoder *decoder) {
+    return decoder->stats;
+}
+
 void aws_h1_decoder_set_logging_id(struct aws_h1_decoder *decoder, const void *id) {
     decoder->logging_id = id;
 }
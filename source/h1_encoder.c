@@ -3,6 +3,7 @@
  * SPDX-License-Identifier: Apache-2.0.
  */
 #include <aws/http/private/h1_encoder.h>
+#include <aws/http/private/request_template.h>
 #include <aws/http/private/strutil.h>
 #include <aws/http/status_code.h>
 #include <aws/io/logging.h>
@@ -19,23 +20,15 @@
 
 /**
  * Scan headers to detect errors and determine anything we'll need to know later (ex: total length).
+ * Results are added to what's already in `scan`, so headers can be scanned in several batches.
  */
-static int s_scan_outgoing_headers(
-    struct aws_h1_encoder_message *encoder_message,
-    const struct aws_http_message *message,
-    size_t *out_header_lines_len,
-    bool body_headers_ignored,
-    bool body_headers_forbidden) {
-
-    size_t total = 0;
-    bool has_body_stream = aws_http_message_get_body_stream(message);
-    bool has_content_length_header = false;
-    bool has_transfer_encoding_header = false;
+static int s_scan_header_lines(struct aws_h1_header_scan *scan, const struct aws_http_headers *headers) {
+    size_t total = scan->header_lines_len;
 
-    const size_t num_headers = aws_http_message_get_header_count(message);
+    const size_t num_headers = aws_http_headers_count(headers);
     for (size_t i = 0; i < num_headers; ++i) {
         struct aws_http_header header;
-        aws_http_message_get_header(message, &header, i);
+        aws_http_headers_get_index(headers, i, &header);
 
         /* Validate header field-name (RFC-7230 3.2): field-name = token */
         if (!aws_strutil_is_http_token(header.name)) {
@@ -63,18 +56,18 @@ static int s_scan_outgoing_headers(
         switch (name_enum) {
             case AWS_HTTP_HEADER_CONNECTION: {
                 if (aws_byte_cursor_eq_c_str(&field_value, "close")) {
-                    encoder_message->has_connection_close_header = true;
+                    scan->has_connection_close_header = true;
                 }
             } break;
             case AWS_HTTP_HEADER_CONTENT_LENGTH: {
-                has_content_length_header = true;
-                if (aws_byte_cursor_utf8_parse_u64(field_value, &encoder_message->content_length)) {
+                scan->has_content_length_header = true;
+                if (aws_byte_cursor_utf8_parse_u64(field_value, &scan->content_length)) {
                     AWS_LOGF_ERROR(AWS_LS_HTTP_STREAM, "id=static: Invalid Content-Length");
                     return aws_raise_error(AWS_ERROR_HTTP_INVALID_HEADER_VALUE);
                 }
             } break;
             case AWS_HTTP_HEADER_TRANSFER_ENCODING: {
-                has_transfer_encoding_header = true;
+                scan->has_transfer_encoding_header = true;
                 if (0 == field_value.len) {
                     AWS_LOGF_ERROR(AWS_LS_HTTP_STREAM, "id=static: Transfer-Encoding must include a valid value");
                     return aws_raise_error(AWS_ERROR_HTTP_INVALID_HEADER_VALUE);
@@ -90,13 +83,13 @@ static int s_scan_outgoing_headers(
                             "comma delimited header value");
                         return aws_raise_error(AWS_ERROR_HTTP_INVALID_HEADER_VALUE);
                     }
-                    if (encoder_message->has_chunked_encoding_header) {
+                    if (scan->has_chunked_encoding_header) {
                         AWS_LOGF_ERROR(
                             AWS_LS_HTTP_STREAM, "id=static: Transfer-Encoding header must end with \"chunked\"");
                         return aws_raise_error(AWS_ERROR_HTTP_INVALID_HEADER_VALUE);
                     }
                     if (aws_byte_cursor_eq_c_str(&trimmed, "chunked")) {
-                        encoder_message->has_chunked_encoding_header = true;
+                        scan->has_chunked_encoding_header = true;
                     }
                 }
             } break;
@@ -114,14 +107,46 @@ static int s_scan_outgoing_headers(
         }
     }
 
-    if (!encoder_message->has_chunked_encoding_header && has_transfer_encoding_header) {
+    scan->header_lines_len = total;
+    return AWS_OP_SUCCESS;
+}
+
+/**
+ * Scan a message's headers, picking up from `template_scan` if the message was made from a request template.
+ * Then check that the headers make sense as a whole.
+ */
+static int s_scan_outgoing_headers(
+    struct aws_h1_encoder_message *encoder_message,
+    const struct aws_http_message *message,
+    const struct aws_h1_header_scan *template_scan,
+    size_t *out_header_lines_len,
+    bool body_headers_ignored,
+    bool body_headers_forbidden) {
+
+    struct aws_h1_header_scan scan;
+    if (template_scan) {
+        scan = *template_scan;
+    } else {
+        AWS_ZERO_STRUCT(scan);
+    }
+
+    if (s_scan_header_lines(&scan, aws_http_message_get_const_headers(message))) {
+        return AWS_OP_ERR;
+    }
+
+    bool has_body_stream = aws_http_message_get_body_stream(message);
+    encoder_message->content_length = scan.content_length;
+    encoder_message->has_chunked_encoding_header = scan.has_chunked_encoding_header;
+    encoder_message->has_connection_close_header = scan.has_connection_close_header;
+
+    if (!encoder_message->has_chunked_encoding_header && scan.has_transfer_encoding_header) {
         AWS_LOGF_ERROR(AWS_LS_HTTP_STREAM, "id=static: Transfer-Encoding header must include \"chunked\"");
         return aws_raise_error(AWS_ERROR_HTTP_INVALID_HEADER_VALUE);
     }
 
     /* Per RFC 7230: A sender MUST NOT send a Content-Length header field in any message that contains a
      * Transfer-Encoding header field. */
-    if (encoder_message->has_chunked_encoding_header && has_content_length_header) {
+    if (encoder_message->has_chunked_encoding_header && scan.has_content_length_header) {
         AWS_LOGF_ERROR(
             AWS_LS_HTTP_STREAM, "id=static: Both Content-Length and Transfer-Encoding are set. Only one may be used");
         return aws_raise_error(AWS_ERROR_HTTP_INVALID_HEADER_VALUE);
@@ -135,7 +160,7 @@ static int s_scan_outgoing_headers(
         return aws_raise_error(AWS_ERROR_HTTP_INVALID_BODY_STREAM);
     }
 
-    if (body_headers_forbidden && (encoder_message->content_length > 0 || has_transfer_encoding_header)) {
+    if (body_headers_forbidden && (encoder_message->content_length > 0 || scan.has_transfer_encoding_header)) {
         AWS_LOGF_ERROR(
             AWS_LS_HTTP_STREAM,
             "id=static: Transfer-Encoding or Content-Length headers may not be present in such a message");
@@ -152,7 +177,7 @@ static int s_scan_outgoing_headers(
         return aws_raise_error(AWS_ERROR_HTTP_MISSING_BODY_STREAM);
     }
 
-    *out_header_lines_len = total;
+    *out_header_lines_len = scan.header_lines_len;
     return AWS_OP_SUCCESS;
 }
 
@@ -246,6 +271,27 @@ static void s_write_headers(struct aws_byte_buf *dst, const struct aws_http_head
     (void)wrote_all;
 }
 
+int aws_h1_encoder_encode_template_header_lines(
+    struct aws_allocator *allocator,
+    const struct aws_http_headers *headers,
+    struct aws_h1_header_scan *out_scan,
+    struct aws_byte_buf *out_lines) {
+
+    AWS_ZERO_STRUCT(*out_scan);
+    AWS_ZERO_STRUCT(*out_lines);
+    if (s_scan_header_lines(out_scan, headers)) {
+        return AWS_OP_ERR;
+    }
+
+    if (aws_byte_buf_init(out_lines, allocator, out_scan->header_lines_len)) {
+        return AWS_OP_ERR;
+    }
+
+    s_write_headers(out_lines, headers);
+    AWS_ASSERT(out_lines->len == out_scan->header_lines_len);
+    return AWS_OP_SUCCESS;
+}
+
 int aws_h1_encoder_message_init_from_request(
     struct aws_h1_encoder_message *message,
     struct aws_allocator *allocator,
@@ -292,9 +338,21 @@ int aws_h1_encoder_message_init_from_request(
      * Calculate total size needed for outgoing_head_buffer, then write to buffer.
      */
 
+    /* If the request was made from a template, the template's headers were already validated and written out.
+     * Only the request's own headers need that done now */
+    const struct aws_http_request_template *request_template = aws_http_message_get_request_template(request);
+    if (request_template && request_template->version != AWS_HTTP_VERSION_1_1) {
+        request_template = NULL;
+    }
+
     size_t header_lines_len;
     err = s_scan_outgoing_headers(
-        message, request, &header_lines_len, false /*body_headers_ignored*/, false /*body_headers_forbidden*/);
+        message,
+        request,
+        request_template ? &request_template->h1_scan : NULL,
+        &header_lines_len,
+        false /*body_headers_ignored*/,
+        false /*body_headers_forbidden*/);
     if (err) {
         goto error;
     }
@@ -329,6 +387,10 @@ int aws_h1_encoder_message_init_from_request(
     wrote_all &= aws_byte_buf_write_from_whole_cursor(&message->outgoing_head_buf, version);
     wrote_all &= s_write_crlf(&message->outgoing_head_buf);
 
+    if (request_template) {
+        wrote_all &=
+            aws_byte_buf_write_from_whole_buffer(&message->outgoing_head_buf, request_template->encoded_headers);
+    }
     s_write_headers(&message->outgoing_head_buf, aws_http_message_get_const_headers(request));
 
     wrote_all &= s_write_crlf(&message->outgoing_head_buf);
@@ -382,7 +444,8 @@ int aws_h1_encoder_message_init_from_response(
      */
     body_headers_ignored |= status_int == AWS_HTTP_STATUS_CODE_304_NOT_MODIFIED;
     bool body_headers_forbidden = status_int == AWS_HTTP_STATUS_CODE_204_NO_CONTENT || status_int / 100 == 1;
-    err = s_scan_outgoing_headers(message, response, &header_lines_len, body_headers_ignored, body_headers_forbidden);
+    err = s_scan_outgoing_headers(
+        message, response, NULL /*template_scan*/, &header_lines_len, body_headers_ignored, body_headers_forbidden);
     if (err) {
         goto error;
     }
@@ -537,32 +600,133 @@ void aws_h1_trailer_destroy(struct aws_h1_trailer *trailer) {
     aws_mem_release(trailer->allocator, trailer);
 }
 
-struct aws_h1_chunk *aws_h1_chunk_new(struct aws_allocator *allocator, const struct aws_http1_chunk_options *options) {
-    /* Allocate chunk along with storage for the chunk-line */
-    struct aws_h1_chunk *chunk;
-    size_t chunk_line_size = s_calculate_chunk_line_size(options);
-    void *chunk_line_storage;
-    if (!aws_mem_acquire_many(
-            allocator, 2, &chunk, sizeof(struct aws_h1_chunk), &chunk_line_storage, chunk_line_size)) {
-        return NULL;
-    }
+static void s_chunk_init(
+    struct aws_h1_chunk *chunk,
+    struct aws_allocator *allocator,
+    const struct aws_http1_chunk_options *options,
+    uint8_t *chunk_line_storage,
+    size_t chunk_line_size) {
 
     chunk->allocator = allocator;
     chunk->data = aws_input_stream_acquire(options->chunk_data);
     chunk->data_size = options->chunk_data_size;
     chunk->on_complete = options->on_complete;
     chunk->user_data = options->user_data;
+    chunk->pool = NULL;
     chunk->chunk_line = aws_byte_buf_from_empty_array(chunk_line_storage, chunk_line_size);
     s_populate_chunk_line_buffer(&chunk->chunk_line, options);
+}
+
+struct aws_h1_chunk *aws_h1_chunk_new(struct aws_allocator *allocator, const struct aws_http1_chunk_options *options) {
+    /* Chunk-line is stored inline if it fits, otherwise allocate chunk along with storage for the chunk-line */
+    struct aws_h1_chunk *chunk;
+    size_t chunk_line_size = s_calculate_chunk_line_size(options);
+    void *chunk_line_storage;
+    if (chunk_line_size <= AWS_H1_CHUNK_LINE_INLINE_SIZE) {
+        chunk = aws_mem_acquire(allocator, sizeof(struct aws_h1_chunk));
+        if (!chunk) {
+            return NULL;
+        }
+        chunk_line_storage = chunk->chunk_line_storage;
+    } else if (!aws_mem_acquire_many(
+                   allocator, 2, &chunk, sizeof(struct aws_h1_chunk), &chunk_line_storage, chunk_line_size)) {
+        return NULL;
+    }
+
+    s_chunk_init(chunk, allocator, options, chunk_line_storage, chunk_line_size);
     return chunk;
 }
 
 void aws_h1_chunk_destroy(struct aws_h1_chunk *chunk) {
     AWS_PRECONDITION(chunk);
     aws_input_stream_release(chunk->data);
+    chunk->data = NULL;
+
+    struct aws_h1_chunk_pool *pool = chunk->pool;
+    if (pool && pool->num_returned < AWS_H1_CHUNK_POOL_MAX_SIZE) {
+        aws_linked_list_push_back(&pool->returned, &chunk->node);
+        pool->num_returned++;
+        return;
+    }
+
+    aws_mem_release(chunk->allocator, chunk);
+}
+
+void aws_h1_chunk_pool_init(struct aws_h1_chunk_pool *pool, struct aws_allocator *allocator) {
+    AWS_ZERO_STRUCT(*pool);
+    pool->allocator = allocator;
+    aws_linked_list_init(&pool->available);
+    aws_linked_list_init(&pool->returned);
+}
+
+static void s_free_chunk_list(struct aws_linked_list *list) {
+    while (!aws_linked_list_empty(list)) {
+        struct aws_linked_list_node *node = aws_linked_list_pop_front(list);
+        struct aws_h1_chunk *chunk = AWS_CONTAINER_OF(node, struct aws_h1_chunk, node);
+        aws_mem_release(chunk->allocator, chunk);
+    }
+}
+
+void aws_h1_chunk_pool_clean_up(struct aws_h1_chunk_pool *pool) {
+    s_free_chunk_list(&pool->available);
+    s_free_chunk_list(&pool->returned);
+    AWS_ZERO_STRUCT(*pool);
+}
+
+struct aws_h1_chunk *aws_h1_chunk_pool_acquire(
+    struct aws_h1_chunk_pool *pool,
+    const struct aws_http1_chunk_options *options) {
+
+    size_t chunk_line_size = s_calculate_chunk_line_size(options);
+    if (chunk_line_size > AWS_H1_CHUNK_LINE_INLINE_SIZE) {
+        /* Chunk-line needs its own storage, this chunk can't be pooled */
+        return aws_h1_chunk_new(pool->allocator, options);
+    }
+
+    struct aws_h1_chunk *chunk;
+    if (aws_linked_list_empty(&pool->available)) {
+        chunk = aws_mem_acquire(pool->allocator, sizeof(struct aws_h1_chunk));
+        if (!chunk) {
+            return NULL;
+        }
+    } else {
+        struct aws_linked_list_node *node = aws_linked_list_pop_front(&pool->available);
+        pool->num_available--;
+        chunk = AWS_CONTAINER_OF(node, struct aws_h1_chunk, node);
+    }
+
+    s_chunk_init(chunk, pool->allocator, options, chunk->chunk_line_storage, chunk_line_size);
+    chunk->pool = pool;
+    return chunk;
+}
+
+void aws_h1_chunk_pool_put_back(struct aws_h1_chunk_pool *pool, struct aws_h1_chunk *chunk) {
+    aws_input_stream_release(chunk->data);
+    chunk->data = NULL;
+
+    if (chunk->pool == pool && pool->num_available < AWS_H1_CHUNK_POOL_MAX_SIZE) {
+        aws_linked_list_push_back(&pool->available, &chunk->node);
+        pool->num_available++;
+        return;
+    }
+
     aws_mem_release(chunk->allocator, chunk);
 }
 
+void aws_h1_chunk_pool_reclaim(struct aws_h1_chunk_pool *pool) {
+    while (!aws_linked_list_empty(&pool->returned)) {
+        struct aws_linked_list_node *node = aws_linked_list_pop_front(&pool->returned);
+        if (pool->num_available < AWS_H1_CHUNK_POOL_MAX_SIZE) {
+            aws_linked_list_push_back(&pool->available, node);
+            pool->num_available++;
+        } else {
+            struct aws_h1_chunk *chunk = AWS_CONTAINER_OF(node, struct aws_h1_chunk, node);
+            aws_mem_release(chunk->allocator, chunk);
+        }
+    }
+    pool->num_returned = 0;
+}
+
 void aws_h1_chunk_complete_and_destroy(
     struct aws_h1_chunk *chunk,
     struct aws_http_stream *http_stream,
@@ -742,8 +906,32 @@ static int s_state_fn_head(struct aws_h1_encoder *encoder, struct aws_byte_buf *
     }
 }
 
+/* If the unchunked body is to be sent by reference, get the portion of its memory that hasn't been sent.
+ * Returns false if the body isn't memory-backed, or if its size doesn't match the declared length
+ * (the stream-reading path is left to report that error). */
+static bool s_get_unsent_body_memory(struct aws_h1_encoder *encoder, struct aws_byte_cursor *out_unsent) {
+    if (!encoder->send_body_by_reference || encoder->state != AWS_H1_ENCODER_STATE_UNCHUNKED_BODY) {
+        return false;
+    }
+
+    if (!aws_http_body_stream_get_unread_memory(encoder->message->body, out_unsent)) {
+        return false;
+    }
+
+    const uint64_t remaining = encoder->message->content_length - encoder->progress_bytes;
+    return out_unsent->len > 0 && out_unsent->len <= remaining;
+}
+
 /* Write out body (not using chunked encoding). */
 static int s_state_fn_unchunked_body(struct aws_h1_encoder *encoder, struct aws_byte_buf *dst) {
+    struct aws_byte_cursor unsent;
+    if (s_get_unsent_body_memory(encoder, &unsent) && unsent.len > dst->capacity - dst->len) {
+        /* Too big to finish in this buffer. Remain in this state until body is taken via
+         * aws_h1_encoder_take_body_reference(), which sends it without copying */
+        ENCODER_LOG(TRACE, encoder, "Waiting for body to be sent by reference.");
+        return AWS_OP_SUCCESS;
+    }
+
     bool done;
     if (s_encode_stream(encoder, dst, encoder->message->body, encoder->message->content_length, &done)) {
         return AWS_OP_ERR;
@@ -905,6 +1093,43 @@ int aws_h1_encoder_process(struct aws_h1_encoder *encoder, struct aws_byte_buf *
     return AWS_OP_SUCCESS;
 }
 
+bool aws_h1_encoder_take_body_reference(
+    struct aws_h1_encoder *encoder,
+    size_t max_size,
+    struct aws_byte_cursor *out_data,
+    struct aws_input_stream **out_body) {
+
+    AWS_PRECONDITION(encoder);
+    AWS_PRECONDITION(out_data);
+    AWS_PRECONDITION(out_body);
+
+    struct aws_byte_cursor unsent;
+    if (!s_get_unsent_body_memory(encoder, &unsent)) {
+        return false;
+    }
+
+    *out_data = aws_byte_cursor_advance(&unsent, aws_min_size(unsent.len, max_size));
+    *out_body = encoder->message->body;
+    aws_http_body_stream_skip_memory(encoder->message->body, out_data->len);
+    encoder->progress_bytes += out_data->len;
+
+    ENCODER_LOGF(
+        TRACE,
+        encoder,
+        "Sending %zu bytes of body by reference, progress: %" PRIu64 "/%" PRIu64,
+        out_data->len,
+        encoder->progress_bytes,
+        encoder->message->content_length);
+
+    if (encoder->progress_bytes == encoder->message->content_length) {
+        /* Message is done. Finish it now, rather than on the next aws_h1_encoder_process() */
+        s_switch_state(encoder, AWS_H1_ENCODER_STATE_DONE);
+        s_state_fn_done(encoder, NULL);
+    }
+
+    return true;
+}
+
 bool aws_h1_encoder_is_message_in_progress(const struct aws_h1_encoder *encoder) {
     return encoder->message;
 }
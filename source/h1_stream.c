@@ -61,19 +61,26 @@ static void s_stream_cross_thread_work_task(struct aws_channel_task *task, void
     bool found_chunks = !aws_linked_list_empty(&stream->synced_data.pending_chunk_list);
     aws_linked_list_move_all_back(&stream->thread_data.pending_chunk_list, &stream->synced_data.pending_chunk_list);
 
+    /* Chunks finished since the last task ran can be reused by the next write */
+    aws_h1_chunk_pool_reclaim(&connection->chunk_pool);
+
     stream->encoder_message.trailer = stream->synced_data.pending_trailer;
     stream->synced_data.pending_trailer = NULL;
 
     bool has_outgoing_response = stream->synced_data.has_outgoing_response;
 
+    bool is_body_ready = stream->synced_data.is_body_ready;
+    stream->synced_data.is_body_ready = false;
+
     uint64_t pending_window_update = stream->synced_data.pending_window_update;
     stream->synced_data.pending_window_update = 0;
 
     s_stream_unlock_synced_data(stream);
     /* END CRITICAL SECTION */
 
-    /* If we have any new outgoing data, prompt the connection to try and send it. */
-    bool new_outgoing_data = found_chunks;
+    /* If we have any new outgoing data, prompt the connection to try and send it.
+     * If the connection is waiting on this stream's body, that wakes it up. */
+    bool new_outgoing_data = found_chunks || is_body_ready;
 
     /* If we JUST learned about having an outgoing response, that's a reason to try sending data */
     if (has_outgoing_response && !stream->thread_data.has_outgoing_response) {
@@ -140,28 +147,70 @@ static void s_stream_update_window(struct aws_http_stream *stream_base, size_t i
     }
 }
 
-static int s_stream_write_chunk(struct aws_http_stream *stream_base, const struct aws_http1_chunk_options *options) {
+/* Note that the body is ready in synced_data, and schedule the cross_thread_work_task if necessary */
+static void s_stream_notify_body_ready(struct aws_http_stream *stream_base) {
+    struct aws_h1_stream *stream = AWS_CONTAINER_OF(stream_base, struct aws_h1_stream, base);
+    bool should_schedule_task = false;
+
+    { /* BEGIN CRITICAL SECTION */
+        s_stream_lock_synced_data(stream);
+
+        /* Don't alert the connection unless the stream is active */
+        if (stream->synced_data.api_state == AWS_H1_STREAM_API_STATE_ACTIVE) {
+            stream->synced_data.is_body_ready = true;
+            if (!stream->synced_data.is_cross_thread_work_task_scheduled) {
+                stream->synced_data.is_cross_thread_work_task_scheduled = true;
+                should_schedule_task = true;
+            }
+        }
+
+        s_stream_unlock_synced_data(stream);
+    } /* END CRITICAL SECTION */
+
+    if (should_schedule_task) {
+        /* Keep stream alive until task completes */
+        aws_atomic_fetch_add(&stream->base.refcount, 1);
+        AWS_LOGF_TRACE(AWS_LS_HTTP_STREAM, "id=%p: Scheduling stream cross-thread work task.", (void *)stream_base);
+        aws_channel_schedule_task_now(
+            stream->base.owning_connection->channel_slot->channel, &stream->cross_thread_work_task);
+    }
+}
+
+static int s_stream_write_chunks(
+    struct aws_http_stream *stream_base,
+    const struct aws_http1_chunk_options *options_array,
+    size_t num_chunks) {
+
     AWS_PRECONDITION(stream_base);
-    AWS_PRECONDITION(options);
+    AWS_PRECONDITION(options_array || num_chunks == 0);
     struct aws_h1_stream *stream = AWS_CONTAINER_OF(stream_base, struct aws_h1_stream, base);
+    struct aws_h1_connection *connection = s_get_h1_connection(stream);
 
-    if (options->chunk_data == NULL && options->chunk_data_size > 0) {
-        AWS_LOGF_ERROR(
-            AWS_LS_HTTP_STREAM, "id=%p: Chunk data cannot be NULL if data size is non-zero", (void *)stream_base);
-        return aws_raise_error(AWS_ERROR_INVALID_ARGUMENT);
+    uint64_t total_data_size = 0;
+    for (size_t i = 0; i < num_chunks; ++i) {
+        const struct aws_http1_chunk_options *options = &options_array[i];
+        if (options->chunk_data == NULL && options->chunk_data_size > 0) {
+            AWS_LOGF_ERROR(
+                AWS_LS_HTTP_STREAM, "id=%p: Chunk data cannot be NULL if data size is non-zero", (void *)stream_base);
+            return aws_raise_error(AWS_ERROR_INVALID_ARGUMENT);
+        }
+
+        if (options->chunk_data_size == 0 && i + 1 < num_chunks) {
+            AWS_LOGF_ERROR(
+                AWS_LS_HTTP_STREAM, "id=%p: Only the last chunk written may be the final chunk.", (void *)stream_base);
+            return aws_raise_error(AWS_ERROR_INVALID_ARGUMENT);
+        }
+
+        total_data_size = aws_add_u64_saturating(total_data_size, options->chunk_data_size);
     }
 
-    struct aws_h1_chunk *chunk = aws_h1_chunk_new(stream_base->alloc, options);
-    if (AWS_UNLIKELY(NULL == chunk)) {
-        AWS_LOGF_ERROR(
-            AWS_LS_HTTP_STREAM,
-            "id=%p: Failed to initialize streamed chunk, error %d (%s).",
-            (void *)stream_base,
-            aws_last_error(),
-            aws_error_name(aws_last_error()));
-        return AWS_OP_ERR;
+    if (num_chunks == 0) {
+        return AWS_OP_SUCCESS;
     }
 
+    struct aws_linked_list new_chunks;
+    aws_linked_list_init(&new_chunks);
+
     int error_code = 0;
     bool should_schedule_task = false;
 
@@ -194,11 +243,34 @@ static int s_stream_write_chunk(struct aws_http_stream *stream_base, const struc
             goto unlock;
         }
 
+        /* The pool is guarded by the same lock, so every chunk is acquired without locking again */
+        for (size_t i = 0; i < num_chunks; ++i) {
+            struct aws_h1_chunk *chunk = aws_h1_chunk_pool_acquire(&connection->chunk_pool, &options_array[i]);
+            if (AWS_UNLIKELY(NULL == chunk)) {
+                error_code = aws_last_error();
+                AWS_LOGF_ERROR(
+                    AWS_LS_HTTP_STREAM,
+                    "id=%p: Failed to initialize streamed chunk, error %d (%s).",
+                    (void *)stream_base,
+                    error_code,
+                    aws_error_name(error_code));
+
+                /* All or nothing, undo the chunks acquired so far */
+                while (!aws_linked_list_empty(&new_chunks)) {
+                    struct aws_linked_list_node *node = aws_linked_list_pop_back(&new_chunks);
+                    struct aws_h1_chunk *acquired = AWS_CONTAINER_OF(node, struct aws_h1_chunk, node);
+                    aws_h1_chunk_pool_put_back(&connection->chunk_pool, acquired);
+                }
+                goto unlock;
+            }
+            aws_linked_list_push_back(&new_chunks, &chunk->node);
+        }
+
         /* success */
-        if (chunk->data_size == 0) {
+        if (options_array[num_chunks - 1].chunk_data_size == 0) {
             stream->synced_data.has_final_chunk = true;
         }
-        aws_linked_list_push_back(&stream->synced_data.pending_chunk_list, &chunk->node);
+        aws_linked_list_move_all_back(&stream->synced_data.pending_chunk_list, &new_chunks);
         should_schedule_task = !stream->synced_data.is_cross_thread_work_task_scheduled;
         stream->synced_data.is_cross_thread_work_task_scheduled = true;
 
@@ -214,15 +286,15 @@ static int s_stream_write_chunk(struct aws_http_stream *stream_base, const struc
             error_code,
             aws_error_name(error_code));
 
-        aws_h1_chunk_destroy(chunk);
         return aws_raise_error(error_code);
     }
 
     AWS_LOGF_TRACE(
         AWS_LS_HTTP_STREAM,
-        "id=%p: Adding chunk with size %" PRIu64 " to stream",
+        "id=%p: Adding %zu chunks with total size %" PRIu64 " to stream",
         (void *)stream,
-        options->chunk_data_size);
+        num_chunks,
+        total_data_size);
 
     if (should_schedule_task) {
         /* Keep stream alive until task completes */
@@ -238,6 +310,11 @@ static int s_stream_write_chunk(struct aws_http_stream *stream_base, const struc
     return AWS_OP_SUCCESS;
 }
 
+static int s_stream_write_chunk(struct aws_http_stream *stream_base, const struct aws_http1_chunk_options *options) {
+    AWS_PRECONDITION(options);
+    return s_stream_write_chunks(stream_base, options, 1);
+}
+
 static int s_stream_add_trailer(struct aws_http_stream *stream_base, const struct aws_http_headers *trailing_headers) {
     AWS_PRECONDITION(stream_base);
     AWS_PRECONDITION(trailing_headers);
@@ -328,8 +405,10 @@ static int s_stream_add_trailer(struct aws_http_stream *stream_base, const struc
 static const struct aws_http_stream_vtable s_stream_vtable = {
     .destroy = s_stream_destroy,
     .update_window = s_stream_update_window,
+    .notify_body_ready = s_stream_notify_body_ready,
     .activate = aws_h1_stream_activate,
     .http1_write_chunk = s_stream_write_chunk,
+    .http1_write_chunks = s_stream_write_chunks,
     .http1_add_trailer = s_stream_add_trailer,
     .http2_reset_stream = NULL,
     .http2_get_received_error_code = NULL,
@@ -0,0 +1,114 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/http/private/h2_closed_streams.h>
+
+#include <aws/common/math.h>
+
+AWS_STATIC_ASSERT(AWS_H2_STREAM_CLOSED_WHEN_RST_STREAM_SENT <= 3);
+
+/* 2 bits per entry */
+#define ENTRIES_PER_WORD 32
+#define ENTRY_MASK ((uint64_t)3)
+
+/* There are only 2^30 ids per initiator */
+static const size_t s_max_window_size = (size_t)1 << 30;
+
+int aws_h2_closed_streams_init(
+    struct aws_h2_closed_streams *closed_streams,
+    struct aws_allocator *allocator,
+    size_t max_closed_streams) {
+
+    AWS_PRECONDITION(closed_streams);
+    AWS_PRECONDITION(allocator);
+
+    AWS_ZERO_STRUCT(*closed_streams);
+    closed_streams->allocator = allocator;
+
+    size_t window_size = aws_min_size(aws_max_size(max_closed_streams, ENTRIES_PER_WORD), s_max_window_size);
+    if (aws_round_up_to_power_of_two(window_size, &window_size)) {
+        return AWS_OP_ERR;
+    }
+    closed_streams->window_size = window_size;
+
+    /* One allocation for both windows */
+    size_t words_per_window = window_size / ENTRIES_PER_WORD;
+    uint64_t *words = aws_mem_calloc(allocator, words_per_window * 2, sizeof(uint64_t));
+    if (!words) {
+        return AWS_OP_ERR;
+    }
+    closed_streams->windows[0].words = words;
+    closed_streams->windows[1].words = words + words_per_window;
+    return AWS_OP_SUCCESS;
+}
+
+void aws_h2_closed_streams_clean_up(struct aws_h2_closed_streams *closed_streams) {
+    AWS_PRECONDITION(closed_streams);
+
+    if (closed_streams->windows[0].words) {
+        aws_mem_release(closed_streams->allocator, closed_streams->windows[0].words);
+    }
+    AWS_ZERO_STRUCT(*closed_streams);
+}
+
+static void s_set_entry(
+    const struct aws_h2_closed_streams *closed_streams,
+    struct aws_h2_closed_streams_window *window,
+    uint32_t index,
+    enum aws_h2_stream_closed_when closed_when) {
+
+    size_t slot = index & (closed_streams->window_size - 1);
+    uint64_t *word = &window->words[slot / ENTRIES_PER_WORD];
+    unsigned shift = (unsigned)(slot % ENTRIES_PER_WORD) * 2;
+    *word = (*word & ~(ENTRY_MASK << shift)) | ((uint64_t)closed_when << shift);
+}
+
+void aws_h2_closed_streams_record(
+    struct aws_h2_closed_streams *closed_streams,
+    uint32_t stream_id,
+    enum aws_h2_stream_closed_when closed_when) {
+
+    AWS_PRECONDITION(closed_streams);
+    AWS_PRECONDITION(closed_when != AWS_H2_STREAM_CLOSED_UNKNOWN);
+
+    struct aws_h2_closed_streams_window *window = &closed_streams->windows[stream_id & 1];
+    uint32_t index = stream_id >> 1;
+
+    if (index >= window->next_index) {
+        /* Slide forward. Entries for the ids skipped over may be stale from a previous trip around the ring */
+        if (index - window->next_index >= closed_streams->window_size) {
+            size_t words_per_window = closed_streams->window_size / ENTRIES_PER_WORD;
+            memset(window->words, 0, words_per_window * sizeof(uint64_t));
+        } else {
+            for (uint32_t i = window->next_index; i < index; ++i) {
+                s_set_entry(closed_streams, window, i, AWS_H2_STREAM_CLOSED_UNKNOWN);
+            }
+        }
+        window->next_index = index + 1;
+
+    } else if (window->next_index - index > closed_streams->window_size) {
+        /* Too old to remember */
+        return;
+    }
+
+    s_set_entry(closed_streams, window, index, closed_when);
+}
+
+enum aws_h2_stream_closed_when aws_h2_closed_streams_find(
+    const struct aws_h2_closed_streams *closed_streams,
+    uint32_t stream_id) {
+
+    AWS_PRECONDITION(closed_streams);
+
+    const struct aws_h2_closed_streams_window *window = &closed_streams->windows[stream_id & 1];
+    uint32_t index = stream_id >> 1;
+    if (index >= window->next_index || window->next_index - index > closed_streams->window_size) {
+        return AWS_H2_STREAM_CLOSED_UNKNOWN;
+    }
+
+    size_t slot = index & (closed_streams->window_size - 1);
+    unsigned shift = (unsigned)(slot % ENTRIES_PER_WORD) * 2;
+    return (enum aws_h2_stream_closed_when)((window->words[slot / ENTRIES_PER_WORD] >> shift) & ENTRY_MASK);
+}
@@ -53,6 +53,10 @@ static void s_handler_installed(struct aws_channel_handler *handler, struct aws_
 static struct aws_http_stream *s_connection_make_request(
     struct aws_http_connection *client_connection,
     const struct aws_http_make_request_options *options);
+static int s_connection_activate_streams(
+    struct aws_http_connection *client_connection,
+    struct aws_http_stream **streams,
+    size_t count);
 static void s_connection_close(struct aws_http_connection *connection_base);
 static void s_connection_stop_new_request(struct aws_http_connection *connection_base);
 static bool s_connection_is_open(const struct aws_http_connection *connection_base);
@@ -93,11 +97,13 @@ static void s_cross_thread_work_task(struct aws_channel_task *task, void *arg, e
 static void s_outgoing_frames_task(struct aws_channel_task *task, void *arg, enum aws_task_status status);
 static int s_encode_outgoing_frames_queue(struct aws_h2_connection *connection, struct aws_byte_buf *output);
 static int s_encode_data_from_outgoing_streams(struct aws_h2_connection *connection, struct aws_byte_buf *output);
-static int s_record_closed_stream(
+static void s_record_closed_stream(
     struct aws_h2_connection *connection,
     uint32_t stream_id,
     enum aws_h2_stream_closed_when closed_when);
 static void s_stream_complete(struct aws_h2_connection *connection, struct aws_h2_stream *stream, int error_code);
+static struct aws_byte_cursor s_take_incoming_body(struct aws_h2_connection *connection);
+static struct aws_h2err s_flush_incoming_body(struct aws_h2_connection *connection);
 static void s_write_outgoing_frames(struct aws_h2_connection *connection, bool first_try);
 static void s_finish_shutdown(struct aws_h2_connection *connection);
 static void s_send_goaway(
@@ -166,6 +172,7 @@ static struct aws_http_connection_vtable s_h2_connection_vtable = {
 
     .on_channel_handler_installed = s_handler_installed,
     .make_request = s_connection_make_request,
+    .activate_streams = s_connection_activate_streams,
     .new_server_request_handler_stream = NULL,
     .stream_send_response = NULL,
     .close = s_connection_close,
@@ -269,6 +276,9 @@ static void s_stop(
         s_unlock_synced_data(connection);
     } /* END CRITICAL SECTION */
 
+    /* User can't request more SETTINGS, PING, or GOAWAY either */
+    aws_mpsc_queue_close(&connection->cross_thread_work_queue);
+
     if (schedule_shutdown) {
         AWS_LOGF_INFO(
             AWS_LS_HTTP_CONNECTION,
@@ -329,6 +339,9 @@ static struct aws_h2_connection *s_connection_new(
     aws_channel_task_init(
         &connection->outgoing_frames_task, s_outgoing_frames_task, connection, "HTTP/2 outgoing frames");
 
+    aws_atomic_init_int(&connection->is_cross_thread_work_task_scheduled, false);
+    aws_mpsc_queue_init(&connection->cross_thread_work_queue);
+
     /* 1 refcount for user */
     aws_atomic_init_int(&connection->base.refcount, 1);
     uint32_t max_stream_id = AWS_H2_STREAM_ID_MAX;
@@ -336,17 +349,15 @@ static struct aws_h2_connection *s_connection_new(
     connection->synced_data.goaway_received_last_stream_id = max_stream_id + 1;
 
     aws_linked_list_init(&connection->synced_data.pending_stream_list);
-    aws_linked_list_init(&connection->synced_data.pending_frame_list);
-    aws_linked_list_init(&connection->synced_data.pending_settings_list);
-    aws_linked_list_init(&connection->synced_data.pending_ping_list);
-    aws_linked_list_init(&connection->synced_data.pending_goaway_list);
 
-    aws_linked_list_init(&connection->thread_data.outgoing_streams_list);
+    aws_h2_priority_scheduler_init(&connection->thread_data.outgoing_streams);
     aws_linked_list_init(&connection->thread_data.pending_settings_queue);
     aws_linked_list_init(&connection->thread_data.pending_ping_queue);
     aws_linked_list_init(&connection->thread_data.stalled_window_streams_list);
     aws_linked_list_init(&connection->thread_data.waiting_streams_list);
     aws_linked_list_init(&connection->thread_data.outgoing_frames_queue);
+    aws_linked_list_init(&connection->thread_data.pending_window_updates.streams);
+    aws_h2_frame_pool_init(&connection->thread_data.frame_pool, alloc);
 
     if (aws_mutex_init(&connection->synced_data.lock)) {
         CONNECTION_LOGF(
@@ -354,11 +365,10 @@ static struct aws_h2_connection *s_connection_new(
         goto error;
     }
 
-    if (aws_hash_table_init(
-            &connection->thread_data.active_streams_map, alloc, 8, aws_hash_ptr, aws_ptr_eq, NULL, NULL)) {
+    if (aws_h2_stream_table_init(&connection->thread_data.active_streams, alloc, server ? 2 : 1)) {
 
         CONNECTION_LOGF(
-            ERROR, connection, "Hashtable init error %d (%s).", aws_last_error(), aws_error_name(aws_last_error()));
+            ERROR, connection, "Stream table init error %d (%s).", aws_last_error(), aws_error_name(aws_last_error()));
         goto error;
     }
     size_t max_closed_streams = AWS_HTTP2_DEFAULT_MAX_CLOSED_STREAMS;
@@ -366,11 +376,13 @@ static struct aws_h2_connection *s_connection_new(
         max_closed_streams = http2_options->max_closed_streams;
     }
 
-    connection->thread_data.closed_streams =
-        aws_cache_new_fifo(alloc, aws_hash_ptr, aws_ptr_eq, NULL, NULL, max_closed_streams);
-    if (!connection->thread_data.closed_streams) {
+    if (aws_h2_closed_streams_init(&connection->thread_data.closed_streams, alloc, max_closed_streams)) {
         CONNECTION_LOGF(
-            ERROR, connection, "FIFO cache init error %d (%s).", aws_last_error(), aws_error_name(aws_last_error()));
+            ERROR,
+            connection,
+            "Closed streams init error %d (%s).",
+            aws_last_error(),
+            aws_error_name(aws_last_error()));
         goto error;
     }
 
@@ -384,6 +396,18 @@ static struct aws_h2_connection *s_connection_new(
     connection->thread_data.window_size_peer = AWS_H2_INIT_WINDOW_SIZE;
     connection->thread_data.window_size_self = AWS_H2_INIT_WINDOW_SIZE;
 
+    connection->thread_data.window_tuning.enabled =
+        http2_options->window_auto_tuning && !connection->base.stream_manual_window_management;
+    connection->thread_data.window_tuning.initial_window_size = AWS_H2_INIT_WINDOW_SIZE;
+    for (size_t i = 0; i < http2_options->num_initial_settings; ++i) {
+        if (http2_options->initial_settings_array[i].id == AWS_HTTP2_SETTINGS_INITIAL_WINDOW_SIZE) {
+            connection->thread_data.window_tuning.initial_window_size = http2_options->initial_settings_array[i].value;
+        }
+    }
+
+    connection->thread_data.incoming_body.enabled = http2_options->coalesce_incoming_body;
+    aws_byte_buf_init(&connection->thread_data.incoming_body.buffer, alloc, 0);
+
     connection->thread_data.goaway_received_last_stream_id = AWS_H2_STREAM_ID_MAX;
     connection->thread_data.goaway_sent_last_stream_id = AWS_H2_STREAM_ID_MAX;
 
@@ -413,6 +437,11 @@ static struct aws_h2_connection *s_connection_new(
             ERROR, connection, "Encoder init error %d (%s)", aws_last_error(), aws_error_name(aws_last_error()));
         goto error;
     }
+    /* Keep per-request values (dates, signatures, ids) from evicting the ones that get reused */
+    aws_hpack_encoder_set_indexing_policy(
+        &connection->thread_data.encoder.hpack, aws_hpack_indexing_policy_builtin, NULL /*user_data*/);
+    aws_hpack_encoder_set_adaptive_indexing(&connection->thread_data.encoder.hpack, true);
+
     /* User data from connection base is not ready until the handler installed */
     connection->thread_data.init_pending_settings = s_new_pending_settings(
         connection->base.alloc,
@@ -468,17 +497,13 @@ static void s_handler_destroy(struct aws_channel_handler *handler) {
 
     /* No streams should be left in internal datastructures */
     AWS_ASSERT(
-        !aws_hash_table_is_valid(&connection->thread_data.active_streams_map) ||
-        aws_hash_table_get_entry_count(&connection->thread_data.active_streams_map) == 0);
+        !aws_hash_table_is_valid(&connection->thread_data.active_streams.outliers) ||
+        aws_h2_stream_table_count(&connection->thread_data.active_streams) == 0);
 
     AWS_ASSERT(aws_linked_list_empty(&connection->thread_data.waiting_streams_list));
     AWS_ASSERT(aws_linked_list_empty(&connection->thread_data.stalled_window_streams_list));
-    AWS_ASSERT(aws_linked_list_empty(&connection->thread_data.outgoing_streams_list));
+    AWS_ASSERT(aws_h2_priority_scheduler_is_empty(&connection->thread_data.outgoing_streams));
     AWS_ASSERT(aws_linked_list_empty(&connection->synced_data.pending_stream_list));
-    AWS_ASSERT(aws_linked_list_empty(&connection->synced_data.pending_frame_list));
-    AWS_ASSERT(aws_linked_list_empty(&connection->synced_data.pending_settings_list));
-    AWS_ASSERT(aws_linked_list_empty(&connection->synced_data.pending_ping_list));
-    AWS_ASSERT(aws_linked_list_empty(&connection->synced_data.pending_goaway_list));
     AWS_ASSERT(aws_linked_list_empty(&connection->thread_data.pending_ping_queue));
     AWS_ASSERT(aws_linked_list_empty(&connection->thread_data.pending_settings_queue));
 
@@ -489,14 +514,36 @@ static void s_handler_destroy(struct aws_channel_handler *handler) {
         struct aws_h2_frame *frame = AWS_CONTAINER_OF(node, struct aws_h2_frame, node);
         aws_h2_frame_destroy(frame);
     }
+    CONNECTION_LOGF(
+        DEBUG,
+        connection,
+        "Frame pool served %" PRIu64 " allocations from recycled memory and %" PRIu64 " from the allocator",
+        connection->thread_data.frame_pool.stats.recycled_count,
+        connection->thread_data.frame_pool.stats.parent_acquire_count);
+    aws_h2_frame_pool_clean_up(&connection->thread_data.frame_pool);
     if (connection->thread_data.init_pending_settings) {
         /* if initial settings were never sent, we need to clear the memory here */
         aws_mem_release(connection->base.alloc, connection->thread_data.init_pending_settings);
     }
+    aws_byte_buf_clean_up(&connection->thread_data.incoming_body.buffer);
     aws_h2_decoder_destroy(connection->thread_data.decoder);
+
+    struct aws_hpack_encoder_metrics hpack_metrics;
+    aws_hpack_encoder_get_metrics(&connection->thread_data.encoder.hpack, &hpack_metrics);
+    CONNECTION_LOGF(
+        DEBUG,
+        connection,
+        "HPACK encoded %" PRIu64 " header bytes into %" PRIu64 " bytes. Fields indexed: %" PRIu64
+        ", added to dynamic table: %" PRIu64 ", kept out of dynamic table: %" PRIu64 ", evicted: %" PRIu64,
+        hpack_metrics.header_bytes,
+        hpack_metrics.encoded_bytes,
+        hpack_metrics.num_indexed,
+        hpack_metrics.num_inserted,
+        hpack_metrics.num_not_inserted,
+        hpack_metrics.num_evicted);
     aws_h2_frame_encoder_clean_up(&connection->thread_data.encoder);
-    aws_hash_table_clean_up(&connection->thread_data.active_streams_map);
-    aws_cache_destroy(connection->thread_data.closed_streams);
+    aws_h2_stream_table_clean_up(&connection->thread_data.active_streams);
+    aws_h2_closed_streams_clean_up(&connection->thread_data.closed_streams);
     aws_mutex_clean_up(&connection->synced_data.lock);
     aws_mem_release(connection->base.alloc, connection);
 }
@@ -646,22 +693,104 @@ static void s_outgoing_frames_task(struct aws_channel_task *task, void *arg, enu
     s_write_outgoing_frames(connection, false /*first_try*/);
 }
 
+/* Enqueue WINDOW_UPDATE frames for a total increment, which may be more than one frame can carry */
+static int s_enqueue_window_update(struct aws_h2_connection *connection, uint32_t stream_id, uint64_t increment) {
+    while (increment > 0) {
+        uint32_t frame_increment = (uint32_t)aws_min_u64(increment, AWS_H2_WINDOW_UPDATE_MAX);
+        struct aws_h2_frame *window_update_frame = aws_h2_frame_new_window_update(
+            aws_h2_connection_get_frame_allocator(connection), stream_id, frame_increment);
+        if (!window_update_frame) {
+            CONNECTION_LOGF(
+                ERROR,
+                connection,
+                "Failed to create WINDOW_UPDATE frame for id=%" PRIu32 ", error %s",
+                stream_id,
+                aws_error_name(aws_last_error()));
+            return AWS_OP_ERR;
+        }
+        aws_h2_connection_enqueue_outgoing_frame(connection, window_update_frame);
+        increment -= frame_increment;
+    }
+    return AWS_OP_SUCCESS;
+}
+
+/* An automatic increment is held back until it's at least as big as what's left of the window, meaning half the
+ * window has been consumed. The peer always has room to send while it waits, so nothing stalls, and a stream
+ * receiving lots of small DATA frames gets one WINDOW_UPDATE now and then instead of one per frame. */
+static bool s_window_update_is_due(uint64_t increment, bool forced, int64_t window_size_self) {
+    return forced || (int64_t)increment >= window_size_self;
+}
+
+/* Turn the flow-control window increments accumulated since the last write into WINDOW_UPDATE frames */
+static int s_flush_window_updates(struct aws_h2_connection *connection) {
+    struct aws_linked_list *streams = &connection->thread_data.pending_window_updates.streams;
+    struct aws_linked_list_node *node = aws_linked_list_begin(streams);
+    while (node != aws_linked_list_end(streams)) {
+        struct aws_h2_stream *stream = AWS_CONTAINER_OF(node, struct aws_h2_stream, thread_data.window_update_node);
+        node = aws_linked_list_next(node);
+
+        uint64_t increment = stream->thread_data.pending_window_update;
+        if (aws_h2_stream_get_state(stream) == AWS_H2_STREAM_STATE_HALF_CLOSED_REMOTE) {
+            /* Peer won't send anything more on this stream, don't bother */
+            increment = 0;
+        } else if (!s_window_update_is_due(
+                       increment,
+                       stream->thread_data.pending_window_update_forced,
+                       stream->thread_data.window_size_self)) {
+            continue;
+        }
+
+        aws_linked_list_remove(&stream->thread_data.window_update_node);
+        stream->thread_data.pending_window_update = 0;
+        stream->thread_data.pending_window_update_forced = false;
+
+        if (s_enqueue_window_update(connection, stream->base.id, increment)) {
+            return AWS_OP_ERR;
+        }
+        /* Let our peer check this value for overflow, it will detect it for us */
+        stream->thread_data.window_size_self += (int64_t)increment;
+    }
+
+    uint64_t connection_increment = connection->thread_data.pending_window_updates.connection_increment;
+    if (connection_increment > 0 &&
+        s_window_update_is_due(
+            connection_increment,
+            connection->thread_data.pending_window_updates.connection_forced,
+            (int64_t)connection->thread_data.window_size_self)) {
+
+        connection->thread_data.pending_window_updates.connection_increment = 0;
+        connection->thread_data.pending_window_updates.connection_forced = false;
+
+        if (s_enqueue_window_update(connection, 0 /*stream_id*/, connection_increment)) {
+            return AWS_OP_ERR;
+        }
+        connection->thread_data.window_size_self =
+            aws_add_size_saturating(connection->thread_data.window_size_self, (size_t)connection_increment);
+    }
+
+    return AWS_OP_SUCCESS;
+}
+
 static void s_write_outgoing_frames(struct aws_h2_connection *connection, bool first_try) {
     AWS_PRECONDITION(aws_channel_thread_is_callers_thread(connection->base.channel_slot->channel));
     AWS_PRECONDITION(connection->thread_data.is_outgoing_frames_task_active);
 
     struct aws_channel_slot *channel_slot = connection->base.channel_slot;
     struct aws_linked_list *outgoing_frames_queue = &connection->thread_data.outgoing_frames_queue;
-    struct aws_linked_list *outgoing_streams_list = &connection->thread_data.outgoing_streams_list;
 
     if (connection->thread_data.is_writing_stopped) {
         return;
     }
 
+    if (s_flush_window_updates(connection)) {
+        aws_h2_connection_shutdown_due_to_write_err(connection, aws_last_error());
+        return;
+    }
+
     /* Determine whether there's work to do, and end task immediately if there's not.
      * Note that we stop writing DATA frames if the channel is trying to shut down */
     bool has_control_frames = !aws_linked_list_empty(outgoing_frames_queue);
-    bool has_data_frames = !aws_linked_list_empty(outgoing_streams_list);
+    bool has_data_frames = !aws_h2_priority_scheduler_is_empty(&connection->thread_data.outgoing_streams);
     bool may_write_data_frames = (connection->thread_data.window_size_peer > AWS_H2_MIN_WINDOW_SIZE) &&
                                  !connection->thread_data.channel_shutdown_waiting_for_goaway_to_be_written;
     bool will_write = has_control_frames || (has_data_frames && may_write_data_frames);
@@ -713,7 +842,7 @@ static void s_write_outgoing_frames(struct aws_h2_connection *connection, bool f
     }
 
     /* If outgoing_frames_queue emptied, and connection is running normally,
-     * then write as many DATA frames from outgoing_streams_list as possible. */
+     * then write as many DATA frames from outgoing_streams as possible. */
     if (aws_linked_list_empty(outgoing_frames_queue) && may_write_data_frames) {
         if (s_encode_data_from_outgoing_streams(connection, &msg->message_data)) {
             goto error;
@@ -806,12 +935,12 @@ static int s_encode_outgoing_frames_queue(struct aws_h2_connection *connection,
     return AWS_OP_SUCCESS;
 }
 
-/* Write as many DATA frames from outgoing_streams_list as possible. */
+/* Write as many DATA frames from outgoing_streams as possible. */
 static int s_encode_data_from_outgoing_streams(struct aws_h2_connection *connection, struct aws_byte_buf *output) {
 
     AWS_PRECONDITION(aws_channel_thread_is_callers_thread(connection->base.channel_slot->channel));
-    struct aws_linked_list *outgoing_streams_list = &connection->thread_data.outgoing_streams_list;
-    if (aws_linked_list_empty(outgoing_streams_list)) {
+    struct aws_h2_priority_scheduler *outgoing_streams = &connection->thread_data.outgoing_streams;
+    if (aws_h2_priority_scheduler_is_empty(outgoing_streams)) {
         return AWS_OP_SUCCESS;
     }
     struct aws_linked_list *stalled_window_streams_list = &connection->thread_data.stalled_window_streams_list;
@@ -824,10 +953,10 @@ static int s_encode_data_from_outgoing_streams(struct aws_h2_connection *connect
 
     int aws_error_code = 0;
 
-    /* We simply round-robin through streams, instead of using stream priority.
-     * Respecting priority is not required (RFC-7540 5.3), so we're ignoring it for now. This also keeps use safe
+    /* Streams are sent in the order of the priority the user gave them (RFC-9218 urgency and incremental).
+     * We ignore PRIORITY frames from the peer (RFC-7540 5.3 doesn't require respecting them), which also keeps us safe
      * from priority DOS attacks: https://cve.mitre.org/cgi-bin/cvename.cgi?name=CVE-2019-9513 */
-    while (!aws_linked_list_empty(outgoing_streams_list)) {
+    while (!aws_h2_priority_scheduler_is_empty(outgoing_streams)) {
         if (connection->thread_data.window_size_peer <= AWS_H2_MIN_WINDOW_SIZE) {
             CONNECTION_LOGF(
                 DEBUG,
@@ -846,8 +975,9 @@ static int s_encode_data_from_outgoing_streams(struct aws_h2_connection *connect
             goto done;
         }
 
-        struct aws_linked_list_node *node = aws_linked_list_pop_front(outgoing_streams_list);
-        struct aws_h2_stream *stream = AWS_CONTAINER_OF(node, struct aws_h2_stream, node);
+        struct aws_h2_stream *stream = aws_h2_priority_scheduler_pop(outgoing_streams);
+        struct aws_linked_list_node *node = &stream->node;
+        const size_t output_len_before = output->len;
 
         /* Ask stream to encode a data frame.
          * Stream may complete itself as a result of encoding its data,
@@ -871,10 +1001,20 @@ static int s_encode_data_from_outgoing_streams(struct aws_h2_connection *connect
             case AWS_H2_DATA_ENCODE_COMPLETE:
                 break;
             case AWS_H2_DATA_ENCODE_ONGOING:
-                aws_linked_list_push_back(outgoing_streams_list, node);
+                aws_h2_priority_scheduler_put_back(outgoing_streams, stream, output->len - output_len_before);
+                if (output->len == output_len_before) {
+                    /* Stream couldn't fit anything into the message, and it may still be first in line */
+                    goto done;
+                }
                 break;
             case AWS_H2_DATA_ENCODE_ONGOING_BODY_STREAM_STALLED:
-                aws_linked_list_push_back(&stalled_streams_list, node);
+                if (stream->base.wait_for_body_ready) {
+                    /* Stream sleeps until user says body is ready, rather than being polled every tick */
+                    stream->thread_data.waiting_for_body_ready = true;
+                    aws_linked_list_push_back(waiting_streams_list, node);
+                } else {
+                    aws_linked_list_push_back(&stalled_streams_list, node);
+                }
                 break;
             case AWS_H2_DATA_ENCODE_ONGOING_WAITING_FOR_WRITES:
                 stream->thread_data.waiting_for_writes = true;
@@ -895,16 +1035,17 @@ static int s_encode_data_from_outgoing_streams(struct aws_h2_connection *connect
     }
 
 done:
-    /* Return any stalled streams to outgoing_streams_list */
+    /* Return any stalled streams to outgoing_streams */
     while (!aws_linked_list_empty(&stalled_streams_list)) {
-        aws_linked_list_push_back(outgoing_streams_list, aws_linked_list_pop_front(&stalled_streams_list));
+        struct aws_linked_list_node *node = aws_linked_list_pop_front(&stalled_streams_list);
+        aws_h2_priority_scheduler_push(outgoing_streams, AWS_CONTAINER_OF(node, struct aws_h2_stream, node));
     }
 
     if (aws_error_code) {
         return aws_raise_error(aws_error_code);
     }
 
-    if (aws_linked_list_empty(outgoing_streams_list)) {
+    if (aws_h2_priority_scheduler_is_empty(outgoing_streams)) {
         /* transition from something to write -> nothing to write */
         uint64_t now_ns = 0;
         aws_channel_current_clock_time(connection->base.channel_slot->channel, &now_ns);
@@ -943,12 +1084,10 @@ struct aws_h2err s_get_active_stream_for_incoming_frame(
     *out_stream = NULL;
 
     /* Check active streams */
-    struct aws_hash_element *found = NULL;
-    const void *stream_id_key = (void *)(size_t)stream_id;
-    aws_hash_table_find(&connection->thread_data.active_streams_map, stream_id_key, &found);
+    struct aws_h2_stream *found = aws_h2_stream_table_find(&connection->thread_data.active_streams, stream_id);
     if (found) {
         /* Found it! return */
-        *out_stream = found->value;
+        *out_stream = found;
         return AWS_H2ERR_SUCCESS;
     }
 
@@ -982,17 +1121,14 @@ struct aws_h2err s_get_active_stream_for_incoming_frame(
         return AWS_H2ERR_SUCCESS;
     }
 
-    void *cached_value = NULL;
     /* Stream is closed, check whether it's legal for a few more frames to trickle in */
-    if (aws_cache_find(connection->thread_data.closed_streams, stream_id_key, &cached_value)) {
-        return aws_h2err_from_last_error();
-    }
-    if (cached_value) {
+    enum aws_h2_stream_closed_when closed_when =
+        aws_h2_closed_streams_find(&connection->thread_data.closed_streams, stream_id);
+    if (closed_when != AWS_H2_STREAM_CLOSED_UNKNOWN) {
         if (frame_type == AWS_H2_FRAME_T_PRIORITY) {
             /* If we support PRIORITY, do something here. Right now just ignore it */
             return AWS_H2ERR_SUCCESS;
         }
-        enum aws_h2_stream_closed_when closed_when = (enum aws_h2_stream_closed_when)(size_t)cached_value;
         switch (closed_when) {
             case AWS_H2_STREAM_CLOSED_WHEN_BOTH_SIDES_END_STREAM:
                 /* WINDOW_UPDATE or RST_STREAM frames can be received ... for a short period after
@@ -1027,8 +1163,8 @@ struct aws_h2err s_get_active_stream_for_incoming_frame(
                     "Illegal to receive %s frame on stream id=%" PRIu32 " after RST_STREAM has been received",
                     aws_h2_frame_type_to_str(frame_type),
                     stream_id);
-                struct aws_h2_frame *rst_stream =
-                    aws_h2_frame_new_rst_stream(connection->base.alloc, stream_id, AWS_HTTP2_ERR_STREAM_CLOSED);
+                struct aws_h2_frame *rst_stream = aws_h2_frame_new_rst_stream(
+                    aws_h2_connection_get_frame_allocator(connection), stream_id, AWS_HTTP2_ERR_STREAM_CLOSED);
                 if (!rst_stream) {
                     CONNECTION_LOGF(
                         ERROR, connection, "Error creating RST_STREAM frame, %s", aws_error_name(aws_last_error()));
@@ -1060,12 +1196,12 @@ struct aws_h2err s_get_active_stream_for_incoming_frame(
         return AWS_H2ERR_SUCCESS;
     }
 
-    /* Stream closed (purged from closed_streams, or implicitly closed when its ID was skipped) */
+    /* Stream closed (too long ago to remember, or implicitly closed when its ID was skipped) */
     CONNECTION_LOGF(
         ERROR,
         connection,
         "Illegal to receive %s frame on stream id=%" PRIu32
-        ", no memory of closed stream (ID skipped, or removed from cache)",
+        ", no memory of closed stream (ID skipped, or closed too long ago)",
         aws_h2_frame_type_to_str(frame_type),
         stream_id);
 
@@ -1090,6 +1226,12 @@ struct aws_h2err s_decoder_on_headers_begin(uint32_t stream_id, void *userdata)
     }
 
     if (stream) {
+        /* Body comes before trailing headers */
+        err = s_flush_incoming_body(connection);
+        if (aws_h2err_failed(err)) {
+            return err;
+        }
+
         err = aws_h2_stream_on_decoder_headers_begin(stream);
         if (aws_h2err_failed(err)) {
             return err;
@@ -1186,19 +1328,133 @@ struct aws_h2err s_decoder_on_push_promise(uint32_t stream_id, uint32_t promised
     return AWS_H2ERR_SUCCESS;
 }
 
-static int s_connection_send_update_window(struct aws_h2_connection *connection, uint32_t window_size) {
-    struct aws_h2_frame *connection_window_update_frame =
-        aws_h2_frame_new_window_update(connection->base.alloc, 0, window_size);
-    if (!connection_window_update_frame) {
-        CONNECTION_LOGF(
-            ERROR,
-            connection,
-            "WINDOW_UPDATE frame on connection failed to be sent, error %s",
-            aws_error_name(aws_last_error()));
+struct aws_allocator *aws_h2_connection_get_frame_allocator(struct aws_h2_connection *connection) {
+    AWS_PRECONDITION(aws_channel_thread_is_callers_thread(connection->base.channel_slot->channel));
+    return &connection->thread_data.frame_pool.allocator;
+}
+
+static void s_connection_add_window_update(struct aws_h2_connection *connection, uint32_t increment_size, bool forced) {
+    connection->thread_data.pending_window_updates.connection_increment += increment_size;
+    connection->thread_data.pending_window_updates.connection_forced |= forced;
+}
+
+void aws_h2_connection_add_stream_window_update(
+    struct aws_h2_connection *connection,
+    struct aws_h2_stream *stream,
+    uint32_t increment_size,
+    bool forced) {
+
+    AWS_PRECONDITION(aws_channel_thread_is_callers_thread(connection->base.channel_slot->channel));
+
+    stream->thread_data.pending_window_update += increment_size;
+    stream->thread_data.pending_window_update_forced |= forced;
+    if (!stream->thread_data.window_update_node.next) {
+        aws_linked_list_push_back(
+            &connection->thread_data.pending_window_updates.streams, &stream->thread_data.window_update_node);
+    }
+}
+
+static void s_on_window_tuning_ping_complete(
+    struct aws_http_connection *connection_base,
+    uint64_t round_trip_time_ns,
+    int error_code,
+    void *user_data) {
+
+    (void)user_data;
+    struct aws_h2_connection *connection = AWS_CONTAINER_OF(connection_base, struct aws_h2_connection, base);
+    connection->thread_data.window_tuning.ping_in_flight = false;
+    if (error_code || !connection->thread_data.window_tuning.enabled) {
+        return;
+    }
+
+    uint64_t bdp = connection->thread_data.window_tuning.bytes_since_ping;
+    uint32_t window_size = connection->thread_data.window_tuning.initial_window_size;
+
+    /* If much less than a window's worth arrived, something other than the window is limiting throughput */
+    if (bdp * 3 < (uint64_t)window_size * 2) {
+        return;
+    }
+
+    /* Only grow if bandwidth went up. If growing the window last time didn't help, the window isn't the bottleneck */
+    double bandwidth = (double)bdp / (double)aws_max_u64(round_trip_time_ns, 1);
+    if (bandwidth <= connection->thread_data.window_tuning.max_bandwidth) {
+        return;
+    }
+    connection->thread_data.window_tuning.max_bandwidth = bandwidth;
+
+    uint32_t new_window_size = (uint32_t)aws_min_u64(bdp * 2, AWS_H2_WINDOW_UPDATE_MAX);
+    if (new_window_size <= window_size) {
+        return;
+    }
+
+    /* Peer will apply the change to all open streams, and we apply it when SETTINGS is ACKed */
+    struct aws_http2_setting setting = {.id = AWS_HTTP2_SETTINGS_INITIAL_WINDOW_SIZE, .value = new_window_size};
+    struct aws_h2_pending_settings *pending_settings =
+        s_new_pending_settings(connection->base.alloc, &setting, 1, NULL /*on_completed*/, NULL /*user_data*/);
+    if (!pending_settings) {
+        goto error;
+    }
+    struct aws_h2_frame *settings_frame =
+        aws_h2_frame_new_settings(aws_h2_connection_get_frame_allocator(connection), &setting, 1, false /*ACK*/);
+    if (!settings_frame) {
+        aws_mem_release(connection->base.alloc, pending_settings);
+        goto error;
+    }
+    aws_linked_list_push_back(&connection->thread_data.pending_settings_queue, &pending_settings->node);
+    aws_h2_connection_enqueue_outgoing_frame(connection, settings_frame);
+
+    CONNECTION_LOGF(
+        DEBUG,
+        connection,
+        "Growing initial stream window from %" PRIu32 " to %" PRIu32 ", after receiving %" PRIu64
+        " bytes in %" PRIu64 "ns round trip",
+        window_size,
+        new_window_size,
+        bdp,
+        round_trip_time_ns);
+    connection->thread_data.window_tuning.initial_window_size = new_window_size;
+    if (new_window_size == AWS_H2_WINDOW_UPDATE_MAX) {
+        /* Can't grow any further, stop sending PINGs */
+        connection->thread_data.window_tuning.enabled = false;
+    }
+    return;
+
+error:
+    CONNECTION_LOGF(
+        ERROR, connection, "Failed to grow initial stream window, error %s", aws_error_name(aws_last_error()));
+}
+
+/* Count DATA towards the bandwidth-delay product estimate, and start a new measurement if none is in progress */
+static int s_window_tuning_on_data(struct aws_h2_connection *connection, uint32_t payload_len) {
+    if (!connection->thread_data.window_tuning.enabled || connection->thread_data.is_writing_stopped) {
+        return AWS_OP_SUCCESS;
+    }
+
+    if (connection->thread_data.window_tuning.ping_in_flight) {
+        connection->thread_data.window_tuning.bytes_since_ping += payload_len;
+        return AWS_OP_SUCCESS;
+    }
+
+    uint64_t time_stamp;
+    if (aws_high_res_clock_get_ticks(&time_stamp)) {
+        return AWS_OP_ERR;
+    }
+    struct aws_h2_pending_ping *pending_ping = s_new_pending_ping(
+        connection->base.alloc, NULL /*optional_opaque_data*/, time_stamp, NULL, s_on_window_tuning_ping_complete);
+    if (!pending_ping) {
+        return AWS_OP_ERR;
+    }
+    struct aws_h2_frame *ping_frame = aws_h2_frame_new_ping(
+        aws_h2_connection_get_frame_allocator(connection), false /*ACK*/, pending_ping->opaque_data);
+    if (!ping_frame) {
+        aws_mem_release(connection->base.alloc, pending_ping);
         return AWS_OP_ERR;
     }
-    aws_h2_connection_enqueue_outgoing_frame(connection, connection_window_update_frame);
-    connection->thread_data.window_size_self += window_size;
+    aws_linked_list_push_back(&connection->thread_data.pending_ping_queue, &pending_ping->node);
+    aws_h2_connection_enqueue_outgoing_frame(connection, ping_frame);
+
+    connection->thread_data.window_tuning.ping_in_flight = true;
+    connection->thread_data.window_tuning.bytes_since_ping = payload_len;
     return AWS_OP_SUCCESS;
 }
 
@@ -1248,9 +1504,9 @@ struct aws_h2err s_decoder_on_data_begin(
     }
 
     if (auto_window_update != 0) {
-        if (s_connection_send_update_window(connection, auto_window_update)) {
-            return aws_h2err_from_last_error();
-        }
+        /* In manual mode this only accounts for padding, which the user can't do anything about, so don't hold it
+         * back waiting for them */
+        s_connection_add_window_update(connection, auto_window_update, connection->conn_manual_window_management);
         CONNECTION_LOGF(
             TRACE,
             connection,
@@ -1259,6 +1515,72 @@ struct aws_h2err s_decoder_on_data_begin(
             total_padding_bytes);
     }
 
+    if (s_window_tuning_on_data(connection, payload_len)) {
+        CONNECTION_LOGF(
+            ERROR,
+            connection,
+            "Failed to send PING for window auto-tuning, error %s",
+            aws_error_name(aws_last_error()));
+        return aws_h2err_from_last_error();
+    }
+
+    return AWS_H2ERR_SUCCESS;
+}
+
+/* Stop holding back body data, and return what was held back */
+static struct aws_byte_cursor s_take_incoming_body(struct aws_h2_connection *connection) {
+    struct aws_byte_cursor data = connection->thread_data.incoming_body.data;
+    connection->thread_data.incoming_body.stream = NULL;
+    AWS_ZERO_STRUCT(connection->thread_data.incoming_body.data);
+    /* `data` may point into the buffer, but nothing can be appended until the caller is done with it */
+    connection->thread_data.incoming_body.buffer.len = 0;
+    return data;
+}
+
+/* Deliver any body data held back by incoming_body coalescing */
+static struct aws_h2err s_flush_incoming_body(struct aws_h2_connection *connection) {
+    struct aws_h2_stream *stream = connection->thread_data.incoming_body.stream;
+    if (!stream) {
+        return AWS_H2ERR_SUCCESS;
+    }
+
+    struct aws_byte_cursor data = s_take_incoming_body(connection);
+    return aws_h2_stream_on_decoder_data_i(stream, data);
+}
+
+/* Hold back body data, so it can be delivered along with the payloads of any DATA frames that follow */
+static struct aws_h2err s_hold_incoming_body(
+    struct aws_h2_connection *connection,
+    struct aws_h2_stream *stream,
+    struct aws_byte_cursor data) {
+
+    if (connection->thread_data.incoming_body.stream != stream) {
+        struct aws_h2err err = s_flush_incoming_body(connection);
+        if (aws_h2err_failed(err)) {
+            return err;
+        }
+    }
+
+    struct aws_byte_buf *buffer = &connection->thread_data.incoming_body.buffer;
+    struct aws_byte_cursor *held = &connection->thread_data.incoming_body.data;
+    if (held->len == 0) {
+        /* Nothing held back yet, so no need to copy anything until more data shows up */
+        *held = data;
+    } else {
+        if (held->ptr != buffer->buffer) {
+            /* Second payload, gather both into the buffer */
+            AWS_ASSERT(buffer->len == 0);
+            if (aws_byte_buf_append_dynamic(buffer, held)) {
+                return aws_h2err_from_last_error();
+            }
+        }
+        if (aws_byte_buf_append_dynamic(buffer, &data)) {
+            return aws_h2err_from_last_error();
+        }
+        *held = aws_byte_cursor_from_buf(buffer);
+    }
+
+    connection->thread_data.incoming_body.stream = stream;
     return AWS_H2ERR_SUCCESS;
 }
 
@@ -1273,6 +1595,10 @@ struct aws_h2err s_decoder_on_data_i(uint32_t stream_id, struct aws_byte_cursor
     }
 
     if (stream) {
+        if (connection->thread_data.incoming_body.enabled) {
+            return s_hold_incoming_body(connection, stream, data);
+        }
+
         err = aws_h2_stream_on_decoder_data_i(stream, data);
         if (aws_h2err_failed(err)) {
             return err;
@@ -1289,11 +1615,15 @@ struct aws_h2err s_decoder_on_end_stream(uint32_t stream_id, void *userdata) {
      * isn't an actual frame type. It's a flag on DATA or HEADERS frames, and we
      * already checked the legality of those frames in their respective callbacks. */
 
-    struct aws_hash_element *found = NULL;
-    aws_hash_table_find(&connection->thread_data.active_streams_map, (void *)(size_t)stream_id, &found);
-    if (found) {
-        struct aws_h2_stream *stream = found->value;
-        struct aws_h2err err = aws_h2_stream_on_decoder_end_stream(stream);
+    struct aws_h2_stream *stream = aws_h2_stream_table_find(&connection->thread_data.active_streams, stream_id);
+    if (stream) {
+        /* All of the body must be delivered before the stream completes */
+        struct aws_h2err err = s_flush_incoming_body(connection);
+        if (aws_h2err_failed(err)) {
+            return err;
+        }
+
+        err = aws_h2_stream_on_decoder_end_stream(stream);
         if (aws_h2err_failed(err)) {
             return err;
         }
@@ -1377,7 +1707,8 @@ static struct aws_h2err s_decoder_on_ping(uint8_t opaque_data[AWS_HTTP2_PING_DAT
     struct aws_h2_connection *connection = userdata;
 
     /* send a PING frame with the ACK flag set in response, with an identical payload. */
-    struct aws_h2_frame *ping_ack_frame = aws_h2_frame_new_ping(connection->base.alloc, true, opaque_data);
+    struct aws_h2_frame *ping_ack_frame =
+        aws_h2_frame_new_ping(aws_h2_connection_get_frame_allocator(connection), true, opaque_data);
     if (!ping_ack_frame) {
         CONNECTION_LOGF(
             ERROR, connection, "Ping ACK frame failed to be sent, error %s", aws_error_name(aws_last_error()));
@@ -1397,7 +1728,8 @@ static struct aws_h2err s_decoder_on_settings(
     /* Once all values have been processed, the recipient MUST immediately emit a SETTINGS frame with the ACK flag
      * set.(RFC-7540 6.5.3) */
     CONNECTION_LOG(TRACE, connection, "Setting frame processing ends");
-    struct aws_h2_frame *settings_ack_frame = aws_h2_frame_new_settings(connection->base.alloc, NULL, 0, true);
+    struct aws_h2_frame *settings_ack_frame =
+        aws_h2_frame_new_settings(aws_h2_connection_get_frame_allocator(connection), NULL, 0, true);
     if (!settings_ack_frame) {
         CONNECTION_LOGF(
             ERROR, connection, "Settings ACK frame failed to be sent, error %s", aws_error_name(aws_last_error()));
@@ -1432,10 +1764,10 @@ static struct aws_h2err s_decoder_on_settings(
                  * flow-control windows that it maintains by the difference between the new value and the old value. */
                 int32_t size_changed =
                     settings_array[i].value - connection->thread_data.settings_peer[settings_array[i].id];
-                struct aws_hash_iter stream_iter = aws_hash_iter_begin(&connection->thread_data.active_streams_map);
-                while (!aws_hash_iter_done(&stream_iter)) {
-                    struct aws_h2_stream *stream = stream_iter.element.value;
-                    aws_hash_iter_next(&stream_iter);
+                struct aws_h2_stream_table_iter stream_iter;
+                aws_h2_stream_table_iter_init(&stream_iter, &connection->thread_data.active_streams);
+                struct aws_h2_stream *stream;
+                while ((stream = aws_h2_stream_table_iter_next(&stream_iter))) {
                     err = aws_h2_stream_window_size_change(stream, size_changed, false /*self*/);
                     if (aws_h2err_failed(err)) {
                         CONNECTION_LOG(
@@ -1443,6 +1775,7 @@ static struct aws_h2err s_decoder_on_settings(
                             connection,
                             "Connection error, change to SETTINGS_INITIAL_WINDOW_SIZE caused a stream's flow-control "
                             "window to exceed the maximum size");
+                        aws_h2_stream_table_iter_clean_up(&stream_iter);
                         goto error;
                     }
                 }
@@ -1508,10 +1841,10 @@ static struct aws_h2err s_decoder_on_settings_ack(void *userdata) {
                  * flow-control windows that it maintains by the difference between the new value and the old value. */
                 int32_t size_changed =
                     settings_array[i].value - connection->thread_data.settings_self[settings_array[i].id];
-                struct aws_hash_iter stream_iter = aws_hash_iter_begin(&connection->thread_data.active_streams_map);
-                while (!aws_hash_iter_done(&stream_iter)) {
-                    struct aws_h2_stream *stream = stream_iter.element.value;
-                    aws_hash_iter_next(&stream_iter);
+                struct aws_h2_stream_table_iter stream_iter;
+                aws_h2_stream_table_iter_init(&stream_iter, &connection->thread_data.active_streams);
+                struct aws_h2_stream *stream;
+                while ((stream = aws_h2_stream_table_iter_next(&stream_iter))) {
                     err = aws_h2_stream_window_size_change(stream, size_changed, true /*self*/);
                     if (aws_h2err_failed(err)) {
                         CONNECTION_LOG(
@@ -1519,6 +1852,7 @@ static struct aws_h2err s_decoder_on_settings_ack(void *userdata) {
                             connection,
                             "Connection error, change to SETTINGS_INITIAL_WINDOW_SIZE from internal caused a stream's "
                             "flow-control window to exceed the maximum size");
+                        aws_h2_stream_table_iter_clean_up(&stream_iter);
                         goto error;
                     }
                 }
@@ -1609,7 +1943,7 @@ static struct aws_h2err s_decoder_on_window_update(uint32_t stream_id, uint32_t
                     " Stream will resume sending data.",
                     stream->thread_data.window_size_peer);
                 aws_linked_list_remove(&stream->node);
-                aws_linked_list_push_back(&connection->thread_data.outgoing_streams_list, &stream->node);
+                aws_h2_priority_scheduler_push(&connection->thread_data.outgoing_streams, stream);
             }
         }
     }
@@ -1653,10 +1987,10 @@ struct aws_h2err s_decoder_on_goaway(
     /* Complete activated streams whose id is higher than last_stream, since they will not process by peer. We should
      * treat them as they had never been created at all.
      * This would be more efficient if we could iterate streams in reverse-id order */
-    struct aws_hash_iter stream_iter = aws_hash_iter_begin(&connection->thread_data.active_streams_map);
-    while (!aws_hash_iter_done(&stream_iter)) {
-        struct aws_h2_stream *stream = stream_iter.element.value;
-        aws_hash_iter_next(&stream_iter);
+    struct aws_h2_stream_table_iter stream_iter;
+    aws_h2_stream_table_iter_init(&stream_iter, &connection->thread_data.active_streams);
+    struct aws_h2_stream *stream;
+    while ((stream = aws_h2_stream_table_iter_next(&stream_iter))) {
         if (stream->base.id > last_stream) {
             AWS_H2_STREAM_LOG(
                 DEBUG,
@@ -1736,7 +2070,7 @@ static void s_handler_installed(struct aws_channel_handler *handler, struct aws_
     init_pending_settings->user_data = connection->base.user_data;
 
     struct aws_h2_frame *init_settings_frame = aws_h2_frame_new_settings(
-        connection->base.alloc,
+        aws_h2_connection_get_frame_allocator(connection),
         init_pending_settings->settings_array,
         init_pending_settings->num_settings,
         false /*ACK*/);
@@ -1755,8 +2089,8 @@ static void s_handler_installed(struct aws_channel_handler *handler, struct aws_
     /* If not manual connection window management, update the connection window to max. */
     if (!connection->conn_manual_window_management) {
         uint32_t initial_window_update_size = AWS_H2_WINDOW_UPDATE_MAX - AWS_H2_INIT_WINDOW_SIZE;
-        struct aws_h2_frame *connection_window_update_frame =
-            aws_h2_frame_new_window_update(connection->base.alloc, 0 /* stream_id */, initial_window_update_size);
+        struct aws_h2_frame *connection_window_update_frame = aws_h2_frame_new_window_update(
+            aws_h2_connection_get_frame_allocator(connection), 0 /* stream_id */, initial_window_update_size);
         AWS_ASSERT(connection_window_update_frame);
         /* enqueue the windows update frame here */
         aws_linked_list_push_back(
@@ -1773,6 +2107,16 @@ error:
 static void s_stream_complete(struct aws_h2_connection *connection, struct aws_h2_stream *stream, int error_code) {
     AWS_PRECONDITION(aws_channel_thread_is_callers_thread(connection->base.channel_slot->channel));
 
+    if (connection->thread_data.incoming_body.stream == stream) {
+        /* Stream is completing mid-read (ex: RST_STREAM received), deliver the body it got before that.
+         * The stream is finished either way, so an error from the user's callback changes nothing */
+        struct aws_byte_cursor data = s_take_incoming_body(connection);
+        if (aws_http_stream_on_incoming_body(&stream->base, &data)) {
+            AWS_H2_STREAM_LOGF(
+                ERROR, stream, "Incoming body callback raised error, %s", aws_error_name(aws_last_error()));
+        }
+    }
+
     /* Nice logging */
     if (error_code) {
         AWS_H2_STREAM_LOGF(
@@ -1785,13 +2129,16 @@ static void s_stream_complete(struct aws_h2_connection *connection, struct aws_h
         AWS_H2_STREAM_LOG(DEBUG, stream, "Server stream complete");
     }
 
-    /* Remove stream from active_streams_map and outgoing_stream_list (if it was in them at all) */
-    aws_hash_table_remove(&connection->thread_data.active_streams_map, (void *)(size_t)stream->base.id, NULL, NULL);
+    /* Remove stream from active_streams and outgoing_streams (if it was in them at all) */
+    aws_h2_stream_table_remove(&connection->thread_data.active_streams, stream->base.id);
     if (stream->node.next) {
         aws_linked_list_remove(&stream->node);
     }
+    if (stream->thread_data.window_update_node.next) {
+        aws_linked_list_remove(&stream->thread_data.window_update_node);
+    }
 
-    if (aws_hash_table_get_entry_count(&connection->thread_data.active_streams_map) == 0 &&
+    if (aws_h2_stream_table_count(&connection->thread_data.active_streams) == 0 &&
         connection->thread_data.incoming_timestamp_ns != 0) {
         uint64_t now_ns = 0;
         aws_channel_current_clock_time(connection->base.channel_slot->channel, &now_ns);
@@ -1827,26 +2174,18 @@ int aws_h2_connection_on_stream_closed(
     s_stream_complete(connection, stream, aws_error_code);
     stream = NULL; /* Reference released, do not touch again */
 
-    if (s_record_closed_stream(connection, stream_id, closed_when)) {
-        return AWS_OP_ERR;
-    }
-
+    s_record_closed_stream(connection, stream_id, closed_when);
     return AWS_OP_SUCCESS;
 }
 
-static int s_record_closed_stream(
+static void s_record_closed_stream(
     struct aws_h2_connection *connection,
     uint32_t stream_id,
     enum aws_h2_stream_closed_when closed_when) {
 
     AWS_PRECONDITION(aws_channel_thread_is_callers_thread(connection->base.channel_slot->channel));
 
-    if (aws_cache_put(connection->thread_data.closed_streams, (void *)(size_t)stream_id, (void *)(size_t)closed_when)) {
-        CONNECTION_LOG(ERROR, connection, "Failed inserting ID into cache of recently closed streams");
-        return AWS_OP_ERR;
-    }
-
-    return AWS_OP_SUCCESS;
+    aws_h2_closed_streams_record(&connection->thread_data.closed_streams, stream_id, closed_when);
 }
 
 int aws_h2_connection_send_rst_and_close_reserved_stream(
@@ -1855,7 +2194,8 @@ int aws_h2_connection_send_rst_and_close_reserved_stream(
     uint32_t h2_error_code) {
     AWS_PRECONDITION(aws_channel_thread_is_callers_thread(connection->base.channel_slot->channel));
 
-    struct aws_h2_frame *rst_stream = aws_h2_frame_new_rst_stream(connection->base.alloc, stream_id, h2_error_code);
+    struct aws_h2_frame *rst_stream =
+        aws_h2_frame_new_rst_stream(aws_h2_connection_get_frame_allocator(connection), stream_id, h2_error_code);
     if (!rst_stream) {
         CONNECTION_LOGF(ERROR, connection, "Error creating RST_STREAM frame, %s", aws_error_name(aws_last_error()));
         return AWS_OP_ERR;
@@ -1865,7 +2205,8 @@ int aws_h2_connection_send_rst_and_close_reserved_stream(
     /* If we ever fully support PUSH_PROMISE, this is where we'd remove the
      * promised_stream_id from some reserved_streams datastructure */
 
-    return s_record_closed_stream(connection, stream_id, AWS_H2_STREAM_CLOSED_WHEN_RST_STREAM_SENT);
+    s_record_closed_stream(connection, stream_id, AWS_H2_STREAM_CLOSED_WHEN_RST_STREAM_SENT);
+    return AWS_OP_SUCCESS;
 }
 
 /* Move stream into "active" datastructures and notify stream that it can send frames now */
@@ -1887,15 +2228,14 @@ static void s_move_stream_to_thread(
     }
 
     uint32_t max_concurrent_streams = connection->thread_data.settings_peer[AWS_HTTP2_SETTINGS_MAX_CONCURRENT_STREAMS];
-    if (aws_hash_table_get_entry_count(&connection->thread_data.active_streams_map) >= max_concurrent_streams) {
+    if (aws_h2_stream_table_count(&connection->thread_data.active_streams) >= max_concurrent_streams) {
         AWS_H2_STREAM_LOG(ERROR, stream, "Failed activating stream, max concurrent streams are reached");
         aws_raise_error(AWS_ERROR_HTTP_MAX_CONCURRENT_STREAMS_EXCEEDED);
         goto error;
     }
 
-    if (aws_hash_table_put(
-            &connection->thread_data.active_streams_map, (void *)(size_t)stream->base.id, stream, NULL)) {
-        AWS_H2_STREAM_LOG(ERROR, stream, "Failed inserting stream into map");
+    if (aws_h2_stream_table_insert(&connection->thread_data.active_streams, stream->base.id, stream)) {
+        AWS_H2_STREAM_LOG(ERROR, stream, "Failed inserting stream into table");
         goto error;
     }
 
@@ -1904,7 +2244,7 @@ static void s_move_stream_to_thread(
         goto error;
     }
 
-    if (aws_hash_table_get_entry_count(&connection->thread_data.active_streams_map) == 1) {
+    if (aws_h2_stream_table_count(&connection->thread_data.active_streams) == 1) {
         /* transition from nothing to read -> something to read */
         uint64_t now_ns = 0;
         aws_channel_current_clock_time(connection->base.channel_slot->channel, &now_ns);
@@ -1916,7 +2256,7 @@ static void s_move_stream_to_thread(
             aws_linked_list_push_back(&connection->thread_data.waiting_streams_list, &stream->node);
             break;
         case AWS_H2_STREAM_BODY_STATE_ONGOING:
-            aws_linked_list_push_back(&connection->thread_data.outgoing_streams_list, &stream->node);
+            aws_h2_priority_scheduler_push(&connection->thread_data.outgoing_streams, stream);
             break;
         default:
             break;
@@ -1927,6 +2267,56 @@ error:
     s_stream_complete(connection, stream, aws_last_error());
 }
 
+/* Schedule `cross_thread_work_task`, unless it's already scheduled. Call from any thread, after handing work over */
+static void s_try_schedule_cross_thread_work_task(struct aws_h2_connection *connection) {
+    if (!aws_atomic_exchange_int(&connection->is_cross_thread_work_task_scheduled, true)) {
+        CONNECTION_LOG(TRACE, connection, "Scheduling cross-thread work task");
+        aws_channel_schedule_task_now(connection->base.channel_slot->channel, &connection->cross_thread_work_task);
+    }
+}
+
+/* Move user-requested work from `cross_thread_work_queue` to thread_data.
+ * SETTINGS and PING wait in thread_data for their ACK. If `send_frames` is false, because the connection is
+ * shutting down, their frames are discarded and s_finish_shutdown() completes them with an error.
+ * GOAWAYs are moved to `out_goaways`, for the caller to send. */
+static void s_pop_cross_thread_work(
+    struct aws_h2_connection *connection,
+    bool send_frames,
+    struct aws_linked_list *out_goaways) {
+
+    struct aws_mpsc_queue_node *node;
+    while ((node = aws_mpsc_queue_pop(&connection->cross_thread_work_queue)) != NULL) {
+        struct aws_h2_cross_thread_work *work = AWS_CONTAINER_OF(node, struct aws_h2_cross_thread_work, node);
+
+        if (work->frame) {
+            if (send_frames) {
+                aws_h2_connection_enqueue_outgoing_frame(connection, work->frame);
+            } else {
+                aws_h2_frame_destroy(work->frame);
+            }
+            work->frame = NULL;
+        }
+
+        switch (work->type) {
+            case AWS_H2_CROSS_THREAD_WORK_SETTINGS: {
+                struct aws_h2_pending_settings *pending_settings =
+                    AWS_CONTAINER_OF(work, struct aws_h2_pending_settings, cross_thread_work);
+                aws_linked_list_push_back(&connection->thread_data.pending_settings_queue, &pending_settings->node);
+            } break;
+            case AWS_H2_CROSS_THREAD_WORK_PING: {
+                struct aws_h2_pending_ping *pending_ping =
+                    AWS_CONTAINER_OF(work, struct aws_h2_pending_ping, cross_thread_work);
+                aws_linked_list_push_back(&connection->thread_data.pending_ping_queue, &pending_ping->node);
+            } break;
+            case AWS_H2_CROSS_THREAD_WORK_GOAWAY: {
+                struct aws_h2_pending_goaway *pending_goaway =
+                    AWS_CONTAINER_OF(work, struct aws_h2_pending_goaway, cross_thread_work);
+                aws_linked_list_push_back(out_goaways, &pending_goaway->node);
+            } break;
+        }
+    }
+}
+
 /* Perform on-thread work that is triggered by calls to the connection/stream API */
 static void s_cross_thread_work_task(struct aws_channel_task *task, void *arg, enum aws_task_status status) {
     (void)task;
@@ -1936,18 +2326,12 @@ static void s_cross_thread_work_task(struct aws_channel_task *task, void *arg, e
 
     struct aws_h2_connection *connection = arg;
 
-    struct aws_linked_list pending_frames;
-    aws_linked_list_init(&pending_frames);
+    /* Clear the flag before collecting work, so anything handed over from now on schedules the task again */
+    aws_atomic_store_int(&connection->is_cross_thread_work_task_scheduled, false);
 
     struct aws_linked_list pending_streams;
     aws_linked_list_init(&pending_streams);
 
-    struct aws_linked_list pending_settings;
-    aws_linked_list_init(&pending_settings);
-
-    struct aws_linked_list pending_ping;
-    aws_linked_list_init(&pending_ping);
-
     struct aws_linked_list pending_goaway;
     aws_linked_list_init(&pending_goaway);
 
@@ -1955,13 +2339,8 @@ static void s_cross_thread_work_task(struct aws_channel_task *task, void *arg, e
     int new_stream_error_code;
     { /* BEGIN CRITICAL SECTION */
         s_lock_synced_data(connection);
-        connection->synced_data.is_cross_thread_work_task_scheduled = false;
 
-        aws_linked_list_swap_contents(&connection->synced_data.pending_frame_list, &pending_frames);
         aws_linked_list_swap_contents(&connection->synced_data.pending_stream_list, &pending_streams);
-        aws_linked_list_swap_contents(&connection->synced_data.pending_settings_list, &pending_settings);
-        aws_linked_list_swap_contents(&connection->synced_data.pending_ping_list, &pending_ping);
-        aws_linked_list_swap_contents(&connection->synced_data.pending_goaway_list, &pending_goaway);
         window_update_size = connection->synced_data.window_update_size;
         connection->synced_data.window_update_size = 0;
         new_stream_error_code = connection->synced_data.new_stream_error_code;
@@ -1969,17 +2348,13 @@ static void s_cross_thread_work_task(struct aws_channel_task *task, void *arg, e
         s_unlock_synced_data(connection);
     } /* END CRITICAL SECTION */
 
-    /* Enqueue new pending control frames */
-    while (!aws_linked_list_empty(&pending_frames)) {
-        struct aws_linked_list_node *node = aws_linked_list_pop_front(&pending_frames);
-        struct aws_h2_frame *frame = AWS_CONTAINER_OF(node, struct aws_h2_frame, node);
-        aws_h2_connection_enqueue_outgoing_frame(connection, frame);
-    }
+    /* Enqueue new pending control frames, and move pending settings and PING to thread data */
+    s_pop_cross_thread_work(connection, true /*send_frames*/, &pending_goaway);
 
-    /* We already enqueued the window_update frame, just apply the change and let our peer check this value, no matter
-     * overflow happens or not. Peer will detect it for us. */
-    connection->thread_data.window_size_self =
-        aws_add_size_saturating(connection->thread_data.window_size_self, window_update_size);
+    /* window_update_size is ensured to be not greater than AWS_H2_WINDOW_UPDATE_MAX */
+    if (window_update_size > 0) {
+        s_connection_add_window_update(connection, (uint32_t)window_update_size, true /*forced*/);
+    }
 
     /* Process new pending_streams */
     while (!aws_linked_list_empty(&pending_streams)) {
@@ -1988,18 +2363,6 @@ static void s_cross_thread_work_task(struct aws_channel_task *task, void *arg, e
         s_move_stream_to_thread(connection, stream, new_stream_error_code);
     }
 
-    /* Move pending settings to thread data */
-    while (!aws_linked_list_empty(&pending_settings)) {
-        aws_linked_list_push_back(
-            &connection->thread_data.pending_settings_queue, aws_linked_list_pop_front(&pending_settings));
-    }
-
-    /* Move pending PING to thread data */
-    while (!aws_linked_list_empty(&pending_ping)) {
-        aws_linked_list_push_back(
-            &connection->thread_data.pending_ping_queue, aws_linked_list_pop_front(&pending_ping));
-    }
-
     /* Send user requested goaways */
     while (!aws_linked_list_empty(&pending_goaway)) {
         struct aws_linked_list_node *node = aws_linked_list_pop_front(&pending_goaway);
@@ -2020,7 +2383,6 @@ int aws_h2_stream_activate(struct aws_http_stream *stream) {
     struct aws_h2_connection *connection = AWS_CONTAINER_OF(base_connection, struct aws_h2_connection, base);
 
     int err;
-    bool was_cross_thread_work_scheduled = false;
     { /* BEGIN CRITICAL SECTION */
         s_acquire_stream_and_connection_lock(h2_stream, connection);
 
@@ -2040,9 +2402,6 @@ int aws_h2_stream_activate(struct aws_http_stream *stream) {
 
         if (stream->id) {
             /* success */
-            was_cross_thread_work_scheduled = connection->synced_data.is_cross_thread_work_task_scheduled;
-            connection->synced_data.is_cross_thread_work_task_scheduled = true;
-
             aws_linked_list_push_back(&connection->synced_data.pending_stream_list, &h2_stream->node);
             h2_stream->synced_data.api_state = AWS_H2_STREAM_API_STATE_ACTIVE;
         }
@@ -2058,10 +2417,7 @@ int aws_h2_stream_activate(struct aws_http_stream *stream) {
     /* connection keeps activated stream alive until stream completes */
     aws_atomic_fetch_add(&stream->refcount, 1);
 
-    if (!was_cross_thread_work_scheduled) {
-        CONNECTION_LOG(TRACE, connection, "Scheduling cross-thread work task");
-        aws_channel_schedule_task_now(connection->base.channel_slot->channel, &connection->cross_thread_work_task);
-    }
+    s_try_schedule_cross_thread_work_task(connection);
 
     return AWS_OP_SUCCESS;
 
@@ -2076,6 +2432,64 @@ error:
     return aws_raise_error(err);
 }
 
+/* Like aws_h2_stream_activate() for a batch of streams, but with one lock and at most one task scheduled.
+ * The streams were just created, and haven't been given to the user, so nobody else can be touching them */
+static int s_connection_activate_streams(
+    struct aws_http_connection *client_connection,
+    struct aws_http_stream **streams,
+    size_t count) {
+
+    struct aws_h2_connection *connection = AWS_CONTAINER_OF(client_connection, struct aws_h2_connection, base);
+
+    int err;
+    { /* BEGIN CRITICAL SECTION */
+        s_lock_synced_data(connection);
+
+        err = connection->synced_data.new_stream_error_code;
+        if (!err && count > 0) {
+            /* All or nothing, so check there are enough ids before using any */
+            uint64_t last_stream_id = (uint64_t)client_connection->next_stream_id + ((uint64_t)count - 1) * 2;
+            if (last_stream_id > AWS_H2_STREAM_ID_MAX) {
+                err = AWS_ERROR_HTTP_STREAM_IDS_EXHAUSTED;
+            }
+        }
+
+        if (!err) {
+            for (size_t i = 0; i < count; ++i) {
+                struct aws_h2_stream *h2_stream = AWS_CONTAINER_OF(streams[i], struct aws_h2_stream, base);
+                AWS_ASSERT(streams[i]->id == 0);
+                streams[i]->id = aws_http_connection_get_next_stream_id(client_connection);
+                aws_linked_list_push_back(&connection->synced_data.pending_stream_list, &h2_stream->node);
+                h2_stream->synced_data.api_state = AWS_H2_STREAM_API_STATE_ACTIVE;
+            }
+        }
+
+        s_unlock_synced_data(connection);
+    } /* END CRITICAL SECTION */
+
+    if (err) {
+        CONNECTION_LOGF(
+            ERROR,
+            connection,
+            "Failed to activate batch of %zu streams, error %d (%s)",
+            count,
+            err,
+            aws_error_name(err));
+        return aws_raise_error(err);
+    }
+
+    for (size_t i = 0; i < count; ++i) {
+        /* connection keeps activated stream alive until stream completes */
+        aws_atomic_fetch_add(&streams[i]->refcount, 1);
+    }
+
+    if (count > 0) {
+        s_try_schedule_cross_thread_work_task(connection);
+    }
+
+    return AWS_OP_SUCCESS;
+}
+
 static struct aws_http_stream *s_connection_make_request(
     struct aws_http_connection *client_connection,
     const struct aws_http_make_request_options *options) {
@@ -2179,21 +2593,7 @@ static void s_connection_update_window(struct aws_http_connection *connection_ba
             "Connection manual window management is off, update window operations are not supported.");
         return;
     }
-    struct aws_h2_frame *connection_window_update_frame =
-        aws_h2_frame_new_window_update(connection->base.alloc, 0, increment_size);
-    if (!connection_window_update_frame) {
-        CONNECTION_LOGF(
-            ERROR,
-            connection,
-            "Failed to create WINDOW_UPDATE frame on connection, error %s",
-            aws_error_name(aws_last_error()));
-        /* OOM should result in a crash. And the increment size is too huge is the only other failure case, which will
-         * result in overflow. */
-        goto overflow;
-    }
-
     int err = 0;
-    bool cross_thread_work_should_schedule = false;
     bool connection_open = false;
     size_t sum_size = 0;
     { /* BEGIN CRITICAL SECTION */
@@ -2204,10 +2604,6 @@ static void s_connection_update_window(struct aws_http_connection *connection_ba
         connection_open = connection->synced_data.is_open;
 
         if (!err && connection_open) {
-            cross_thread_work_should_schedule = !connection->synced_data.is_cross_thread_work_task_scheduled;
-            connection->synced_data.is_cross_thread_work_task_scheduled = true;
-            aws_linked_list_push_back(
-                &connection->synced_data.pending_frame_list, &connection_window_update_frame->node);
             connection->synced_data.window_update_size = sum_size;
         }
         s_unlock_synced_data(connection);
@@ -2217,20 +2613,15 @@ static void s_connection_update_window(struct aws_http_connection *connection_ba
             ERROR,
             connection,
             "The connection's flow-control windows has been incremented beyond 2**31 -1, the max for HTTP/2. The ");
-        aws_h2_frame_destroy(connection_window_update_frame);
         goto overflow;
     }
 
-    if (cross_thread_work_should_schedule) {
-        CONNECTION_LOG(TRACE, connection, "Scheduling cross-thread work task");
-        aws_channel_schedule_task_now(connection->base.channel_slot->channel, &connection->cross_thread_work_task);
-    }
-
     if (!connection_open) {
         /* connection already closed, just do nothing */
-        aws_h2_frame_destroy(connection_window_update_frame);
         return;
     }
+
+    s_try_schedule_cross_thread_work_task(connection);
     CONNECTION_LOGF(
         TRACE,
         connection,
@@ -2275,29 +2666,14 @@ static int s_connection_change_settings(
         return AWS_OP_ERR;
     }
 
-    bool was_cross_thread_work_scheduled = false;
-    bool connection_open;
-    { /* BEGIN CRITICAL SECTION */
-        s_lock_synced_data(connection);
-
-        connection_open = connection->synced_data.is_open;
-        if (!connection_open) {
-            s_unlock_synced_data(connection);
-            goto closed;
-        }
-        was_cross_thread_work_scheduled = connection->synced_data.is_cross_thread_work_task_scheduled;
-        connection->synced_data.is_cross_thread_work_task_scheduled = true;
-        aws_linked_list_push_back(&connection->synced_data.pending_frame_list, &settings_frame->node);
-        aws_linked_list_push_back(&connection->synced_data.pending_settings_list, &pending_settings->node);
-
-        s_unlock_synced_data(connection);
-    } /* END CRITICAL SECTION */
-
-    if (!was_cross_thread_work_scheduled) {
-        CONNECTION_LOG(TRACE, connection, "Scheduling cross-thread work task");
-        aws_channel_schedule_task_now(connection->base.channel_slot->channel, &connection->cross_thread_work_task);
+    pending_settings->cross_thread_work.type = AWS_H2_CROSS_THREAD_WORK_SETTINGS;
+    pending_settings->cross_thread_work.frame = settings_frame;
+    if (!aws_mpsc_queue_try_push(&connection->cross_thread_work_queue, &pending_settings->cross_thread_work.node)) {
+        goto closed;
     }
 
+    s_try_schedule_cross_thread_work_task(connection);
+
     return AWS_OP_SUCCESS;
 closed:
     CONNECTION_LOG(ERROR, connection, "Failed to change settings, connection is closed or closing.");
@@ -2339,29 +2715,14 @@ static int s_connection_send_ping(
         return AWS_OP_ERR;
     }
 
-    bool was_cross_thread_work_scheduled = false;
-    bool connection_open;
-    { /* BEGIN CRITICAL SECTION */
-        s_lock_synced_data(connection);
-
-        connection_open = connection->synced_data.is_open;
-        if (!connection_open) {
-            s_unlock_synced_data(connection);
-            goto closed;
-        }
-        was_cross_thread_work_scheduled = connection->synced_data.is_cross_thread_work_task_scheduled;
-        connection->synced_data.is_cross_thread_work_task_scheduled = true;
-        aws_linked_list_push_back(&connection->synced_data.pending_frame_list, &ping_frame->node);
-        aws_linked_list_push_back(&connection->synced_data.pending_ping_list, &pending_ping->node);
-
-        s_unlock_synced_data(connection);
-    } /* END CRITICAL SECTION */
-
-    if (!was_cross_thread_work_scheduled) {
-        CONNECTION_LOG(TRACE, connection, "Scheduling cross-thread work task");
-        aws_channel_schedule_task_now(connection->base.channel_slot->channel, &connection->cross_thread_work_task);
+    pending_ping->cross_thread_work.type = AWS_H2_CROSS_THREAD_WORK_PING;
+    pending_ping->cross_thread_work.frame = ping_frame;
+    if (!aws_mpsc_queue_try_push(&connection->cross_thread_work_queue, &pending_ping->cross_thread_work.node)) {
+        goto closed;
     }
 
+    s_try_schedule_cross_thread_work_task(connection);
+
     return AWS_OP_SUCCESS;
 
 closed:
@@ -2381,23 +2742,13 @@ static void s_connection_send_goaway(
     struct aws_h2_pending_goaway *pending_goaway =
         s_new_pending_goaway(connection->base.alloc, http2_error, allow_more_streams, optional_debug_data);
 
-    bool was_cross_thread_work_scheduled = false;
-    bool connection_open;
-    { /* BEGIN CRITICAL SECTION */
-        s_lock_synced_data(connection);
-
-        connection_open = connection->synced_data.is_open;
-        if (!connection_open) {
-            s_unlock_synced_data(connection);
-            CONNECTION_LOG(DEBUG, connection, "Goaway not sent, connection is closed or closing.");
-            aws_mem_release(connection->base.alloc, pending_goaway);
-            return;
-        }
-        was_cross_thread_work_scheduled = connection->synced_data.is_cross_thread_work_task_scheduled;
-        connection->synced_data.is_cross_thread_work_task_scheduled = true;
-        aws_linked_list_push_back(&connection->synced_data.pending_goaway_list, &pending_goaway->node);
-        s_unlock_synced_data(connection);
-    } /* END CRITICAL SECTION */
+    pending_goaway->cross_thread_work.type = AWS_H2_CROSS_THREAD_WORK_GOAWAY;
+    pending_goaway->cross_thread_work.frame = NULL;
+    if (!aws_mpsc_queue_try_push(&connection->cross_thread_work_queue, &pending_goaway->cross_thread_work.node)) {
+        CONNECTION_LOG(DEBUG, connection, "Goaway not sent, connection is closed or closing.");
+        aws_mem_release(connection->base.alloc, pending_goaway);
+        return;
+    }
 
     if (allow_more_streams && (http2_error != AWS_HTTP2_ERR_NO_ERROR)) {
         CONNECTION_LOGF(
@@ -2408,10 +2759,7 @@ static void s_connection_send_goaway(
             http2_error);
     }
 
-    if (!was_cross_thread_work_scheduled) {
-        CONNECTION_LOG(TRACE, connection, "Scheduling cross-thread work task");
-        aws_channel_schedule_task_now(connection->base.channel_slot->channel, &connection->cross_thread_work_task);
-    }
+    s_try_schedule_cross_thread_work_task(connection);
 }
 
 static void s_get_settings_general(
@@ -2479,8 +2827,8 @@ static void s_send_goaway(
         debug_data = *optional_debug_data;
     }
 
-    struct aws_h2_frame *goaway =
-        aws_h2_frame_new_goaway(connection->base.alloc, last_stream_id, h2_error_code, debug_data);
+    struct aws_h2_frame *goaway = aws_h2_frame_new_goaway(
+        aws_h2_connection_get_frame_allocator(connection), last_stream_id, h2_error_code, debug_data);
     if (!goaway) {
         CONNECTION_LOGF(ERROR, connection, "Error creating GOAWAY frame, %s", aws_error_name(aws_last_error()));
         goto error;
@@ -2575,6 +2923,13 @@ static int s_handler_process_read_message(
      * a Connection Error (a GOAWAY frames is sent, and the connection is closed) */
     struct aws_byte_cursor message_cursor = aws_byte_cursor_from_buf(&message->message_data);
     struct aws_h2err err = aws_h2_decode(connection->thread_data.decoder, &message_cursor);
+    /* Held back body data may point into the message, so it can't wait for the next one */
+    if (aws_h2err_success(err)) {
+        err = s_flush_incoming_body(connection);
+    } else {
+        /* Connection is going down regardless, but deliver what arrived before the error */
+        s_flush_incoming_body(connection);
+    }
     if (aws_h2err_failed(err)) {
         CONNECTION_LOGF(
             ERROR,
@@ -2656,13 +3011,14 @@ static int s_handler_shutdown(
     if (dir == AWS_CHANNEL_DIR_READ) {
         /* This call ensures that no further streams will be created. */
         s_stop(connection, true /*stop_reading*/, false /*stop_writing*/, false /*schedule_shutdown*/, error_code);
-        /* Send user requested GOAWAY, if they haven't been sent before. It's OK to access
-         * synced_data.pending_goaway_list without holding the lock because no more user_requested GOAWAY can be added
-         * after s_stop() has been invoked. */
-        if (!aws_linked_list_empty(&connection->synced_data.pending_goaway_list)) {
-            while (!aws_linked_list_empty(&connection->synced_data.pending_goaway_list)) {
-                struct aws_linked_list_node *node =
-                    aws_linked_list_pop_front(&connection->synced_data.pending_goaway_list);
+        /* Send user requested GOAWAY, if they haven't been sent before. No more user-requested work can be added
+         * after s_stop() has been invoked. Pending SETTINGS and PING aren't sent, they'll complete with an error */
+        struct aws_linked_list pending_goaway;
+        aws_linked_list_init(&pending_goaway);
+        s_pop_cross_thread_work(connection, false /*send_frames*/, &pending_goaway);
+        if (!aws_linked_list_empty(&pending_goaway)) {
+            while (!aws_linked_list_empty(&pending_goaway)) {
+                struct aws_linked_list_node *node = aws_linked_list_pop_front(&pending_goaway);
                 struct aws_h2_pending_goaway *goaway = AWS_CONTAINER_OF(node, struct aws_h2_pending_goaway, node);
                 s_send_goaway(connection, goaway->http2_error, goaway->allow_more_streams, &goaway->debug_data);
                 aws_mem_release(connection->base.alloc, goaway);
@@ -2719,45 +3075,28 @@ static void s_finish_shutdown(struct aws_h2_connection *connection) {
 
     /* Remove remaining streams from internal datastructures and mark them as complete. */
 
-    struct aws_hash_iter stream_iter = aws_hash_iter_begin(&connection->thread_data.active_streams_map);
-    while (!aws_hash_iter_done(&stream_iter)) {
-        struct aws_h2_stream *stream = stream_iter.element.value;
-        aws_hash_iter_delete(&stream_iter, true);
-        aws_hash_iter_next(&stream_iter);
-
+    struct aws_h2_stream_table_iter stream_iter;
+    aws_h2_stream_table_iter_init(&stream_iter, &connection->thread_data.active_streams);
+    for (struct aws_h2_stream *stream = aws_h2_stream_table_iter_next(&stream_iter); stream != NULL;
+         stream = aws_h2_stream_table_iter_next(&stream_iter)) {
         s_stream_complete(connection, stream, AWS_ERROR_HTTP_CONNECTION_CLOSED);
     }
 
     /* It's OK to access synced_data without holding the lock because
-     * no more streams or user-requested control frames can be added after s_stop() has been invoked. */
+     * no more streams can be added after s_stop() has been invoked. */
     while (!aws_linked_list_empty(&connection->synced_data.pending_stream_list)) {
         struct aws_linked_list_node *node = aws_linked_list_pop_front(&connection->synced_data.pending_stream_list);
         struct aws_h2_stream *stream = AWS_CONTAINER_OF(node, struct aws_h2_stream, node);
         s_stream_complete(connection, stream, AWS_ERROR_HTTP_CONNECTION_CLOSED);
     }
 
-    while (!aws_linked_list_empty(&connection->synced_data.pending_frame_list)) {
-        struct aws_linked_list_node *node = aws_linked_list_pop_front(&connection->synced_data.pending_frame_list);
-        struct aws_h2_frame *frame = AWS_CONTAINER_OF(node, struct aws_h2_frame, node);
-        aws_h2_frame_destroy(frame);
-    }
-
-    /* invoke pending callbacks haven't moved into thread, and clean up the data */
-    while (!aws_linked_list_empty(&connection->synced_data.pending_settings_list)) {
-        struct aws_linked_list_node *node = aws_linked_list_pop_front(&connection->synced_data.pending_settings_list);
-        struct aws_h2_pending_settings *settings = AWS_CONTAINER_OF(node, struct aws_h2_pending_settings, node);
-        if (settings->on_completed) {
-            settings->on_completed(&connection->base, AWS_ERROR_HTTP_CONNECTION_CLOSED, settings->user_data);
-        }
-        aws_mem_release(connection->base.alloc, settings);
-    }
-    while (!aws_linked_list_empty(&connection->synced_data.pending_ping_list)) {
-        struct aws_linked_list_node *node = aws_linked_list_pop_front(&connection->synced_data.pending_ping_list);
-        struct aws_h2_pending_ping *ping = AWS_CONTAINER_OF(node, struct aws_h2_pending_ping, node);
-        if (ping->on_completed) {
-            ping->on_completed(&connection->base, 0 /*fake rtt*/, AWS_ERROR_HTTP_CONNECTION_CLOSED, ping->user_data);
-        }
-        aws_mem_release(connection->base.alloc, ping);
+    /* Move the last user-requested SETTINGS and PING into thread data, so they're completed below */
+    struct aws_linked_list pending_goaway;
+    aws_linked_list_init(&pending_goaway);
+    s_pop_cross_thread_work(connection, false /*send_frames*/, &pending_goaway);
+    while (!aws_linked_list_empty(&pending_goaway)) {
+        struct aws_linked_list_node *node = aws_linked_list_pop_front(&pending_goaway);
+        aws_mem_release(connection->base.alloc, AWS_CONTAINER_OF(node, struct aws_h2_pending_goaway, node));
     }
 
     /* invoke pending callbacks moved into thread, and clean up the data */
@@ -2806,7 +3145,7 @@ static size_t s_handler_message_overhead(struct aws_channel_handler *handler) {
 static void s_reset_statistics(struct aws_channel_handler *handler) {
     struct aws_h2_connection *connection = handler->impl;
     aws_crt_statistics_http2_channel_reset(&connection->thread_data.stats);
-    if (aws_hash_table_get_entry_count(&connection->thread_data.active_streams_map) == 0) {
+    if (aws_h2_stream_table_count(&connection->thread_data.active_streams) == 0) {
         /* Check the current state */
         connection->thread_data.stats.was_inactive = true;
     }
@@ -2826,7 +3165,7 @@ static void s_gather_statistics(struct aws_channel_handler *handler, struct aws_
         return;
     }
 
-    if (!aws_linked_list_empty(&connection->thread_data.outgoing_streams_list)) {
+    if (!aws_h2_priority_scheduler_is_empty(&connection->thread_data.outgoing_streams)) {
         s_add_time_measurement_to_stats(
             connection->thread_data.outgoing_timestamp_ns,
             now_ns,
@@ -2834,7 +3173,7 @@ static void s_gather_statistics(struct aws_channel_handler *handler, struct aws_
 
         connection->thread_data.outgoing_timestamp_ns = now_ns;
     }
-    if (aws_hash_table_get_entry_count(&connection->thread_data.active_streams_map) != 0) {
+    if (aws_h2_stream_table_count(&connection->thread_data.active_streams) != 0) {
         s_add_time_measurement_to_stats(
             connection->thread_data.incoming_timestamp_ns,
             now_ns,
@@ -170,6 +170,10 @@ DEFINE_STATE(frame_unknown, 0);
 /* States that have nothing to do with frames */
 DEFINE_STATE(connection_preface_string, 1); /* requires 1 byte but may consume more */
 
+/* Fast path for input that holds whole frames, which skips the states above */
+static bool s_input_holds_whole_frame(const struct aws_h2_decoder *decoder, struct aws_byte_cursor input);
+static struct aws_h2err s_decode_whole_frame(struct aws_h2_decoder *decoder, struct aws_byte_cursor *input);
+
 /* Helper for states that need to transition to frame-type states */
 static const struct decoder_state *s_state_frames[AWS_H2_FRAME_TYPE_COUNT] = {
     [AWS_H2_FRAME_T_DATA] = &s_state_frame_data,
@@ -240,8 +244,10 @@ struct aws_h2_decoder {
         /* Whether these are informational (1xx), normal, or trailing headers */
         enum aws_http_header_block block_type;
 
-        /* Buffer up pseudo-headers and deliver them once they're all validated */
-        struct aws_string *pseudoheader_values[PSEUDOHEADER_COUNT];
+        /* Hold onto pseudo-headers and deliver them once they're all validated.
+         * Values point into the HPACK decoder, which keeps them valid until the header-block ends */
+        bool has_pseudoheader[PSEUDOHEADER_COUNT];
+        struct aws_byte_cursor pseudoheader_values[PSEUDOHEADER_COUNT];
         enum aws_http_header_compression pseudoheader_compression[PSEUDOHEADER_COUNT];
 
         /* All pseudo-header fields MUST appear in the header block before regular header fields. */
@@ -262,7 +268,10 @@ struct aws_h2_decoder {
 
         bool body_headers_forbidden;
 
-        /* Buffer up cookie header fields to concatenate separate ones */
+        /* The first cookie header field is held onto, since the value stays valid until the header-block ends.
+         * If more arrive, they're all concatenated in the buffer */
+        size_t num_cookies;
+        struct aws_byte_cursor first_cookie;
         struct aws_byte_buf cookies;
         /* If separate cookie fields have different compression types, the concatenated cookie uses the strictest type.
          */
@@ -348,9 +357,6 @@ error:
 }
 
 static void s_reset_header_block_in_progress(struct aws_h2_decoder *decoder) {
-    for (size_t i = 0; i < PSEUDOHEADER_COUNT; ++i) {
-        aws_string_destroy(decoder->header_block_in_progress.pseudoheader_values[i]);
-    }
     struct aws_byte_buf cookie_backup = decoder->header_block_in_progress.cookies;
     AWS_ZERO_STRUCT(decoder->header_block_in_progress);
     decoder->header_block_in_progress.cookies = cookie_backup;
@@ -383,6 +389,14 @@ struct aws_h2err aws_h2_decode(struct aws_h2_decoder *decoder, struct aws_byte_c
     do {
         decoder->state_changed = false;
 
+        /* Whenever the state machine is between frames, decode as many whole frames in place as we can */
+        while (s_input_holds_whole_frame(decoder, *data)) {
+            err = s_decode_whole_frame(decoder, data);
+            if (aws_h2err_failed(err)) {
+                goto handle_error;
+            }
+        }
+
         const uint32_t bytes_required = decoder->state->bytes_required;
         AWS_ASSERT(bytes_required <= decoder->scratch.capacity);
         const char *current_state_name = decoder->state->name;
@@ -567,7 +581,10 @@ static const enum stream_id_rules s_stream_id_rules_for_frame[AWS_H2_FRAME_TYPE_
  *  |                   Frame Payload (0...)                      ...
  *  +---------------------------------------------------------------+
  */
-static struct aws_h2err s_state_fn_prefix(struct aws_h2_decoder *decoder, struct aws_byte_cursor *input) {
+static struct aws_h2err s_decode_prefix(
+    struct aws_h2_decoder *decoder,
+    struct aws_byte_cursor *input,
+    bool *out_is_padded) {
 
     AWS_ASSERT(input->len >= s_state_prefix_requires_9_bytes);
 
@@ -591,7 +608,7 @@ static struct aws_h2err s_state_fn_prefix(struct aws_h2_decoder *decoder, struct
      * Flags that have no defined semantics for a particular frame type MUST be ignored (RFC-7540 4.1) */
     const uint8_t flags = raw_flags & s_acceptable_flags_for_frame[decoder->frame_in_progress.type];
 
-    bool is_padded = flags & AWS_H2_FRAME_F_PADDED;
+    *out_is_padded = flags & AWS_H2_FRAME_F_PADDED;
     decoder->frame_in_progress.flags.ack = flags & AWS_H2_FRAME_F_ACK;
     decoder->frame_in_progress.flags.end_stream = flags & AWS_H2_FRAME_F_END_STREAM;
     decoder->frame_in_progress.flags.end_headers = flags & AWS_H2_FRAME_F_END_HEADERS;
@@ -665,6 +682,19 @@ static struct aws_h2err s_state_fn_prefix(struct aws_h2_decoder *decoder, struct
         frame->stream_id,
         frame->payload_len);
 
+    return AWS_H2ERR_SUCCESS;
+}
+
+/* Decode the frame prefix, then move on to whichever state comes next for this frame */
+static struct aws_h2err s_state_fn_prefix(struct aws_h2_decoder *decoder, struct aws_byte_cursor *input) {
+
+    struct aws_frame_in_progress *frame = &decoder->frame_in_progress;
+    bool is_padded = false;
+    struct aws_h2err err = s_decode_prefix(decoder, input, &is_padded);
+    if (aws_h2err_failed(err)) {
+        return err;
+    }
+
     if (is_padded) {
         /* Read padding length if necessary */
         return s_decoder_switch_state(decoder, &s_state_padding_len);
@@ -879,6 +909,34 @@ static struct aws_h2err s_state_fn_frame_settings_loop(struct aws_h2_decoder *de
     return s_decoder_switch_state(decoder, &s_state_frame_settings_i);
 }
 
+/* Validate one setting, and buffer it up until the whole SETTINGS frame is decoded */
+static struct aws_h2err s_process_setting(struct aws_h2_decoder *decoder, uint16_t id, uint32_t value) {
+    /* An endpoint that receives a SETTINGS frame with any unknown or unsupported identifier MUST ignore that setting.
+     * RFC-7540 6.5.2 */
+    if (id >= AWS_HTTP2_SETTINGS_BEGIN_RANGE && id < AWS_HTTP2_SETTINGS_END_RANGE) {
+        /* check the value meets the settings bounds */
+        if (value < aws_h2_settings_bounds[id][0] || value > aws_h2_settings_bounds[id][1]) {
+            DECODER_LOGF(
+                ERROR, decoder, "A value of SETTING frame is invalid, id: %" PRIu16 ", value: %" PRIu32, id, value);
+            if (id == AWS_HTTP2_SETTINGS_INITIAL_WINDOW_SIZE) {
+                return aws_h2err_from_h2_code(AWS_HTTP2_ERR_FLOW_CONTROL_ERROR);
+            } else {
+                return aws_h2err_from_h2_code(AWS_HTTP2_ERR_PROTOCOL_ERROR);
+            }
+        }
+        struct aws_http2_setting setting;
+        setting.id = id;
+        setting.value = value;
+        /* array_list will keep a copy of setting, it is fine to be a local variable */
+        if (aws_array_list_push_back(&decoder->settings_buffer_list, &setting)) {
+            DECODER_LOGF(ERROR, decoder, "Writing setting to buffer failed, %s", aws_error_name(aws_last_error()));
+            return aws_h2err_from_last_error();
+        }
+    }
+
+    return AWS_H2ERR_SUCCESS;
+}
+
 /* Each run through this state consumes one 6-byte setting.
  * There may be multiple settings in a SETTINGS frame.
  *  +-------------------------------+
@@ -902,27 +960,9 @@ static struct aws_h2err s_state_fn_frame_settings_i(struct aws_h2_decoder *decod
     AWS_ASSERT(succ);
     (void)succ;
 
-    /* An endpoint that receives a SETTINGS frame with any unknown or unsupported identifier MUST ignore that setting.
-     * RFC-7540 6.5.2 */
-    if (id >= AWS_HTTP2_SETTINGS_BEGIN_RANGE && id < AWS_HTTP2_SETTINGS_END_RANGE) {
-        /* check the value meets the settings bounds */
-        if (value < aws_h2_settings_bounds[id][0] || value > aws_h2_settings_bounds[id][1]) {
-            DECODER_LOGF(
-                ERROR, decoder, "A value of SETTING frame is invalid, id: %" PRIu16 ", value: %" PRIu32, id, value);
-            if (id == AWS_HTTP2_SETTINGS_INITIAL_WINDOW_SIZE) {
-                return aws_h2err_from_h2_code(AWS_HTTP2_ERR_FLOW_CONTROL_ERROR);
-            } else {
-                return aws_h2err_from_h2_code(AWS_HTTP2_ERR_PROTOCOL_ERROR);
-            }
-        }
-        struct aws_http2_setting setting;
-        setting.id = id;
-        setting.value = value;
-        /* array_list will keep a copy of setting, it is fine to be a local variable */
-        if (aws_array_list_push_back(&decoder->settings_buffer_list, &setting)) {
-            DECODER_LOGF(ERROR, decoder, "Writing setting to buffer failed, %s", aws_error_name(aws_last_error()));
-            return aws_h2err_from_last_error();
-        }
+    struct aws_h2err err = s_process_setting(decoder, id, value);
+    if (aws_h2err_failed(err)) {
+        return err;
     }
 
     /* Update payload len */
@@ -1123,6 +1163,193 @@ static struct aws_h2err s_state_fn_frame_unknown(struct aws_h2_decoder *decoder,
     return AWS_H2ERR_SUCCESS;
 }
 
+/***********************************************************************************************************************
+ * Whole-frame fast path
+ **********************************************************************************************************************/
+
+/* True if the input holds the next frame in its entirety, and it's a type the fast path handles.
+ * Frames carrying a header-block fragment always go through the state machine, since HPACK decoding
+ * already works in place and the header-block can span several frames anyway. */
+static bool s_input_holds_whole_frame(const struct aws_h2_decoder *decoder, struct aws_byte_cursor input) {
+    if (decoder->state != &s_state_prefix || decoder->scratch.len || input.len < s_state_prefix_requires_9_bytes) {
+        return false;
+    }
+
+    uint32_t payload_len = 0;
+    uint8_t raw_type = 0;
+    aws_byte_cursor_read_be24(&input, &payload_len);
+    aws_byte_cursor_read_u8(&input, &raw_type);
+    switch (raw_type) {
+        case AWS_H2_FRAME_T_HEADERS:
+        case AWS_H2_FRAME_T_PUSH_PROMISE:
+        case AWS_H2_FRAME_T_CONTINUATION:
+            return false;
+        default:
+            break;
+    }
+
+    /* Less the 5 bytes of flags and stream-id that weren't read yet */
+    return input.len - 5 >= payload_len;
+}
+
+static struct aws_h2err s_whole_frame_payload_too_small(struct aws_h2_decoder *decoder) {
+    DECODER_LOGF(ERROR, decoder, "%s payload is too small", aws_h2_frame_type_to_str(decoder->frame_in_progress.type));
+    return aws_h2err_from_h2_code(AWS_HTTP2_ERR_FRAME_SIZE_ERROR);
+}
+
+/* Decode a frame that s_input_holds_whole_frame() approved, reading every field straight from the input.
+ * This skips the scratch space and the state-by-state walk through the frame, but must make exactly the same
+ * callbacks and report exactly the same errors as the state machine would. */
+static struct aws_h2err s_decode_whole_frame(struct aws_h2_decoder *decoder, struct aws_byte_cursor *input) {
+    struct aws_frame_in_progress *frame = &decoder->frame_in_progress;
+
+    bool is_padded = false;
+    struct aws_h2err err = s_decode_prefix(decoder, input, &is_padded);
+    if (aws_h2err_failed(err)) {
+        return err;
+    }
+
+    struct aws_byte_cursor payload = aws_byte_cursor_advance(input, frame->payload_len);
+    AWS_ASSERT(payload.len == frame->payload_len);
+
+    uint32_t total_padding_bytes = 0;
+    if (is_padded) {
+        if (!aws_byte_cursor_read_u8(&payload, &frame->padding_len)) {
+            return s_whole_frame_payload_too_small(decoder);
+        }
+        total_padding_bytes = s_state_padding_len_requires_1_bytes + frame->padding_len;
+        if (total_padding_bytes > frame->payload_len) {
+            DECODER_LOG(ERROR, decoder, "Padding length exceeds payload length");
+            return aws_h2err_from_h2_code(AWS_HTTP2_ERR_PROTOCOL_ERROR);
+        }
+        /* Padding is at the end, drop it */
+        payload.len -= frame->padding_len;
+    }
+
+    if (frame->type == AWS_H2_FRAME_T_DATA) {
+        DECODER_CALL_VTABLE_STREAM_ARGS(
+            decoder, on_data_begin, frame->payload_len, total_padding_bytes, frame->flags.end_stream);
+    }
+
+    if (frame->flags.priority) {
+        /* Throw priority data on the ground, see s_state_fn_priority_block() */
+        if (payload.len < s_state_priority_block_requires_5_bytes) {
+            return s_whole_frame_payload_too_small(decoder);
+        }
+        aws_byte_cursor_advance(&payload, s_state_priority_block_requires_5_bytes);
+    }
+
+    if (payload.len < s_state_frames[frame->type]->bytes_required) {
+        return s_whole_frame_payload_too_small(decoder);
+    }
+
+    switch (frame->type) {
+        case AWS_H2_FRAME_T_DATA: {
+            if (payload.len) {
+                DECODER_CALL_VTABLE_STREAM_ARGS(decoder, on_data_i, payload);
+                aws_byte_cursor_advance(&payload, payload.len);
+            }
+            DECODER_CALL_VTABLE_STREAM(decoder, on_data_end);
+            if (frame->flags.end_stream) {
+                DECODER_CALL_VTABLE_STREAM(decoder, on_end_stream);
+            }
+        } break;
+
+        case AWS_H2_FRAME_T_PRIORITY:
+            break;
+
+        case AWS_H2_FRAME_T_RST_STREAM: {
+            uint32_t error_code = 0;
+            aws_byte_cursor_read_be32(&payload, &error_code);
+            DECODER_CALL_VTABLE_STREAM_ARGS(decoder, on_rst_stream, error_code);
+        } break;
+
+        case AWS_H2_FRAME_T_SETTINGS: {
+            if (frame->flags.ack) {
+                if (payload.len) {
+                    DECODER_LOGF(
+                        ERROR,
+                        decoder,
+                        "SETTINGS ACK frame received, but it has non-0 payload length %zu",
+                        payload.len);
+                    return aws_h2err_from_h2_code(AWS_HTTP2_ERR_FRAME_SIZE_ERROR);
+                }
+                DECODER_CALL_VTABLE(decoder, on_settings_ack);
+                break;
+            }
+
+            if (payload.len % s_state_frame_settings_i_requires_6_bytes != 0) {
+                DECODER_LOGF(
+                    ERROR,
+                    decoder,
+                    "Settings frame payload length is %zu, but it must be divisible by %" PRIu32,
+                    payload.len,
+                    s_state_frame_settings_i_requires_6_bytes);
+                return aws_h2err_from_h2_code(AWS_HTTP2_ERR_FRAME_SIZE_ERROR);
+            }
+
+            uint16_t id = 0;
+            uint32_t value = 0;
+            while (aws_byte_cursor_read_be16(&payload, &id) && aws_byte_cursor_read_be32(&payload, &value)) {
+                err = s_process_setting(decoder, id, value);
+                if (aws_h2err_failed(err)) {
+                    return err;
+                }
+            }
+
+            struct aws_array_list *buffer = &decoder->settings_buffer_list;
+            DECODER_CALL_VTABLE_ARGS(decoder, on_settings, buffer->data, aws_array_list_length(buffer));
+            aws_array_list_clear(buffer);
+        } break;
+
+        case AWS_H2_FRAME_T_PING: {
+            uint8_t opaque_data[AWS_HTTP2_PING_DATA_SIZE] = {0};
+            aws_byte_cursor_read(&payload, opaque_data, AWS_HTTP2_PING_DATA_SIZE);
+            if (frame->flags.ack) {
+                DECODER_CALL_VTABLE_ARGS(decoder, on_ping_ack, opaque_data);
+            } else {
+                DECODER_CALL_VTABLE_ARGS(decoder, on_ping, opaque_data);
+            }
+        } break;
+
+        case AWS_H2_FRAME_T_GOAWAY: {
+            uint32_t last_stream = 0;
+            uint32_t error_code = AWS_HTTP2_ERR_NO_ERROR;
+            aws_byte_cursor_read_be32(&payload, &last_stream);
+            aws_byte_cursor_read_be32(&payload, &error_code);
+            last_stream &= s_31_bit_mask;
+
+            /* The rest is debug data, which can be passed along without buffering it */
+            struct aws_byte_cursor debug_data = aws_byte_cursor_advance(&payload, payload.len);
+            DECODER_CALL_VTABLE_ARGS(decoder, on_goaway, last_stream, error_code, debug_data);
+        } break;
+
+        case AWS_H2_FRAME_T_WINDOW_UPDATE: {
+            uint32_t window_increment = 0;
+            aws_byte_cursor_read_be32(&payload, &window_increment);
+            window_increment &= s_31_bit_mask;
+            DECODER_CALL_VTABLE_STREAM_ARGS(decoder, on_window_update, window_increment);
+        } break;
+
+        case AWS_H2_FRAME_T_UNKNOWN:
+            aws_byte_cursor_advance(&payload, payload.len);
+            break;
+
+        default:
+            /* s_input_holds_whole_frame() doesn't let header-block frames in */
+            AWS_FATAL_ASSERT(false);
+    }
+
+    if (payload.len > 0) {
+        DECODER_LOGF(ERROR, decoder, "%s frame payload is too large", aws_h2_frame_type_to_str(frame->type));
+        return aws_h2err_from_h2_code(AWS_HTTP2_ERR_FRAME_SIZE_ERROR);
+    }
+
+    DECODER_LOGF(TRACE, decoder, "%s frame complete", aws_h2_frame_type_to_str(frame->type));
+    AWS_ZERO_STRUCT(decoder->frame_in_progress);
+    return AWS_H2ERR_SUCCESS;
+}
+
 /* Perform analysis that can't be done until all pseudo-headers are received.
  * Then deliver buffered pseudoheaders via callback */
 static struct aws_h2err s_flush_pseudoheaders(struct aws_h2_decoder *decoder) {
@@ -1140,13 +1367,13 @@ static struct aws_h2err s_flush_pseudoheaders(struct aws_h2_decoder *decoder) {
     /* s_process_header_field() already checked that we're not mixing request & response pseudoheaders */
     bool has_request_pseudoheaders = false;
     for (int i = PSEUDOHEADER_METHOD; i <= PSEUDOHEADER_PATH; ++i) {
-        if (current_block->pseudoheader_values[i] != NULL) {
+        if (current_block->has_pseudoheader[i]) {
             has_request_pseudoheaders = true;
             break;
         }
     }
 
-    bool has_response_pseudoheaders = current_block->pseudoheader_values[PSEUDOHEADER_STATUS] != NULL;
+    bool has_response_pseudoheaders = current_block->has_pseudoheader[PSEUDOHEADER_STATUS];
 
     if (current_block->is_push_promise && !has_request_pseudoheaders) {
         DECODER_LOG(ERROR, decoder, "PUSH_PROMISE is missing :method");
@@ -1161,8 +1388,7 @@ static struct aws_h2err s_flush_pseudoheaders(struct aws_h2_decoder *decoder) {
         /* Response header block. */
 
         /* Determine whether this is an Informational (1xx) response */
-        struct aws_byte_cursor status_value =
-            aws_byte_cursor_from_string(current_block->pseudoheader_values[PSEUDOHEADER_STATUS]);
+        struct aws_byte_cursor status_value = current_block->pseudoheader_values[PSEUDOHEADER_STATUS];
         uint64_t status_code;
         if (status_value.len != 3 || aws_byte_cursor_utf8_parse_u64(status_value, &status_code)) {
             DECODER_LOG(ERROR, decoder, ":status header has invalid value");
@@ -1204,12 +1430,11 @@ static struct aws_h2err s_flush_pseudoheaders(struct aws_h2_decoder *decoder) {
 
     /* Finally, deliver header-fields via callback */
     for (size_t i = 0; i < PSEUDOHEADER_COUNT; ++i) {
-        const struct aws_string *value_string = current_block->pseudoheader_values[i];
-        if (value_string) {
+        if (current_block->has_pseudoheader[i]) {
 
             struct aws_http_header header_field = {
                 .name = *s_pseudoheader_name_to_cursor[i],
-                .value = aws_byte_cursor_from_string(value_string),
+                .value = current_block->pseudoheader_values[i],
                 .compression = current_block->pseudoheader_compression[i],
             };
 
@@ -1237,10 +1462,12 @@ already_malformed:
 
 /* Process single header-field.
  * If it's invalid, mark the header-block as malformed.
- * If it's valid, and header-block is not malformed, deliver via callback. */
+ * If it's valid, and header-block is not malformed, deliver via callback.
+ * If `value_is_transient`, the value must be copied to hold onto it past this call */
 static struct aws_h2err s_process_header_field(
     struct aws_h2_decoder *decoder,
-    const struct aws_http_header *header_field) {
+    const struct aws_http_header *header_field,
+    bool value_is_transient) {
 
     struct aws_header_block_in_progress *current_block = &decoder->header_block_in_progress;
     if (current_block->malformed) {
@@ -1287,18 +1514,19 @@ static struct aws_h2err s_process_header_field(
         }
 
         /* Protect against duplicates. */
-        if (current_block->pseudoheader_values[pseudoheader_enum] != NULL) {
+        if (current_block->has_pseudoheader[pseudoheader_enum]) {
             /* ok to log name of recognized pseudo-header at ERROR level */
             DECODER_LOGF(
                 ERROR, decoder, "'" PRInSTR "' pseudo-header occurred multiple times", AWS_BYTE_CURSOR_PRI(name));
             goto malformed;
         }
 
-        /* Buffer up pseudo-headers, we'll deliver them later once they're all validated. */
+        /* Hold onto pseudo-headers, we'll deliver them later once they're all validated. */
+        current_block->has_pseudoheader[pseudoheader_enum] = true;
+        current_block->pseudoheader_values[pseudoheader_enum] = header_field->value;
         current_block->pseudoheader_compression[pseudoheader_enum] = header_field->compression;
-        current_block->pseudoheader_values[pseudoheader_enum] =
-            aws_string_new_from_cursor(decoder->alloc, &header_field->value);
-        if (!current_block->pseudoheader_values[pseudoheader_enum]) {
+        if (value_is_transient &&
+            aws_hpack_decoder_keep_string(&decoder->hpack, &current_block->pseudoheader_values[pseudoheader_enum])) {
             return aws_h2err_from_last_error();
         }
 
@@ -1330,22 +1558,35 @@ static struct aws_h2err s_process_header_field(
 
         switch (name_enum) {
             case AWS_HTTP_HEADER_COOKIE:
-                /* for a header cookie, we will not fire callback until we concatenate them all, let's store it at the
-                 * buffer */
+                /* for a header cookie, we will not fire callback until we concatenate them all */
                 if (header_field->compression > current_block->cookie_header_compression_type) {
                     current_block->cookie_header_compression_type = header_field->compression;
                 }
 
-                if (current_block->cookies.len) {
-                    /* add a delimiter */
-                    struct aws_byte_cursor delimiter = AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("; ");
-                    if (aws_byte_buf_append_dynamic(&current_block->cookies, &delimiter)) {
+                if (current_block->num_cookies == 0) {
+                    /* Usually there's just one, so don't copy it unless another arrives */
+                    current_block->first_cookie = header_field->value;
+                    if (value_is_transient &&
+                        aws_hpack_decoder_keep_string(&decoder->hpack, &current_block->first_cookie)) {
+                        return aws_h2err_from_last_error();
+                    }
+                } else {
+                    if (current_block->num_cookies == 1 &&
+                        aws_byte_buf_append_dynamic(&current_block->cookies, &current_block->first_cookie)) {
+                        return aws_h2err_from_last_error();
+                    }
+                    if (current_block->cookies.len) {
+                        /* add a delimiter */
+                        struct aws_byte_cursor delimiter = AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("; ");
+                        if (aws_byte_buf_append_dynamic(&current_block->cookies, &delimiter)) {
+                            return aws_h2err_from_last_error();
+                        }
+                    }
+                    if (aws_byte_buf_append_dynamic(&current_block->cookies, &header_field->value)) {
                         return aws_h2err_from_last_error();
                     }
                 }
-                if (aws_byte_buf_append_dynamic(&current_block->cookies, &header_field->value)) {
-                    return aws_h2err_from_last_error();
-                }
+                current_block->num_cookies++;
                 /* Early return */
                 return AWS_H2ERR_SUCCESS;
             case AWS_HTTP_HEADER_TRANSFER_ENCODING:
@@ -1395,14 +1636,17 @@ static struct aws_h2err s_flush_cookie_header(struct aws_h2_decoder *decoder) {
     if (current_block->malformed) {
         return AWS_H2ERR_SUCCESS;
     }
-    if (current_block->cookies.len == 0) {
+    struct aws_byte_cursor cookie_value = current_block->num_cookies > 1
+                                              ? aws_byte_cursor_from_buf(&current_block->cookies)
+                                              : current_block->first_cookie;
+    if (cookie_value.len == 0) {
         /* Nothing to flush */
         return AWS_H2ERR_SUCCESS;
     }
     struct aws_http_header concatenated_cookie;
     struct aws_byte_cursor header_name = AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("cookie");
     concatenated_cookie.name = header_name;
-    concatenated_cookie.value = aws_byte_cursor_from_buf(&current_block->cookies);
+    concatenated_cookie.value = cookie_value;
     concatenated_cookie.compression = current_block->cookie_header_compression_type;
     if (current_block->is_push_promise) {
         DECODER_CALL_VTABLE_STREAM_ARGS(decoder, on_push_promise_i, &concatenated_cookie, AWS_HTTP_HEADER_COOKIE);
@@ -1451,6 +1695,7 @@ static struct aws_h2err s_state_fn_header_block_loop(struct aws_h2_decoder *deco
             }
 
             s_reset_header_block_in_progress(decoder);
+            aws_hpack_decoder_end_header_block(&decoder->hpack);
 
         } else {
             DECODER_LOG(TRACE, decoder, "Done decoding header-block fragment, expecting CONTINUATION frames");
@@ -1542,7 +1787,7 @@ static struct aws_h2err s_state_fn_header_block_entry(struct aws_h2_decoder *dec
             AWS_BYTE_CURSOR_PRI(header_field->name),
             AWS_BYTE_CURSOR_PRI(header_field->value));
 
-        struct aws_h2err err = s_process_header_field(decoder, header_field);
+        struct aws_h2err err = s_process_header_field(decoder, header_field, result.value_is_transient);
         if (aws_h2err_failed(err)) {
             return err;
         }
@@ -0,0 +1,159 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/http/private/h2_frame_pool.h>
+
+#include <aws/common/math.h>
+
+/* Big enough for most frames: prebuilt control frames fit in the 128 byte class,
+ * and HEADERS frames plus their encoded header block fit in the 256 and 512 byte classes */
+static const size_t s_size_classes[AWS_H2_FRAME_POOL_SIZE_CLASS_COUNT] = {64, 128, 256, 512};
+
+/* Caps the memory an idle connection holds on to */
+static const size_t s_max_free_blocks_per_class = 16;
+
+/* size_class of blocks too big for any class */
+#define OVERSIZED SIZE_MAX
+
+/* Each block starts with a header saying which size class it belongs to, padded to keep what follows aligned */
+struct block_header {
+    size_t size_class;
+};
+#define BLOCK_HEADER_SIZE 16
+AWS_STATIC_ASSERT(sizeof(struct block_header) <= BLOCK_HEADER_SIZE);
+
+static struct block_header *s_header_from_ptr(void *ptr) {
+    return (struct block_header *)((uint8_t *)ptr - BLOCK_HEADER_SIZE);
+}
+
+static void *s_pool_acquire(struct aws_allocator *allocator, size_t size) {
+    struct aws_h2_frame_pool *pool = AWS_CONTAINER_OF(allocator, struct aws_h2_frame_pool, allocator);
+
+    size_t size_class = OVERSIZED;
+    for (size_t i = 0; i < AWS_H2_FRAME_POOL_SIZE_CLASS_COUNT; ++i) {
+        if (size <= s_size_classes[i]) {
+            size_class = i;
+            break;
+        }
+    }
+
+    size_t block_size = size;
+    if (size_class != OVERSIZED) {
+        struct aws_h2_frame_pool_free_list *free_list = &pool->free_lists[size_class];
+        if (!aws_linked_list_empty(&free_list->blocks)) {
+            /* Free blocks store their list node where the caller's data goes */
+            void *ptr = aws_linked_list_pop_front(&free_list->blocks);
+            free_list->count--;
+            pool->stats.recycled_count++;
+            pool->stats.live_count++;
+            return ptr;
+        }
+        block_size = s_size_classes[size_class];
+    }
+
+    if (aws_add_size_checked(block_size, BLOCK_HEADER_SIZE, &block_size)) {
+        return NULL;
+    }
+    uint8_t *block = aws_mem_acquire(pool->parent, block_size);
+    if (!block) {
+        return NULL;
+    }
+    pool->stats.parent_acquire_count++;
+    pool->stats.live_count++;
+
+    struct block_header *header = (struct block_header *)block;
+    header->size_class = size_class;
+    return block + BLOCK_HEADER_SIZE;
+}
+
+static void s_pool_release(struct aws_allocator *allocator, void *ptr) {
+    struct aws_h2_frame_pool *pool = AWS_CONTAINER_OF(allocator, struct aws_h2_frame_pool, allocator);
+    struct block_header *header = s_header_from_ptr(ptr);
+
+    AWS_ASSERT(pool->stats.live_count > 0);
+    pool->stats.live_count--;
+
+    if (header->size_class != OVERSIZED) {
+        struct aws_h2_frame_pool_free_list *free_list = &pool->free_lists[header->size_class];
+        if (free_list->count < s_max_free_blocks_per_class) {
+            /* Most recently released first, it's likeliest to still be in cache */
+            aws_linked_list_push_front(&free_list->blocks, (struct aws_linked_list_node *)ptr);
+            free_list->count++;
+            return;
+        }
+    }
+
+    aws_mem_release(pool->parent, header);
+}
+
+static void *s_pool_realloc(struct aws_allocator *allocator, void *old_ptr, size_t old_size, size_t new_size) {
+    if (old_ptr) {
+        /* Grow in place if the block's size class has room */
+        size_t size_class = s_header_from_ptr(old_ptr)->size_class;
+        if (size_class != OVERSIZED && new_size <= s_size_classes[size_class]) {
+            return old_ptr;
+        }
+    }
+
+    void *new_ptr = s_pool_acquire(allocator, new_size);
+    if (!new_ptr) {
+        return NULL;
+    }
+
+    if (old_ptr) {
+        memcpy(new_ptr, old_ptr, aws_min_size(old_size, new_size));
+        s_pool_release(allocator, old_ptr);
+    }
+    return new_ptr;
+}
+
+static void *s_pool_calloc(struct aws_allocator *allocator, size_t num, size_t size) {
+    size_t total_size;
+    if (aws_mul_size_checked(num, size, &total_size)) {
+        return NULL;
+    }
+
+    void *ptr = s_pool_acquire(allocator, total_size);
+    if (ptr) {
+        memset(ptr, 0, total_size);
+    }
+    return ptr;
+}
+
+void aws_h2_frame_pool_init(struct aws_h2_frame_pool *pool, struct aws_allocator *parent) {
+    AWS_PRECONDITION(pool);
+    AWS_PRECONDITION(parent);
+
+    AWS_ZERO_STRUCT(*pool);
+    pool->allocator.mem_acquire = s_pool_acquire;
+    pool->allocator.mem_release = s_pool_release;
+    pool->allocator.mem_realloc = s_pool_realloc;
+    pool->allocator.mem_calloc = s_pool_calloc;
+    pool->allocator.impl = pool;
+    pool->parent = parent;
+
+    for (size_t i = 0; i < AWS_H2_FRAME_POOL_SIZE_CLASS_COUNT; ++i) {
+        aws_linked_list_init(&pool->free_lists[i].blocks);
+    }
+}
+
+void aws_h2_frame_pool_clean_up(struct aws_h2_frame_pool *pool) {
+    AWS_PRECONDITION(pool);
+
+    if (!pool->parent) {
+        return;
+    }
+
+    AWS_ASSERT(pool->stats.live_count == 0);
+
+    for (size_t i = 0; i < AWS_H2_FRAME_POOL_SIZE_CLASS_COUNT; ++i) {
+        struct aws_linked_list *blocks = &pool->free_lists[i].blocks;
+        while (!aws_linked_list_empty(blocks)) {
+            void *ptr = aws_linked_list_pop_front(blocks);
+            aws_mem_release(pool->parent, s_header_from_ptr(ptr));
+        }
+    }
+    AWS_ZERO_STRUCT(*pool);
+}
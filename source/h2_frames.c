@@ -5,6 +5,8 @@
 
 #include <aws/http/private/h2_frames.h>
 
+#include <aws/http/private/request_template.h>
+
 #include <aws/compression/huffman.h>
 
 #include <aws/common/logging.h>
@@ -478,6 +480,9 @@ struct aws_h2_frame_headers {
     /* PUSH_PROMISE-only data */
     uint32_t promised_stream_id;
 
+    /* If set, the template's pre-encoded headers are part of the header-block */
+    struct aws_http_request_template *request_template;
+
     /* State */
     enum {
         AWS_H2_HEADERS_STATE_INIT,
@@ -575,6 +580,27 @@ struct aws_h2_frame *aws_h2_frame_new_headers(
         0 /* HEADERS doesn't have promised_stream_id */);
 }
 
+struct aws_h2_frame *aws_h2_frame_new_headers_from_template(
+    struct aws_allocator *allocator,
+    uint32_t stream_id,
+    const struct aws_http_headers *headers,
+    struct aws_http_request_template *request_template,
+    bool end_stream,
+    uint8_t pad_length,
+    const struct aws_h2_frame_priority_settings *optional_priority) {
+
+    AWS_PRECONDITION(request_template);
+    AWS_PRECONDITION(request_template->version == AWS_HTTP_VERSION_2);
+
+    struct aws_h2_frame *frame_base =
+        aws_h2_frame_new_headers(allocator, stream_id, headers, end_stream, pad_length, optional_priority);
+    if (frame_base) {
+        struct aws_h2_frame_headers *frame = AWS_CONTAINER_OF(frame_base, struct aws_h2_frame_headers, base);
+        frame->request_template = aws_http_request_template_acquire(request_template);
+    }
+    return frame_base;
+}
+
 struct aws_h2_frame *aws_h2_frame_new_push_promise(
     struct aws_allocator *allocator,
     uint32_t stream_id,
@@ -596,6 +622,7 @@ struct aws_h2_frame *aws_h2_frame_new_push_promise(
 static void s_frame_headers_destroy(struct aws_h2_frame *frame_base) {
     struct aws_h2_frame_headers *frame = AWS_CONTAINER_OF(frame_base, struct aws_h2_frame_headers, base);
     aws_http_headers_release((struct aws_http_headers *)frame->headers);
+    aws_http_request_template_release(frame->request_template);
     aws_byte_buf_clean_up(&frame->whole_encoded_header_block);
     aws_mem_release(frame->base.alloc, frame);
 }
@@ -751,7 +778,17 @@ static int s_frame_headers_encode(
     /* Pre-encode the entire header-block into another buffer
      * the first time we're called. */
     if (frame->state == AWS_H2_HEADERS_STATE_INIT) {
-        if (aws_hpack_encode_header_block(&encoder->hpack, frame->headers, &frame->whole_encoded_header_block)) {
+        int err;
+        if (frame->request_template) {
+            err = aws_hpack_encode_header_block_with_prefix(
+                &encoder->hpack,
+                frame->headers,
+                aws_byte_cursor_from_buf(&frame->request_template->encoded_headers),
+                &frame->whole_encoded_header_block);
+        } else {
+            err = aws_hpack_encode_header_block(&encoder->hpack, frame->headers, &frame->whole_encoded_header_block);
+        }
+        if (err) {
             ENCODER_LOGF(
                 ERROR,
                 encoder,
@@ -0,0 +1,96 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/http/private/h2_priority_scheduler.h>
+
+#include <aws/http/private/h2_stream.h>
+
+void aws_h2_priority_scheduler_init(struct aws_h2_priority_scheduler *scheduler) {
+    AWS_PRECONDITION(scheduler);
+
+    for (size_t i = 0; i < AWS_ARRAY_SIZE(scheduler->levels); ++i) {
+        aws_linked_list_init(&scheduler->levels[i].non_incremental);
+        aws_linked_list_init(&scheduler->levels[i].incremental);
+    }
+}
+
+bool aws_h2_priority_scheduler_is_empty(const struct aws_h2_priority_scheduler *scheduler) {
+    AWS_PRECONDITION(scheduler);
+
+    for (size_t i = 0; i < AWS_ARRAY_SIZE(scheduler->levels); ++i) {
+        if (!aws_linked_list_empty(&scheduler->levels[i].non_incremental) ||
+            !aws_linked_list_empty(&scheduler->levels[i].incremental)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void aws_h2_priority_scheduler_push(struct aws_h2_priority_scheduler *scheduler, struct aws_h2_stream *stream) {
+    AWS_PRECONDITION(scheduler);
+    AWS_PRECONDITION(stream);
+    AWS_PRECONDITION(stream->priority.urgency <= AWS_HTTP2_PRIORITY_URGENCY_MAX);
+
+    struct aws_h2_priority_level *level = &scheduler->levels[stream->priority.urgency];
+    if (stream->priority.incremental) {
+        stream->thread_data.priority_deficit = 0;
+        aws_linked_list_push_back(&level->incremental, &stream->node);
+    } else {
+        aws_linked_list_push_back(&level->non_incremental, &stream->node);
+    }
+}
+
+struct aws_h2_stream *aws_h2_priority_scheduler_pop(struct aws_h2_priority_scheduler *scheduler) {
+    AWS_PRECONDITION(scheduler);
+
+    for (size_t i = 0; i < AWS_ARRAY_SIZE(scheduler->levels); ++i) {
+        struct aws_h2_priority_level *level = &scheduler->levels[i];
+
+        if (!aws_linked_list_empty(&level->non_incremental)) {
+            return AWS_CONTAINER_OF(aws_linked_list_pop_front(&level->non_incremental), struct aws_h2_stream, node);
+        }
+
+        /* Deficit round-robin. A stream with bytes left to send is mid-turn.
+         * Otherwise its turn starts by adding its quantum. If it overshot by more than that last turn,
+         * it sits this turn out. Every pass raises every deficit, so this loop ends. */
+        while (!aws_linked_list_empty(&level->incremental)) {
+            struct aws_linked_list_node *node = aws_linked_list_front(&level->incremental);
+            struct aws_h2_stream *stream = AWS_CONTAINER_OF(node, struct aws_h2_stream, node);
+            if (stream->thread_data.priority_deficit <= 0) {
+                stream->thread_data.priority_deficit += stream->priority.quantum;
+            }
+
+            aws_linked_list_remove(node);
+            if (stream->thread_data.priority_deficit > 0) {
+                return stream;
+            }
+            aws_linked_list_push_back(&level->incremental, node);
+        }
+    }
+
+    return NULL;
+}
+
+void aws_h2_priority_scheduler_put_back(
+    struct aws_h2_priority_scheduler *scheduler,
+    struct aws_h2_stream *stream,
+    size_t bytes_sent) {
+
+    AWS_PRECONDITION(scheduler);
+    AWS_PRECONDITION(stream);
+
+    struct aws_h2_priority_level *level = &scheduler->levels[stream->priority.urgency];
+    if (!stream->priority.incremental) {
+        aws_linked_list_push_front(&level->non_incremental, &stream->node);
+        return;
+    }
+
+    stream->thread_data.priority_deficit -= (int64_t)bytes_sent;
+    if (stream->thread_data.priority_deficit > 0) {
+        aws_linked_list_push_front(&level->incremental, &stream->node);
+    } else {
+        aws_linked_list_push_back(&level->incremental, &stream->node);
+    }
+}
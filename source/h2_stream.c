@@ -17,6 +17,7 @@
 
 static void s_stream_destroy(struct aws_http_stream *stream_base);
 static void s_stream_update_window(struct aws_http_stream *stream_base, size_t increment_size);
+static void s_stream_notify_body_ready(struct aws_http_stream *stream_base);
 static int s_stream_reset_stream(struct aws_http_stream *stream_base, uint32_t http2_error);
 static int s_stream_get_received_error_code(struct aws_http_stream *stream_base, uint32_t *out_http2_error);
 static int s_stream_get_sent_error_code(struct aws_http_stream *stream_base, uint32_t *out_http2_error);
@@ -31,8 +32,10 @@ static int s_stream_reset_stream_internal(struct aws_http_stream *stream_base, s
 struct aws_http_stream_vtable s_h2_stream_vtable = {
     .destroy = s_stream_destroy,
     .update_window = s_stream_update_window,
+    .notify_body_ready = s_stream_notify_body_ready,
     .activate = aws_h2_stream_activate,
     .http1_write_chunk = NULL,
+    .http1_write_chunks = NULL,
     .http2_reset_stream = s_stream_reset_stream,
     .http2_get_received_error_code = s_stream_get_received_error_code,
     .http2_get_sent_error_code = s_stream_get_sent_error_code,
@@ -203,27 +206,6 @@ static struct aws_h2err s_check_state_allows_frame_type(
     return aws_h2err_from_h2_code(h2_error_code);
 }
 
-static int s_stream_send_update_window_frame(struct aws_h2_stream *stream, size_t increment_size) {
-    AWS_PRECONDITION_ON_CHANNEL_THREAD(stream);
-    AWS_PRECONDITION(increment_size <= AWS_H2_WINDOW_UPDATE_MAX);
-
-    struct aws_h2_connection *connection = s_get_h2_connection(stream);
-    struct aws_h2_frame *stream_window_update_frame =
-        aws_h2_frame_new_window_update(stream->base.alloc, stream->base.id, (uint32_t)increment_size);
-
-    if (!stream_window_update_frame) {
-        AWS_H2_STREAM_LOGF(
-            ERROR,
-            stream,
-            "Failed to create WINDOW_UPDATE frame on connection, error %s",
-            aws_error_name(aws_last_error()));
-        return AWS_OP_ERR;
-    }
-    aws_h2_connection_enqueue_outgoing_frame(connection, stream_window_update_frame);
-
-    return AWS_OP_SUCCESS;
-}
-
 struct aws_h2_stream *aws_h2_stream_new_request(
     struct aws_http_connection *client_connection,
     const struct aws_http_make_request_options *options) {
@@ -283,6 +265,19 @@ struct aws_h2_stream *aws_h2_stream_new_request(
     stream->synced_data.manual_write_ended = !options->http2_use_manual_data_writes;
     stream->manual_write = options->http2_use_manual_data_writes;
 
+    /* Without a priority, streams share the connection equally, as they always have */
+    uint16_t weight = AWS_HTTP2_PRIORITY_WEIGHT_DEFAULT;
+    stream->priority.urgency = AWS_HTTP2_PRIORITY_URGENCY_DEFAULT;
+    stream->priority.incremental = true;
+    if (options->http2_priority) {
+        stream->priority.urgency = options->http2_priority->urgency;
+        stream->priority.incremental = options->http2_priority->incremental;
+        if (options->http2_priority->weight) {
+            weight = options->http2_priority->weight;
+        }
+    }
+    stream->priority.quantum = AWS_H2_PRIORITY_QUANTUM_DEFAULT / AWS_HTTP2_PRIORITY_WEIGHT_DEFAULT * weight;
+
     /* if there's a request body to write, add it as the first outgoing write */
     struct aws_input_stream *body_stream = aws_http_message_get_body_stream(options->request);
     if (body_stream) {
@@ -332,6 +327,7 @@ static void s_stream_cross_thread_work_task(struct aws_channel_task *task, void
     bool reset_called;
     size_t window_update_size;
     struct aws_h2err reset_error;
+    bool is_body_ready;
 
     struct aws_linked_list pending_writes;
     aws_linked_list_init(&pending_writes);
@@ -345,6 +341,8 @@ static void s_stream_cross_thread_work_task(struct aws_channel_task *task, void
         stream->synced_data.window_update_size = 0;
         reset_called = stream->synced_data.reset_called;
         reset_error = stream->synced_data.reset_error;
+        is_body_ready = stream->synced_data.is_body_ready;
+        stream->synced_data.is_body_ready = false;
 
         /* copy out pending writes */
         aws_linked_list_swap_contents(&pending_writes, &stream->synced_data.pending_write_list);
@@ -353,16 +351,10 @@ static void s_stream_cross_thread_work_task(struct aws_channel_task *task, void
     } /* END CRITICAL SECTION */
 
     if (window_update_size > 0 && !ignore_window_update) {
-        if (s_stream_send_update_window_frame(stream, window_update_size)) {
-            /* Treat this as a connection error */
-            aws_h2_connection_shutdown_due_to_write_err(connection, aws_last_error());
-        }
+        /* The user asked for it, so send it on the next write however small it is */
+        aws_h2_connection_add_stream_window_update(connection, stream, (uint32_t)window_update_size, true /*forced*/);
     }
 
-    /* The largest legal value will be 2 * max window size, which is way less than INT64_MAX, so if the window_size_self
-     * overflows, remote peer will find it out. So just apply the change and ignore the possible overflow.*/
-    stream->thread_data.window_size_self += window_update_size;
-
     if (reset_called) {
         struct aws_h2err returned_h2err = s_send_rst_and_close_stream(stream, reset_error);
         if (aws_h2err_failed(returned_h2err)) {
@@ -373,9 +365,15 @@ static void s_stream_cross_thread_work_task(struct aws_channel_task *task, void
     if (stream->thread_data.waiting_for_writes && !aws_linked_list_empty(&pending_writes)) {
         /* Got more to write, move the stream back to outgoing list */
         aws_linked_list_remove(&stream->node);
-        aws_linked_list_push_back(&connection->thread_data.outgoing_streams_list, &stream->node);
+        aws_h2_priority_scheduler_push(&connection->thread_data.outgoing_streams, stream);
         stream->thread_data.waiting_for_writes = false;
     }
+    if (stream->thread_data.waiting_for_body_ready && is_body_ready) {
+        /* Body stream has data again, move the stream back to outgoing list */
+        aws_linked_list_remove(&stream->node);
+        aws_h2_priority_scheduler_push(&connection->thread_data.outgoing_streams, stream);
+        stream->thread_data.waiting_for_body_ready = false;
+    }
     /* move any pending writes to the outgoing write queue */
     aws_linked_list_move_all_back(&stream->thread_data.outgoing_writes, &pending_writes);
 
@@ -520,6 +518,31 @@ static void s_stream_update_window(struct aws_http_stream *stream_base, size_t i
     return;
 }
 
+static void s_stream_notify_body_ready(struct aws_http_stream *stream_base) {
+    AWS_PRECONDITION(stream_base);
+    struct aws_h2_stream *stream = AWS_CONTAINER_OF(stream_base, struct aws_h2_stream, base);
+    struct aws_h2_connection *connection = s_get_h2_connection(stream);
+
+    bool cross_thread_work_should_schedule = false;
+    { /* BEGIN CRITICAL SECTION */
+        s_lock_synced_data(stream);
+        /* Only active streams have a body being sent */
+        if (stream->synced_data.api_state == AWS_H2_STREAM_API_STATE_ACTIVE) {
+            stream->synced_data.is_body_ready = true;
+            cross_thread_work_should_schedule = !stream->synced_data.is_cross_thread_work_task_scheduled;
+            stream->synced_data.is_cross_thread_work_task_scheduled = true;
+        }
+        s_unlock_synced_data(stream);
+    } /* END CRITICAL SECTION */
+
+    if (cross_thread_work_should_schedule) {
+        AWS_H2_STREAM_LOG(TRACE, stream, "Scheduling stream cross-thread work task");
+        /* increment the refcount of stream to keep it alive until the task runs */
+        aws_atomic_fetch_add(&stream->base.refcount, 1);
+        aws_channel_schedule_task_now(connection->base.channel_slot->channel, &stream->cross_thread_work_task);
+    }
+}
+
 static int s_stream_reset_stream_internal(struct aws_http_stream *stream_base, struct aws_h2err stream_error) {
 
     struct aws_h2_stream *stream = AWS_CONTAINER_OF(stream_base, struct aws_h2_stream, base);
@@ -615,8 +638,8 @@ static struct aws_h2err s_send_rst_and_close_stream(struct aws_h2_stream *stream
         stream_error.h2_code);
 
     /* Send RST_STREAM */
-    struct aws_h2_frame *rst_stream_frame =
-        aws_h2_frame_new_rst_stream(stream->base.alloc, stream->base.id, stream_error.h2_code);
+    struct aws_h2_frame *rst_stream_frame = aws_h2_frame_new_rst_stream(
+        aws_h2_connection_get_frame_allocator(connection), stream->base.id, stream_error.h2_code);
     AWS_FATAL_ASSERT(rst_stream_frame != NULL);
     aws_h2_connection_enqueue_outgoing_frame(connection, rst_stream_frame); /* connection takes ownership of frame */
     stream->sent_reset_error_code = stream_error.h2_code;
@@ -694,13 +717,27 @@ int aws_h2_stream_on_activated(struct aws_h2_stream *stream, enum aws_h2_stream_
 
     struct aws_http_headers *h2_headers = aws_http_message_get_headers(msg);
 
-    struct aws_h2_frame *headers_frame = aws_h2_frame_new_headers(
-        stream->base.alloc,
-        stream->base.id,
-        h2_headers,
-        !with_data /* end_stream */,
-        0 /* padding - not currently configurable via public API */,
-        NULL /* priority - not currently configurable via public API */);
+    /* If the request was made from a template, its headers were HPACK-encoded in advance */
+    struct aws_http_request_template *request_template = aws_http_message_get_request_template(msg);
+    struct aws_h2_frame *headers_frame;
+    if (request_template) {
+        headers_frame = aws_h2_frame_new_headers_from_template(
+            aws_h2_connection_get_frame_allocator(connection),
+            stream->base.id,
+            h2_headers,
+            request_template,
+            !with_data /* end_stream */,
+            0 /* padding - not currently configurable via public API */,
+            NULL /* priority - not currently configurable via public API */);
+    } else {
+        headers_frame = aws_h2_frame_new_headers(
+            aws_h2_connection_get_frame_allocator(connection),
+            stream->base.id,
+            h2_headers,
+            !with_data /* end_stream */,
+            0 /* padding - not currently configurable via public API */,
+            NULL /* priority - not currently configurable via public API */);
+    }
 
     if (!headers_frame) {
         AWS_H2_STREAM_LOGF(ERROR, stream, "Failed to create HEADERS frame: %s", aws_error_name(aws_last_error()));
@@ -714,7 +751,7 @@ int aws_h2_stream_on_activated(struct aws_h2_stream *stream, enum aws_h2_stream_
         connection->thread_data.settings_self[AWS_HTTP2_SETTINGS_INITIAL_WINDOW_SIZE];
 
     if (with_data) {
-        /* If stream has DATA to send, put it in the outgoing_streams_list, and we'll send data later */
+        /* If stream has DATA to send, the connection schedules it in outgoing_streams, and we'll send data later */
         stream->thread_data.state = AWS_H2_STREAM_STATE_OPEN;
         AWS_H2_STREAM_LOG(TRACE, stream, "Sending HEADERS. State -> OPEN");
     } else {
@@ -912,13 +949,19 @@ struct aws_h2err aws_h2_stream_on_decoder_headers_i(
                 }
                 stream->thread_data.content_length_received = true;
             } break;
+            case AWS_HTTP_HEADER_CONTENT_ENCODING: {
+                if (block_type == AWS_HTTP_HEADER_BLOCK_MAIN) {
+                    aws_http_stream_on_incoming_coding_header(
+                        &stream->base, header->value, false /*is_transfer_encoding*/);
+                }
+            } break;
             default:
                 break;
         }
     }
 
     if (stream->base.on_incoming_headers) {
-        if (stream->base.on_incoming_headers(&stream->base, block_type, header, 1, stream->base.user_data)) {
+        if (aws_http_stream_on_incoming_header(&stream->base, block_type, header)) {
             AWS_H2_STREAM_LOGF(
                 ERROR, stream, "Incoming header callback raised error, %s", aws_error_name(aws_last_error()));
             return s_send_rst_and_close_stream(stream, aws_h2err_from_last_error());
@@ -963,6 +1006,12 @@ struct aws_h2err aws_h2_stream_on_decoder_headers_end(
             AWS_ASSERT(0);
     }
 
+    if (aws_http_stream_flush_incoming_headers(&stream->base, block_type)) {
+        AWS_H2_STREAM_LOGF(
+            ERROR, stream, "Incoming header callback raised error, %s", aws_error_name(aws_last_error()));
+        return s_send_rst_and_close_stream(stream, aws_h2err_from_last_error());
+    }
+
     if (stream->base.on_incoming_header_block_done) {
         if (stream->base.on_incoming_header_block_done(&stream->base, block_type, stream->base.user_data)) {
             AWS_H2_STREAM_LOGF(
@@ -996,23 +1045,6 @@ struct aws_h2err aws_h2_stream_on_decoder_push_promise(struct aws_h2_stream *str
     return AWS_H2ERR_SUCCESS;
 }
 
-static int s_stream_send_update_window(struct aws_h2_stream *stream, uint32_t window_size) {
-    struct aws_h2_frame *stream_window_update_frame =
-        aws_h2_frame_new_window_update(stream->base.alloc, stream->base.id, window_size);
-    if (!stream_window_update_frame) {
-        AWS_H2_STREAM_LOGF(
-            ERROR,
-            stream,
-            "WINDOW_UPDATE frame on stream failed to be sent, error %s",
-            aws_error_name(aws_last_error()));
-        return AWS_OP_ERR;
-    }
-
-    aws_h2_connection_enqueue_outgoing_frame(s_get_h2_connection(stream), stream_window_update_frame);
-    stream->thread_data.window_size_self += window_size;
-    return AWS_OP_SUCCESS;
-}
-
 struct aws_h2err aws_h2_stream_on_decoder_data_begin(
     struct aws_h2_stream *stream,
     uint32_t payload_len,
@@ -1080,9 +1112,13 @@ struct aws_h2err aws_h2_stream_on_decoder_data_begin(
         }
 
         if (auto_window_update != 0) {
-            if (s_stream_send_update_window(stream, auto_window_update)) {
-                return aws_h2err_from_last_error();
-            }
+            /* In manual mode this only accounts for padding, which the user can't do anything about, so don't hold
+             * it back waiting for them */
+            aws_h2_connection_add_stream_window_update(
+                s_get_h2_connection(stream),
+                stream,
+                auto_window_update,
+                stream->base.owning_connection->stream_manual_window_management);
             AWS_H2_STREAM_LOGF(
                 TRACE,
                 stream,
@@ -1101,12 +1137,9 @@ struct aws_h2err aws_h2_stream_on_decoder_data_i(struct aws_h2_stream *stream, s
     /* Not calling s_check_state_allows_frame_type() here because we already checked at start of DATA frame in
      * aws_h2_stream_on_decoder_data_begin() */
 
-    if (stream->base.on_incoming_body) {
-        if (stream->base.on_incoming_body(&stream->base, &data, stream->base.user_data)) {
-            AWS_H2_STREAM_LOGF(
-                ERROR, stream, "Incoming body callback raised error, %s", aws_error_name(aws_last_error()));
-            return s_send_rst_and_close_stream(stream, aws_h2err_from_last_error());
-        }
+    if (aws_http_stream_on_incoming_body(&stream->base, &data)) {
+        AWS_H2_STREAM_LOGF(ERROR, stream, "Incoming body callback raised error, %s", aws_error_name(aws_last_error()));
+        return s_send_rst_and_close_stream(stream, aws_h2err_from_last_error());
     }
 
     return AWS_H2ERR_SUCCESS;
@@ -1180,6 +1213,13 @@ struct aws_h2err aws_h2_stream_on_decoder_end_stream(struct aws_h2_stream *strea
         }
     }
 
+    /* A compressed body must not end early */
+    if (aws_http_stream_on_incoming_body_done(&stream->base)) {
+        AWS_H2_STREAM_LOGF(
+            ERROR, stream, "Incoming body could not be decompressed, %s", aws_error_name(aws_last_error()));
+        return s_send_rst_and_close_stream(stream, aws_h2err_from_last_error());
+    }
+
     if (stream->thread_data.state == AWS_H2_STREAM_STATE_HALF_CLOSED_LOCAL) {
         /* Both sides have sent END_STREAM */
         stream->thread_data.state = AWS_H2_STREAM_STATE_CLOSED;
@@ -0,0 +1,294 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/http/private/h2_stream_table.h>
+
+#include <aws/common/math.h>
+
+/* Enough for a typical connection's SETTINGS_MAX_CONCURRENT_STREAMS, without ever growing */
+static const size_t s_ring_initial_capacity = 128;
+
+int aws_h2_stream_table_init(
+    struct aws_h2_stream_table *table,
+    struct aws_allocator *allocator,
+    uint32_t local_first_id) {
+
+    AWS_PRECONDITION(table);
+    AWS_PRECONDITION(allocator);
+
+    AWS_ZERO_STRUCT(*table);
+    table->allocator = allocator;
+    table->ring_id_parity = local_first_id & 1;
+    return aws_hash_table_init(&table->outliers, allocator, 8, aws_hash_ptr, aws_ptr_eq, NULL, NULL);
+}
+
+void aws_h2_stream_table_clean_up(struct aws_h2_stream_table *table) {
+    AWS_PRECONDITION(table);
+
+    if (table->ring.slots) {
+        aws_mem_release(table->allocator, table->ring.slots);
+    }
+    aws_hash_table_clean_up(&table->outliers);
+    AWS_ZERO_STRUCT(*table);
+}
+
+size_t aws_h2_stream_table_count(const struct aws_h2_stream_table *table) {
+    AWS_PRECONDITION(table);
+
+    return table->ring.count + aws_hash_table_get_entry_count(&table->outliers) -
+           table->outliers_removed_while_iterating;
+}
+
+/* If id belongs in the ring's current window, set its offset from head and return true */
+static bool s_ring_offset(const struct aws_h2_stream_table *table, uint32_t stream_id, size_t *out_offset) {
+    if (table->ring.len == 0 || (stream_id & 1) != table->ring_id_parity || stream_id < table->ring.base_id) {
+        return false;
+    }
+
+    size_t offset = (stream_id - table->ring.base_id) / 2;
+    if (offset >= table->ring.len) {
+        return false;
+    }
+
+    *out_offset = offset;
+    return true;
+}
+
+static struct aws_h2_stream **s_ring_slot(const struct aws_h2_stream_table *table, size_t offset) {
+    return &table->ring.slots[(table->ring.head + offset) & (table->ring.capacity - 1)];
+}
+
+struct aws_h2_stream *aws_h2_stream_table_find(const struct aws_h2_stream_table *table, uint32_t stream_id) {
+    AWS_PRECONDITION(table);
+
+    size_t offset;
+    if (s_ring_offset(table, stream_id, &offset)) {
+        struct aws_h2_stream *stream = *s_ring_slot(table, offset);
+        if (stream) {
+            return stream;
+        }
+    }
+
+    if (aws_hash_table_get_entry_count(&table->outliers) == 0) {
+        return NULL;
+    }
+
+    /* Value is NULL if it was removed while iterating */
+    struct aws_hash_element *found = NULL;
+    aws_hash_table_find(&table->outliers, (void *)(size_t)stream_id, &found);
+    return found ? found->value : NULL;
+}
+
+/* Really remove entries that were removed while iterating */
+static void s_purge_outliers_removed_while_iterating(struct aws_h2_stream_table *table) {
+    if (table->outliers_removed_while_iterating > 0) {
+        for (struct aws_hash_iter iter = aws_hash_iter_begin(&table->outliers); !aws_hash_iter_done(&iter);
+             aws_hash_iter_next(&iter)) {
+            if (iter.element.value == NULL) {
+                aws_hash_iter_delete(&iter, false /*destroy_contents*/);
+            }
+        }
+        table->outliers_removed_while_iterating = 0;
+    }
+    table->is_iterating = false;
+}
+
+/* Drop empty slots from the front of the ring, so the head slot is always in use */
+static void s_ring_trim_front(struct aws_h2_stream_table *table) {
+    while (table->ring.len > 0 && *s_ring_slot(table, 0) == NULL) {
+        table->ring.head = (table->ring.head + 1) & (table->ring.capacity - 1);
+        table->ring.base_id += 2;
+        table->ring.len--;
+    }
+}
+
+/* Move the ring into a bigger array, unwrapping it so head is at index 0 */
+static int s_ring_grow(struct aws_h2_stream_table *table, size_t min_capacity) {
+    size_t new_capacity = aws_max_size(table->ring.capacity, s_ring_initial_capacity);
+    while (new_capacity < min_capacity) {
+        if (aws_mul_size_checked(new_capacity, 2, &new_capacity)) {
+            return AWS_OP_ERR;
+        }
+    }
+
+    struct aws_h2_stream **new_slots = aws_mem_calloc(table->allocator, new_capacity, sizeof(struct aws_h2_stream *));
+    if (!new_slots) {
+        return AWS_OP_ERR;
+    }
+
+    for (size_t offset = 0; offset < table->ring.len; ++offset) {
+        new_slots[offset] = *s_ring_slot(table, offset);
+    }
+
+    aws_mem_release(table->allocator, table->ring.slots);
+    table->ring.slots = new_slots;
+    table->ring.capacity = new_capacity;
+    table->ring.head = 0;
+    return AWS_OP_SUCCESS;
+}
+
+/* Make room in the ring for the id at `offset` from head, returns the new offset.
+ * If the ring is mostly empty slots, due to a few long-lived streams at the front,
+ * those streams are moved to the outliers table and the ring slides forward. Otherwise it grows */
+static int s_ring_make_room(struct aws_h2_stream_table *table, size_t offset, size_t *out_offset) {
+    while (offset >= table->ring.capacity && table->ring.count * 2 < table->ring.capacity) {
+        struct aws_h2_stream **front = s_ring_slot(table, 0);
+        if (aws_hash_table_put(&table->outliers, (void *)(size_t)table->ring.base_id, *front, NULL)) {
+            return AWS_OP_ERR;
+        }
+        *front = NULL;
+        table->ring.count--;
+
+        size_t prev_len = table->ring.len;
+        s_ring_trim_front(table);
+        size_t slid = prev_len - table->ring.len;
+        if (table->ring.len == 0) {
+            /* Ring emptied, caller starts it over */
+            *out_offset = 0;
+            return AWS_OP_SUCCESS;
+        }
+        offset -= slid;
+    }
+
+    if (offset >= table->ring.capacity) {
+        if (s_ring_grow(table, offset + 1)) {
+            return AWS_OP_ERR;
+        }
+    }
+
+    *out_offset = offset;
+    return AWS_OP_SUCCESS;
+}
+
+int aws_h2_stream_table_insert(struct aws_h2_stream_table *table, uint32_t stream_id, struct aws_h2_stream *stream) {
+    AWS_PRECONDITION(table);
+    AWS_PRECONDITION(stream);
+    AWS_PRECONDITION(!table->is_iterating);
+    AWS_PRECONDITION(aws_h2_stream_table_find(table, stream_id) == NULL);
+
+    bool in_ring_window = (stream_id & 1) == table->ring_id_parity &&
+                          (table->ring.len == 0 || stream_id >= table->ring.base_id);
+    if (!in_ring_window) {
+        return aws_hash_table_put(&table->outliers, (void *)(size_t)stream_id, stream, NULL);
+    }
+
+    size_t offset = table->ring.len == 0 ? 0 : (stream_id - table->ring.base_id) / 2;
+    if (table->ring.len > 0 && offset >= table->ring.capacity) {
+        if (s_ring_make_room(table, offset, &offset)) {
+            return AWS_OP_ERR;
+        }
+    }
+
+    if (table->ring.len == 0) {
+        /* Start the ring at this id */
+        if (table->ring.capacity == 0 && s_ring_grow(table, s_ring_initial_capacity)) {
+            return AWS_OP_ERR;
+        }
+        table->ring.head = 0;
+        table->ring.base_id = stream_id;
+        offset = 0;
+    }
+
+    struct aws_h2_stream **slot = s_ring_slot(table, offset);
+    AWS_ASSERT(*slot == NULL);
+    *slot = stream;
+    table->ring.count++;
+    table->ring.len = aws_max_size(table->ring.len, offset + 1);
+    return AWS_OP_SUCCESS;
+}
+
+void aws_h2_stream_table_remove(struct aws_h2_stream_table *table, uint32_t stream_id) {
+    AWS_PRECONDITION(table);
+
+    size_t offset;
+    if (s_ring_offset(table, stream_id, &offset)) {
+        struct aws_h2_stream **slot = s_ring_slot(table, offset);
+        if (*slot) {
+            *slot = NULL;
+            table->ring.count--;
+            s_ring_trim_front(table);
+            return;
+        }
+    }
+
+    if (table->is_iterating) {
+        struct aws_hash_element *found = NULL;
+        aws_hash_table_find(&table->outliers, (void *)(size_t)stream_id, &found);
+        if (found && found->value) {
+            found->value = NULL;
+            table->outliers_removed_while_iterating++;
+        }
+        return;
+    }
+
+    aws_hash_table_remove(&table->outliers, (void *)(size_t)stream_id, NULL, NULL);
+}
+
+void aws_h2_stream_table_iter_init(struct aws_h2_stream_table_iter *iter, struct aws_h2_stream_table *table) {
+    AWS_PRECONDITION(iter);
+    AWS_PRECONDITION(table);
+    AWS_PRECONDITION(!table->is_iterating);
+
+    table->is_iterating = true;
+
+    AWS_ZERO_STRUCT(*iter);
+    iter->table = table;
+    if (table->ring.len > 0) {
+        iter->next_id = table->ring.base_id;
+        iter->end_id = (uint64_t)table->ring.base_id + (uint64_t)table->ring.len * 2;
+    }
+}
+
+struct aws_h2_stream *aws_h2_stream_table_iter_next(struct aws_h2_stream_table_iter *iter) {
+    AWS_PRECONDITION(iter);
+
+    struct aws_h2_stream_table *table = iter->table;
+    if (!table) {
+        /* Iteration already ended */
+        return NULL;
+    }
+
+    /* Visit ring by id, rather than by slot, so it doesn't matter if removals slide the ring forward */
+    while (iter->next_id < iter->end_id) {
+        uint32_t stream_id = (uint32_t)iter->next_id;
+        iter->next_id += 2;
+
+        size_t offset;
+        if (s_ring_offset(table, stream_id, &offset)) {
+            struct aws_h2_stream *stream = *s_ring_slot(table, offset);
+            if (stream) {
+                return stream;
+            }
+        }
+    }
+
+    if (!iter->outliers_started) {
+        iter->outliers_iter = aws_hash_iter_begin(&table->outliers);
+        iter->outliers_started = true;
+    } else if (!aws_hash_iter_done(&iter->outliers_iter)) {
+        aws_hash_iter_next(&iter->outliers_iter);
+    }
+
+    /* Skip entries removed during this iteration */
+    while (!aws_hash_iter_done(&iter->outliers_iter)) {
+        struct aws_h2_stream *stream = iter->outliers_iter.element.value;
+        if (stream) {
+            return stream;
+        }
+        aws_hash_iter_next(&iter->outliers_iter);
+    }
+
+    aws_h2_stream_table_iter_clean_up(iter);
+    return NULL;
+}
+
+void aws_h2_stream_table_iter_clean_up(struct aws_h2_stream_table_iter *iter) {
+    AWS_PRECONDITION(iter);
+
+    if (iter->table) {
+        s_purge_outliers_removed_while_iterating(iter->table);
+        iter->table = NULL;
+    }
+}
@@ -4,6 +4,8 @@
  */
 #include <aws/http/private/hpack.h>
 
+#include <aws/common/math.h>
+
 /* #TODO test empty strings */
 
 /* #TODO remove all OOM error handling in HTTP/2 & HPACK. make functions void if possible */
@@ -17,7 +19,7 @@ const size_t s_hpack_dynamic_table_max_size = 16 * 1024 * 1024;
 /* Used for growing the dynamic table buffer when it fills up */
 const float s_hpack_dynamic_table_buffer_growth_rate = 1.5F;
 
-struct aws_http_header s_static_header_table[] = {
+static const struct aws_http_header s_static_header_table[] = {
 #define HEADER(_index, _name)                                                                                          \
     [_index] = {                                                                                                       \
         .name = AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL(_name),                                                          \
@@ -36,82 +38,29 @@ struct aws_http_header s_static_header_table[] = {
 };
 static const size_t s_static_header_table_size = AWS_ARRAY_SIZE(s_static_header_table);
 
-struct aws_byte_cursor s_static_header_table_name_only[] = {
-#define HEADER(_index, _name) [_index] = AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL(_name),
-#define HEADER_WITH_VALUE(_index, _name, _value) HEADER(_index, _name)
-
-#include <aws/http/private/hpack_header_static_table.def>
-
-#undef HEADER
-#undef HEADER_WITH_VALUE
-};
-
-/* aws_http_header * -> size_t */
-static struct aws_hash_table s_static_header_reverse_lookup;
-/* aws_byte_cursor * -> size_t */
-static struct aws_hash_table s_static_header_reverse_lookup_name_only;
-
-static uint64_t s_header_hash(const void *key) {
-    const struct aws_http_header *header = key;
-
-    return aws_hash_combine(aws_hash_byte_cursor_ptr(&header->name), aws_hash_byte_cursor_ptr(&header->value));
-}
-
-static bool s_header_eq(const void *a, const void *b) {
-    const struct aws_http_header *left = a;
-    const struct aws_http_header *right = b;
-
-    if (!aws_byte_cursor_eq(&left->name, &right->name)) {
-        return false;
+/* Returns the bucket for a name in the static table, or NULL if the name isn't in the static table */
+static const struct aws_hpack_static_name_bucket *s_static_table_find_name(struct aws_byte_cursor name) {
+    if (name.len == 0) {
+        return NULL;
     }
 
-    /* If the header stored in the table doesn't have a value, then it's a match */
-    return aws_byte_cursor_eq(&left->value, &right->value);
-}
-
-void aws_hpack_static_table_init(struct aws_allocator *allocator) {
-
-    int result = aws_hash_table_init(
-        &s_static_header_reverse_lookup,
-        allocator,
-        s_static_header_table_size - 1,
-        s_header_hash,
-        s_header_eq,
-        NULL,
-        NULL);
-    AWS_FATAL_ASSERT(AWS_OP_SUCCESS == result);
-
-    result = aws_hash_table_init(
-        &s_static_header_reverse_lookup_name_only,
-        allocator,
-        s_static_header_table_size - 1,
-        aws_hash_byte_cursor_ptr,
-        (aws_hash_callback_eq_fn *)aws_byte_cursor_eq,
-        NULL,
-        NULL);
-    AWS_FATAL_ASSERT(AWS_OP_SUCCESS == result);
-
-    /* Process in reverse so that name_only prefers lower indices */
-    for (size_t i = s_static_header_table_size - 1; i > 0; --i) {
-        /* the tables are created as 1-based indexing */
-        result = aws_hash_table_put(&s_static_header_reverse_lookup, &s_static_header_table[i], (void *)i, NULL);
-        AWS_FATAL_ASSERT(AWS_OP_SUCCESS == result);
-
-        result = aws_hash_table_put(
-            &s_static_header_reverse_lookup_name_only, &s_static_header_table_name_only[i], (void *)(i), NULL);
-        AWS_FATAL_ASSERT(AWS_OP_SUCCESS == result);
+    const struct aws_hpack_static_name_bucket *bucket =
+        &aws_hpack_static_name_buckets[AWS_HPACK_STATIC_NAME_HASH(name.len, name.ptr[0], name.ptr[name.len - 1])];
+    if (bucket->index == 0 || !aws_byte_cursor_eq(&name, &s_static_header_table[bucket->index].name)) {
+        return NULL;
     }
-}
-
-void aws_hpack_static_table_clean_up() {
-    aws_hash_table_clean_up(&s_static_header_reverse_lookup);
-    aws_hash_table_clean_up(&s_static_header_reverse_lookup_name_only);
+    return bucket;
 }
 
 #define HPACK_LOGF(level, hpack, text, ...)                                                                            \
     AWS_LOGF_##level((hpack)->log_subject, "id=%p [HPACK]: " text, (hpack)->log_id, __VA_ARGS__)
 #define HPACK_LOG(level, hpack, text) HPACK_LOGF(level, hpack, "%s", text)
 
+/* Marks an empty slot in the reverse lookups */
+#define LOOKUP_SLOT_EMPTY UINT32_MAX
+
+static int s_dynamic_table_resize_buffer(struct aws_hpack_context *context, size_t new_max_elements);
+
 void aws_hpack_context_init(
     struct aws_hpack_context *context,
     struct aws_allocator *allocator,
@@ -123,49 +72,16 @@ void aws_hpack_context_init(
     context->log_subject = log_subject;
     context->log_id = log_id;
 
-    /* Initialize dynamic table */
+    /* Initialize dynamic table. The arena is allocated on first insert */
     context->dynamic_table.max_size = s_hpack_dynamic_table_initial_size;
-    context->dynamic_table.buffer_capacity = s_hpack_dynamic_table_initial_elements;
-    context->dynamic_table.buffer =
-        aws_mem_calloc(allocator, context->dynamic_table.buffer_capacity, sizeof(struct aws_http_header));
-
-    aws_hash_table_init(
-        &context->dynamic_table.reverse_lookup,
-        allocator,
-        s_hpack_dynamic_table_initial_elements,
-        s_header_hash,
-        s_header_eq,
-        NULL,
-        NULL);
-
-    aws_hash_table_init(
-        &context->dynamic_table.reverse_lookup_name_only,
-        allocator,
-        s_hpack_dynamic_table_initial_elements,
-        aws_hash_byte_cursor_ptr,
-        (aws_hash_callback_eq_fn *)aws_byte_cursor_eq,
-        NULL,
-        NULL);
-}
-
-static struct aws_http_header *s_dynamic_table_get(const struct aws_hpack_context *context, size_t index);
-
-static void s_clean_up_dynamic_table_buffer(struct aws_hpack_context *context) {
-    while (context->dynamic_table.num_elements > 0) {
-        struct aws_http_header *back = s_dynamic_table_get(context, context->dynamic_table.num_elements - 1);
-        context->dynamic_table.num_elements -= 1;
-        /* clean-up the memory we allocate for it */
-        aws_mem_release(context->allocator, back->name.ptr);
-    }
-    aws_mem_release(context->allocator, context->dynamic_table.buffer);
+    s_dynamic_table_resize_buffer(context, s_hpack_dynamic_table_initial_elements);
 }
 
 void aws_hpack_context_clean_up(struct aws_hpack_context *context) {
-    if (context->dynamic_table.buffer) {
-        s_clean_up_dynamic_table_buffer(context);
-    }
-    aws_hash_table_clean_up(&context->dynamic_table.reverse_lookup);
-    aws_hash_table_clean_up(&context->dynamic_table.reverse_lookup_name_only);
+    aws_mem_release(context->allocator, context->dynamic_table.buffer);
+    aws_mem_release(context->allocator, context->dynamic_table.arena);
+    aws_mem_release(context->allocator, context->dynamic_table.reverse_lookup);
+    aws_mem_release(context->allocator, context->dynamic_table.reverse_lookup_name_only);
     AWS_ZERO_STRUCT(*context);
 }
 
@@ -193,6 +109,11 @@ static struct aws_http_header *s_dynamic_table_get(const struct aws_hpack_contex
                 .buffer[(context->dynamic_table.index_0 + index) % context->dynamic_table.buffer_capacity];
 }
 
+/* Position in the buffer of the header at this index */
+static size_t s_dynamic_table_position(const struct aws_hpack_context *context, size_t index) {
+    return (context->dynamic_table.index_0 + index) % context->dynamic_table.buffer_capacity;
+}
+
 const struct aws_http_header *aws_hpack_get_header(const struct aws_hpack_context *context, size_t index) {
     if (index == 0 || index >= s_static_header_table_size + context->dynamic_table.num_elements) {
         aws_raise_error(AWS_ERROR_INVALID_INDEX);
@@ -208,6 +129,147 @@ const struct aws_http_header *aws_hpack_get_header(const struct aws_hpack_contex
     return s_dynamic_table_get(context, index - s_static_header_table_size);
 }
 
+/*****************************************************************************/
+/* Dynamic table reverse lookups */
+
+static uint32_t s_lookup_hash(const struct aws_http_header *header, bool name_only) {
+    uint64_t hash = aws_hash_byte_cursor_ptr(&header->name);
+    if (!name_only) {
+        hash = aws_hash_combine(hash, aws_hash_byte_cursor_ptr(&header->value));
+    }
+    return (uint32_t)hash;
+}
+
+/* Return the slot whose entry matches the header, or the empty slot where it would go.
+ * The table is never more than half full, so there's always an empty slot to stop at */
+static struct aws_hpack_lookup_slot *s_lookup_probe(
+    const struct aws_hpack_context *context,
+    struct aws_hpack_lookup_slot *slots,
+    const struct aws_http_header *header,
+    uint32_t hash,
+    bool name_only) {
+
+    const size_t mask = context->dynamic_table.lookup_capacity - 1;
+    for (size_t i = hash & mask;; i = (i + 1) & mask) {
+        struct aws_hpack_lookup_slot *slot = &slots[i];
+        if (slot->position == LOOKUP_SLOT_EMPTY) {
+            return slot;
+        }
+
+        if (slot->hash == hash) {
+            const struct aws_http_header *entry = &context->dynamic_table.buffer[slot->position];
+            if (aws_byte_cursor_eq(&entry->name, &header->name) &&
+                (name_only || aws_byte_cursor_eq(&entry->value, &header->value))) {
+                return slot;
+            }
+        }
+    }
+}
+
+/* Return the slot of the newest entry matching the header, or NULL */
+static const struct aws_hpack_lookup_slot *s_lookup_find(
+    const struct aws_hpack_context *context,
+    struct aws_hpack_lookup_slot *slots,
+    const struct aws_http_header *header,
+    bool name_only) {
+
+    if (context->dynamic_table.num_elements == 0) {
+        return NULL;
+    }
+
+    const struct aws_hpack_lookup_slot *slot =
+        s_lookup_probe(context, slots, header, s_lookup_hash(header, name_only), name_only);
+    return slot->position == LOOKUP_SLOT_EMPTY ? NULL : slot;
+}
+
+/* Point the lookup at the entry in this position, replacing any older entry with the same key */
+static void s_lookup_put(
+    struct aws_hpack_context *context,
+    struct aws_hpack_lookup_slot *slots,
+    size_t position,
+    bool name_only) {
+
+    const struct aws_http_header *header = &context->dynamic_table.buffer[position];
+    const uint32_t hash = s_lookup_hash(header, name_only);
+    struct aws_hpack_lookup_slot *slot = s_lookup_probe(context, slots, header, hash, name_only);
+    slot->hash = hash;
+    slot->position = (uint32_t)position;
+}
+
+/* Entry in this position is being evicted. If the lookup points at it, and not at a newer entry with the
+ * same key, remove it. Entries after it in the probe sequence shift back, so no tombstone is needed */
+static void s_lookup_remove(
+    struct aws_hpack_context *context,
+    struct aws_hpack_lookup_slot *slots,
+    size_t position,
+    bool name_only) {
+
+    const struct aws_http_header *header = &context->dynamic_table.buffer[position];
+    struct aws_hpack_lookup_slot *slot =
+        s_lookup_probe(context, slots, header, s_lookup_hash(header, name_only), name_only);
+    if (slot->position != position) {
+        return;
+    }
+
+    const size_t mask = context->dynamic_table.lookup_capacity - 1;
+    size_t hole = (size_t)(slot - slots);
+    for (size_t i = (hole + 1) & mask; slots[i].position != LOOKUP_SLOT_EMPTY; i = (i + 1) & mask) {
+        /* Move this slot back into the hole, unless that would put it before its home */
+        const size_t home = slots[i].hash & mask;
+        if (((i - home) & mask) >= ((i - hole) & mask)) {
+            slots[hole] = slots[i];
+            hole = i;
+        }
+    }
+    slots[hole].position = LOOKUP_SLOT_EMPTY;
+}
+
+/* Size the lookups for the current buffer_capacity, and fill them from the current entries */
+static int s_lookup_rebuild(struct aws_hpack_context *context) {
+    size_t new_capacity = 0;
+    if (context->dynamic_table.buffer_capacity > 0) {
+        if (aws_mul_size_checked(context->dynamic_table.buffer_capacity, 2, &new_capacity) ||
+            aws_round_up_to_power_of_two(new_capacity, &new_capacity)) {
+            return AWS_OP_ERR;
+        }
+    }
+
+    if (new_capacity != context->dynamic_table.lookup_capacity) {
+        aws_mem_release(context->allocator, context->dynamic_table.reverse_lookup);
+        aws_mem_release(context->allocator, context->dynamic_table.reverse_lookup_name_only);
+        context->dynamic_table.reverse_lookup = NULL;
+        context->dynamic_table.reverse_lookup_name_only = NULL;
+        context->dynamic_table.lookup_capacity = 0;
+
+        if (new_capacity > 0) {
+            context->dynamic_table.reverse_lookup =
+                aws_mem_acquire(context->allocator, new_capacity * sizeof(struct aws_hpack_lookup_slot));
+            context->dynamic_table.reverse_lookup_name_only =
+                aws_mem_acquire(context->allocator, new_capacity * sizeof(struct aws_hpack_lookup_slot));
+            if (!context->dynamic_table.reverse_lookup || !context->dynamic_table.reverse_lookup_name_only) {
+                return AWS_OP_ERR;
+            }
+        }
+        context->dynamic_table.lookup_capacity = new_capacity;
+    }
+
+    /* Every byte 0xFF makes every position LOOKUP_SLOT_EMPTY */
+    const size_t lookup_bytes = new_capacity * sizeof(struct aws_hpack_lookup_slot);
+    if (lookup_bytes > 0) {
+        memset(context->dynamic_table.reverse_lookup, 0xFF, lookup_bytes);
+        memset(context->dynamic_table.reverse_lookup_name_only, 0xFF, lookup_bytes);
+    }
+
+    /* Insert oldest to newest, so each key ends up pointing at its newest entry */
+    for (size_t i = context->dynamic_table.num_elements; i > 0; --i) {
+        const size_t position = s_dynamic_table_position(context, i - 1);
+        s_lookup_put(context, context->dynamic_table.reverse_lookup, position, false /*name_only*/);
+        s_lookup_put(context, context->dynamic_table.reverse_lookup_name_only, position, true /*name_only*/);
+    }
+
+    return AWS_OP_SUCCESS;
+}
+
 /* TODO: remove `bool search_value`, this option has no reason to exist */
 size_t aws_hpack_find_index(
     const struct aws_hpack_context *context,
@@ -217,40 +279,44 @@ size_t aws_hpack_find_index(
 
     *found_value = false;
 
-    struct aws_hash_element *elem = NULL;
+    const struct aws_hpack_static_name_bucket *static_name = s_static_table_find_name(header->name);
+    const struct aws_hpack_lookup_slot *slot = NULL;
     if (search_value) {
         /* Check name-and-value first in static table */
-        aws_hash_table_find(&s_static_header_reverse_lookup, header, &elem);
-        if (elem) {
-            /* TODO: Maybe always set found_value to true? Who cares that the value is empty if they matched? */
-            /* If an element was found, check if it has a value */
-            *found_value = ((const struct aws_http_header *)elem->key)->value.len;
-            return (size_t)elem->value;
+        if (static_name) {
+            const size_t end_index = static_name->index + static_name->num_entries;
+            for (size_t i = static_name->index; i < end_index; ++i) {
+                if (aws_byte_cursor_eq(&header->value, &s_static_header_table[i].value)) {
+                    /* TODO: Maybe always set found_value to true? Who cares that the value is empty if they matched? */
+                    /* If an element was found, check if it has a value */
+                    *found_value = s_static_header_table[i].value.len;
+                    return i;
+                }
+            }
         }
         /* Check name-and-value in dynamic table */
-        aws_hash_table_find(&context->dynamic_table.reverse_lookup, header, &elem);
-        if (elem) {
+        slot = s_lookup_find(context, context->dynamic_table.reverse_lookup, header, false /*name_only*/);
+        if (slot) {
             /* TODO: Maybe always set found_value to true? Who cares that the value is empty if they matched? */
-            *found_value = ((const struct aws_http_header *)elem->key)->value.len;
+            *found_value = header->value.len;
             goto trans_index_from_dynamic_table;
         }
     }
     /* Check the name-only table. Note, even if we search for value, when we fail in searching for name-and-value, we
      * should also check the name only table */
-    aws_hash_table_find(&s_static_header_reverse_lookup_name_only, &header->name, &elem);
-    if (elem) {
-        return (size_t)elem->value;
+    if (static_name) {
+        return static_name->index;
     }
-    aws_hash_table_find(&context->dynamic_table.reverse_lookup_name_only, &header->name, &elem);
-    if (elem) {
+    slot = s_lookup_find(context, context->dynamic_table.reverse_lookup_name_only, header, true /*name_only*/);
+    if (slot) {
         goto trans_index_from_dynamic_table;
     }
     return 0;
 
 trans_index_from_dynamic_table:
-    AWS_ASSERT(elem);
+    AWS_ASSERT(slot);
     size_t index;
-    const size_t absolute_index = (size_t)elem->value;
+    const size_t absolute_index = slot->position;
     if (absolute_index >= context->dynamic_table.index_0) {
         index = absolute_index - context->dynamic_table.index_0;
     } else {
@@ -261,52 +327,123 @@ trans_index_from_dynamic_table:
     return index;
 }
 
-/* Remove elements from the dynamic table until it fits in max_size bytes */
-static int s_dynamic_table_shrink(struct aws_hpack_context *context, size_t max_size) {
-    while (context->dynamic_table.size > max_size && context->dynamic_table.num_elements > 0) {
-        struct aws_http_header *back = s_dynamic_table_get(context, context->dynamic_table.num_elements - 1);
+/*****************************************************************************/
+/* Dynamic table storage */
 
-        /* "Remove" the header from the table */
-        context->dynamic_table.size -= aws_hpack_get_header_size(back);
-        context->dynamic_table.num_elements -= 1;
+/* Bytes of name and value stored in the arena. Every entry's size is these plus 32 [4.1] */
+static size_t s_arena_used(const struct aws_hpack_context *context) {
+    return context->dynamic_table.size - 32 * context->dynamic_table.num_elements;
+}
 
-        /* Remove old header from hash tables */
-        if (aws_hash_table_remove(&context->dynamic_table.reverse_lookup, back, NULL, NULL)) {
-            HPACK_LOG(ERROR, context, "Failed to remove header from the reverse lookup table");
-            goto error;
+/* Move entries into a new arena of new_capacity bytes, oldest to newest, starting at offset 0 */
+static int s_arena_resize(struct aws_hpack_context *context, size_t new_capacity) {
+    AWS_ASSERT(new_capacity >= s_arena_used(context));
+
+    uint8_t *new_arena = NULL;
+    if (new_capacity > 0) {
+        new_arena = aws_mem_acquire(context->allocator, new_capacity);
+        if (!new_arena) {
+            return AWS_OP_ERR;
         }
+    }
+
+    size_t offset = 0;
+    for (size_t i = context->dynamic_table.num_elements; i > 0; --i) {
+        struct aws_http_header *entry = s_dynamic_table_get(context, i - 1);
+        const size_t entry_len = entry->name.len + entry->value.len;
+        if (entry_len > 0) {
+            /* name and value are stored one after the other */
+            memcpy(new_arena + offset, entry->name.ptr, entry_len);
+        }
+        entry->name.ptr = new_arena + offset;
+        entry->value.ptr = new_arena + offset + entry->name.len;
+        offset += entry_len;
+    }
 
-        /* If the name-only lookup is pointing to the element we're removing, it needs to go.
-         * If not, it's pointing to a younger, sexier element. */
-        struct aws_hash_element *elem = NULL;
-        aws_hash_table_find(&context->dynamic_table.reverse_lookup_name_only, &back->name, &elem);
-        if (elem && elem->key == back) {
-            if (aws_hash_table_remove_element(&context->dynamic_table.reverse_lookup_name_only, elem)) {
-                HPACK_LOG(ERROR, context, "Failed to remove header from the reverse lookup (name-only) table");
-                goto error;
+    aws_mem_release(context->allocator, context->dynamic_table.arena);
+    context->dynamic_table.arena = new_arena;
+    context->dynamic_table.arena_capacity = new_capacity;
+    context->dynamic_table.arena_head = offset;
+    return AWS_OP_SUCCESS;
+}
+
+/* Find a contiguous run of len bytes in the arena for a new entry, growing the arena if necessary.
+ * Call after evicting whatever the new entry pushes out of the table.
+ *
+ * An arena twice the size of max_size always has room: whatever run of bytes is skipped at the end
+ * of the arena, to keep an entry contiguous, is smaller than that entry, and the table never holds
+ * more than max_size. So the arena grows while the table fills up, and after that it never does. */
+static int s_arena_acquire(struct aws_hpack_context *context, size_t len, size_t *out_offset) {
+    if (context->dynamic_table.num_elements == 0) {
+        context->dynamic_table.arena_head = 0;
+    }
+
+    if (context->dynamic_table.arena) {
+        const size_t capacity = context->dynamic_table.arena_capacity;
+        const size_t head = context->dynamic_table.arena_head;
+        const size_t tail =
+            context->dynamic_table.num_elements == 0
+                ? 0
+                : (size_t)(s_dynamic_table_get(context, context->dynamic_table.num_elements - 1)->name.ptr -
+                           context->dynamic_table.arena);
+
+        /* Head must stay strictly behind tail after wrapping, so head == tail can only mean not wrapped */
+        if (head >= tail) {
+            if (capacity - head >= len) {
+                *out_offset = head;
+                goto found;
+            }
+            if (len < tail) {
+                *out_offset = 0;
+                goto found;
             }
+        } else if (tail - head > len) {
+            *out_offset = head;
+            goto found;
         }
+    }
 
-        /* clean up the memory we allocated to hold the name and value string*/
-        aws_mem_release(context->allocator, back->name.ptr);
+    /* Out of room. Double the arena, but there's no need to go beyond twice max_size */
+    const size_t used = s_arena_used(context);
+    size_t new_capacity = aws_max_size(
+        aws_mul_size_saturating(context->dynamic_table.arena_capacity, 2), s_hpack_dynamic_table_initial_size);
+    new_capacity = aws_min_size(new_capacity, aws_mul_size_saturating(context->dynamic_table.max_size, 2));
+    new_capacity = aws_max_size(new_capacity, used + len);
+    if (s_arena_resize(context, new_capacity)) {
+        return AWS_OP_ERR;
     }
+    *out_offset = context->dynamic_table.arena_head;
 
+found:
+    context->dynamic_table.arena_head = *out_offset + len;
     return AWS_OP_SUCCESS;
+}
 
-error:
-    return AWS_OP_ERR;
+/* Remove elements from the dynamic table until it fits in max_size bytes.
+ * Their bytes in the arena are freed just by no longer being in use. */
+static void s_dynamic_table_shrink(struct aws_hpack_context *context, size_t max_size) {
+    while (context->dynamic_table.size > max_size && context->dynamic_table.num_elements > 0) {
+        const size_t position = s_dynamic_table_position(context, context->dynamic_table.num_elements - 1);
+
+        /* Remove old header from lookups, if they're pointing to it and not a younger, sexier element */
+        s_lookup_remove(context, context->dynamic_table.reverse_lookup, position, false /*name_only*/);
+        s_lookup_remove(context, context->dynamic_table.reverse_lookup_name_only, position, true /*name_only*/);
+
+        /* "Remove" the header from the table */
+        context->dynamic_table.size -= aws_hpack_get_header_size(&context->dynamic_table.buffer[position]);
+        context->dynamic_table.num_elements -= 1;
+        context->dynamic_table.num_evicted += 1;
+    }
 }
 
 /*
  * Resizes the dynamic table storage buffer to new_max_elements.
  * Useful when inserting over capacity, or when downsizing.
- * Do shrink first, if you want to remove elements, or memory leak will happen.
+ * Do shrink first, if you want to remove elements, or they'll be lost without being removed from the lookups.
  */
 static int s_dynamic_table_resize_buffer(struct aws_hpack_context *context, size_t new_max_elements) {
 
-    /* Clear the old hash tables */
-    aws_hash_table_clear(&context->dynamic_table.reverse_lookup);
-    aws_hash_table_clear(&context->dynamic_table.reverse_lookup_name_only);
+    AWS_ASSERT(new_max_elements < LOOKUP_SLOT_EMPTY);
 
     struct aws_http_header *new_buffer = NULL;
 
@@ -323,7 +460,7 @@ static int s_dynamic_table_resize_buffer(struct aws_hpack_context *context, size
 
     /* Don't bother copying data if old buffer was of size 0 */
     if (AWS_UNLIKELY(context->dynamic_table.num_elements == 0)) {
-        goto reset_dyn_table_state;
+        goto cleanup_old_buffer;
     }
 
     /*
@@ -369,7 +506,6 @@ cleanup_old_buffer:
     aws_mem_release(context->allocator, context->dynamic_table.buffer);
 
     /* Reset state */
-reset_dyn_table_state:
     if (context->dynamic_table.num_elements > new_max_elements) {
         context->dynamic_table.num_elements = new_max_elements;
     }
@@ -377,22 +513,8 @@ reset_dyn_table_state:
     context->dynamic_table.index_0 = 0;
     context->dynamic_table.buffer = new_buffer;
 
-    /* Re-insert all of the reverse lookup elements */
-    for (size_t i = 0; i < context->dynamic_table.num_elements; ++i) {
-        if (aws_hash_table_put(
-                &context->dynamic_table.reverse_lookup, &context->dynamic_table.buffer[i], (void *)i, NULL)) {
-            return AWS_OP_ERR;
-        }
-        if (aws_hash_table_put(
-                &context->dynamic_table.reverse_lookup_name_only,
-                &context->dynamic_table.buffer[i].name,
-                (void *)i,
-                NULL)) {
-            return AWS_OP_ERR;
-        }
-    }
-
-    return AWS_OP_SUCCESS;
+    /* Positions changed, so re-insert all of the reverse lookup elements */
+    return s_lookup_rebuild(context);
 }
 
 int aws_hpack_insert_header(struct aws_hpack_context *context, const struct aws_http_header *header) {
@@ -412,9 +534,7 @@ int aws_hpack_insert_header(struct aws_hpack_context *context, const struct aws_
 
     /* Rotate out headers until there's room for the new header (this function will return immediately if nothing needs
      * to be evicted) */
-    if (s_dynamic_table_shrink(context, context->dynamic_table.max_size - header_size)) {
-        goto error;
-    }
+    s_dynamic_table_shrink(context, context->dynamic_table.max_size - header_size);
 
     /* If we're out of space in the buffer, grow it */
     if (context->dynamic_table.num_elements == context->dynamic_table.buffer_capacity) {
@@ -429,6 +549,20 @@ int aws_hpack_insert_header(struct aws_hpack_context *context, const struct aws_
         }
     }
 
+    /* Copy name and value into the arena, one after the other */
+    size_t arena_offset = 0;
+    if (s_arena_acquire(context, header->name.len + header->value.len, &arena_offset)) {
+        goto error;
+    }
+    uint8_t *name_ptr = context->dynamic_table.arena + arena_offset;
+    uint8_t *value_ptr = name_ptr + header->name.len;
+    if (header->name.len) {
+        memcpy(name_ptr, header->name.ptr, header->name.len);
+    }
+    if (header->value.len) {
+        memcpy(value_ptr, header->value.ptr, header->value.len);
+    }
+
     /* Decrement index 0, wrapping if necessary */
     if (context->dynamic_table.index_0 == 0) {
         context->dynamic_table.index_0 = context->dynamic_table.buffer_capacity - 1;
@@ -443,41 +577,15 @@ int aws_hpack_insert_header(struct aws_hpack_context *context, const struct aws_
 
     /* Put the header at the "front" of the table */
     struct aws_http_header *table_header = s_dynamic_table_get(context, 0);
+    *table_header = *header;
+    table_header->name.ptr = name_ptr;
+    table_header->value.ptr = value_ptr;
 
-    /* TODO:: We can optimize this with ring buffer. */
-    /* allocate memory for the name and value, which will be deallocated whenever the entry is evicted from the table or
-     * the table is cleaned up. We keep the pointer in the name pointer of each entry */
-    const size_t buf_memory_size = header->name.len + header->value.len;
-
-    if (buf_memory_size) {
-        uint8_t *buf_memory = aws_mem_acquire(context->allocator, buf_memory_size);
-        if (!buf_memory) {
-            return AWS_OP_ERR;
-        }
-        struct aws_byte_buf buf = aws_byte_buf_from_empty_array(buf_memory, buf_memory_size);
-        /* Copy header, then backup strings into our own allocation */
-        *table_header = *header;
-        aws_byte_buf_append_and_update(&buf, &table_header->name);
-        aws_byte_buf_append_and_update(&buf, &table_header->value);
-    } else {
-        /* if buf_memory_size is 0, no memory needed, we will insert the empty header into dynamic table */
-        *table_header = *header;
-        table_header->name.ptr = NULL;
-        table_header->value.ptr = NULL;
-    }
-    /* Write the new header to the look up tables */
-    if (aws_hash_table_put(
-            &context->dynamic_table.reverse_lookup, table_header, (void *)context->dynamic_table.index_0, NULL)) {
-        goto error;
-    }
-    /* Note that we can just blindly put here, we want to overwrite any older entry so it isn't accidentally removed. */
-    if (aws_hash_table_put(
-            &context->dynamic_table.reverse_lookup_name_only,
-            &table_header->name,
-            (void *)context->dynamic_table.index_0,
-            NULL)) {
-        goto error;
-    }
+    /* Write the new header to the look up tables.
+     * This overwrites any older entry with the same key, so it isn't accidentally removed when that one's evicted */
+    s_lookup_put(context, context->dynamic_table.reverse_lookup, context->dynamic_table.index_0, false /*name_only*/);
+    s_lookup_put(
+        context, context->dynamic_table.reverse_lookup_name_only, context->dynamic_table.index_0, true /*name_only*/);
 
     return AWS_OP_SUCCESS;
 
@@ -506,15 +614,20 @@ int aws_hpack_resize_dynamic_table(struct aws_hpack_context *context, size_t new
     }
 
     /* If downsizing, remove elements until we're within the new size constraints */
-    if (s_dynamic_table_shrink(context, new_max_size)) {
-        goto error;
-    }
+    s_dynamic_table_shrink(context, new_max_size);
 
     /* Resize the buffer to the current size */
     if (s_dynamic_table_resize_buffer(context, context->dynamic_table.num_elements)) {
         goto error;
     }
 
+    /* Give back arena memory the new max_size will never need */
+    if (context->dynamic_table.arena_capacity > new_max_size * 2) {
+        if (s_arena_resize(context, new_max_size * 2)) {
+            goto error;
+        }
+    }
+
     /* Update the max size */
     context->dynamic_table.max_size = new_max_size;
 
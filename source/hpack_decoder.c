@@ -8,31 +8,150 @@
     AWS_LOGF_##level(AWS_LS_HTTP_DECODER, "id=%p [HPACK]: " text, (decoder)->log_id, __VA_ARGS__)
 #define HPACK_LOG(level, decoder, text) HPACK_LOGF(level, decoder, "%s", text)
 
-struct aws_huffman_symbol_coder *hpack_get_coder(void);
-
-/* Used while decoding the header name & value, grows if necessary */
-const size_t s_hpack_decoder_scratch_initial_size = 512;
+/* Size of the block arena's first buffer. When a string doesn't fit, a buffer twice as big is started */
+const size_t s_hpack_decoder_block_arena_initial_size = 512;
+/* When a header-block ends, a buffer bigger than this is freed instead of being kept for the next header-block */
+const size_t s_hpack_decoder_block_arena_max_retained_size = 16 * 1024;
+/* Initial size of the buffer for header-names copied from the dynamic table */
+const size_t s_hpack_decoder_indexed_name_initial_size = 64;
 
 void aws_hpack_decoder_init(struct aws_hpack_decoder *decoder, struct aws_allocator *allocator, const void *log_id) {
     AWS_ZERO_STRUCT(*decoder);
     decoder->log_id = log_id;
 
-    aws_huffman_decoder_init(&decoder->huffman_decoder, hpack_get_coder());
-    aws_huffman_decoder_allow_growth(&decoder->huffman_decoder, true);
-
     aws_hpack_context_init(&decoder->context, allocator, AWS_LS_HTTP_DECODER, log_id);
 
-    aws_byte_buf_init(&decoder->progress_entry.scratch, allocator, s_hpack_decoder_scratch_initial_size);
+    aws_byte_buf_init(&decoder->block_arena.current, allocator, s_hpack_decoder_block_arena_initial_size);
+    aws_array_list_init_dynamic(&decoder->block_arena.full, allocator, 0, sizeof(struct aws_byte_buf));
+    aws_byte_buf_init(&decoder->progress_entry.indexed_name, allocator, s_hpack_decoder_indexed_name_initial_size);
 
     decoder->dynamic_table_protocol_max_size_setting = aws_hpack_get_dynamic_table_max_size(&decoder->context);
 }
 
+/* Free the buffers that filled up during this header-block */
+static void s_block_arena_release_full(struct aws_hpack_decoder *decoder) {
+    const size_t num_full = aws_array_list_length(&decoder->block_arena.full);
+    for (size_t i = 0; i < num_full; ++i) {
+        struct aws_byte_buf *full = NULL;
+        aws_array_list_get_at_ptr(&decoder->block_arena.full, (void **)&full, i);
+        aws_byte_buf_clean_up(full);
+    }
+    aws_array_list_clear(&decoder->block_arena.full);
+}
+
 void aws_hpack_decoder_clean_up(struct aws_hpack_decoder *decoder) {
     aws_hpack_context_clean_up(&decoder->context);
-    aws_byte_buf_clean_up(&decoder->progress_entry.scratch);
+    s_block_arena_release_full(decoder);
+    aws_array_list_clean_up(&decoder->block_arena.full);
+    aws_byte_buf_clean_up(&decoder->block_arena.current);
+    aws_byte_buf_clean_up(&decoder->progress_entry.indexed_name);
     AWS_ZERO_STRUCT(*decoder);
 }
 
+void aws_hpack_decoder_end_header_block(struct aws_hpack_decoder *decoder) {
+    s_block_arena_release_full(decoder);
+
+    struct aws_byte_buf *current = &decoder->block_arena.current;
+    if (current->capacity > s_hpack_decoder_block_arena_max_retained_size) {
+        aws_byte_buf_clean_up(current);
+        aws_byte_buf_init(current, decoder->context.allocator, s_hpack_decoder_block_arena_initial_size);
+    } else {
+        aws_byte_buf_reset(current, false /*zero_contents*/);
+    }
+}
+
+/* Start the next string at the end of the block arena's current buffer */
+static void s_block_arena_begin_string(struct aws_hpack_decoder *decoder, struct aws_byte_buf *string) {
+    struct aws_byte_buf *current = &decoder->block_arena.current;
+    AWS_ZERO_STRUCT(*string);
+    if (current->buffer) {
+        *string = aws_byte_buf_from_empty_array(current->buffer + current->len, current->capacity - current->len);
+    }
+}
+
+/* The string being decoded needs room for `len` more bytes than the current buffer has left.
+ * Start a bigger buffer and move the unfinished string there. That's fine, since nobody has a cursor to it yet.
+ * Finished strings stay in the old buffer, which is kept until the header-block ends. */
+static int s_block_arena_grow_string(struct aws_hpack_decoder *decoder, struct aws_byte_buf *string, size_t len) {
+    struct aws_byte_buf *current = &decoder->block_arena.current;
+
+    size_t required = 0;
+    if (aws_add_size_checked(string->len, len, &required)) {
+        return AWS_OP_ERR;
+    }
+    const size_t doubled_capacity =
+        aws_max_size(aws_mul_size_saturating(current->capacity, 2), s_hpack_decoder_block_arena_initial_size);
+    const size_t new_capacity = aws_max_size(required, doubled_capacity);
+
+    struct aws_byte_buf new_buffer;
+    if (aws_byte_buf_init(&new_buffer, decoder->context.allocator, new_capacity)) {
+        return AWS_OP_ERR;
+    }
+
+    const size_t string_len = string->len;
+    if (string_len) {
+        memcpy(new_buffer.buffer, string->buffer, string_len);
+    }
+
+    if (current->len) {
+        if (aws_array_list_push_back(&decoder->block_arena.full, current)) {
+            aws_byte_buf_clean_up(&new_buffer);
+            return AWS_OP_ERR;
+        }
+    } else {
+        aws_byte_buf_clean_up(current);
+    }
+
+    *current = new_buffer;
+    *string = aws_byte_buf_from_empty_array(current->buffer, current->capacity);
+    string->len = string_len;
+    return AWS_OP_SUCCESS;
+}
+
+/* The string is done. Claim its bytes, so the next string starts after it */
+static struct aws_byte_cursor s_block_arena_finish_string(
+    struct aws_hpack_decoder *decoder,
+    struct aws_byte_buf *string) {
+
+    struct aws_byte_buf *current = &decoder->block_arena.current;
+    AWS_ASSERT(string->len == 0 || string->buffer == current->buffer + current->len);
+    current->len += string->len;
+
+    struct aws_byte_cursor cursor = aws_byte_cursor_from_buf(string);
+    AWS_ZERO_STRUCT(*string);
+    return cursor;
+}
+
+/* Ensure there's room to write `len` more bytes to the string */
+static int s_string_reserve(
+    struct aws_hpack_decoder *decoder,
+    struct aws_byte_buf *string,
+    bool in_block_arena,
+    size_t len) {
+
+    if (string->capacity - string->len >= len) {
+        return AWS_OP_SUCCESS;
+    }
+
+    if (in_block_arena) {
+        return s_block_arena_grow_string(decoder, string, len);
+    }
+
+    return aws_byte_buf_reserve_relative(string, aws_max_size(len, string->capacity));
+}
+
+int aws_hpack_decoder_keep_string(struct aws_hpack_decoder *decoder, struct aws_byte_cursor *string) {
+    struct aws_byte_buf copy;
+    s_block_arena_begin_string(decoder, &copy);
+    if (s_string_reserve(decoder, &copy, true /*in_block_arena*/, string->len)) {
+        return AWS_OP_ERR;
+    }
+
+    aws_byte_buf_write_from_whole_cursor(&copy, *string);
+    *string = s_block_arena_finish_string(decoder, &copy);
+    return AWS_OP_SUCCESS;
+}
+
 static const struct aws_http_header *s_get_header_u64(const struct aws_hpack_decoder *decoder, uint64_t index) {
     if (index > SIZE_MAX) {
         HPACK_LOG(ERROR, decoder, "Header index is absurdly large")
@@ -130,17 +249,58 @@ handle_complete:
     return AWS_OP_SUCCESS;
 }
 
-int aws_hpack_decode_string(
+/* Huffman decode 4 bits at a time, using the state machine in aws_hpack_huffman_decode_table.
+ * The state carries over between calls, so a string can be split anywhere.
+ * Every code is at least 5 bits, so each nibble produces at most 1 symbol.
+ * Output must have room for 2 bytes per byte of the chunk. */
+static int s_decode_huffman(
+    struct aws_hpack_decoder *decoder,
+    struct aws_byte_cursor chunk,
+    struct aws_byte_buf *output) {
+
+    struct hpack_progress_string *progress = &decoder->progress_string;
+    AWS_ASSERT(output->capacity - output->len >= chunk.len * 2);
+
+    uint8_t state = progress->huffman_state;
+    uint8_t flags = progress->huffman_accepting ? AWS_HPACK_HUFFMAN_DECODE_F_ACCEPT : 0;
+    uint8_t *dst = output->buffer + output->len;
+
+    for (size_t i = 0; i < chunk.len; ++i) {
+        const uint8_t byte = chunk.ptr[i];
+
+        /* Symbols are written unconditionally, and only kept if the entry says one was completed */
+        const struct aws_hpack_huffman_decode_entry *high = &aws_hpack_huffman_decode_table[state][byte >> 4];
+        *dst = high->symbol;
+        dst += high->flags & AWS_HPACK_HUFFMAN_DECODE_F_SYMBOL;
+
+        const struct aws_hpack_huffman_decode_entry *low = &aws_hpack_huffman_decode_table[high->state][byte & 0x0F];
+        *dst = low->symbol;
+        dst += low->flags & AWS_HPACK_HUFFMAN_DECODE_F_SYMBOL;
+
+        state = low->state;
+        flags = low->flags;
+
+        if ((high->flags | low->flags) & AWS_HPACK_HUFFMAN_DECODE_F_FAIL) {
+            /* EOS (end-of-string) symbol is only meant for padding, HPACK says to treat it as an error */
+            HPACK_LOG(ERROR, decoder, "Huffman encoded end-of-string symbol is illegal");
+            return aws_raise_error(AWS_ERROR_INVALID_ARGUMENT);
+        }
+    }
+
+    output->len = (size_t)(dst - output->buffer);
+    progress->huffman_state = state;
+    progress->huffman_accepting = (flags & AWS_HPACK_HUFFMAN_DECODE_F_ACCEPT) != 0;
+    return AWS_OP_SUCCESS;
+}
+
+/* If `in_block_arena` is true, output is a string in the block arena. Otherwise it's an ordinary resizable buffer */
+static int s_decode_string(
     struct aws_hpack_decoder *decoder,
     struct aws_byte_cursor *to_decode,
     struct aws_byte_buf *output,
+    bool in_block_arena,
     bool *complete) {
 
-    AWS_PRECONDITION(decoder);
-    AWS_PRECONDITION(to_decode);
-    AWS_PRECONDITION(output);
-    AWS_PRECONDITION(complete);
-
     struct hpack_progress_string *progress = &decoder->progress_string;
 
     while (to_decode->len) {
@@ -149,7 +309,8 @@ int aws_hpack_decode_string(
                 /* Do init stuff */
                 progress->state = HPACK_STRING_STATE_LENGTH;
                 progress->use_huffman = *to_decode->ptr >> 7;
-                aws_huffman_decoder_reset(&decoder->huffman_decoder);
+                progress->huffman_state = 0;
+                progress->huffman_accepting = true;
                 /* fallthrough, since we didn't consume any data */
             }
             /* FALLTHRU */
@@ -182,28 +343,25 @@ int aws_hpack_decode_string(
                 struct aws_byte_cursor chunk = aws_byte_cursor_advance(to_decode, to_process);
 
                 if (progress->use_huffman) {
-                    if (aws_huffman_decode(&decoder->huffman_decoder, &chunk, output)) {
-                        HPACK_LOGF(ERROR, decoder, "Error from Huffman decoder: %s", aws_error_name(aws_last_error()));
+                    if (s_string_reserve(decoder, output, in_block_arena, chunk.len * 2) ||
+                        s_decode_huffman(decoder, chunk, output)) {
                         return AWS_OP_ERR;
                     }
-
-                    /* Decoder should consume all bytes we feed it.
-                     * EOS (end-of-string) symbol could stop it early, but HPACK says to treat EOS as error. */
-                    if (chunk.len != 0) {
-                        HPACK_LOG(ERROR, decoder, "Huffman encoded end-of-string symbol is illegal");
-                        return aws_raise_error(AWS_ERROR_INVALID_ARGUMENT);
-                    }
                 } else {
-                    if (aws_byte_buf_append_dynamic(output, &chunk)) {
+                    if (s_string_reserve(decoder, output, in_block_arena, chunk.len)) {
                         return AWS_OP_ERR;
                     }
+                    aws_byte_buf_write_from_whole_cursor(output, chunk);
                 }
 
                 /* If whole length consumed, we're done */
                 if (progress->length == 0) {
-                    /* #TODO Validate any padding bits left over in final byte of string.
-                     * "A padding not corresponding to the most significant bits of the
+                    /* "A padding not corresponding to the most significant bits of the
                      * code for the EOS symbol MUST be treated as a decoding error" */
+                    if (progress->use_huffman && !progress->huffman_accepting) {
+                        HPACK_LOG(ERROR, decoder, "Huffman encoded string has invalid padding");
+                        return aws_raise_error(AWS_ERROR_INVALID_ARGUMENT);
+                    }
 
                     /* #TODO impose limits on string length */
 
@@ -226,6 +384,20 @@ handle_complete:
     return AWS_OP_SUCCESS;
 }
 
+int aws_hpack_decode_string(
+    struct aws_hpack_decoder *decoder,
+    struct aws_byte_cursor *to_decode,
+    struct aws_byte_buf *output,
+    bool *complete) {
+
+    AWS_PRECONDITION(decoder);
+    AWS_PRECONDITION(to_decode);
+    AWS_PRECONDITION(output);
+    AWS_PRECONDITION(complete);
+
+    return s_decode_string(decoder, to_decode, output, false /*in_block_arena*/, complete);
+}
+
 /* Implements RFC-7541 Section 6 - Binary Format */
 int aws_hpack_decode(
     struct aws_hpack_decoder *decoder,
@@ -235,6 +407,7 @@ int aws_hpack_decode(
     AWS_PRECONDITION(decoder);
     AWS_PRECONDITION(to_decode);
     AWS_PRECONDITION(result);
+    AWS_ZERO_STRUCT(*result);
 
     /* Run state machine until we decode a complete entry.
      * Every state requires data, so we can simply loop until no more data available. */
@@ -244,7 +417,6 @@ int aws_hpack_decode(
             case HPACK_ENTRY_STATE_INIT: {
                 /* Reset entry */
                 AWS_ZERO_STRUCT(decoder->progress_entry.u);
-                decoder->progress_entry.scratch.len = 0;
 
                 /* Determine next state by looking at first few bits of the next byte:
                  * 1xxxxxxx: Indexed Header Field Representation
@@ -299,8 +471,12 @@ int aws_hpack_decode(
                     return AWS_OP_ERR;
                 }
 
+                /* Static table strings are valid forever, dynamic table strings only until the table changes */
+                const bool from_dynamic_table = *index > AWS_HPACK_STATIC_TABLE_SIZE;
                 result->type = AWS_HPACK_DECODE_T_HEADER_FIELD;
                 result->data.header_field = *header;
+                result->name_is_transient = from_dynamic_table;
+                result->value_is_transient = from_dynamic_table;
                 goto handle_complete;
             } break;
 
@@ -327,6 +503,7 @@ int aws_hpack_decode(
 
                 if (literal->name_index == 0) {
                     /* Index 0 means header-name is not in table. Need to decode header-name as a string instead */
+                    s_block_arena_begin_string(decoder, &decoder->progress_entry.string);
                     decoder->progress_entry.state = HPACK_ENTRY_STATE_LITERAL_NAME_STRING;
                     break;
                 }
@@ -337,22 +514,30 @@ int aws_hpack_decode(
                     return AWS_OP_ERR;
                 }
 
-                /* Store the name in scratch. We don't just keep a pointer to it because it could be
-                 * evicted from the dynamic table later, when we save the literal. */
-                if (aws_byte_buf_append_dynamic(&decoder->progress_entry.scratch, &header->name)) {
-                    return AWS_OP_ERR;
+                /* Static table names are valid forever. Copy a dynamic table name, rather than just keeping
+                 * a pointer to it, because inserting this header could evict it from the dynamic table. */
+                if (literal->name_index > AWS_HPACK_STATIC_TABLE_SIZE) {
+                    struct aws_byte_buf *indexed_name = &decoder->progress_entry.indexed_name;
+                    indexed_name->len = 0;
+                    if (aws_byte_buf_append_dynamic(indexed_name, &header->name)) {
+                        return AWS_OP_ERR;
+                    }
+                    literal->name = aws_byte_cursor_from_buf(indexed_name);
+                    literal->name_is_transient = true;
+                } else {
+                    literal->name = header->name;
                 }
 
-                /* Move on to decoding header-value.
-                 * Value will also decode into the scratch, so save where name ends. */
-                literal->name_length = header->name.len;
+                /* Move on to decoding header-value. */
+                s_block_arena_begin_string(decoder, &decoder->progress_entry.string);
                 decoder->progress_entry.state = HPACK_ENTRY_STATE_LITERAL_VALUE_STRING;
             } break;
 
             /* We only end up in this state if header-name is encoded as string. */
             case HPACK_ENTRY_STATE_LITERAL_NAME_STRING: {
+                struct aws_byte_buf *string = &decoder->progress_entry.string;
                 bool string_complete = false;
-                if (aws_hpack_decode_string(decoder, to_decode, &decoder->progress_entry.scratch, &string_complete)) {
+                if (s_decode_string(decoder, to_decode, string, true /*in_block_arena*/, &string_complete)) {
                     return AWS_OP_ERR;
                 }
 
@@ -360,17 +545,18 @@ int aws_hpack_decode(
                     break;
                 }
 
-                /* Done decoding name string! Move on to decoding the value string.
-                 * Value will also decode into the scratch, so save where name ends. */
-                decoder->progress_entry.u.literal.name_length = decoder->progress_entry.scratch.len;
+                /* Done decoding name string! Move on to decoding the value string. */
+                decoder->progress_entry.u.literal.name = s_block_arena_finish_string(decoder, string);
+                s_block_arena_begin_string(decoder, string);
                 decoder->progress_entry.state = HPACK_ENTRY_STATE_LITERAL_VALUE_STRING;
             } break;
 
             /* Final state for "literal" entries.
              * Decode the header-value string, then deliver the results. */
             case HPACK_ENTRY_STATE_LITERAL_VALUE_STRING: {
+                struct aws_byte_buf *string = &decoder->progress_entry.string;
                 bool string_complete = false;
-                if (aws_hpack_decode_string(decoder, to_decode, &decoder->progress_entry.scratch, &string_complete)) {
+                if (s_decode_string(decoder, to_decode, string, true /*in_block_arena*/, &string_complete)) {
                     return AWS_OP_ERR;
                 }
 
@@ -381,10 +567,9 @@ int aws_hpack_decode(
                 /* Done decoding value string. Done decoding entry. */
                 struct hpack_progress_literal *literal = &decoder->progress_entry.u.literal;
 
-                /* Set up a header with name and value (which are packed one after the other in scratch) */
                 struct aws_http_header header;
-                header.value = aws_byte_cursor_from_buf(&decoder->progress_entry.scratch);
-                header.name = aws_byte_cursor_advance(&header.value, literal->name_length);
+                header.name = literal->name;
+                header.value = s_block_arena_finish_string(decoder, string);
                 header.compression = literal->compression;
 
                 /* Save to table if necessary */
@@ -396,6 +581,7 @@ int aws_hpack_decode(
 
                 result->type = AWS_HPACK_DECODE_T_HEADER_FIELD;
                 result->data.header_field = header;
+                result->name_is_transient = literal->name_is_transient;
                 goto handle_complete;
             } break;
 
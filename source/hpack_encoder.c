@@ -8,15 +8,25 @@
     AWS_LOGF_##level(AWS_LS_HTTP_ENCODER, "id=%p [HPACK]: " text, (encoder)->log_id, __VA_ARGS__)
 #define HPACK_LOG(level, encoder, text) HPACK_LOGF(level, encoder, "%s", text)
 
-struct aws_huffman_symbol_coder *hpack_get_coder(void);
+/* HPACK Huffman code for each octet (RFC-7541 Appendix B), right-aligned */
+static const uint32_t s_huffman_codes[256] = {
+#define HUFFMAN_CODE(_symbol, _bit_string, _code, _num_bits) [_symbol] = _code,
+#include <aws/http/private/hpack_huffman_static_table.def>
+#undef HUFFMAN_CODE
+};
+
+/* Length in bits of each octet's code. Kept apart from the codes so the length sum is a tight loop over bytes */
+static const uint8_t s_huffman_code_lengths[256] = {
+#define HUFFMAN_CODE(_symbol, _bit_string, _code, _num_bits) [_symbol] = _num_bits,
+#include <aws/http/private/hpack_huffman_static_table.def>
+#undef HUFFMAN_CODE
+};
 
 void aws_hpack_encoder_init(struct aws_hpack_encoder *encoder, struct aws_allocator *allocator, const void *log_id) {
 
     AWS_ZERO_STRUCT(*encoder);
     encoder->log_id = log_id;
 
-    aws_huffman_encoder_init(&encoder->huffman_encoder, hpack_get_coder());
-
     aws_hpack_context_init(&encoder->context, allocator, AWS_LS_HTTP_ENCODER, log_id);
 
     encoder->dynamic_table_size_update.pending = false;
@@ -33,6 +43,27 @@ void aws_hpack_encoder_set_huffman_mode(struct aws_hpack_encoder *encoder, enum
     encoder->huffman_mode = mode;
 }
 
+void aws_hpack_encoder_set_indexing_policy(
+    struct aws_hpack_encoder *encoder,
+    aws_hpack_indexing_policy_fn *policy_fn,
+    void *user_data) {
+
+    encoder->indexing.policy_fn = policy_fn;
+    encoder->indexing.policy_user_data = user_data;
+}
+
+void aws_hpack_encoder_set_adaptive_indexing(struct aws_hpack_encoder *encoder, bool enabled) {
+    encoder->indexing.adaptive = enabled;
+}
+
+void aws_hpack_encoder_get_metrics(
+    const struct aws_hpack_encoder *encoder,
+    struct aws_hpack_encoder_metrics *out_metrics) {
+
+    *out_metrics = encoder->metrics;
+    out_metrics->num_evicted = encoder->context.dynamic_table.num_evicted;
+}
+
 void aws_hpack_encoder_update_max_table_size(struct aws_hpack_encoder *encoder, uint32_t new_max_size) {
 
     if (!encoder->dynamic_table_size_update.pending) {
@@ -130,6 +161,60 @@ error:
     return AWS_OP_ERR;
 }
 
+/* Length in bytes of the string once Huffman encoded, including padding */
+static size_t s_huffman_encoded_length(struct aws_byte_cursor to_encode) {
+    /* Several independent sums, so the adds don't all wait on each other */
+    uint64_t bits[4] = {0};
+    size_t i = 0;
+    for (; i + 4 <= to_encode.len; i += 4) {
+        bits[0] += s_huffman_code_lengths[to_encode.ptr[i]];
+        bits[1] += s_huffman_code_lengths[to_encode.ptr[i + 1]];
+        bits[2] += s_huffman_code_lengths[to_encode.ptr[i + 2]];
+        bits[3] += s_huffman_code_lengths[to_encode.ptr[i + 3]];
+    }
+    for (; i < to_encode.len; ++i) {
+        bits[0] += s_huffman_code_lengths[to_encode.ptr[i]];
+    }
+
+    const uint64_t total_bits = bits[0] + bits[1] + bits[2] + bits[3];
+    return (size_t)((total_bits + 7) / 8);
+}
+
+/* Huffman encode into space the caller has already reserved, which must be exactly the encoded length.
+ * Codes are packed into a 64-bit accumulator and written out 32 bits at a time. */
+static void s_huffman_encode(struct aws_byte_cursor to_encode, uint8_t *dst) {
+    uint64_t accumulator = 0;
+    /* Number of bits in the accumulator, always less than 32 between symbols */
+    size_t accumulator_bits = 0;
+
+    for (size_t i = 0; i < to_encode.len; ++i) {
+        const uint8_t octet = to_encode.ptr[i];
+        /* Codes are at most 30 bits, so this never exceeds 61 bits */
+        accumulator = (accumulator << s_huffman_code_lengths[octet]) | s_huffman_codes[octet];
+        accumulator_bits += s_huffman_code_lengths[octet];
+
+        if (accumulator_bits >= 32) {
+            accumulator_bits -= 32;
+            const uint32_t word = (uint32_t)(accumulator >> accumulator_bits);
+            dst[0] = (uint8_t)(word >> 24);
+            dst[1] = (uint8_t)(word >> 16);
+            dst[2] = (uint8_t)(word >> 8);
+            dst[3] = (uint8_t)word;
+            dst += 4;
+        }
+    }
+
+    /* Pad the final byte with the most significant bits of EOS, which are all 1s (RFC-7541 5.2) */
+    const size_t padding_bits = (8 - accumulator_bits % 8) % 8;
+    accumulator = (accumulator << padding_bits) | ((1u << padding_bits) - 1);
+    accumulator_bits += padding_bits;
+
+    while (accumulator_bits > 0) {
+        accumulator_bits -= 8;
+        *dst++ = (uint8_t)(accumulator >> accumulator_bits);
+    }
+}
+
 int aws_hpack_encode_string(
     struct aws_hpack_encoder *encoder,
     struct aws_byte_cursor to_encode,
@@ -152,11 +237,11 @@ int aws_hpack_encode_string(
 
         case AWS_HPACK_HUFFMAN_ALWAYS:
             use_huffman = 1;
-            str_length = aws_huffman_get_encoded_length(&encoder->huffman_encoder, to_encode);
+            str_length = s_huffman_encoded_length(to_encode);
             break;
 
         case AWS_HPACK_HUFFMAN_SMALLEST:
-            str_length = aws_huffman_get_encoded_length(&encoder->huffman_encoder, to_encode);
+            str_length = s_huffman_encoded_length(to_encode);
             if (str_length < to_encode.len) {
                 use_huffman = 1;
             } else {
@@ -197,10 +282,8 @@ int aws_hpack_encode_string(
                 goto error;
             }
 
-            if (aws_huffman_encode(&encoder->huffman_encoder, &to_encode, output)) {
-                HPACK_LOGF(ERROR, encoder, "Error from Huffman encoder: %s", aws_error_name(aws_last_error()));
-                goto error;
-            }
+            s_huffman_encode(to_encode, output->buffer + output->len);
+            output->len += str_length;
 
         } else {
             if (aws_byte_buf_append_dynamic(output, &to_encode)) {
@@ -213,7 +296,6 @@ int aws_hpack_encode_string(
 
 error:
     output->len = original_len;
-    aws_huffman_encoder_reset(&encoder->huffman_encoder);
     return AWS_OP_ERR;
 }
 
@@ -274,9 +356,120 @@ static int s_convert_http_compression_to_literal_entry_type(
     return aws_raise_error(AWS_ERROR_INVALID_ARGUMENT);
 }
 
+/* Names whose values are different on nearly every message */
+static const struct aws_byte_cursor s_never_index_names[] = {
+    AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("authorization"),
+    AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("date"),
+    AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("x-amz-date"),
+    AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("x-amz-content-sha256"),
+    AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("x-amz-request-id"),
+    AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("x-amz-id-2"),
+    AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("x-amzn-requestid"),
+    AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("x-amzn-trace-id"),
+    AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("amz-sdk-invocation-id"),
+    AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("content-md5"),
+    AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("etag"),
+    AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("last-modified"),
+    AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("range"),
+    AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("content-range"),
+};
+
+/* Names whose values rarely change over the life of a connection */
+static const struct aws_byte_cursor s_always_index_names[] = {
+    AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL(":authority"),
+    AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("user-agent"),
+    AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("x-amz-user-agent"),
+    AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("x-amz-security-token"),
+    AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("content-type"),
+    AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("content-encoding"),
+    AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("accept"),
+    AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("accept-encoding"),
+};
+
+enum aws_hpack_indexing_decision aws_hpack_indexing_policy_builtin(
+    const struct aws_http_header *header,
+    void *user_data) {
+
+    (void)user_data;
+
+    for (size_t i = 0; i < AWS_ARRAY_SIZE(s_never_index_names); ++i) {
+        if (aws_byte_cursor_eq_ignore_case(&header->name, &s_never_index_names[i])) {
+            return AWS_HPACK_INDEXING_NEVER;
+        }
+    }
+    for (size_t i = 0; i < AWS_ARRAY_SIZE(s_always_index_names); ++i) {
+        if (aws_byte_cursor_eq_ignore_case(&header->name, &s_always_index_names[i])) {
+            return AWS_HPACK_INDEXING_ALWAYS;
+        }
+    }
+    return AWS_HPACK_INDEXING_AUTO;
+}
+
+/* Adaptive indexing learns about a name after this many of its values have been added to the dynamic table */
+static const uint16_t s_adaptive_min_inserts = 16;
+/* A name stops being indexed if fewer than 1 in this many of its values added to the dynamic table are found again */
+static const uint16_t s_adaptive_min_hit_ratio = 8;
+/* After a name is skipped this many times, half of what was learned about it is forgotten,
+ * so it gets indexed a few more times in case its values started repeating */
+static const uint16_t s_adaptive_skips_before_retry = 64;
+
+static struct aws_hpack_name_stats *s_get_name_stats(
+    struct aws_hpack_encoder *encoder,
+    const struct aws_http_header *header) {
+
+    const uint32_t name_hash = (uint32_t)aws_hash_byte_cursor_ptr(&header->name);
+    struct aws_hpack_name_stats *stats = &encoder->indexing.name_stats[name_hash % AWS_HPACK_NAME_STATS_COUNT];
+    if (stats->name_hash != name_hash) {
+        /* Slot was used by some other name, start over */
+        AWS_ZERO_STRUCT(*stats);
+        stats->name_hash = name_hash;
+    }
+    return stats;
+}
+
+static void s_halve_name_stats(struct aws_hpack_name_stats *stats) {
+    stats->inserts /= 2;
+    stats->hits /= 2;
+    stats->skips = 0;
+}
+
+/* Header's compression setting allows it to be added to the dynamic table. Should it be? */
+static bool s_should_index(struct aws_hpack_encoder *encoder, const struct aws_http_header *header) {
+    enum aws_hpack_indexing_decision decision = AWS_HPACK_INDEXING_AUTO;
+    if (encoder->indexing.policy_fn) {
+        decision = encoder->indexing.policy_fn(header, encoder->indexing.policy_user_data);
+    }
+
+    switch (decision) {
+        case AWS_HPACK_INDEXING_ALWAYS:
+            return true;
+        case AWS_HPACK_INDEXING_NEVER:
+            return false;
+        case AWS_HPACK_INDEXING_AUTO:
+            break;
+    }
+
+    if (!encoder->indexing.adaptive) {
+        return true;
+    }
+
+    struct aws_hpack_name_stats *stats = s_get_name_stats(encoder, header);
+    if (stats->inserts < s_adaptive_min_inserts || stats->hits * s_adaptive_min_hit_ratio >= stats->inserts) {
+        return true;
+    }
+
+    if (++stats->skips >= s_adaptive_skips_before_retry) {
+        s_halve_name_stats(stats);
+    }
+    return false;
+}
+
+/* If `allow_indexing` is false, the header is never added to the dynamic table,
+ * even if its compression setting would normally allow it */
 static int s_encode_header_field(
     struct aws_hpack_encoder *encoder,
     const struct aws_http_header *header,
+    bool allow_indexing,
     struct aws_byte_buf *output) {
 
     AWS_PRECONDITION(encoder);
@@ -295,6 +488,13 @@ static int s_encode_header_field(
     }
 
     if (header_index && found_indexed_value) {
+        if (encoder->indexing.adaptive && header_index > AWS_HPACK_STATIC_TABLE_SIZE) {
+            struct aws_hpack_name_stats *stats = s_get_name_stats(encoder, header);
+            if (stats->hits < UINT16_MAX) {
+                stats->hits++;
+            }
+        }
+
         /* Indexed header field */
         const enum aws_hpack_entry_type entry_type = AWS_HPACK_ENTRY_INDEXED_HEADER_FIELD;
 
@@ -305,6 +505,9 @@ static int s_encode_header_field(
             goto error;
         }
 
+        encoder->metrics.num_indexed++;
+        encoder->metrics.header_bytes += header->name.len + header->value.len;
+        encoder->metrics.encoded_bytes += output->len - original_len;
         return AWS_OP_SUCCESS;
     }
 
@@ -315,6 +518,14 @@ static int s_encode_header_field(
     if (s_convert_http_compression_to_literal_entry_type(header->compression, &literal_entry_type)) {
         goto error;
     }
+    if (literal_entry_type == AWS_HPACK_ENTRY_LITERAL_HEADER_FIELD_WITH_INCREMENTAL_INDEXING) {
+        if (!allow_indexing) {
+            literal_entry_type = AWS_HPACK_ENTRY_LITERAL_HEADER_FIELD_WITHOUT_INDEXING;
+        } else if (!s_should_index(encoder, header)) {
+            literal_entry_type = AWS_HPACK_ENTRY_LITERAL_HEADER_FIELD_WITHOUT_INDEXING;
+            encoder->metrics.num_not_inserted++;
+        }
+    }
 
     /* the entry type makes up the first few bits of the next integer we encode */
     uint8_t starting_bit_pattern = s_hpack_entry_starting_bit_pattern[literal_entry_type];
@@ -351,21 +562,28 @@ static int s_encode_header_field(
         if (aws_hpack_insert_header(&encoder->context, header)) {
             goto error;
         }
+
+        encoder->metrics.num_inserted++;
+        if (encoder->indexing.adaptive) {
+            struct aws_hpack_name_stats *stats = s_get_name_stats(encoder, header);
+            if (stats->inserts == UINT16_MAX) {
+                s_halve_name_stats(stats);
+            }
+            stats->inserts++;
+        }
     }
 
+    encoder->metrics.header_bytes += header->name.len + header->value.len;
+    encoder->metrics.encoded_bytes += output->len - original_len;
     return AWS_OP_SUCCESS;
 error:
     output->len = original_len;
     return AWS_OP_ERR;
 }
 
-int aws_hpack_encode_header_block(
-    struct aws_hpack_encoder *encoder,
-    const struct aws_http_headers *headers,
-    struct aws_byte_buf *output) {
-
-    /* Encode a dynamic table size update at the beginning of the first header-block
-     * following the change to the dynamic table size RFC-7541 4.2 */
+/* Encode a dynamic table size update at the beginning of the first header-block
+ * following the change to the dynamic table size RFC-7541 4.2 */
+static int s_encode_dynamic_table_size_update(struct aws_hpack_encoder *encoder, struct aws_byte_buf *output) {
     if (encoder->dynamic_table_size_update.pending) {
         if (encoder->dynamic_table_size_update.smallest_value != encoder->dynamic_table_size_update.latest_value) {
             size_t smallest_update_value = encoder->dynamic_table_size_update.smallest_value;
@@ -405,11 +623,87 @@ int aws_hpack_encode_header_block(
         encoder->dynamic_table_size_update.smallest_value = SIZE_MAX;
     }
 
+    return AWS_OP_SUCCESS;
+}
+
+int aws_hpack_encode_header_block(
+    struct aws_hpack_encoder *encoder,
+    const struct aws_http_headers *headers,
+    struct aws_byte_buf *output) {
+
+    if (s_encode_dynamic_table_size_update(encoder, output)) {
+        return AWS_OP_ERR;
+    }
+
+    const size_t num_headers = aws_http_headers_count(headers);
+    for (size_t i = 0; i < num_headers; ++i) {
+        struct aws_http_header header;
+        aws_http_headers_get_index(headers, i, &header);
+        if (s_encode_header_field(encoder, &header, true /*allow_indexing*/, output)) {
+            return AWS_OP_ERR;
+        }
+    }
+
+    return AWS_OP_SUCCESS;
+}
+
+static bool s_is_pseudo_header(const struct aws_http_header *header) {
+    return header->name.len > 0 && header->name.ptr[0] == ':';
+}
+
+int aws_hpack_encode_header_block_with_prefix(
+    struct aws_hpack_encoder *encoder,
+    const struct aws_http_headers *headers,
+    struct aws_byte_cursor pre_encoded,
+    struct aws_byte_buf *output) {
+
+    if (s_encode_dynamic_table_size_update(encoder, output)) {
+        return AWS_OP_ERR;
+    }
+
+    /* Pseudo-headers must precede all regular headers (RFC-9113 8.3).
+     * The pre-encoded block may contain both, so these headers' pseudo-headers go before it, and the rest after */
+    const size_t num_headers = aws_http_headers_count(headers);
+    for (size_t i = 0; i < num_headers; ++i) {
+        struct aws_http_header header;
+        aws_http_headers_get_index(headers, i, &header);
+        if (s_is_pseudo_header(&header)) {
+            if (s_encode_header_field(encoder, &header, true /*allow_indexing*/, output)) {
+                return AWS_OP_ERR;
+            }
+        }
+    }
+
+    if (aws_byte_buf_append_dynamic(output, &pre_encoded)) {
+        return AWS_OP_ERR;
+    }
+
+    for (size_t i = 0; i < num_headers; ++i) {
+        struct aws_http_header header;
+        aws_http_headers_get_index(headers, i, &header);
+        if (!s_is_pseudo_header(&header)) {
+            if (s_encode_header_field(encoder, &header, true /*allow_indexing*/, output)) {
+                return AWS_OP_ERR;
+            }
+        }
+    }
+
+    return AWS_OP_SUCCESS;
+}
+
+int aws_hpack_encode_header_block_without_indexing(
+    struct aws_hpack_encoder *encoder,
+    const struct aws_http_headers *headers,
+    struct aws_byte_buf *output) {
+
+    /* Only the static table may be referenced, so the result is valid on any connection */
+    AWS_PRECONDITION(aws_hpack_get_dynamic_table_num_elements(&encoder->context) == 0);
+
     const size_t num_headers = aws_http_headers_count(headers);
     for (size_t i = 0; i < num_headers; ++i) {
         struct aws_http_header header;
         aws_http_headers_get_index(headers, i, &header);
-        if (s_encode_header_field(encoder, &header, output)) {
+        if (s_encode_header_field(encoder, &header, false /*allow_indexing*/, output)) {
             return AWS_OP_ERR;
         }
     }
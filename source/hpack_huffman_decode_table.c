@@ -0,0 +1,1807 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+/* WARNING: THIS FILE WAS AUTOMATICALLY GENERATED BY scripts/generate_hpack_tables.py. DO NOT EDIT. */
+/* clang-format off */
+
+#include <aws/http/private/hpack.h>
+
+/* Each state is a node in the Huffman tree, where the bits decoded since the last symbol lead.
+ * Each entry is what happens when the next 4 bits are fed in. Codes are at least 5 bits,
+ * so 4 bits can complete at most 1 symbol. */
+const struct aws_hpack_huffman_decode_entry aws_hpack_huffman_decode_table[256][16] = {
+    /* state 0: "" */
+    {
+        {15, 0x0, 0}, {16, 0x0, 0}, {17, 0x0, 0}, {18, 0x0, 0},
+        {19, 0x0, 0}, {20, 0x0, 0}, {21, 0x0, 0}, {22, 0x0, 0},
+        {23, 0x0, 0}, {24, 0x0, 0}, {25, 0x0, 0}, {26, 0x0, 0},
+        {27, 0x0, 0}, {28, 0x0, 0}, {29, 0x0, 0}, {30, 0x2, 0},
+    },
+    /* state 1: "0" */
+    {
+        {0, 0x3, 48}, {0, 0x3, 49}, {0, 0x3, 50}, {0, 0x3, 97},
+        {0, 0x3, 99}, {0, 0x3, 101}, {0, 0x3, 105}, {0, 0x3, 111},
+        {0, 0x3, 115}, {0, 0x3, 116}, {31, 0x0, 0}, {32, 0x0, 0},
+        {33, 0x0, 0}, {34, 0x0, 0}, {35, 0x0, 0}, {36, 0x0, 0},
+    },
+    /* state 2: "1" */
+    {
+        {37, 0x0, 0}, {38, 0x0, 0}, {39, 0x0, 0}, {40, 0x0, 0},
+        {41, 0x0, 0}, {42, 0x0, 0}, {43, 0x0, 0}, {44, 0x0, 0},
+        {45, 0x0, 0}, {46, 0x0, 0}, {47, 0x0, 0}, {48, 0x0, 0},
+        {49, 0x0, 0}, {50, 0x0, 0}, {51, 0x0, 0}, {52, 0x2, 0},
+    },
+    /* state 3: "00" */
+    {
+        {1, 0x1, 48}, {2, 0x3, 48}, {1, 0x1, 49}, {2, 0x3, 49},
+        {1, 0x1, 50}, {2, 0x3, 50}, {1, 0x1, 97}, {2, 0x3, 97},
+        {1, 0x1, 99}, {2, 0x3, 99}, {1, 0x1, 101}, {2, 0x3, 101},
+        {1, 0x1, 105}, {2, 0x3, 105}, {1, 0x1, 111}, {2, 0x3, 111},
+    },
+    /* state 4: "01" */
+    {
+        {1, 0x1, 115}, {2, 0x3, 115}, {1, 0x1, 116}, {2, 0x3, 116},
+        {0, 0x3, 32}, {0, 0x3, 37}, {0, 0x3, 45}, {0, 0x3, 46},
+        {0, 0x3, 47}, {0, 0x3, 51}, {0, 0x3, 52}, {0, 0x3, 53},
+        {0, 0x3, 54}, {0, 0x3, 55}, {0, 0x3, 56}, {0, 0x3, 57},
+    },
+    /* state 5: "10" */
+    {
+        {0, 0x3, 61}, {0, 0x3, 65}, {0, 0x3, 95}, {0, 0x3, 98},
+        {0, 0x3, 100}, {0, 0x3, 102}, {0, 0x3, 103}, {0, 0x3, 104},
+        {0, 0x3, 108}, {0, 0x3, 109}, {0, 0x3, 110}, {0, 0x3, 112},
+        {0, 0x3, 114}, {0, 0x3, 117}, {53, 0x0, 0}, {54, 0x0, 0},
+    },
+    /* state 6: "11" */
+    {
+        {55, 0x0, 0}, {56, 0x0, 0}, {57, 0x0, 0}, {58, 0x0, 0},
+        {59, 0x0, 0}, {60, 0x0, 0}, {61, 0x0, 0}, {62, 0x0, 0},
+        {63, 0x0, 0}, {64, 0x0, 0}, {65, 0x0, 0}, {66, 0x0, 0},
+        {67, 0x0, 0}, {68, 0x0, 0}, {69, 0x0, 0}, {70, 0x2, 0},
+    },
+    /* state 7: "000" */
+    {
+        {3, 0x1, 48}, {4, 0x1, 48}, {5, 0x1, 48}, {6, 0x3, 48},
+        {3, 0x1, 49}, {4, 0x1, 49}, {5, 0x1, 49}, {6, 0x3, 49},
+        {3, 0x1, 50}, {4, 0x1, 50}, {5, 0x1, 50}, {6, 0x3, 50},
+        {3, 0x1, 97}, {4, 0x1, 97}, {5, 0x1, 97}, {6, 0x3, 97},
+    },
+    /* state 8: "001" */
+    {
+        {3, 0x1, 99}, {4, 0x1, 99}, {5, 0x1, 99}, {6, 0x3, 99},
+        {3, 0x1, 101}, {4, 0x1, 101}, {5, 0x1, 101}, {6, 0x3, 101},
+        {3, 0x1, 105}, {4, 0x1, 105}, {5, 0x1, 105}, {6, 0x3, 105},
+        {3, 0x1, 111}, {4, 0x1, 111}, {5, 0x1, 111}, {6, 0x3, 111},
+    },
+    /* state 9: "010" */
+    {
+        {3, 0x1, 115}, {4, 0x1, 115}, {5, 0x1, 115}, {6, 0x3, 115},
+        {3, 0x1, 116}, {4, 0x1, 116}, {5, 0x1, 116}, {6, 0x3, 116},
+        {1, 0x1, 32}, {2, 0x3, 32}, {1, 0x1, 37}, {2, 0x3, 37},
+        {1, 0x1, 45}, {2, 0x3, 45}, {1, 0x1, 46}, {2, 0x3, 46},
+    },
+    /* state 10: "011" */
+    {
+        {1, 0x1, 47}, {2, 0x3, 47}, {1, 0x1, 51}, {2, 0x3, 51},
+        {1, 0x1, 52}, {2, 0x3, 52}, {1, 0x1, 53}, {2, 0x3, 53},
+        {1, 0x1, 54}, {2, 0x3, 54}, {1, 0x1, 55}, {2, 0x3, 55},
+        {1, 0x1, 56}, {2, 0x3, 56}, {1, 0x1, 57}, {2, 0x3, 57},
+    },
+    /* state 11: "100" */
+    {
+        {1, 0x1, 61}, {2, 0x3, 61}, {1, 0x1, 65}, {2, 0x3, 65},
+        {1, 0x1, 95}, {2, 0x3, 95}, {1, 0x1, 98}, {2, 0x3, 98},
+        {1, 0x1, 100}, {2, 0x3, 100}, {1, 0x1, 102}, {2, 0x3, 102},
+        {1, 0x1, 103}, {2, 0x3, 103}, {1, 0x1, 104}, {2, 0x3, 104},
+    },
+    /* state 12: "101" */
+    {
+        {1, 0x1, 108}, {2, 0x3, 108}, {1, 0x1, 109}, {2, 0x3, 109},
+        {1, 0x1, 110}, {2, 0x3, 110}, {1, 0x1, 112}, {2, 0x3, 112},
+        {1, 0x1, 114}, {2, 0x3, 114}, {1, 0x1, 117}, {2, 0x3, 117},
+        {0, 0x3, 58}, {0, 0x3, 66}, {0, 0x3, 67}, {0, 0x3, 68},
+    },
+    /* state 13: "110" */
+    {
+        {0, 0x3, 69}, {0, 0x3, 70}, {0, 0x3, 71}, {0, 0x3, 72},
+        {0, 0x3, 73}, {0, 0x3, 74}, {0, 0x3, 75}, {0, 0x3, 76},
+        {0, 0x3, 77}, {0, 0x3, 78}, {0, 0x3, 79}, {0, 0x3, 80},
+        {0, 0x3, 81}, {0, 0x3, 82}, {0, 0x3, 83}, {0, 0x3, 84},
+    },
+    /* state 14: "111" */
+    {
+        {0, 0x3, 85}, {0, 0x3, 86}, {0, 0x3, 87}, {0, 0x3, 89},
+        {0, 0x3, 106}, {0, 0x3, 107}, {0, 0x3, 113}, {0, 0x3, 118},
+        {0, 0x3, 119}, {0, 0x3, 120}, {0, 0x3, 121}, {0, 0x3, 122},
+        {71, 0x0, 0}, {72, 0x0, 0}, {73, 0x0, 0}, {74, 0x2, 0},
+    },
+    /* state 15: "0000" */
+    {
+        {7, 0x1, 48}, {8, 0x1, 48}, {9, 0x1, 48}, {10, 0x1, 48},
+        {11, 0x1, 48}, {12, 0x1, 48}, {13, 0x1, 48}, {14, 0x3, 48},
+        {7, 0x1, 49}, {8, 0x1, 49}, {9, 0x1, 49}, {10, 0x1, 49},
+        {11, 0x1, 49}, {12, 0x1, 49}, {13, 0x1, 49}, {14, 0x3, 49},
+    },
+    /* state 16: "0001" */
+    {
+        {7, 0x1, 50}, {8, 0x1, 50}, {9, 0x1, 50}, {10, 0x1, 50},
+        {11, 0x1, 50}, {12, 0x1, 50}, {13, 0x1, 50}, {14, 0x3, 50},
+        {7, 0x1, 97}, {8, 0x1, 97}, {9, 0x1, 97}, {10, 0x1, 97},
+        {11, 0x1, 97}, {12, 0x1, 97}, {13, 0x1, 97}, {14, 0x3, 97},
+    },
+    /* state 17: "0010" */
+    {
+        {7, 0x1, 99}, {8, 0x1, 99}, {9, 0x1, 99}, {10, 0x1, 99},
+        {11, 0x1, 99}, {12, 0x1, 99}, {13, 0x1, 99}, {14, 0x3, 99},
+        {7, 0x1, 101}, {8, 0x1, 101}, {9, 0x1, 101}, {10, 0x1, 101},
+        {11, 0x1, 101}, {12, 0x1, 101}, {13, 0x1, 101}, {14, 0x3, 101},
+    },
+    /* state 18: "0011" */
+    {
+        {7, 0x1, 105}, {8, 0x1, 105}, {9, 0x1, 105}, {10, 0x1, 105},
+        {11, 0x1, 105}, {12, 0x1, 105}, {13, 0x1, 105}, {14, 0x3, 105},
+        {7, 0x1, 111}, {8, 0x1, 111}, {9, 0x1, 111}, {10, 0x1, 111},
+        {11, 0x1, 111}, {12, 0x1, 111}, {13, 0x1, 111}, {14, 0x3, 111},
+    },
+    /* state 19: "0100" */
+    {
+        {7, 0x1, 115}, {8, 0x1, 115}, {9, 0x1, 115}, {10, 0x1, 115},
+        {11, 0x1, 115}, {12, 0x1, 115}, {13, 0x1, 115}, {14, 0x3, 115},
+        {7, 0x1, 116}, {8, 0x1, 116}, {9, 0x1, 116}, {10, 0x1, 116},
+        {11, 0x1, 116}, {12, 0x1, 116}, {13, 0x1, 116}, {14, 0x3, 116},
+    },
+    /* state 20: "0101" */
+    {
+        {3, 0x1, 32}, {4, 0x1, 32}, {5, 0x1, 32}, {6, 0x3, 32},
+        {3, 0x1, 37}, {4, 0x1, 37}, {5, 0x1, 37}, {6, 0x3, 37},
+        {3, 0x1, 45}, {4, 0x1, 45}, {5, 0x1, 45}, {6, 0x3, 45},
+        {3, 0x1, 46}, {4, 0x1, 46}, {5, 0x1, 46}, {6, 0x3, 46},
+    },
+    /* state 21: "0110" */
+    {
+        {3, 0x1, 47}, {4, 0x1, 47}, {5, 0x1, 47}, {6, 0x3, 47},
+        {3, 0x1, 51}, {4, 0x1, 51}, {5, 0x1, 51}, {6, 0x3, 51},
+        {3, 0x1, 52}, {4, 0x1, 52}, {5, 0x1, 52}, {6, 0x3, 52},
+        {3, 0x1, 53}, {4, 0x1, 53}, {5, 0x1, 53}, {6, 0x3, 53},
+    },
+    /* state 22: "0111" */
+    {
+        {3, 0x1, 54}, {4, 0x1, 54}, {5, 0x1, 54}, {6, 0x3, 54},
+        {3, 0x1, 55}, {4, 0x1, 55}, {5, 0x1, 55}, {6, 0x3, 55},
+        {3, 0x1, 56}, {4, 0x1, 56}, {5, 0x1, 56}, {6, 0x3, 56},
+        {3, 0x1, 57}, {4, 0x1, 57}, {5, 0x1, 57}, {6, 0x3, 57},
+    },
+    /* state 23: "1000" */
+    {
+        {3, 0x1, 61}, {4, 0x1, 61}, {5, 0x1, 61}, {6, 0x3, 61},
+        {3, 0x1, 65}, {4, 0x1, 65}, {5, 0x1, 65}, {6, 0x3, 65},
+        {3, 0x1, 95}, {4, 0x1, 95}, {5, 0x1, 95}, {6, 0x3, 95},
+        {3, 0x1, 98}, {4, 0x1, 98}, {5, 0x1, 98}, {6, 0x3, 98},
+    },
+    /* state 24: "1001" */
+    {
+        {3, 0x1, 100}, {4, 0x1, 100}, {5, 0x1, 100}, {6, 0x3, 100},
+        {3, 0x1, 102}, {4, 0x1, 102}, {5, 0x1, 102}, {6, 0x3, 102},
+        {3, 0x1, 103}, {4, 0x1, 103}, {5, 0x1, 103}, {6, 0x3, 103},
+        {3, 0x1, 104}, {4, 0x1, 104}, {5, 0x1, 104}, {6, 0x3, 104},
+    },
+    /* state 25: "1010" */
+    {
+        {3, 0x1, 108}, {4, 0x1, 108}, {5, 0x1, 108}, {6, 0x3, 108},
+        {3, 0x1, 109}, {4, 0x1, 109}, {5, 0x1, 109}, {6, 0x3, 109},
+        {3, 0x1, 110}, {4, 0x1, 110}, {5, 0x1, 110}, {6, 0x3, 110},
+        {3, 0x1, 112}, {4, 0x1, 112}, {5, 0x1, 112}, {6, 0x3, 112},
+    },
+    /* state 26: "1011" */
+    {
+        {3, 0x1, 114}, {4, 0x1, 114}, {5, 0x1, 114}, {6, 0x3, 114},
+        {3, 0x1, 117}, {4, 0x1, 117}, {5, 0x1, 117}, {6, 0x3, 117},
+        {1, 0x1, 58}, {2, 0x3, 58}, {1, 0x1, 66}, {2, 0x3, 66},
+        {1, 0x1, 67}, {2, 0x3, 67}, {1, 0x1, 68}, {2, 0x3, 68},
+    },
+    /* state 27: "1100" */
+    {
+        {1, 0x1, 69}, {2, 0x3, 69}, {1, 0x1, 70}, {2, 0x3, 70},
+        {1, 0x1, 71}, {2, 0x3, 71}, {1, 0x1, 72}, {2, 0x3, 72},
+        {1, 0x1, 73}, {2, 0x3, 73}, {1, 0x1, 74}, {2, 0x3, 74},
+        {1, 0x1, 75}, {2, 0x3, 75}, {1, 0x1, 76}, {2, 0x3, 76},
+    },
+    /* state 28: "1101" */
+    {
+        {1, 0x1, 77}, {2, 0x3, 77}, {1, 0x1, 78}, {2, 0x3, 78},
+        {1, 0x1, 79}, {2, 0x3, 79}, {1, 0x1, 80}, {2, 0x3, 80},
+        {1, 0x1, 81}, {2, 0x3, 81}, {1, 0x1, 82}, {2, 0x3, 82},
+        {1, 0x1, 83}, {2, 0x3, 83}, {1, 0x1, 84}, {2, 0x3, 84},
+    },
+    /* state 29: "1110" */
+    {
+        {1, 0x1, 85}, {2, 0x3, 85}, {1, 0x1, 86}, {2, 0x3, 86},
+        {1, 0x1, 87}, {2, 0x3, 87}, {1, 0x1, 89}, {2, 0x3, 89},
+        {1, 0x1, 106}, {2, 0x3, 106}, {1, 0x1, 107}, {2, 0x3, 107},
+        {1, 0x1, 113}, {2, 0x3, 113}, {1, 0x1, 118}, {2, 0x3, 118},
+    },
+    /* state 30: "1111" */
+    {
+        {1, 0x1, 119}, {2, 0x3, 119}, {1, 0x1, 120}, {2, 0x3, 120},
+        {1, 0x1, 121}, {2, 0x3, 121}, {1, 0x1, 122}, {2, 0x3, 122},
+        {0, 0x3, 38}, {0, 0x3, 42}, {0, 0x3, 44}, {0, 0x3, 59},
+        {0, 0x3, 88}, {0, 0x3, 90}, {75, 0x0, 0}, {76, 0x0, 0},
+    },
+    /* state 31: "01010" */
+    {
+        {7, 0x1, 32}, {8, 0x1, 32}, {9, 0x1, 32}, {10, 0x1, 32},
+        {11, 0x1, 32}, {12, 0x1, 32}, {13, 0x1, 32}, {14, 0x3, 32},
+        {7, 0x1, 37}, {8, 0x1, 37}, {9, 0x1, 37}, {10, 0x1, 37},
+        {11, 0x1, 37}, {12, 0x1, 37}, {13, 0x1, 37}, {14, 0x3, 37},
+    },
+    /* state 32: "01011" */
+    {
+        {7, 0x1, 45}, {8, 0x1, 45}, {9, 0x1, 45}, {10, 0x1, 45},
+        {11, 0x1, 45}, {12, 0x1, 45}, {13, 0x1, 45}, {14, 0x3, 45},
+        {7, 0x1, 46}, {8, 0x1, 46}, {9, 0x1, 46}, {10, 0x1, 46},
+        {11, 0x1, 46}, {12, 0x1, 46}, {13, 0x1, 46}, {14, 0x3, 46},
+    },
+    /* state 33: "01100" */
+    {
+        {7, 0x1, 47}, {8, 0x1, 47}, {9, 0x1, 47}, {10, 0x1, 47},
+        {11, 0x1, 47}, {12, 0x1, 47}, {13, 0x1, 47}, {14, 0x3, 47},
+        {7, 0x1, 51}, {8, 0x1, 51}, {9, 0x1, 51}, {10, 0x1, 51},
+        {11, 0x1, 51}, {12, 0x1, 51}, {13, 0x1, 51}, {14, 0x3, 51},
+    },
+    /* state 34: "01101" */
+    {
+        {7, 0x1, 52}, {8, 0x1, 52}, {9, 0x1, 52}, {10, 0x1, 52},
+        {11, 0x1, 52}, {12, 0x1, 52}, {13, 0x1, 52}, {14, 0x3, 52},
+        {7, 0x1, 53}, {8, 0x1, 53}, {9, 0x1, 53}, {10, 0x1, 53},
+        {11, 0x1, 53}, {12, 0x1, 53}, {13, 0x1, 53}, {14, 0x3, 53},
+    },
+    /* state 35: "01110" */
+    {
+        {7, 0x1, 54}, {8, 0x1, 54}, {9, 0x1, 54}, {10, 0x1, 54},
+        {11, 0x1, 54}, {12, 0x1, 54}, {13, 0x1, 54}, {14, 0x3, 54},
+        {7, 0x1, 55}, {8, 0x1, 55}, {9, 0x1, 55}, {10, 0x1, 55},
+        {11, 0x1, 55}, {12, 0x1, 55}, {13, 0x1, 55}, {14, 0x3, 55},
+    },
+    /* state 36: "01111" */
+    {
+        {7, 0x1, 56}, {8, 0x1, 56}, {9, 0x1, 56}, {10, 0x1, 56},
+        {11, 0x1, 56}, {12, 0x1, 56}, {13, 0x1, 56}, {14, 0x3, 56},
+        {7, 0x1, 57}, {8, 0x1, 57}, {9, 0x1, 57}, {10, 0x1, 57},
+        {11, 0x1, 57}, {12, 0x1, 57}, {13, 0x1, 57}, {14, 0x3, 57},
+    },
+    /* state 37: "10000" */
+    {
+        {7, 0x1, 61}, {8, 0x1, 61}, {9, 0x1, 61}, {10, 0x1, 61},
+        {11, 0x1, 61}, {12, 0x1, 61}, {13, 0x1, 61}, {14, 0x3, 61},
+        {7, 0x1, 65}, {8, 0x1, 65}, {9, 0x1, 65}, {10, 0x1, 65},
+        {11, 0x1, 65}, {12, 0x1, 65}, {13, 0x1, 65}, {14, 0x3, 65},
+    },
+    /* state 38: "10001" */
+    {
+        {7, 0x1, 95}, {8, 0x1, 95}, {9, 0x1, 95}, {10, 0x1, 95},
+        {11, 0x1, 95}, {12, 0x1, 95}, {13, 0x1, 95}, {14, 0x3, 95},
+        {7, 0x1, 98}, {8, 0x1, 98}, {9, 0x1, 98}, {10, 0x1, 98},
+        {11, 0x1, 98}, {12, 0x1, 98}, {13, 0x1, 98}, {14, 0x3, 98},
+    },
+    /* state 39: "10010" */
+    {
+        {7, 0x1, 100}, {8, 0x1, 100}, {9, 0x1, 100}, {10, 0x1, 100},
+        {11, 0x1, 100}, {12, 0x1, 100}, {13, 0x1, 100}, {14, 0x3, 100},
+        {7, 0x1, 102}, {8, 0x1, 102}, {9, 0x1, 102}, {10, 0x1, 102},
+        {11, 0x1, 102}, {12, 0x1, 102}, {13, 0x1, 102}, {14, 0x3, 102},
+    },
+    /* state 40: "10011" */
+    {
+        {7, 0x1, 103}, {8, 0x1, 103}, {9, 0x1, 103}, {10, 0x1, 103},
+        {11, 0x1, 103}, {12, 0x1, 103}, {13, 0x1, 103}, {14, 0x3, 103},
+        {7, 0x1, 104}, {8, 0x1, 104}, {9, 0x1, 104}, {10, 0x1, 104},
+        {11, 0x1, 104}, {12, 0x1, 104}, {13, 0x1, 104}, {14, 0x3, 104},
+    },
+    /* state 41: "10100" */
+    {
+        {7, 0x1, 108}, {8, 0x1, 108}, {9, 0x1, 108}, {10, 0x1, 108},
+        {11, 0x1, 108}, {12, 0x1, 108}, {13, 0x1, 108}, {14, 0x3, 108},
+        {7, 0x1, 109}, {8, 0x1, 109}, {9, 0x1, 109}, {10, 0x1, 109},
+        {11, 0x1, 109}, {12, 0x1, 109}, {13, 0x1, 109}, {14, 0x3, 109},
+    },
+    /* state 42: "10101" */
+    {
+        {7, 0x1, 110}, {8, 0x1, 110}, {9, 0x1, 110}, {10, 0x1, 110},
+        {11, 0x1, 110}, {12, 0x1, 110}, {13, 0x1, 110}, {14, 0x3, 110},
+        {7, 0x1, 112}, {8, 0x1, 112}, {9, 0x1, 112}, {10, 0x1, 112},
+        {11, 0x1, 112}, {12, 0x1, 112}, {13, 0x1, 112}, {14, 0x3, 112},
+    },
+    /* state 43: "10110" */
+    {
+        {7, 0x1, 114}, {8, 0x1, 114}, {9, 0x1, 114}, {10, 0x1, 114},
+        {11, 0x1, 114}, {12, 0x1, 114}, {13, 0x1, 114}, {14, 0x3, 114},
+        {7, 0x1, 117}, {8, 0x1, 117}, {9, 0x1, 117}, {10, 0x1, 117},
+        {11, 0x1, 117}, {12, 0x1, 117}, {13, 0x1, 117}, {14, 0x3, 117},
+    },
+    /* state 44: "10111" */
+    {
+        {3, 0x1, 58}, {4, 0x1, 58}, {5, 0x1, 58}, {6, 0x3, 58},
+        {3, 0x1, 66}, {4, 0x1, 66}, {5, 0x1, 66}, {6, 0x3, 66},
+        {3, 0x1, 67}, {4, 0x1, 67}, {5, 0x1, 67}, {6, 0x3, 67},
+        {3, 0x1, 68}, {4, 0x1, 68}, {5, 0x1, 68}, {6, 0x3, 68},
+    },
+    /* state 45: "11000" */
+    {
+        {3, 0x1, 69}, {4, 0x1, 69}, {5, 0x1, 69}, {6, 0x3, 69},
+        {3, 0x1, 70}, {4, 0x1, 70}, {5, 0x1, 70}, {6, 0x3, 70},
+        {3, 0x1, 71}, {4, 0x1, 71}, {5, 0x1, 71}, {6, 0x3, 71},
+        {3, 0x1, 72}, {4, 0x1, 72}, {5, 0x1, 72}, {6, 0x3, 72},
+    },
+    /* state 46: "11001" */
+    {
+        {3, 0x1, 73}, {4, 0x1, 73}, {5, 0x1, 73}, {6, 0x3, 73},
+        {3, 0x1, 74}, {4, 0x1, 74}, {5, 0x1, 74}, {6, 0x3, 74},
+        {3, 0x1, 75}, {4, 0x1, 75}, {5, 0x1, 75}, {6, 0x3, 75},
+        {3, 0x1, 76}, {4, 0x1, 76}, {5, 0x1, 76}, {6, 0x3, 76},
+    },
+    /* state 47: "11010" */
+    {
+        {3, 0x1, 77}, {4, 0x1, 77}, {5, 0x1, 77}, {6, 0x3, 77},
+        {3, 0x1, 78}, {4, 0x1, 78}, {5, 0x1, 78}, {6, 0x3, 78},
+        {3, 0x1, 79}, {4, 0x1, 79}, {5, 0x1, 79}, {6, 0x3, 79},
+        {3, 0x1, 80}, {4, 0x1, 80}, {5, 0x1, 80}, {6, 0x3, 80},
+    },
+    /* state 48: "11011" */
+    {
+        {3, 0x1, 81}, {4, 0x1, 81}, {5, 0x1, 81}, {6, 0x3, 81},
+        {3, 0x1, 82}, {4, 0x1, 82}, {5, 0x1, 82}, {6, 0x3, 82},
+        {3, 0x1, 83}, {4, 0x1, 83}, {5, 0x1, 83}, {6, 0x3, 83},
+        {3, 0x1, 84}, {4, 0x1, 84}, {5, 0x1, 84}, {6, 0x3, 84},
+    },
+    /* state 49: "11100" */
+    {
+        {3, 0x1, 85}, {4, 0x1, 85}, {5, 0x1, 85}, {6, 0x3, 85},
+        {3, 0x1, 86}, {4, 0x1, 86}, {5, 0x1, 86}, {6, 0x3, 86},
+        {3, 0x1, 87}, {4, 0x1, 87}, {5, 0x1, 87}, {6, 0x3, 87},
+        {3, 0x1, 89}, {4, 0x1, 89}, {5, 0x1, 89}, {6, 0x3, 89},
+    },
+    /* state 50: "11101" */
+    {
+        {3, 0x1, 106}, {4, 0x1, 106}, {5, 0x1, 106}, {6, 0x3, 106},
+        {3, 0x1, 107}, {4, 0x1, 107}, {5, 0x1, 107}, {6, 0x3, 107},
+        {3, 0x1, 113}, {4, 0x1, 113}, {5, 0x1, 113}, {6, 0x3, 113},
+        {3, 0x1, 118}, {4, 0x1, 118}, {5, 0x1, 118}, {6, 0x3, 118},
+    },
+    /* state 51: "11110" */
+    {
+        {3, 0x1, 119}, {4, 0x1, 119}, {5, 0x1, 119}, {6, 0x3, 119},
+        {3, 0x1, 120}, {4, 0x1, 120}, {5, 0x1, 120}, {6, 0x3, 120},
+        {3, 0x1, 121}, {4, 0x1, 121}, {5, 0x1, 121}, {6, 0x3, 121},
+        {3, 0x1, 122}, {4, 0x1, 122}, {5, 0x1, 122}, {6, 0x3, 122},
+    },
+    /* state 52: "11111" */
+    {
+        {1, 0x1, 38}, {2, 0x3, 38}, {1, 0x1, 42}, {2, 0x3, 42},
+        {1, 0x1, 44}, {2, 0x3, 44}, {1, 0x1, 59}, {2, 0x3, 59},
+        {1, 0x1, 88}, {2, 0x3, 88}, {1, 0x1, 90}, {2, 0x3, 90},
+        {77, 0x0, 0}, {78, 0x0, 0}, {79, 0x0, 0}, {80, 0x0, 0},
+    },
+    /* state 53: "101110" */
+    {
+        {7, 0x1, 58}, {8, 0x1, 58}, {9, 0x1, 58}, {10, 0x1, 58},
+        {11, 0x1, 58}, {12, 0x1, 58}, {13, 0x1, 58}, {14, 0x3, 58},
+        {7, 0x1, 66}, {8, 0x1, 66}, {9, 0x1, 66}, {10, 0x1, 66},
+        {11, 0x1, 66}, {12, 0x1, 66}, {13, 0x1, 66}, {14, 0x3, 66},
+    },
+    /* state 54: "101111" */
+    {
+        {7, 0x1, 67}, {8, 0x1, 67}, {9, 0x1, 67}, {10, 0x1, 67},
+        {11, 0x1, 67}, {12, 0x1, 67}, {13, 0x1, 67}, {14, 0x3, 67},
+        {7, 0x1, 68}, {8, 0x1, 68}, {9, 0x1, 68}, {10, 0x1, 68},
+        {11, 0x1, 68}, {12, 0x1, 68}, {13, 0x1, 68}, {14, 0x3, 68},
+    },
+    /* state 55: "110000" */
+    {
+        {7, 0x1, 69}, {8, 0x1, 69}, {9, 0x1, 69}, {10, 0x1, 69},
+        {11, 0x1, 69}, {12, 0x1, 69}, {13, 0x1, 69}, {14, 0x3, 69},
+        {7, 0x1, 70}, {8, 0x1, 70}, {9, 0x1, 70}, {10, 0x1, 70},
+        {11, 0x1, 70}, {12, 0x1, 70}, {13, 0x1, 70}, {14, 0x3, 70},
+    },
+    /* state 56: "110001" */
+    {
+        {7, 0x1, 71}, {8, 0x1, 71}, {9, 0x1, 71}, {10, 0x1, 71},
+        {11, 0x1, 71}, {12, 0x1, 71}, {13, 0x1, 71}, {14, 0x3, 71},
+        {7, 0x1, 72}, {8, 0x1, 72}, {9, 0x1, 72}, {10, 0x1, 72},
+        {11, 0x1, 72}, {12, 0x1, 72}, {13, 0x1, 72}, {14, 0x3, 72},
+    },
+    /* state 57: "110010" */
+    {
+        {7, 0x1, 73}, {8, 0x1, 73}, {9, 0x1, 73}, {10, 0x1, 73},
+        {11, 0x1, 73}, {12, 0x1, 73}, {13, 0x1, 73}, {14, 0x3, 73},
+        {7, 0x1, 74}, {8, 0x1, 74}, {9, 0x1, 74}, {10, 0x1, 74},
+        {11, 0x1, 74}, {12, 0x1, 74}, {13, 0x1, 74}, {14, 0x3, 74},
+    },
+    /* state 58: "110011" */
+    {
+        {7, 0x1, 75}, {8, 0x1, 75}, {9, 0x1, 75}, {10, 0x1, 75},
+        {11, 0x1, 75}, {12, 0x1, 75}, {13, 0x1, 75}, {14, 0x3, 75},
+        {7, 0x1, 76}, {8, 0x1, 76}, {9, 0x1, 76}, {10, 0x1, 76},
+        {11, 0x1, 76}, {12, 0x1, 76}, {13, 0x1, 76}, {14, 0x3, 76},
+    },
+    /* state 59: "110100" */
+    {
+        {7, 0x1, 77}, {8, 0x1, 77}, {9, 0x1, 77}, {10, 0x1, 77},
+        {11, 0x1, 77}, {12, 0x1, 77}, {13, 0x1, 77}, {14, 0x3, 77},
+        {7, 0x1, 78}, {8, 0x1, 78}, {9, 0x1, 78}, {10, 0x1, 78},
+        {11, 0x1, 78}, {12, 0x1, 78}, {13, 0x1, 78}, {14, 0x3, 78},
+    },
+    /* state 60: "110101" */
+    {
+        {7, 0x1, 79}, {8, 0x1, 79}, {9, 0x1, 79}, {10, 0x1, 79},
+        {11, 0x1, 79}, {12, 0x1, 79}, {13, 0x1, 79}, {14, 0x3, 79},
+        {7, 0x1, 80}, {8, 0x1, 80}, {9, 0x1, 80}, {10, 0x1, 80},
+        {11, 0x1, 80}, {12, 0x1, 80}, {13, 0x1, 80}, {14, 0x3, 80},
+    },
+    /* state 61: "110110" */
+    {
+        {7, 0x1, 81}, {8, 0x1, 81}, {9, 0x1, 81}, {10, 0x1, 81},
+        {11, 0x1, 81}, {12, 0x1, 81}, {13, 0x1, 81}, {14, 0x3, 81},
+        {7, 0x1, 82}, {8, 0x1, 82}, {9, 0x1, 82}, {10, 0x1, 82},
+        {11, 0x1, 82}, {12, 0x1, 82}, {13, 0x1, 82}, {14, 0x3, 82},
+    },
+    /* state 62: "110111" */
+    {
+        {7, 0x1, 83}, {8, 0x1, 83}, {9, 0x1, 83}, {10, 0x1, 83},
+        {11, 0x1, 83}, {12, 0x1, 83}, {13, 0x1, 83}, {14, 0x3, 83},
+        {7, 0x1, 84}, {8, 0x1, 84}, {9, 0x1, 84}, {10, 0x1, 84},
+        {11, 0x1, 84}, {12, 0x1, 84}, {13, 0x1, 84}, {14, 0x3, 84},
+    },
+    /* state 63: "111000" */
+    {
+        {7, 0x1, 85}, {8, 0x1, 85}, {9, 0x1, 85}, {10, 0x1, 85},
+        {11, 0x1, 85}, {12, 0x1, 85}, {13, 0x1, 85}, {14, 0x3, 85},
+        {7, 0x1, 86}, {8, 0x1, 86}, {9, 0x1, 86}, {10, 0x1, 86},
+        {11, 0x1, 86}, {12, 0x1, 86}, {13, 0x1, 86}, {14, 0x3, 86},
+    },
+    /* state 64: "111001" */
+    {
+        {7, 0x1, 87}, {8, 0x1, 87}, {9, 0x1, 87}, {10, 0x1, 87},
+        {11, 0x1, 87}, {12, 0x1, 87}, {13, 0x1, 87}, {14, 0x3, 87},
+        {7, 0x1, 89}, {8, 0x1, 89}, {9, 0x1, 89}, {10, 0x1, 89},
+        {11, 0x1, 89}, {12, 0x1, 89}, {13, 0x1, 89}, {14, 0x3, 89},
+    },
+    /* state 65: "111010" */
+    {
+        {7, 0x1, 106}, {8, 0x1, 106}, {9, 0x1, 106}, {10, 0x1, 106},
+        {11, 0x1, 106}, {12, 0x1, 106}, {13, 0x1, 106}, {14, 0x3, 106},
+        {7, 0x1, 107}, {8, 0x1, 107}, {9, 0x1, 107}, {10, 0x1, 107},
+        {11, 0x1, 107}, {12, 0x1, 107}, {13, 0x1, 107}, {14, 0x3, 107},
+    },
+    /* state 66: "111011" */
+    {
+        {7, 0x1, 113}, {8, 0x1, 113}, {9, 0x1, 113}, {10, 0x1, 113},
+        {11, 0x1, 113}, {12, 0x1, 113}, {13, 0x1, 113}, {14, 0x3, 113},
+        {7, 0x1, 118}, {8, 0x1, 118}, {9, 0x1, 118}, {10, 0x1, 118},
+        {11, 0x1, 118}, {12, 0x1, 118}, {13, 0x1, 118}, {14, 0x3, 118},
+    },
+    /* state 67: "111100" */
+    {
+        {7, 0x1, 119}, {8, 0x1, 119}, {9, 0x1, 119}, {10, 0x1, 119},
+        {11, 0x1, 119}, {12, 0x1, 119}, {13, 0x1, 119}, {14, 0x3, 119},
+        {7, 0x1, 120}, {8, 0x1, 120}, {9, 0x1, 120}, {10, 0x1, 120},
+        {11, 0x1, 120}, {12, 0x1, 120}, {13, 0x1, 120}, {14, 0x3, 120},
+    },
+    /* state 68: "111101" */
+    {
+        {7, 0x1, 121}, {8, 0x1, 121}, {9, 0x1, 121}, {10, 0x1, 121},
+        {11, 0x1, 121}, {12, 0x1, 121}, {13, 0x1, 121}, {14, 0x3, 121},
+        {7, 0x1, 122}, {8, 0x1, 122}, {9, 0x1, 122}, {10, 0x1, 122},
+        {11, 0x1, 122}, {12, 0x1, 122}, {13, 0x1, 122}, {14, 0x3, 122},
+    },
+    /* state 69: "111110" */
+    {
+        {3, 0x1, 38}, {4, 0x1, 38}, {5, 0x1, 38}, {6, 0x3, 38},
+        {3, 0x1, 42}, {4, 0x1, 42}, {5, 0x1, 42}, {6, 0x3, 42},
+        {3, 0x1, 44}, {4, 0x1, 44}, {5, 0x1, 44}, {6, 0x3, 44},
+        {3, 0x1, 59}, {4, 0x1, 59}, {5, 0x1, 59}, {6, 0x3, 59},
+    },
+    /* state 70: "111111" */
+    {
+        {3, 0x1, 88}, {4, 0x1, 88}, {5, 0x1, 88}, {6, 0x3, 88},
+        {3, 0x1, 90}, {4, 0x1, 90}, {5, 0x1, 90}, {6, 0x3, 90},
+        {0, 0x3, 33}, {0, 0x3, 34}, {0, 0x3, 40}, {0, 0x3, 41},
+        {0, 0x3, 63}, {81, 0x0, 0}, {82, 0x0, 0}, {83, 0x0, 0},
+    },
+    /* state 71: "1111100" */
+    {
+        {7, 0x1, 38}, {8, 0x1, 38}, {9, 0x1, 38}, {10, 0x1, 38},
+        {11, 0x1, 38}, {12, 0x1, 38}, {13, 0x1, 38}, {14, 0x3, 38},
+        {7, 0x1, 42}, {8, 0x1, 42}, {9, 0x1, 42}, {10, 0x1, 42},
+        {11, 0x1, 42}, {12, 0x1, 42}, {13, 0x1, 42}, {14, 0x3, 42},
+    },
+    /* state 72: "1111101" */
+    {
+        {7, 0x1, 44}, {8, 0x1, 44}, {9, 0x1, 44}, {10, 0x1, 44},
+        {11, 0x1, 44}, {12, 0x1, 44}, {13, 0x1, 44}, {14, 0x3, 44},
+        {7, 0x1, 59}, {8, 0x1, 59}, {9, 0x1, 59}, {10, 0x1, 59},
+        {11, 0x1, 59}, {12, 0x1, 59}, {13, 0x1, 59}, {14, 0x3, 59},
+    },
+    /* state 73: "1111110" */
+    {
+        {7, 0x1, 88}, {8, 0x1, 88}, {9, 0x1, 88}, {10, 0x1, 88},
+        {11, 0x1, 88}, {12, 0x1, 88}, {13, 0x1, 88}, {14, 0x3, 88},
+        {7, 0x1, 90}, {8, 0x1, 90}, {9, 0x1, 90}, {10, 0x1, 90},
+        {11, 0x1, 90}, {12, 0x1, 90}, {13, 0x1, 90}, {14, 0x3, 90},
+    },
+    /* state 74: "1111111" */
+    {
+        {1, 0x1, 33}, {2, 0x3, 33}, {1, 0x1, 34}, {2, 0x3, 34},
+        {1, 0x1, 40}, {2, 0x3, 40}, {1, 0x1, 41}, {2, 0x3, 41},
+        {1, 0x1, 63}, {2, 0x3, 63}, {0, 0x3, 39}, {0, 0x3, 43},
+        {0, 0x3, 124}, {84, 0x0, 0}, {85, 0x0, 0}, {86, 0x0, 0},
+    },
+    /* state 75: "11111110" */
+    {
+        {3, 0x1, 33}, {4, 0x1, 33}, {5, 0x1, 33}, {6, 0x3, 33},
+        {3, 0x1, 34}, {4, 0x1, 34}, {5, 0x1, 34}, {6, 0x3, 34},
+        {3, 0x1, 40}, {4, 0x1, 40}, {5, 0x1, 40}, {6, 0x3, 40},
+        {3, 0x1, 41}, {4, 0x1, 41}, {5, 0x1, 41}, {6, 0x3, 41},
+    },
+    /* state 76: "11111111" */
+    {
+        {3, 0x1, 63}, {4, 0x1, 63}, {5, 0x1, 63}, {6, 0x3, 63},
+        {1, 0x1, 39}, {2, 0x3, 39}, {1, 0x1, 43}, {2, 0x3, 43},
+        {1, 0x1, 124}, {2, 0x3, 124}, {0, 0x3, 35}, {0, 0x3, 62},
+        {87, 0x0, 0}, {88, 0x0, 0}, {89, 0x0, 0}, {90, 0x0, 0},
+    },
+    /* state 77: "111111100" */
+    {
+        {7, 0x1, 33}, {8, 0x1, 33}, {9, 0x1, 33}, {10, 0x1, 33},
+        {11, 0x1, 33}, {12, 0x1, 33}, {13, 0x1, 33}, {14, 0x3, 33},
+        {7, 0x1, 34}, {8, 0x1, 34}, {9, 0x1, 34}, {10, 0x1, 34},
+        {11, 0x1, 34}, {12, 0x1, 34}, {13, 0x1, 34}, {14, 0x3, 34},
+    },
+    /* state 78: "111111101" */
+    {
+        {7, 0x1, 40}, {8, 0x1, 40}, {9, 0x1, 40}, {10, 0x1, 40},
+        {11, 0x1, 40}, {12, 0x1, 40}, {13, 0x1, 40}, {14, 0x3, 40},
+        {7, 0x1, 41}, {8, 0x1, 41}, {9, 0x1, 41}, {10, 0x1, 41},
+        {11, 0x1, 41}, {12, 0x1, 41}, {13, 0x1, 41}, {14, 0x3, 41},
+    },
+    /* state 79: "111111110" */
+    {
+        {7, 0x1, 63}, {8, 0x1, 63}, {9, 0x1, 63}, {10, 0x1, 63},
+        {11, 0x1, 63}, {12, 0x1, 63}, {13, 0x1, 63}, {14, 0x3, 63},
+        {3, 0x1, 39}, {4, 0x1, 39}, {5, 0x1, 39}, {6, 0x3, 39},
+        {3, 0x1, 43}, {4, 0x1, 43}, {5, 0x1, 43}, {6, 0x3, 43},
+    },
+    /* state 80: "111111111" */
+    {
+        {3, 0x1, 124}, {4, 0x1, 124}, {5, 0x1, 124}, {6, 0x3, 124},
+        {1, 0x1, 35}, {2, 0x3, 35}, {1, 0x1, 62}, {2, 0x3, 62},
+        {0, 0x3, 0}, {0, 0x3, 36}, {0, 0x3, 64}, {0, 0x3, 91},
+        {0, 0x3, 93}, {0, 0x3, 126}, {91, 0x0, 0}, {92, 0x0, 0},
+    },
+    /* state 81: "1111111101" */
+    {
+        {7, 0x1, 39}, {8, 0x1, 39}, {9, 0x1, 39}, {10, 0x1, 39},
+        {11, 0x1, 39}, {12, 0x1, 39}, {13, 0x1, 39}, {14, 0x3, 39},
+        {7, 0x1, 43}, {8, 0x1, 43}, {9, 0x1, 43}, {10, 0x1, 43},
+        {11, 0x1, 43}, {12, 0x1, 43}, {13, 0x1, 43}, {14, 0x3, 43},
+    },
+    /* state 82: "1111111110" */
+    {
+        {7, 0x1, 124}, {8, 0x1, 124}, {9, 0x1, 124}, {10, 0x1, 124},
+        {11, 0x1, 124}, {12, 0x1, 124}, {13, 0x1, 124}, {14, 0x3, 124},
+        {3, 0x1, 35}, {4, 0x1, 35}, {5, 0x1, 35}, {6, 0x3, 35},
+        {3, 0x1, 62}, {4, 0x1, 62}, {5, 0x1, 62}, {6, 0x3, 62},
+    },
+    /* state 83: "1111111111" */
+    {
+        {1, 0x1, 0}, {2, 0x3, 0}, {1, 0x1, 36}, {2, 0x3, 36},
+        {1, 0x1, 64}, {2, 0x3, 64}, {1, 0x1, 91}, {2, 0x3, 91},
+        {1, 0x1, 93}, {2, 0x3, 93}, {1, 0x1, 126}, {2, 0x3, 126},
+        {0, 0x3, 94}, {0, 0x3, 125}, {93, 0x0, 0}, {94, 0x0, 0},
+    },
+    /* state 84: "11111111101" */
+    {
+        {7, 0x1, 35}, {8, 0x1, 35}, {9, 0x1, 35}, {10, 0x1, 35},
+        {11, 0x1, 35}, {12, 0x1, 35}, {13, 0x1, 35}, {14, 0x3, 35},
+        {7, 0x1, 62}, {8, 0x1, 62}, {9, 0x1, 62}, {10, 0x1, 62},
+        {11, 0x1, 62}, {12, 0x1, 62}, {13, 0x1, 62}, {14, 0x3, 62},
+    },
+    /* state 85: "11111111110" */
+    {
+        {3, 0x1, 0}, {4, 0x1, 0}, {5, 0x1, 0}, {6, 0x3, 0},
+        {3, 0x1, 36}, {4, 0x1, 36}, {5, 0x1, 36}, {6, 0x3, 36},
+        {3, 0x1, 64}, {4, 0x1, 64}, {5, 0x1, 64}, {6, 0x3, 64},
+        {3, 0x1, 91}, {4, 0x1, 91}, {5, 0x1, 91}, {6, 0x3, 91},
+    },
+    /* state 86: "11111111111" */
+    {
+        {3, 0x1, 93}, {4, 0x1, 93}, {5, 0x1, 93}, {6, 0x3, 93},
+        {3, 0x1, 126}, {4, 0x1, 126}, {5, 0x1, 126}, {6, 0x3, 126},
+        {1, 0x1, 94}, {2, 0x3, 94}, {1, 0x1, 125}, {2, 0x3, 125},
+        {0, 0x3, 60}, {0, 0x3, 96}, {0, 0x3, 123}, {95, 0x0, 0},
+    },
+    /* state 87: "111111111100" */
+    {
+        {7, 0x1, 0}, {8, 0x1, 0}, {9, 0x1, 0}, {10, 0x1, 0},
+        {11, 0x1, 0}, {12, 0x1, 0}, {13, 0x1, 0}, {14, 0x3, 0},
+        {7, 0x1, 36}, {8, 0x1, 36}, {9, 0x1, 36}, {10, 0x1, 36},
+        {11, 0x1, 36}, {12, 0x1, 36}, {13, 0x1, 36}, {14, 0x3, 36},
+    },
+    /* state 88: "111111111101" */
+    {
+        {7, 0x1, 64}, {8, 0x1, 64}, {9, 0x1, 64}, {10, 0x1, 64},
+        {11, 0x1, 64}, {12, 0x1, 64}, {13, 0x1, 64}, {14, 0x3, 64},
+        {7, 0x1, 91}, {8, 0x1, 91}, {9, 0x1, 91}, {10, 0x1, 91},
+        {11, 0x1, 91}, {12, 0x1, 91}, {13, 0x1, 91}, {14, 0x3, 91},
+    },
+    /* state 89: "111111111110" */
+    {
+        {7, 0x1, 93}, {8, 0x1, 93}, {9, 0x1, 93}, {10, 0x1, 93},
+        {11, 0x1, 93}, {12, 0x1, 93}, {13, 0x1, 93}, {14, 0x3, 93},
+        {7, 0x1, 126}, {8, 0x1, 126}, {9, 0x1, 126}, {10, 0x1, 126},
+        {11, 0x1, 126}, {12, 0x1, 126}, {13, 0x1, 126}, {14, 0x3, 126},
+    },
+    /* state 90: "111111111111" */
+    {
+        {3, 0x1, 94}, {4, 0x1, 94}, {5, 0x1, 94}, {6, 0x3, 94},
+        {3, 0x1, 125}, {4, 0x1, 125}, {5, 0x1, 125}, {6, 0x3, 125},
+        {1, 0x1, 60}, {2, 0x3, 60}, {1, 0x1, 96}, {2, 0x3, 96},
+        {1, 0x1, 123}, {2, 0x3, 123}, {96, 0x0, 0}, {97, 0x0, 0},
+    },
+    /* state 91: "1111111111110" */
+    {
+        {7, 0x1, 94}, {8, 0x1, 94}, {9, 0x1, 94}, {10, 0x1, 94},
+        {11, 0x1, 94}, {12, 0x1, 94}, {13, 0x1, 94}, {14, 0x3, 94},
+        {7, 0x1, 125}, {8, 0x1, 125}, {9, 0x1, 125}, {10, 0x1, 125},
+        {11, 0x1, 125}, {12, 0x1, 125}, {13, 0x1, 125}, {14, 0x3, 125},
+    },
+    /* state 92: "1111111111111" */
+    {
+        {3, 0x1, 60}, {4, 0x1, 60}, {5, 0x1, 60}, {6, 0x3, 60},
+        {3, 0x1, 96}, {4, 0x1, 96}, {5, 0x1, 96}, {6, 0x3, 96},
+        {3, 0x1, 123}, {4, 0x1, 123}, {5, 0x1, 123}, {6, 0x3, 123},
+        {98, 0x0, 0}, {99, 0x0, 0}, {100, 0x0, 0}, {101, 0x0, 0},
+    },
+    /* state 93: "11111111111110" */
+    {
+        {7, 0x1, 60}, {8, 0x1, 60}, {9, 0x1, 60}, {10, 0x1, 60},
+        {11, 0x1, 60}, {12, 0x1, 60}, {13, 0x1, 60}, {14, 0x3, 60},
+        {7, 0x1, 96}, {8, 0x1, 96}, {9, 0x1, 96}, {10, 0x1, 96},
+        {11, 0x1, 96}, {12, 0x1, 96}, {13, 0x1, 96}, {14, 0x3, 96},
+    },
+    /* state 94: "11111111111111" */
+    {
+        {7, 0x1, 123}, {8, 0x1, 123}, {9, 0x1, 123}, {10, 0x1, 123},
+        {11, 0x1, 123}, {12, 0x1, 123}, {13, 0x1, 123}, {14, 0x3, 123},
+        {102, 0x0, 0}, {103, 0x0, 0}, {104, 0x0, 0}, {105, 0x0, 0},
+        {106, 0x0, 0}, {107, 0x0, 0}, {108, 0x0, 0}, {109, 0x0, 0},
+    },
+    /* state 95: "111111111111111" */
+    {
+        {0, 0x3, 92}, {0, 0x3, 195}, {0, 0x3, 208}, {110, 0x0, 0},
+        {111, 0x0, 0}, {112, 0x0, 0}, {113, 0x0, 0}, {114, 0x0, 0},
+        {115, 0x0, 0}, {116, 0x0, 0}, {117, 0x0, 0}, {118, 0x0, 0},
+        {119, 0x0, 0}, {120, 0x0, 0}, {121, 0x0, 0}, {122, 0x0, 0},
+    },
+    /* state 96: "1111111111111110" */
+    {
+        {1, 0x1, 92}, {2, 0x3, 92}, {1, 0x1, 195}, {2, 0x3, 195},
+        {1, 0x1, 208}, {2, 0x3, 208}, {0, 0x3, 128}, {0, 0x3, 130},
+        {0, 0x3, 131}, {0, 0x3, 162}, {0, 0x3, 184}, {0, 0x3, 194},
+        {0, 0x3, 224}, {0, 0x3, 226}, {123, 0x0, 0}, {124, 0x0, 0},
+    },
+    /* state 97: "1111111111111111" */
+    {
+        {125, 0x0, 0}, {126, 0x0, 0}, {127, 0x0, 0}, {128, 0x0, 0},
+        {129, 0x0, 0}, {130, 0x0, 0}, {131, 0x0, 0}, {132, 0x0, 0},
+        {133, 0x0, 0}, {134, 0x0, 0}, {135, 0x0, 0}, {136, 0x0, 0},
+        {137, 0x0, 0}, {138, 0x0, 0}, {139, 0x0, 0}, {140, 0x0, 0},
+    },
+    /* state 98: "11111111111111100" */
+    {
+        {3, 0x1, 92}, {4, 0x1, 92}, {5, 0x1, 92}, {6, 0x3, 92},
+        {3, 0x1, 195}, {4, 0x1, 195}, {5, 0x1, 195}, {6, 0x3, 195},
+        {3, 0x1, 208}, {4, 0x1, 208}, {5, 0x1, 208}, {6, 0x3, 208},
+        {1, 0x1, 128}, {2, 0x3, 128}, {1, 0x1, 130}, {2, 0x3, 130},
+    },
+    /* state 99: "11111111111111101" */
+    {
+        {1, 0x1, 131}, {2, 0x3, 131}, {1, 0x1, 162}, {2, 0x3, 162},
+        {1, 0x1, 184}, {2, 0x3, 184}, {1, 0x1, 194}, {2, 0x3, 194},
+        {1, 0x1, 224}, {2, 0x3, 224}, {1, 0x1, 226}, {2, 0x3, 226},
+        {0, 0x3, 153}, {0, 0x3, 161}, {0, 0x3, 167}, {0, 0x3, 172},
+    },
+    /* state 100: "11111111111111110" */
+    {
+        {0, 0x3, 176}, {0, 0x3, 177}, {0, 0x3, 179}, {0, 0x3, 209},
+        {0, 0x3, 216}, {0, 0x3, 217}, {0, 0x3, 227}, {0, 0x3, 229},
+        {0, 0x3, 230}, {141, 0x0, 0}, {142, 0x0, 0}, {143, 0x0, 0},
+        {144, 0x0, 0}, {145, 0x0, 0}, {146, 0x0, 0}, {147, 0x0, 0},
+    },
+    /* state 101: "11111111111111111" */
+    {
+        {148, 0x0, 0}, {149, 0x0, 0}, {150, 0x0, 0}, {151, 0x0, 0},
+        {152, 0x0, 0}, {153, 0x0, 0}, {154, 0x0, 0}, {155, 0x0, 0},
+        {156, 0x0, 0}, {157, 0x0, 0}, {158, 0x0, 0}, {159, 0x0, 0},
+        {160, 0x0, 0}, {161, 0x0, 0}, {162, 0x0, 0}, {163, 0x0, 0},
+    },
+    /* state 102: "111111111111111000" */
+    {
+        {7, 0x1, 92}, {8, 0x1, 92}, {9, 0x1, 92}, {10, 0x1, 92},
+        {11, 0x1, 92}, {12, 0x1, 92}, {13, 0x1, 92}, {14, 0x3, 92},
+        {7, 0x1, 195}, {8, 0x1, 195}, {9, 0x1, 195}, {10, 0x1, 195},
+        {11, 0x1, 195}, {12, 0x1, 195}, {13, 0x1, 195}, {14, 0x3, 195},
+    },
+    /* state 103: "111111111111111001" */
+    {
+        {7, 0x1, 208}, {8, 0x1, 208}, {9, 0x1, 208}, {10, 0x1, 208},
+        {11, 0x1, 208}, {12, 0x1, 208}, {13, 0x1, 208}, {14, 0x3, 208},
+        {3, 0x1, 128}, {4, 0x1, 128}, {5, 0x1, 128}, {6, 0x3, 128},
+        {3, 0x1, 130}, {4, 0x1, 130}, {5, 0x1, 130}, {6, 0x3, 130},
+    },
+    /* state 104: "111111111111111010" */
+    {
+        {3, 0x1, 131}, {4, 0x1, 131}, {5, 0x1, 131}, {6, 0x3, 131},
+        {3, 0x1, 162}, {4, 0x1, 162}, {5, 0x1, 162}, {6, 0x3, 162},
+        {3, 0x1, 184}, {4, 0x1, 184}, {5, 0x1, 184}, {6, 0x3, 184},
+        {3, 0x1, 194}, {4, 0x1, 194}, {5, 0x1, 194}, {6, 0x3, 194},
+    },
+    /* state 105: "111111111111111011" */
+    {
+        {3, 0x1, 224}, {4, 0x1, 224}, {5, 0x1, 224}, {6, 0x3, 224},
+        {3, 0x1, 226}, {4, 0x1, 226}, {5, 0x1, 226}, {6, 0x3, 226},
+        {1, 0x1, 153}, {2, 0x3, 153}, {1, 0x1, 161}, {2, 0x3, 161},
+        {1, 0x1, 167}, {2, 0x3, 167}, {1, 0x1, 172}, {2, 0x3, 172},
+    },
+    /* state 106: "111111111111111100" */
+    {
+        {1, 0x1, 176}, {2, 0x3, 176}, {1, 0x1, 177}, {2, 0x3, 177},
+        {1, 0x1, 179}, {2, 0x3, 179}, {1, 0x1, 209}, {2, 0x3, 209},
+        {1, 0x1, 216}, {2, 0x3, 216}, {1, 0x1, 217}, {2, 0x3, 217},
+        {1, 0x1, 227}, {2, 0x3, 227}, {1, 0x1, 229}, {2, 0x3, 229},
+    },
+    /* state 107: "111111111111111101" */
+    {
+        {1, 0x1, 230}, {2, 0x3, 230}, {0, 0x3, 129}, {0, 0x3, 132},
+        {0, 0x3, 133}, {0, 0x3, 134}, {0, 0x3, 136}, {0, 0x3, 146},
+        {0, 0x3, 154}, {0, 0x3, 156}, {0, 0x3, 160}, {0, 0x3, 163},
+        {0, 0x3, 164}, {0, 0x3, 169}, {0, 0x3, 170}, {0, 0x3, 173},
+    },
+    /* state 108: "111111111111111110" */
+    {
+        {0, 0x3, 178}, {0, 0x3, 181}, {0, 0x3, 185}, {0, 0x3, 186},
+        {0, 0x3, 187}, {0, 0x3, 189}, {0, 0x3, 190}, {0, 0x3, 196},
+        {0, 0x3, 198}, {0, 0x3, 228}, {0, 0x3, 232}, {0, 0x3, 233},
+        {164, 0x0, 0}, {165, 0x0, 0}, {166, 0x0, 0}, {167, 0x0, 0},
+    },
+    /* state 109: "111111111111111111" */
+    {
+        {168, 0x0, 0}, {169, 0x0, 0}, {170, 0x0, 0}, {171, 0x0, 0},
+        {172, 0x0, 0}, {173, 0x0, 0}, {174, 0x0, 0}, {175, 0x0, 0},
+        {176, 0x0, 0}, {177, 0x0, 0}, {178, 0x0, 0}, {179, 0x0, 0},
+        {180, 0x0, 0}, {181, 0x0, 0}, {182, 0x0, 0}, {183, 0x0, 0},
+    },
+    /* state 110: "1111111111111110011" */
+    {
+        {7, 0x1, 128}, {8, 0x1, 128}, {9, 0x1, 128}, {10, 0x1, 128},
+        {11, 0x1, 128}, {12, 0x1, 128}, {13, 0x1, 128}, {14, 0x3, 128},
+        {7, 0x1, 130}, {8, 0x1, 130}, {9, 0x1, 130}, {10, 0x1, 130},
+        {11, 0x1, 130}, {12, 0x1, 130}, {13, 0x1, 130}, {14, 0x3, 130},
+    },
+    /* state 111: "1111111111111110100" */
+    {
+        {7, 0x1, 131}, {8, 0x1, 131}, {9, 0x1, 131}, {10, 0x1, 131},
+        {11, 0x1, 131}, {12, 0x1, 131}, {13, 0x1, 131}, {14, 0x3, 131},
+        {7, 0x1, 162}, {8, 0x1, 162}, {9, 0x1, 162}, {10, 0x1, 162},
+        {11, 0x1, 162}, {12, 0x1, 162}, {13, 0x1, 162}, {14, 0x3, 162},
+    },
+    /* state 112: "1111111111111110101" */
+    {
+        {7, 0x1, 184}, {8, 0x1, 184}, {9, 0x1, 184}, {10, 0x1, 184},
+        {11, 0x1, 184}, {12, 0x1, 184}, {13, 0x1, 184}, {14, 0x3, 184},
+        {7, 0x1, 194}, {8, 0x1, 194}, {9, 0x1, 194}, {10, 0x1, 194},
+        {11, 0x1, 194}, {12, 0x1, 194}, {13, 0x1, 194}, {14, 0x3, 194},
+    },
+    /* state 113: "1111111111111110110" */
+    {
+        {7, 0x1, 224}, {8, 0x1, 224}, {9, 0x1, 224}, {10, 0x1, 224},
+        {11, 0x1, 224}, {12, 0x1, 224}, {13, 0x1, 224}, {14, 0x3, 224},
+        {7, 0x1, 226}, {8, 0x1, 226}, {9, 0x1, 226}, {10, 0x1, 226},
+        {11, 0x1, 226}, {12, 0x1, 226}, {13, 0x1, 226}, {14, 0x3, 226},
+    },
+    /* state 114: "1111111111111110111" */
+    {
+        {3, 0x1, 153}, {4, 0x1, 153}, {5, 0x1, 153}, {6, 0x3, 153},
+        {3, 0x1, 161}, {4, 0x1, 161}, {5, 0x1, 161}, {6, 0x3, 161},
+        {3, 0x1, 167}, {4, 0x1, 167}, {5, 0x1, 167}, {6, 0x3, 167},
+        {3, 0x1, 172}, {4, 0x1, 172}, {5, 0x1, 172}, {6, 0x3, 172},
+    },
+    /* state 115: "1111111111111111000" */
+    {
+        {3, 0x1, 176}, {4, 0x1, 176}, {5, 0x1, 176}, {6, 0x3, 176},
+        {3, 0x1, 177}, {4, 0x1, 177}, {5, 0x1, 177}, {6, 0x3, 177},
+        {3, 0x1, 179}, {4, 0x1, 179}, {5, 0x1, 179}, {6, 0x3, 179},
+        {3, 0x1, 209}, {4, 0x1, 209}, {5, 0x1, 209}, {6, 0x3, 209},
+    },
+    /* state 116: "1111111111111111001" */
+    {
+        {3, 0x1, 216}, {4, 0x1, 216}, {5, 0x1, 216}, {6, 0x3, 216},
+        {3, 0x1, 217}, {4, 0x1, 217}, {5, 0x1, 217}, {6, 0x3, 217},
+        {3, 0x1, 227}, {4, 0x1, 227}, {5, 0x1, 227}, {6, 0x3, 227},
+        {3, 0x1, 229}, {4, 0x1, 229}, {5, 0x1, 229}, {6, 0x3, 229},
+    },
+    /* state 117: "1111111111111111010" */
+    {
+        {3, 0x1, 230}, {4, 0x1, 230}, {5, 0x1, 230}, {6, 0x3, 230},
+        {1, 0x1, 129}, {2, 0x3, 129}, {1, 0x1, 132}, {2, 0x3, 132},
+        {1, 0x1, 133}, {2, 0x3, 133}, {1, 0x1, 134}, {2, 0x3, 134},
+        {1, 0x1, 136}, {2, 0x3, 136}, {1, 0x1, 146}, {2, 0x3, 146},
+    },
+    /* state 118: "1111111111111111011" */
+    {
+        {1, 0x1, 154}, {2, 0x3, 154}, {1, 0x1, 156}, {2, 0x3, 156},
+        {1, 0x1, 160}, {2, 0x3, 160}, {1, 0x1, 163}, {2, 0x3, 163},
+        {1, 0x1, 164}, {2, 0x3, 164}, {1, 0x1, 169}, {2, 0x3, 169},
+        {1, 0x1, 170}, {2, 0x3, 170}, {1, 0x1, 173}, {2, 0x3, 173},
+    },
+    /* state 119: "1111111111111111100" */
+    {
+        {1, 0x1, 178}, {2, 0x3, 178}, {1, 0x1, 181}, {2, 0x3, 181},
+        {1, 0x1, 185}, {2, 0x3, 185}, {1, 0x1, 186}, {2, 0x3, 186},
+        {1, 0x1, 187}, {2, 0x3, 187}, {1, 0x1, 189}, {2, 0x3, 189},
+        {1, 0x1, 190}, {2, 0x3, 190}, {1, 0x1, 196}, {2, 0x3, 196},
+    },
+    /* state 120: "1111111111111111101" */
+    {
+        {1, 0x1, 198}, {2, 0x3, 198}, {1, 0x1, 228}, {2, 0x3, 228},
+        {1, 0x1, 232}, {2, 0x3, 232}, {1, 0x1, 233}, {2, 0x3, 233},
+        {0, 0x3, 1}, {0, 0x3, 135}, {0, 0x3, 137}, {0, 0x3, 138},
+        {0, 0x3, 139}, {0, 0x3, 140}, {0, 0x3, 141}, {0, 0x3, 143},
+    },
+    /* state 121: "1111111111111111110" */
+    {
+        {0, 0x3, 147}, {0, 0x3, 149}, {0, 0x3, 150}, {0, 0x3, 151},
+        {0, 0x3, 152}, {0, 0x3, 155}, {0, 0x3, 157}, {0, 0x3, 158},
+        {0, 0x3, 165}, {0, 0x3, 166}, {0, 0x3, 168}, {0, 0x3, 174},
+        {0, 0x3, 175}, {0, 0x3, 180}, {0, 0x3, 182}, {0, 0x3, 183},
+    },
+    /* state 122: "1111111111111111111" */
+    {
+        {0, 0x3, 188}, {0, 0x3, 191}, {0, 0x3, 197}, {0, 0x3, 231},
+        {0, 0x3, 239}, {184, 0x0, 0}, {185, 0x0, 0}, {186, 0x0, 0},
+        {187, 0x0, 0}, {188, 0x0, 0}, {189, 0x0, 0}, {190, 0x0, 0},
+        {191, 0x0, 0}, {192, 0x0, 0}, {193, 0x0, 0}, {194, 0x0, 0},
+    },
+    /* state 123: "11111111111111101110" */
+    {
+        {7, 0x1, 153}, {8, 0x1, 153}, {9, 0x1, 153}, {10, 0x1, 153},
+        {11, 0x1, 153}, {12, 0x1, 153}, {13, 0x1, 153}, {14, 0x3, 153},
+        {7, 0x1, 161}, {8, 0x1, 161}, {9, 0x1, 161}, {10, 0x1, 161},
+        {11, 0x1, 161}, {12, 0x1, 161}, {13, 0x1, 161}, {14, 0x3, 161},
+    },
+    /* state 124: "11111111111111101111" */
+    {
+        {7, 0x1, 167}, {8, 0x1, 167}, {9, 0x1, 167}, {10, 0x1, 167},
+        {11, 0x1, 167}, {12, 0x1, 167}, {13, 0x1, 167}, {14, 0x3, 167},
+        {7, 0x1, 172}, {8, 0x1, 172}, {9, 0x1, 172}, {10, 0x1, 172},
+        {11, 0x1, 172}, {12, 0x1, 172}, {13, 0x1, 172}, {14, 0x3, 172},
+    },
+    /* state 125: "11111111111111110000" */
+    {
+        {7, 0x1, 176}, {8, 0x1, 176}, {9, 0x1, 176}, {10, 0x1, 176},
+        {11, 0x1, 176}, {12, 0x1, 176}, {13, 0x1, 176}, {14, 0x3, 176},
+        {7, 0x1, 177}, {8, 0x1, 177}, {9, 0x1, 177}, {10, 0x1, 177},
+        {11, 0x1, 177}, {12, 0x1, 177}, {13, 0x1, 177}, {14, 0x3, 177},
+    },
+    /* state 126: "11111111111111110001" */
+    {
+        {7, 0x1, 179}, {8, 0x1, 179}, {9, 0x1, 179}, {10, 0x1, 179},
+        {11, 0x1, 179}, {12, 0x1, 179}, {13, 0x1, 179}, {14, 0x3, 179},
+        {7, 0x1, 209}, {8, 0x1, 209}, {9, 0x1, 209}, {10, 0x1, 209},
+        {11, 0x1, 209}, {12, 0x1, 209}, {13, 0x1, 209}, {14, 0x3, 209},
+    },
+    /* state 127: "11111111111111110010" */
+    {
+        {7, 0x1, 216}, {8, 0x1, 216}, {9, 0x1, 216}, {10, 0x1, 216},
+        {11, 0x1, 216}, {12, 0x1, 216}, {13, 0x1, 216}, {14, 0x3, 216},
+        {7, 0x1, 217}, {8, 0x1, 217}, {9, 0x1, 217}, {10, 0x1, 217},
+        {11, 0x1, 217}, {12, 0x1, 217}, {13, 0x1, 217}, {14, 0x3, 217},
+    },
+    /* state 128: "11111111111111110011" */
+    {
+        {7, 0x1, 227}, {8, 0x1, 227}, {9, 0x1, 227}, {10, 0x1, 227},
+        {11, 0x1, 227}, {12, 0x1, 227}, {13, 0x1, 227}, {14, 0x3, 227},
+        {7, 0x1, 229}, {8, 0x1, 229}, {9, 0x1, 229}, {10, 0x1, 229},
+        {11, 0x1, 229}, {12, 0x1, 229}, {13, 0x1, 229}, {14, 0x3, 229},
+    },
+    /* state 129: "11111111111111110100" */
+    {
+        {7, 0x1, 230}, {8, 0x1, 230}, {9, 0x1, 230}, {10, 0x1, 230},
+        {11, 0x1, 230}, {12, 0x1, 230}, {13, 0x1, 230}, {14, 0x3, 230},
+        {3, 0x1, 129}, {4, 0x1, 129}, {5, 0x1, 129}, {6, 0x3, 129},
+        {3, 0x1, 132}, {4, 0x1, 132}, {5, 0x1, 132}, {6, 0x3, 132},
+    },
+    /* state 130: "11111111111111110101" */
+    {
+        {3, 0x1, 133}, {4, 0x1, 133}, {5, 0x1, 133}, {6, 0x3, 133},
+        {3, 0x1, 134}, {4, 0x1, 134}, {5, 0x1, 134}, {6, 0x3, 134},
+        {3, 0x1, 136}, {4, 0x1, 136}, {5, 0x1, 136}, {6, 0x3, 136},
+        {3, 0x1, 146}, {4, 0x1, 146}, {5, 0x1, 146}, {6, 0x3, 146},
+    },
+    /* state 131: "11111111111111110110" */
+    {
+        {3, 0x1, 154}, {4, 0x1, 154}, {5, 0x1, 154}, {6, 0x3, 154},
+        {3, 0x1, 156}, {4, 0x1, 156}, {5, 0x1, 156}, {6, 0x3, 156},
+        {3, 0x1, 160}, {4, 0x1, 160}, {5, 0x1, 160}, {6, 0x3, 160},
+        {3, 0x1, 163}, {4, 0x1, 163}, {5, 0x1, 163}, {6, 0x3, 163},
+    },
+    /* state 132: "11111111111111110111" */
+    {
+        {3, 0x1, 164}, {4, 0x1, 164}, {5, 0x1, 164}, {6, 0x3, 164},
+        {3, 0x1, 169}, {4, 0x1, 169}, {5, 0x1, 169}, {6, 0x3, 169},
+        {3, 0x1, 170}, {4, 0x1, 170}, {5, 0x1, 170}, {6, 0x3, 170},
+        {3, 0x1, 173}, {4, 0x1, 173}, {5, 0x1, 173}, {6, 0x3, 173},
+    },
+    /* state 133: "11111111111111111000" */
+    {
+        {3, 0x1, 178}, {4, 0x1, 178}, {5, 0x1, 178}, {6, 0x3, 178},
+        {3, 0x1, 181}, {4, 0x1, 181}, {5, 0x1, 181}, {6, 0x3, 181},
+        {3, 0x1, 185}, {4, 0x1, 185}, {5, 0x1, 185}, {6, 0x3, 185},
+        {3, 0x1, 186}, {4, 0x1, 186}, {5, 0x1, 186}, {6, 0x3, 186},
+    },
+    /* state 134: "11111111111111111001" */
+    {
+        {3, 0x1, 187}, {4, 0x1, 187}, {5, 0x1, 187}, {6, 0x3, 187},
+        {3, 0x1, 189}, {4, 0x1, 189}, {5, 0x1, 189}, {6, 0x3, 189},
+        {3, 0x1, 190}, {4, 0x1, 190}, {5, 0x1, 190}, {6, 0x3, 190},
+        {3, 0x1, 196}, {4, 0x1, 196}, {5, 0x1, 196}, {6, 0x3, 196},
+    },
+    /* state 135: "11111111111111111010" */
+    {
+        {3, 0x1, 198}, {4, 0x1, 198}, {5, 0x1, 198}, {6, 0x3, 198},
+        {3, 0x1, 228}, {4, 0x1, 228}, {5, 0x1, 228}, {6, 0x3, 228},
+        {3, 0x1, 232}, {4, 0x1, 232}, {5, 0x1, 232}, {6, 0x3, 232},
+        {3, 0x1, 233}, {4, 0x1, 233}, {5, 0x1, 233}, {6, 0x3, 233},
+    },
+    /* state 136: "11111111111111111011" */
+    {
+        {1, 0x1, 1}, {2, 0x3, 1}, {1, 0x1, 135}, {2, 0x3, 135},
+        {1, 0x1, 137}, {2, 0x3, 137}, {1, 0x1, 138}, {2, 0x3, 138},
+        {1, 0x1, 139}, {2, 0x3, 139}, {1, 0x1, 140}, {2, 0x3, 140},
+        {1, 0x1, 141}, {2, 0x3, 141}, {1, 0x1, 143}, {2, 0x3, 143},
+    },
+    /* state 137: "11111111111111111100" */
+    {
+        {1, 0x1, 147}, {2, 0x3, 147}, {1, 0x1, 149}, {2, 0x3, 149},
+        {1, 0x1, 150}, {2, 0x3, 150}, {1, 0x1, 151}, {2, 0x3, 151},
+        {1, 0x1, 152}, {2, 0x3, 152}, {1, 0x1, 155}, {2, 0x3, 155},
+        {1, 0x1, 157}, {2, 0x3, 157}, {1, 0x1, 158}, {2, 0x3, 158},
+    },
+    /* state 138: "11111111111111111101" */
+    {
+        {1, 0x1, 165}, {2, 0x3, 165}, {1, 0x1, 166}, {2, 0x3, 166},
+        {1, 0x1, 168}, {2, 0x3, 168}, {1, 0x1, 174}, {2, 0x3, 174},
+        {1, 0x1, 175}, {2, 0x3, 175}, {1, 0x1, 180}, {2, 0x3, 180},
+        {1, 0x1, 182}, {2, 0x3, 182}, {1, 0x1, 183}, {2, 0x3, 183},
+    },
+    /* state 139: "11111111111111111110" */
+    {
+        {1, 0x1, 188}, {2, 0x3, 188}, {1, 0x1, 191}, {2, 0x3, 191},
+        {1, 0x1, 197}, {2, 0x3, 197}, {1, 0x1, 231}, {2, 0x3, 231},
+        {1, 0x1, 239}, {2, 0x3, 239}, {0, 0x3, 9}, {0, 0x3, 142},
+        {0, 0x3, 144}, {0, 0x3, 145}, {0, 0x3, 148}, {0, 0x3, 159},
+    },
+    /* state 140: "11111111111111111111" */
+    {
+        {0, 0x3, 171}, {0, 0x3, 206}, {0, 0x3, 215}, {0, 0x3, 225},
+        {0, 0x3, 236}, {0, 0x3, 237}, {195, 0x0, 0}, {196, 0x0, 0},
+        {197, 0x0, 0}, {198, 0x0, 0}, {199, 0x0, 0}, {200, 0x0, 0},
+        {201, 0x0, 0}, {202, 0x0, 0}, {203, 0x0, 0}, {204, 0x0, 0},
+    },
+    /* state 141: "111111111111111101001" */
+    {
+        {7, 0x1, 129}, {8, 0x1, 129}, {9, 0x1, 129}, {10, 0x1, 129},
+        {11, 0x1, 129}, {12, 0x1, 129}, {13, 0x1, 129}, {14, 0x3, 129},
+        {7, 0x1, 132}, {8, 0x1, 132}, {9, 0x1, 132}, {10, 0x1, 132},
+        {11, 0x1, 132}, {12, 0x1, 132}, {13, 0x1, 132}, {14, 0x3, 132},
+    },
+    /* state 142: "111111111111111101010" */
+    {
+        {7, 0x1, 133}, {8, 0x1, 133}, {9, 0x1, 133}, {10, 0x1, 133},
+        {11, 0x1, 133}, {12, 0x1, 133}, {13, 0x1, 133}, {14, 0x3, 133},
+        {7, 0x1, 134}, {8, 0x1, 134}, {9, 0x1, 134}, {10, 0x1, 134},
+        {11, 0x1, 134}, {12, 0x1, 134}, {13, 0x1, 134}, {14, 0x3, 134},
+    },
+    /* state 143: "111111111111111101011" */
+    {
+        {7, 0x1, 136}, {8, 0x1, 136}, {9, 0x1, 136}, {10, 0x1, 136},
+        {11, 0x1, 136}, {12, 0x1, 136}, {13, 0x1, 136}, {14, 0x3, 136},
+        {7, 0x1, 146}, {8, 0x1, 146}, {9, 0x1, 146}, {10, 0x1, 146},
+        {11, 0x1, 146}, {12, 0x1, 146}, {13, 0x1, 146}, {14, 0x3, 146},
+    },
+    /* state 144: "111111111111111101100" */
+    {
+        {7, 0x1, 154}, {8, 0x1, 154}, {9, 0x1, 154}, {10, 0x1, 154},
+        {11, 0x1, 154}, {12, 0x1, 154}, {13, 0x1, 154}, {14, 0x3, 154},
+        {7, 0x1, 156}, {8, 0x1, 156}, {9, 0x1, 156}, {10, 0x1, 156},
+        {11, 0x1, 156}, {12, 0x1, 156}, {13, 0x1, 156}, {14, 0x3, 156},
+    },
+    /* state 145: "111111111111111101101" */
+    {
+        {7, 0x1, 160}, {8, 0x1, 160}, {9, 0x1, 160}, {10, 0x1, 160},
+        {11, 0x1, 160}, {12, 0x1, 160}, {13, 0x1, 160}, {14, 0x3, 160},
+        {7, 0x1, 163}, {8, 0x1, 163}, {9, 0x1, 163}, {10, 0x1, 163},
+        {11, 0x1, 163}, {12, 0x1, 163}, {13, 0x1, 163}, {14, 0x3, 163},
+    },
+    /* state 146: "111111111111111101110" */
+    {
+        {7, 0x1, 164}, {8, 0x1, 164}, {9, 0x1, 164}, {10, 0x1, 164},
+        {11, 0x1, 164}, {12, 0x1, 164}, {13, 0x1, 164}, {14, 0x3, 164},
+        {7, 0x1, 169}, {8, 0x1, 169}, {9, 0x1, 169}, {10, 0x1, 169},
+        {11, 0x1, 169}, {12, 0x1, 169}, {13, 0x1, 169}, {14, 0x3, 169},
+    },
+    /* state 147: "111111111111111101111" */
+    {
+        {7, 0x1, 170}, {8, 0x1, 170}, {9, 0x1, 170}, {10, 0x1, 170},
+        {11, 0x1, 170}, {12, 0x1, 170}, {13, 0x1, 170}, {14, 0x3, 170},
+        {7, 0x1, 173}, {8, 0x1, 173}, {9, 0x1, 173}, {10, 0x1, 173},
+        {11, 0x1, 173}, {12, 0x1, 173}, {13, 0x1, 173}, {14, 0x3, 173},
+    },
+    /* state 148: "111111111111111110000" */
+    {
+        {7, 0x1, 178}, {8, 0x1, 178}, {9, 0x1, 178}, {10, 0x1, 178},
+        {11, 0x1, 178}, {12, 0x1, 178}, {13, 0x1, 178}, {14, 0x3, 178},
+        {7, 0x1, 181}, {8, 0x1, 181}, {9, 0x1, 181}, {10, 0x1, 181},
+        {11, 0x1, 181}, {12, 0x1, 181}, {13, 0x1, 181}, {14, 0x3, 181},
+    },
+    /* state 149: "111111111111111110001" */
+    {
+        {7, 0x1, 185}, {8, 0x1, 185}, {9, 0x1, 185}, {10, 0x1, 185},
+        {11, 0x1, 185}, {12, 0x1, 185}, {13, 0x1, 185}, {14, 0x3, 185},
+        {7, 0x1, 186}, {8, 0x1, 186}, {9, 0x1, 186}, {10, 0x1, 186},
+        {11, 0x1, 186}, {12, 0x1, 186}, {13, 0x1, 186}, {14, 0x3, 186},
+    },
+    /* state 150: "111111111111111110010" */
+    {
+        {7, 0x1, 187}, {8, 0x1, 187}, {9, 0x1, 187}, {10, 0x1, 187},
+        {11, 0x1, 187}, {12, 0x1, 187}, {13, 0x1, 187}, {14, 0x3, 187},
+        {7, 0x1, 189}, {8, 0x1, 189}, {9, 0x1, 189}, {10, 0x1, 189},
+        {11, 0x1, 189}, {12, 0x1, 189}, {13, 0x1, 189}, {14, 0x3, 189},
+    },
+    /* state 151: "111111111111111110011" */
+    {
+        {7, 0x1, 190}, {8, 0x1, 190}, {9, 0x1, 190}, {10, 0x1, 190},
+        {11, 0x1, 190}, {12, 0x1, 190}, {13, 0x1, 190}, {14, 0x3, 190},
+        {7, 0x1, 196}, {8, 0x1, 196}, {9, 0x1, 196}, {10, 0x1, 196},
+        {11, 0x1, 196}, {12, 0x1, 196}, {13, 0x1, 196}, {14, 0x3, 196},
+    },
+    /* state 152: "111111111111111110100" */
+    {
+        {7, 0x1, 198}, {8, 0x1, 198}, {9, 0x1, 198}, {10, 0x1, 198},
+        {11, 0x1, 198}, {12, 0x1, 198}, {13, 0x1, 198}, {14, 0x3, 198},
+        {7, 0x1, 228}, {8, 0x1, 228}, {9, 0x1, 228}, {10, 0x1, 228},
+        {11, 0x1, 228}, {12, 0x1, 228}, {13, 0x1, 228}, {14, 0x3, 228},
+    },
+    /* state 153: "111111111111111110101" */
+    {
+        {7, 0x1, 232}, {8, 0x1, 232}, {9, 0x1, 232}, {10, 0x1, 232},
+        {11, 0x1, 232}, {12, 0x1, 232}, {13, 0x1, 232}, {14, 0x3, 232},
+        {7, 0x1, 233}, {8, 0x1, 233}, {9, 0x1, 233}, {10, 0x1, 233},
+        {11, 0x1, 233}, {12, 0x1, 233}, {13, 0x1, 233}, {14, 0x3, 233},
+    },
+    /* state 154: "111111111111111110110" */
+    {
+        {3, 0x1, 1}, {4, 0x1, 1}, {5, 0x1, 1}, {6, 0x3, 1},
+        {3, 0x1, 135}, {4, 0x1, 135}, {5, 0x1, 135}, {6, 0x3, 135},
+        {3, 0x1, 137}, {4, 0x1, 137}, {5, 0x1, 137}, {6, 0x3, 137},
+        {3, 0x1, 138}, {4, 0x1, 138}, {5, 0x1, 138}, {6, 0x3, 138},
+    },
+    /* state 155: "111111111111111110111" */
+    {
+        {3, 0x1, 139}, {4, 0x1, 139}, {5, 0x1, 139}, {6, 0x3, 139},
+        {3, 0x1, 140}, {4, 0x1, 140}, {5, 0x1, 140}, {6, 0x3, 140},
+        {3, 0x1, 141}, {4, 0x1, 141}, {5, 0x1, 141}, {6, 0x3, 141},
+        {3, 0x1, 143}, {4, 0x1, 143}, {5, 0x1, 143}, {6, 0x3, 143},
+    },
+    /* state 156: "111111111111111111000" */
+    {
+        {3, 0x1, 147}, {4, 0x1, 147}, {5, 0x1, 147}, {6, 0x3, 147},
+        {3, 0x1, 149}, {4, 0x1, 149}, {5, 0x1, 149}, {6, 0x3, 149},
+        {3, 0x1, 150}, {4, 0x1, 150}, {5, 0x1, 150}, {6, 0x3, 150},
+        {3, 0x1, 151}, {4, 0x1, 151}, {5, 0x1, 151}, {6, 0x3, 151},
+    },
+    /* state 157: "111111111111111111001" */
+    {
+        {3, 0x1, 152}, {4, 0x1, 152}, {5, 0x1, 152}, {6, 0x3, 152},
+        {3, 0x1, 155}, {4, 0x1, 155}, {5, 0x1, 155}, {6, 0x3, 155},
+        {3, 0x1, 157}, {4, 0x1, 157}, {5, 0x1, 157}, {6, 0x3, 157},
+        {3, 0x1, 158}, {4, 0x1, 158}, {5, 0x1, 158}, {6, 0x3, 158},
+    },
+    /* state 158: "111111111111111111010" */
+    {
+        {3, 0x1, 165}, {4, 0x1, 165}, {5, 0x1, 165}, {6, 0x3, 165},
+        {3, 0x1, 166}, {4, 0x1, 166}, {5, 0x1, 166}, {6, 0x3, 166},
+        {3, 0x1, 168}, {4, 0x1, 168}, {5, 0x1, 168}, {6, 0x3, 168},
+        {3, 0x1, 174}, {4, 0x1, 174}, {5, 0x1, 174}, {6, 0x3, 174},
+    },
+    /* state 159: "111111111111111111011" */
+    {
+        {3, 0x1, 175}, {4, 0x1, 175}, {5, 0x1, 175}, {6, 0x3, 175},
+        {3, 0x1, 180}, {4, 0x1, 180}, {5, 0x1, 180}, {6, 0x3, 180},
+        {3, 0x1, 182}, {4, 0x1, 182}, {5, 0x1, 182}, {6, 0x3, 182},
+        {3, 0x1, 183}, {4, 0x1, 183}, {5, 0x1, 183}, {6, 0x3, 183},
+    },
+    /* state 160: "111111111111111111100" */
+    {
+        {3, 0x1, 188}, {4, 0x1, 188}, {5, 0x1, 188}, {6, 0x3, 188},
+        {3, 0x1, 191}, {4, 0x1, 191}, {5, 0x1, 191}, {6, 0x3, 191},
+        {3, 0x1, 197}, {4, 0x1, 197}, {5, 0x1, 197}, {6, 0x3, 197},
+        {3, 0x1, 231}, {4, 0x1, 231}, {5, 0x1, 231}, {6, 0x3, 231},
+    },
+    /* state 161: "111111111111111111101" */
+    {
+        {3, 0x1, 239}, {4, 0x1, 239}, {5, 0x1, 239}, {6, 0x3, 239},
+        {1, 0x1, 9}, {2, 0x3, 9}, {1, 0x1, 142}, {2, 0x3, 142},
+        {1, 0x1, 144}, {2, 0x3, 144}, {1, 0x1, 145}, {2, 0x3, 145},
+        {1, 0x1, 148}, {2, 0x3, 148}, {1, 0x1, 159}, {2, 0x3, 159},
+    },
+    /* state 162: "111111111111111111110" */
+    {
+        {1, 0x1, 171}, {2, 0x3, 171}, {1, 0x1, 206}, {2, 0x3, 206},
+        {1, 0x1, 215}, {2, 0x3, 215}, {1, 0x1, 225}, {2, 0x3, 225},
+        {1, 0x1, 236}, {2, 0x3, 236}, {1, 0x1, 237}, {2, 0x3, 237},
+        {0, 0x3, 199}, {0, 0x3, 207}, {0, 0x3, 234}, {0, 0x3, 235},
+    },
+    /* state 163: "111111111111111111111" */
+    {
+        {205, 0x0, 0}, {206, 0x0, 0}, {207, 0x0, 0}, {208, 0x0, 0},
+        {209, 0x0, 0}, {210, 0x0, 0}, {211, 0x0, 0}, {212, 0x0, 0},
+        {213, 0x0, 0}, {214, 0x0, 0}, {215, 0x0, 0}, {216, 0x0, 0},
+        {217, 0x0, 0}, {218, 0x0, 0}, {219, 0x0, 0}, {220, 0x0, 0},
+    },
+    /* state 164: "1111111111111111101100" */
+    {
+        {7, 0x1, 1}, {8, 0x1, 1}, {9, 0x1, 1}, {10, 0x1, 1},
+        {11, 0x1, 1}, {12, 0x1, 1}, {13, 0x1, 1}, {14, 0x3, 1},
+        {7, 0x1, 135}, {8, 0x1, 135}, {9, 0x1, 135}, {10, 0x1, 135},
+        {11, 0x1, 135}, {12, 0x1, 135}, {13, 0x1, 135}, {14, 0x3, 135},
+    },
+    /* state 165: "1111111111111111101101" */
+    {
+        {7, 0x1, 137}, {8, 0x1, 137}, {9, 0x1, 137}, {10, 0x1, 137},
+        {11, 0x1, 137}, {12, 0x1, 137}, {13, 0x1, 137}, {14, 0x3, 137},
+        {7, 0x1, 138}, {8, 0x1, 138}, {9, 0x1, 138}, {10, 0x1, 138},
+        {11, 0x1, 138}, {12, 0x1, 138}, {13, 0x1, 138}, {14, 0x3, 138},
+    },
+    /* state 166: "1111111111111111101110" */
+    {
+        {7, 0x1, 139}, {8, 0x1, 139}, {9, 0x1, 139}, {10, 0x1, 139},
+        {11, 0x1, 139}, {12, 0x1, 139}, {13, 0x1, 139}, {14, 0x3, 139},
+        {7, 0x1, 140}, {8, 0x1, 140}, {9, 0x1, 140}, {10, 0x1, 140},
+        {11, 0x1, 140}, {12, 0x1, 140}, {13, 0x1, 140}, {14, 0x3, 140},
+    },
+    /* state 167: "1111111111111111101111" */
+    {
+        {7, 0x1, 141}, {8, 0x1, 141}, {9, 0x1, 141}, {10, 0x1, 141},
+        {11, 0x1, 141}, {12, 0x1, 141}, {13, 0x1, 141}, {14, 0x3, 141},
+        {7, 0x1, 143}, {8, 0x1, 143}, {9, 0x1, 143}, {10, 0x1, 143},
+        {11, 0x1, 143}, {12, 0x1, 143}, {13, 0x1, 143}, {14, 0x3, 143},
+    },
+    /* state 168: "1111111111111111110000" */
+    {
+        {7, 0x1, 147}, {8, 0x1, 147}, {9, 0x1, 147}, {10, 0x1, 147},
+        {11, 0x1, 147}, {12, 0x1, 147}, {13, 0x1, 147}, {14, 0x3, 147},
+        {7, 0x1, 149}, {8, 0x1, 149}, {9, 0x1, 149}, {10, 0x1, 149},
+        {11, 0x1, 149}, {12, 0x1, 149}, {13, 0x1, 149}, {14, 0x3, 149},
+    },
+    /* state 169: "1111111111111111110001" */
+    {
+        {7, 0x1, 150}, {8, 0x1, 150}, {9, 0x1, 150}, {10, 0x1, 150},
+        {11, 0x1, 150}, {12, 0x1, 150}, {13, 0x1, 150}, {14, 0x3, 150},
+        {7, 0x1, 151}, {8, 0x1, 151}, {9, 0x1, 151}, {10, 0x1, 151},
+        {11, 0x1, 151}, {12, 0x1, 151}, {13, 0x1, 151}, {14, 0x3, 151},
+    },
+    /* state 170: "1111111111111111110010" */
+    {
+        {7, 0x1, 152}, {8, 0x1, 152}, {9, 0x1, 152}, {10, 0x1, 152},
+        {11, 0x1, 152}, {12, 0x1, 152}, {13, 0x1, 152}, {14, 0x3, 152},
+        {7, 0x1, 155}, {8, 0x1, 155}, {9, 0x1, 155}, {10, 0x1, 155},
+        {11, 0x1, 155}, {12, 0x1, 155}, {13, 0x1, 155}, {14, 0x3, 155},
+    },
+    /* state 171: "1111111111111111110011" */
+    {
+        {7, 0x1, 157}, {8, 0x1, 157}, {9, 0x1, 157}, {10, 0x1, 157},
+        {11, 0x1, 157}, {12, 0x1, 157}, {13, 0x1, 157}, {14, 0x3, 157},
+        {7, 0x1, 158}, {8, 0x1, 158}, {9, 0x1, 158}, {10, 0x1, 158},
+        {11, 0x1, 158}, {12, 0x1, 158}, {13, 0x1, 158}, {14, 0x3, 158},
+    },
+    /* state 172: "1111111111111111110100" */
+    {
+        {7, 0x1, 165}, {8, 0x1, 165}, {9, 0x1, 165}, {10, 0x1, 165},
+        {11, 0x1, 165}, {12, 0x1, 165}, {13, 0x1, 165}, {14, 0x3, 165},
+        {7, 0x1, 166}, {8, 0x1, 166}, {9, 0x1, 166}, {10, 0x1, 166},
+        {11, 0x1, 166}, {12, 0x1, 166}, {13, 0x1, 166}, {14, 0x3, 166},
+    },
+    /* state 173: "1111111111111111110101" */
+    {
+        {7, 0x1, 168}, {8, 0x1, 168}, {9, 0x1, 168}, {10, 0x1, 168},
+        {11, 0x1, 168}, {12, 0x1, 168}, {13, 0x1, 168}, {14, 0x3, 168},
+        {7, 0x1, 174}, {8, 0x1, 174}, {9, 0x1, 174}, {10, 0x1, 174},
+        {11, 0x1, 174}, {12, 0x1, 174}, {13, 0x1, 174}, {14, 0x3, 174},
+    },
+    /* state 174: "1111111111111111110110" */
+    {
+        {7, 0x1, 175}, {8, 0x1, 175}, {9, 0x1, 175}, {10, 0x1, 175},
+        {11, 0x1, 175}, {12, 0x1, 175}, {13, 0x1, 175}, {14, 0x3, 175},
+        {7, 0x1, 180}, {8, 0x1, 180}, {9, 0x1, 180}, {10, 0x1, 180},
+        {11, 0x1, 180}, {12, 0x1, 180}, {13, 0x1, 180}, {14, 0x3, 180},
+    },
+    /* state 175: "1111111111111111110111" */
+    {
+        {7, 0x1, 182}, {8, 0x1, 182}, {9, 0x1, 182}, {10, 0x1, 182},
+        {11, 0x1, 182}, {12, 0x1, 182}, {13, 0x1, 182}, {14, 0x3, 182},
+        {7, 0x1, 183}, {8, 0x1, 183}, {9, 0x1, 183}, {10, 0x1, 183},
+        {11, 0x1, 183}, {12, 0x1, 183}, {13, 0x1, 183}, {14, 0x3, 183},
+    },
+    /* state 176: "1111111111111111111000" */
+    {
+        {7, 0x1, 188}, {8, 0x1, 188}, {9, 0x1, 188}, {10, 0x1, 188},
+        {11, 0x1, 188}, {12, 0x1, 188}, {13, 0x1, 188}, {14, 0x3, 188},
+        {7, 0x1, 191}, {8, 0x1, 191}, {9, 0x1, 191}, {10, 0x1, 191},
+        {11, 0x1, 191}, {12, 0x1, 191}, {13, 0x1, 191}, {14, 0x3, 191},
+    },
+    /* state 177: "1111111111111111111001" */
+    {
+        {7, 0x1, 197}, {8, 0x1, 197}, {9, 0x1, 197}, {10, 0x1, 197},
+        {11, 0x1, 197}, {12, 0x1, 197}, {13, 0x1, 197}, {14, 0x3, 197},
+        {7, 0x1, 231}, {8, 0x1, 231}, {9, 0x1, 231}, {10, 0x1, 231},
+        {11, 0x1, 231}, {12, 0x1, 231}, {13, 0x1, 231}, {14, 0x3, 231},
+    },
+    /* state 178: "1111111111111111111010" */
+    {
+        {7, 0x1, 239}, {8, 0x1, 239}, {9, 0x1, 239}, {10, 0x1, 239},
+        {11, 0x1, 239}, {12, 0x1, 239}, {13, 0x1, 239}, {14, 0x3, 239},
+        {3, 0x1, 9}, {4, 0x1, 9}, {5, 0x1, 9}, {6, 0x3, 9},
+        {3, 0x1, 142}, {4, 0x1, 142}, {5, 0x1, 142}, {6, 0x3, 142},
+    },
+    /* state 179: "1111111111111111111011" */
+    {
+        {3, 0x1, 144}, {4, 0x1, 144}, {5, 0x1, 144}, {6, 0x3, 144},
+        {3, 0x1, 145}, {4, 0x1, 145}, {5, 0x1, 145}, {6, 0x3, 145},
+        {3, 0x1, 148}, {4, 0x1, 148}, {5, 0x1, 148}, {6, 0x3, 148},
+        {3, 0x1, 159}, {4, 0x1, 159}, {5, 0x1, 159}, {6, 0x3, 159},
+    },
+    /* state 180: "1111111111111111111100" */
+    {
+        {3, 0x1, 171}, {4, 0x1, 171}, {5, 0x1, 171}, {6, 0x3, 171},
+        {3, 0x1, 206}, {4, 0x1, 206}, {5, 0x1, 206}, {6, 0x3, 206},
+        {3, 0x1, 215}, {4, 0x1, 215}, {5, 0x1, 215}, {6, 0x3, 215},
+        {3, 0x1, 225}, {4, 0x1, 225}, {5, 0x1, 225}, {6, 0x3, 225},
+    },
+    /* state 181: "1111111111111111111101" */
+    {
+        {3, 0x1, 236}, {4, 0x1, 236}, {5, 0x1, 236}, {6, 0x3, 236},
+        {3, 0x1, 237}, {4, 0x1, 237}, {5, 0x1, 237}, {6, 0x3, 237},
+        {1, 0x1, 199}, {2, 0x3, 199}, {1, 0x1, 207}, {2, 0x3, 207},
+        {1, 0x1, 234}, {2, 0x3, 234}, {1, 0x1, 235}, {2, 0x3, 235},
+    },
+    /* state 182: "1111111111111111111110" */
+    {
+        {0, 0x3, 192}, {0, 0x3, 193}, {0, 0x3, 200}, {0, 0x3, 201},
+        {0, 0x3, 202}, {0, 0x3, 205}, {0, 0x3, 210}, {0, 0x3, 213},
+        {0, 0x3, 218}, {0, 0x3, 219}, {0, 0x3, 238}, {0, 0x3, 240},
+        {0, 0x3, 242}, {0, 0x3, 243}, {0, 0x3, 255}, {221, 0x0, 0},
+    },
+    /* state 183: "1111111111111111111111" */
+    {
+        {222, 0x0, 0}, {223, 0x0, 0}, {224, 0x0, 0}, {225, 0x0, 0},
+        {226, 0x0, 0}, {227, 0x0, 0}, {228, 0x0, 0}, {229, 0x0, 0},
+        {230, 0x0, 0}, {231, 0x0, 0}, {232, 0x0, 0}, {233, 0x0, 0},
+        {234, 0x0, 0}, {235, 0x0, 0}, {236, 0x0, 0}, {237, 0x0, 0},
+    },
+    /* state 184: "11111111111111111110101" */
+    {
+        {7, 0x1, 9}, {8, 0x1, 9}, {9, 0x1, 9}, {10, 0x1, 9},
+        {11, 0x1, 9}, {12, 0x1, 9}, {13, 0x1, 9}, {14, 0x3, 9},
+        {7, 0x1, 142}, {8, 0x1, 142}, {9, 0x1, 142}, {10, 0x1, 142},
+        {11, 0x1, 142}, {12, 0x1, 142}, {13, 0x1, 142}, {14, 0x3, 142},
+    },
+    /* state 185: "11111111111111111110110" */
+    {
+        {7, 0x1, 144}, {8, 0x1, 144}, {9, 0x1, 144}, {10, 0x1, 144},
+        {11, 0x1, 144}, {12, 0x1, 144}, {13, 0x1, 144}, {14, 0x3, 144},
+        {7, 0x1, 145}, {8, 0x1, 145}, {9, 0x1, 145}, {10, 0x1, 145},
+        {11, 0x1, 145}, {12, 0x1, 145}, {13, 0x1, 145}, {14, 0x3, 145},
+    },
+    /* state 186: "11111111111111111110111" */
+    {
+        {7, 0x1, 148}, {8, 0x1, 148}, {9, 0x1, 148}, {10, 0x1, 148},
+        {11, 0x1, 148}, {12, 0x1, 148}, {13, 0x1, 148}, {14, 0x3, 148},
+        {7, 0x1, 159}, {8, 0x1, 159}, {9, 0x1, 159}, {10, 0x1, 159},
+        {11, 0x1, 159}, {12, 0x1, 159}, {13, 0x1, 159}, {14, 0x3, 159},
+    },
+    /* state 187: "11111111111111111111000" */
+    {
+        {7, 0x1, 171}, {8, 0x1, 171}, {9, 0x1, 171}, {10, 0x1, 171},
+        {11, 0x1, 171}, {12, 0x1, 171}, {13, 0x1, 171}, {14, 0x3, 171},
+        {7, 0x1, 206}, {8, 0x1, 206}, {9, 0x1, 206}, {10, 0x1, 206},
+        {11, 0x1, 206}, {12, 0x1, 206}, {13, 0x1, 206}, {14, 0x3, 206},
+    },
+    /* state 188: "11111111111111111111001" */
+    {
+        {7, 0x1, 215}, {8, 0x1, 215}, {9, 0x1, 215}, {10, 0x1, 215},
+        {11, 0x1, 215}, {12, 0x1, 215}, {13, 0x1, 215}, {14, 0x3, 215},
+        {7, 0x1, 225}, {8, 0x1, 225}, {9, 0x1, 225}, {10, 0x1, 225},
+        {11, 0x1, 225}, {12, 0x1, 225}, {13, 0x1, 225}, {14, 0x3, 225},
+    },
+    /* state 189: "11111111111111111111010" */
+    {
+        {7, 0x1, 236}, {8, 0x1, 236}, {9, 0x1, 236}, {10, 0x1, 236},
+        {11, 0x1, 236}, {12, 0x1, 236}, {13, 0x1, 236}, {14, 0x3, 236},
+        {7, 0x1, 237}, {8, 0x1, 237}, {9, 0x1, 237}, {10, 0x1, 237},
+        {11, 0x1, 237}, {12, 0x1, 237}, {13, 0x1, 237}, {14, 0x3, 237},
+    },
+    /* state 190: "11111111111111111111011" */
+    {
+        {3, 0x1, 199}, {4, 0x1, 199}, {5, 0x1, 199}, {6, 0x3, 199},
+        {3, 0x1, 207}, {4, 0x1, 207}, {5, 0x1, 207}, {6, 0x3, 207},
+        {3, 0x1, 234}, {4, 0x1, 234}, {5, 0x1, 234}, {6, 0x3, 234},
+        {3, 0x1, 235}, {4, 0x1, 235}, {5, 0x1, 235}, {6, 0x3, 235},
+    },
+    /* state 191: "11111111111111111111100" */
+    {
+        {1, 0x1, 192}, {2, 0x3, 192}, {1, 0x1, 193}, {2, 0x3, 193},
+        {1, 0x1, 200}, {2, 0x3, 200}, {1, 0x1, 201}, {2, 0x3, 201},
+        {1, 0x1, 202}, {2, 0x3, 202}, {1, 0x1, 205}, {2, 0x3, 205},
+        {1, 0x1, 210}, {2, 0x3, 210}, {1, 0x1, 213}, {2, 0x3, 213},
+    },
+    /* state 192: "11111111111111111111101" */
+    {
+        {1, 0x1, 218}, {2, 0x3, 218}, {1, 0x1, 219}, {2, 0x3, 219},
+        {1, 0x1, 238}, {2, 0x3, 238}, {1, 0x1, 240}, {2, 0x3, 240},
+        {1, 0x1, 242}, {2, 0x3, 242}, {1, 0x1, 243}, {2, 0x3, 243},
+        {1, 0x1, 255}, {2, 0x3, 255}, {0, 0x3, 203}, {0, 0x3, 204},
+    },
+    /* state 193: "11111111111111111111110" */
+    {
+        {0, 0x3, 211}, {0, 0x3, 212}, {0, 0x3, 214}, {0, 0x3, 221},
+        {0, 0x3, 222}, {0, 0x3, 223}, {0, 0x3, 241}, {0, 0x3, 244},
+        {0, 0x3, 245}, {0, 0x3, 246}, {0, 0x3, 247}, {0, 0x3, 248},
+        {0, 0x3, 250}, {0, 0x3, 251}, {0, 0x3, 252}, {0, 0x3, 253},
+    },
+    /* state 194: "11111111111111111111111" */
+    {
+        {0, 0x3, 254}, {238, 0x0, 0}, {239, 0x0, 0}, {240, 0x0, 0},
+        {241, 0x0, 0}, {242, 0x0, 0}, {243, 0x0, 0}, {244, 0x0, 0},
+        {245, 0x0, 0}, {246, 0x0, 0}, {247, 0x0, 0}, {248, 0x0, 0},
+        {249, 0x0, 0}, {250, 0x0, 0}, {251, 0x0, 0}, {252, 0x0, 0},
+    },
+    /* state 195: "111111111111111111110110" */
+    {
+        {7, 0x1, 199}, {8, 0x1, 199}, {9, 0x1, 199}, {10, 0x1, 199},
+        {11, 0x1, 199}, {12, 0x1, 199}, {13, 0x1, 199}, {14, 0x3, 199},
+        {7, 0x1, 207}, {8, 0x1, 207}, {9, 0x1, 207}, {10, 0x1, 207},
+        {11, 0x1, 207}, {12, 0x1, 207}, {13, 0x1, 207}, {14, 0x3, 207},
+    },
+    /* state 196: "111111111111111111110111" */
+    {
+        {7, 0x1, 234}, {8, 0x1, 234}, {9, 0x1, 234}, {10, 0x1, 234},
+        {11, 0x1, 234}, {12, 0x1, 234}, {13, 0x1, 234}, {14, 0x3, 234},
+        {7, 0x1, 235}, {8, 0x1, 235}, {9, 0x1, 235}, {10, 0x1, 235},
+        {11, 0x1, 235}, {12, 0x1, 235}, {13, 0x1, 235}, {14, 0x3, 235},
+    },
+    /* state 197: "111111111111111111111000" */
+    {
+        {3, 0x1, 192}, {4, 0x1, 192}, {5, 0x1, 192}, {6, 0x3, 192},
+        {3, 0x1, 193}, {4, 0x1, 193}, {5, 0x1, 193}, {6, 0x3, 193},
+        {3, 0x1, 200}, {4, 0x1, 200}, {5, 0x1, 200}, {6, 0x3, 200},
+        {3, 0x1, 201}, {4, 0x1, 201}, {5, 0x1, 201}, {6, 0x3, 201},
+    },
+    /* state 198: "111111111111111111111001" */
+    {
+        {3, 0x1, 202}, {4, 0x1, 202}, {5, 0x1, 202}, {6, 0x3, 202},
+        {3, 0x1, 205}, {4, 0x1, 205}, {5, 0x1, 205}, {6, 0x3, 205},
+        {3, 0x1, 210}, {4, 0x1, 210}, {5, 0x1, 210}, {6, 0x3, 210},
+        {3, 0x1, 213}, {4, 0x1, 213}, {5, 0x1, 213}, {6, 0x3, 213},
+    },
+    /* state 199: "111111111111111111111010" */
+    {
+        {3, 0x1, 218}, {4, 0x1, 218}, {5, 0x1, 218}, {6, 0x3, 218},
+        {3, 0x1, 219}, {4, 0x1, 219}, {5, 0x1, 219}, {6, 0x3, 219},
+        {3, 0x1, 238}, {4, 0x1, 238}, {5, 0x1, 238}, {6, 0x3, 238},
+        {3, 0x1, 240}, {4, 0x1, 240}, {5, 0x1, 240}, {6, 0x3, 240},
+    },
+    /* state 200: "111111111111111111111011" */
+    {
+        {3, 0x1, 242}, {4, 0x1, 242}, {5, 0x1, 242}, {6, 0x3, 242},
+        {3, 0x1, 243}, {4, 0x1, 243}, {5, 0x1, 243}, {6, 0x3, 243},
+        {3, 0x1, 255}, {4, 0x1, 255}, {5, 0x1, 255}, {6, 0x3, 255},
+        {1, 0x1, 203}, {2, 0x3, 203}, {1, 0x1, 204}, {2, 0x3, 204},
+    },
+    /* state 201: "111111111111111111111100" */
+    {
+        {1, 0x1, 211}, {2, 0x3, 211}, {1, 0x1, 212}, {2, 0x3, 212},
+        {1, 0x1, 214}, {2, 0x3, 214}, {1, 0x1, 221}, {2, 0x3, 221},
+        {1, 0x1, 222}, {2, 0x3, 222}, {1, 0x1, 223}, {2, 0x3, 223},
+        {1, 0x1, 241}, {2, 0x3, 241}, {1, 0x1, 244}, {2, 0x3, 244},
+    },
+    /* state 202: "111111111111111111111101" */
+    {
+        {1, 0x1, 245}, {2, 0x3, 245}, {1, 0x1, 246}, {2, 0x3, 246},
+        {1, 0x1, 247}, {2, 0x3, 247}, {1, 0x1, 248}, {2, 0x3, 248},
+        {1, 0x1, 250}, {2, 0x3, 250}, {1, 0x1, 251}, {2, 0x3, 251},
+        {1, 0x1, 252}, {2, 0x3, 252}, {1, 0x1, 253}, {2, 0x3, 253},
+    },
+    /* state 203: "111111111111111111111110" */
+    {
+        {1, 0x1, 254}, {2, 0x3, 254}, {0, 0x3, 2}, {0, 0x3, 3},
+        {0, 0x3, 4}, {0, 0x3, 5}, {0, 0x3, 6}, {0, 0x3, 7},
+        {0, 0x3, 8}, {0, 0x3, 11}, {0, 0x3, 12}, {0, 0x3, 14},
+        {0, 0x3, 15}, {0, 0x3, 16}, {0, 0x3, 17}, {0, 0x3, 18},
+    },
+    /* state 204: "111111111111111111111111" */
+    {
+        {0, 0x3, 19}, {0, 0x3, 20}, {0, 0x3, 21}, {0, 0x3, 23},
+        {0, 0x3, 24}, {0, 0x3, 25}, {0, 0x3, 26}, {0, 0x3, 27},
+        {0, 0x3, 28}, {0, 0x3, 29}, {0, 0x3, 30}, {0, 0x3, 31},
+        {0, 0x3, 127}, {0, 0x3, 220}, {0, 0x3, 249}, {253, 0x0, 0},
+    },
+    /* state 205: "1111111111111111111110000" */
+    {
+        {7, 0x1, 192}, {8, 0x1, 192}, {9, 0x1, 192}, {10, 0x1, 192},
+        {11, 0x1, 192}, {12, 0x1, 192}, {13, 0x1, 192}, {14, 0x3, 192},
+        {7, 0x1, 193}, {8, 0x1, 193}, {9, 0x1, 193}, {10, 0x1, 193},
+        {11, 0x1, 193}, {12, 0x1, 193}, {13, 0x1, 193}, {14, 0x3, 193},
+    },
+    /* state 206: "1111111111111111111110001" */
+    {
+        {7, 0x1, 200}, {8, 0x1, 200}, {9, 0x1, 200}, {10, 0x1, 200},
+        {11, 0x1, 200}, {12, 0x1, 200}, {13, 0x1, 200}, {14, 0x3, 200},
+        {7, 0x1, 201}, {8, 0x1, 201}, {9, 0x1, 201}, {10, 0x1, 201},
+        {11, 0x1, 201}, {12, 0x1, 201}, {13, 0x1, 201}, {14, 0x3, 201},
+    },
+    /* state 207: "1111111111111111111110010" */
+    {
+        {7, 0x1, 202}, {8, 0x1, 202}, {9, 0x1, 202}, {10, 0x1, 202},
+        {11, 0x1, 202}, {12, 0x1, 202}, {13, 0x1, 202}, {14, 0x3, 202},
+        {7, 0x1, 205}, {8, 0x1, 205}, {9, 0x1, 205}, {10, 0x1, 205},
+        {11, 0x1, 205}, {12, 0x1, 205}, {13, 0x1, 205}, {14, 0x3, 205},
+    },
+    /* state 208: "1111111111111111111110011" */
+    {
+        {7, 0x1, 210}, {8, 0x1, 210}, {9, 0x1, 210}, {10, 0x1, 210},
+        {11, 0x1, 210}, {12, 0x1, 210}, {13, 0x1, 210}, {14, 0x3, 210},
+        {7, 0x1, 213}, {8, 0x1, 213}, {9, 0x1, 213}, {10, 0x1, 213},
+        {11, 0x1, 213}, {12, 0x1, 213}, {13, 0x1, 213}, {14, 0x3, 213},
+    },
+    /* state 209: "1111111111111111111110100" */
+    {
+        {7, 0x1, 218}, {8, 0x1, 218}, {9, 0x1, 218}, {10, 0x1, 218},
+        {11, 0x1, 218}, {12, 0x1, 218}, {13, 0x1, 218}, {14, 0x3, 218},
+        {7, 0x1, 219}, {8, 0x1, 219}, {9, 0x1, 219}, {10, 0x1, 219},
+        {11, 0x1, 219}, {12, 0x1, 219}, {13, 0x1, 219}, {14, 0x3, 219},
+    },
+    /* state 210: "1111111111111111111110101" */
+    {
+        {7, 0x1, 238}, {8, 0x1, 238}, {9, 0x1, 238}, {10, 0x1, 238},
+        {11, 0x1, 238}, {12, 0x1, 238}, {13, 0x1, 238}, {14, 0x3, 238},
+        {7, 0x1, 240}, {8, 0x1, 240}, {9, 0x1, 240}, {10, 0x1, 240},
+        {11, 0x1, 240}, {12, 0x1, 240}, {13, 0x1, 240}, {14, 0x3, 240},
+    },
+    /* state 211: "1111111111111111111110110" */
+    {
+        {7, 0x1, 242}, {8, 0x1, 242}, {9, 0x1, 242}, {10, 0x1, 242},
+        {11, 0x1, 242}, {12, 0x1, 242}, {13, 0x1, 242}, {14, 0x3, 242},
+        {7, 0x1, 243}, {8, 0x1, 243}, {9, 0x1, 243}, {10, 0x1, 243},
+        {11, 0x1, 243}, {12, 0x1, 243}, {13, 0x1, 243}, {14, 0x3, 243},
+    },
+    /* state 212: "1111111111111111111110111" */
+    {
+        {7, 0x1, 255}, {8, 0x1, 255}, {9, 0x1, 255}, {10, 0x1, 255},
+        {11, 0x1, 255}, {12, 0x1, 255}, {13, 0x1, 255}, {14, 0x3, 255},
+        {3, 0x1, 203}, {4, 0x1, 203}, {5, 0x1, 203}, {6, 0x3, 203},
+        {3, 0x1, 204}, {4, 0x1, 204}, {5, 0x1, 204}, {6, 0x3, 204},
+    },
+    /* state 213: "1111111111111111111111000" */
+    {
+        {3, 0x1, 211}, {4, 0x1, 211}, {5, 0x1, 211}, {6, 0x3, 211},
+        {3, 0x1, 212}, {4, 0x1, 212}, {5, 0x1, 212}, {6, 0x3, 212},
+        {3, 0x1, 214}, {4, 0x1, 214}, {5, 0x1, 214}, {6, 0x3, 214},
+        {3, 0x1, 221}, {4, 0x1, 221}, {5, 0x1, 221}, {6, 0x3, 221},
+    },
+    /* state 214: "1111111111111111111111001" */
+    {
+        {3, 0x1, 222}, {4, 0x1, 222}, {5, 0x1, 222}, {6, 0x3, 222},
+        {3, 0x1, 223}, {4, 0x1, 223}, {5, 0x1, 223}, {6, 0x3, 223},
+        {3, 0x1, 241}, {4, 0x1, 241}, {5, 0x1, 241}, {6, 0x3, 241},
+        {3, 0x1, 244}, {4, 0x1, 244}, {5, 0x1, 244}, {6, 0x3, 244},
+    },
+    /* state 215: "1111111111111111111111010" */
+    {
+        {3, 0x1, 245}, {4, 0x1, 245}, {5, 0x1, 245}, {6, 0x3, 245},
+        {3, 0x1, 246}, {4, 0x1, 246}, {5, 0x1, 246}, {6, 0x3, 246},
+        {3, 0x1, 247}, {4, 0x1, 247}, {5, 0x1, 247}, {6, 0x3, 247},
+        {3, 0x1, 248}, {4, 0x1, 248}, {5, 0x1, 248}, {6, 0x3, 248},
+    },
+    /* state 216: "1111111111111111111111011" */
+    {
+        {3, 0x1, 250}, {4, 0x1, 250}, {5, 0x1, 250}, {6, 0x3, 250},
+        {3, 0x1, 251}, {4, 0x1, 251}, {5, 0x1, 251}, {6, 0x3, 251},
+        {3, 0x1, 252}, {4, 0x1, 252}, {5, 0x1, 252}, {6, 0x3, 252},
+        {3, 0x1, 253}, {4, 0x1, 253}, {5, 0x1, 253}, {6, 0x3, 253},
+    },
+    /* state 217: "1111111111111111111111100" */
+    {
+        {3, 0x1, 254}, {4, 0x1, 254}, {5, 0x1, 254}, {6, 0x3, 254},
+        {1, 0x1, 2}, {2, 0x3, 2}, {1, 0x1, 3}, {2, 0x3, 3},
+        {1, 0x1, 4}, {2, 0x3, 4}, {1, 0x1, 5}, {2, 0x3, 5},
+        {1, 0x1, 6}, {2, 0x3, 6}, {1, 0x1, 7}, {2, 0x3, 7},
+    },
+    /* state 218: "1111111111111111111111101" */
+    {
+        {1, 0x1, 8}, {2, 0x3, 8}, {1, 0x1, 11}, {2, 0x3, 11},
+        {1, 0x1, 12}, {2, 0x3, 12}, {1, 0x1, 14}, {2, 0x3, 14},
+        {1, 0x1, 15}, {2, 0x3, 15}, {1, 0x1, 16}, {2, 0x3, 16},
+        {1, 0x1, 17}, {2, 0x3, 17}, {1, 0x1, 18}, {2, 0x3, 18},
+    },
+    /* state 219: "1111111111111111111111110" */
+    {
+        {1, 0x1, 19}, {2, 0x3, 19}, {1, 0x1, 20}, {2, 0x3, 20},
+        {1, 0x1, 21}, {2, 0x3, 21}, {1, 0x1, 23}, {2, 0x3, 23},
+        {1, 0x1, 24}, {2, 0x3, 24}, {1, 0x1, 25}, {2, 0x3, 25},
+        {1, 0x1, 26}, {2, 0x3, 26}, {1, 0x1, 27}, {2, 0x3, 27},
+    },
+    /* state 220: "1111111111111111111111111" */
+    {
+        {1, 0x1, 28}, {2, 0x3, 28}, {1, 0x1, 29}, {2, 0x3, 29},
+        {1, 0x1, 30}, {2, 0x3, 30}, {1, 0x1, 31}, {2, 0x3, 31},
+        {1, 0x1, 127}, {2, 0x3, 127}, {1, 0x1, 220}, {2, 0x3, 220},
+        {1, 0x1, 249}, {2, 0x3, 249}, {254, 0x0, 0}, {255, 0x0, 0},
+    },
+    /* state 221: "11111111111111111111101111" */
+    {
+        {7, 0x1, 203}, {8, 0x1, 203}, {9, 0x1, 203}, {10, 0x1, 203},
+        {11, 0x1, 203}, {12, 0x1, 203}, {13, 0x1, 203}, {14, 0x3, 203},
+        {7, 0x1, 204}, {8, 0x1, 204}, {9, 0x1, 204}, {10, 0x1, 204},
+        {11, 0x1, 204}, {12, 0x1, 204}, {13, 0x1, 204}, {14, 0x3, 204},
+    },
+    /* state 222: "11111111111111111111110000" */
+    {
+        {7, 0x1, 211}, {8, 0x1, 211}, {9, 0x1, 211}, {10, 0x1, 211},
+        {11, 0x1, 211}, {12, 0x1, 211}, {13, 0x1, 211}, {14, 0x3, 211},
+        {7, 0x1, 212}, {8, 0x1, 212}, {9, 0x1, 212}, {10, 0x1, 212},
+        {11, 0x1, 212}, {12, 0x1, 212}, {13, 0x1, 212}, {14, 0x3, 212},
+    },
+    /* state 223: "11111111111111111111110001" */
+    {
+        {7, 0x1, 214}, {8, 0x1, 214}, {9, 0x1, 214}, {10, 0x1, 214},
+        {11, 0x1, 214}, {12, 0x1, 214}, {13, 0x1, 214}, {14, 0x3, 214},
+        {7, 0x1, 221}, {8, 0x1, 221}, {9, 0x1, 221}, {10, 0x1, 221},
+        {11, 0x1, 221}, {12, 0x1, 221}, {13, 0x1, 221}, {14, 0x3, 221},
+    },
+    /* state 224: "11111111111111111111110010" */
+    {
+        {7, 0x1, 222}, {8, 0x1, 222}, {9, 0x1, 222}, {10, 0x1, 222},
+        {11, 0x1, 222}, {12, 0x1, 222}, {13, 0x1, 222}, {14, 0x3, 222},
+        {7, 0x1, 223}, {8, 0x1, 223}, {9, 0x1, 223}, {10, 0x1, 223},
+        {11, 0x1, 223}, {12, 0x1, 223}, {13, 0x1, 223}, {14, 0x3, 223},
+    },
+    /* state 225: "11111111111111111111110011" */
+    {
+        {7, 0x1, 241}, {8, 0x1, 241}, {9, 0x1, 241}, {10, 0x1, 241},
+        {11, 0x1, 241}, {12, 0x1, 241}, {13, 0x1, 241}, {14, 0x3, 241},
+        {7, 0x1, 244}, {8, 0x1, 244}, {9, 0x1, 244}, {10, 0x1, 244},
+        {11, 0x1, 244}, {12, 0x1, 244}, {13, 0x1, 244}, {14, 0x3, 244},
+    },
+    /* state 226: "11111111111111111111110100" */
+    {
+        {7, 0x1, 245}, {8, 0x1, 245}, {9, 0x1, 245}, {10, 0x1, 245},
+        {11, 0x1, 245}, {12, 0x1, 245}, {13, 0x1, 245}, {14, 0x3, 245},
+        {7, 0x1, 246}, {8, 0x1, 246}, {9, 0x1, 246}, {10, 0x1, 246},
+        {11, 0x1, 246}, {12, 0x1, 246}, {13, 0x1, 246}, {14, 0x3, 246},
+    },
+    /* state 227: "11111111111111111111110101" */
+    {
+        {7, 0x1, 247}, {8, 0x1, 247}, {9, 0x1, 247}, {10, 0x1, 247},
+        {11, 0x1, 247}, {12, 0x1, 247}, {13, 0x1, 247}, {14, 0x3, 247},
+        {7, 0x1, 248}, {8, 0x1, 248}, {9, 0x1, 248}, {10, 0x1, 248},
+        {11, 0x1, 248}, {12, 0x1, 248}, {13, 0x1, 248}, {14, 0x3, 248},
+    },
+    /* state 228: "11111111111111111111110110" */
+    {
+        {7, 0x1, 250}, {8, 0x1, 250}, {9, 0x1, 250}, {10, 0x1, 250},
+        {11, 0x1, 250}, {12, 0x1, 250}, {13, 0x1, 250}, {14, 0x3, 250},
+        {7, 0x1, 251}, {8, 0x1, 251}, {9, 0x1, 251}, {10, 0x1, 251},
+        {11, 0x1, 251}, {12, 0x1, 251}, {13, 0x1, 251}, {14, 0x3, 251},
+    },
+    /* state 229: "11111111111111111111110111" */
+    {
+        {7, 0x1, 252}, {8, 0x1, 252}, {9, 0x1, 252}, {10, 0x1, 252},
+        {11, 0x1, 252}, {12, 0x1, 252}, {13, 0x1, 252}, {14, 0x3, 252},
+        {7, 0x1, 253}, {8, 0x1, 253}, {9, 0x1, 253}, {10, 0x1, 253},
+        {11, 0x1, 253}, {12, 0x1, 253}, {13, 0x1, 253}, {14, 0x3, 253},
+    },
+    /* state 230: "11111111111111111111111000" */
+    {
+        {7, 0x1, 254}, {8, 0x1, 254}, {9, 0x1, 254}, {10, 0x1, 254},
+        {11, 0x1, 254}, {12, 0x1, 254}, {13, 0x1, 254}, {14, 0x3, 254},
+        {3, 0x1, 2}, {4, 0x1, 2}, {5, 0x1, 2}, {6, 0x3, 2},
+        {3, 0x1, 3}, {4, 0x1, 3}, {5, 0x1, 3}, {6, 0x3, 3},
+    },
+    /* state 231: "11111111111111111111111001" */
+    {
+        {3, 0x1, 4}, {4, 0x1, 4}, {5, 0x1, 4}, {6, 0x3, 4},
+        {3, 0x1, 5}, {4, 0x1, 5}, {5, 0x1, 5}, {6, 0x3, 5},
+        {3, 0x1, 6}, {4, 0x1, 6}, {5, 0x1, 6}, {6, 0x3, 6},
+        {3, 0x1, 7}, {4, 0x1, 7}, {5, 0x1, 7}, {6, 0x3, 7},
+    },
+    /* state 232: "11111111111111111111111010" */
+    {
+        {3, 0x1, 8}, {4, 0x1, 8}, {5, 0x1, 8}, {6, 0x3, 8},
+        {3, 0x1, 11}, {4, 0x1, 11}, {5, 0x1, 11}, {6, 0x3, 11},
+        {3, 0x1, 12}, {4, 0x1, 12}, {5, 0x1, 12}, {6, 0x3, 12},
+        {3, 0x1, 14}, {4, 0x1, 14}, {5, 0x1, 14}, {6, 0x3, 14},
+    },
+    /* state 233: "11111111111111111111111011" */
+    {
+        {3, 0x1, 15}, {4, 0x1, 15}, {5, 0x1, 15}, {6, 0x3, 15},
+        {3, 0x1, 16}, {4, 0x1, 16}, {5, 0x1, 16}, {6, 0x3, 16},
+        {3, 0x1, 17}, {4, 0x1, 17}, {5, 0x1, 17}, {6, 0x3, 17},
+        {3, 0x1, 18}, {4, 0x1, 18}, {5, 0x1, 18}, {6, 0x3, 18},
+    },
+    /* state 234: "11111111111111111111111100" */
+    {
+        {3, 0x1, 19}, {4, 0x1, 19}, {5, 0x1, 19}, {6, 0x3, 19},
+        {3, 0x1, 20}, {4, 0x1, 20}, {5, 0x1, 20}, {6, 0x3, 20},
+        {3, 0x1, 21}, {4, 0x1, 21}, {5, 0x1, 21}, {6, 0x3, 21},
+        {3, 0x1, 23}, {4, 0x1, 23}, {5, 0x1, 23}, {6, 0x3, 23},
+    },
+    /* state 235: "11111111111111111111111101" */
+    {
+        {3, 0x1, 24}, {4, 0x1, 24}, {5, 0x1, 24}, {6, 0x3, 24},
+        {3, 0x1, 25}, {4, 0x1, 25}, {5, 0x1, 25}, {6, 0x3, 25},
+        {3, 0x1, 26}, {4, 0x1, 26}, {5, 0x1, 26}, {6, 0x3, 26},
+        {3, 0x1, 27}, {4, 0x1, 27}, {5, 0x1, 27}, {6, 0x3, 27},
+    },
+    /* state 236: "11111111111111111111111110" */
+    {
+        {3, 0x1, 28}, {4, 0x1, 28}, {5, 0x1, 28}, {6, 0x3, 28},
+        {3, 0x1, 29}, {4, 0x1, 29}, {5, 0x1, 29}, {6, 0x3, 29},
+        {3, 0x1, 30}, {4, 0x1, 30}, {5, 0x1, 30}, {6, 0x3, 30},
+        {3, 0x1, 31}, {4, 0x1, 31}, {5, 0x1, 31}, {6, 0x3, 31},
+    },
+    /* state 237: "11111111111111111111111111" */
+    {
+        {3, 0x1, 127}, {4, 0x1, 127}, {5, 0x1, 127}, {6, 0x3, 127},
+        {3, 0x1, 220}, {4, 0x1, 220}, {5, 0x1, 220}, {6, 0x3, 220},
+        {3, 0x1, 249}, {4, 0x1, 249}, {5, 0x1, 249}, {6, 0x3, 249},
+        {0, 0x3, 10}, {0, 0x3, 13}, {0, 0x3, 22}, {0, 0x4, 0},
+    },
+    /* state 238: "111111111111111111111110001" */
+    {
+        {7, 0x1, 2}, {8, 0x1, 2}, {9, 0x1, 2}, {10, 0x1, 2},
+        {11, 0x1, 2}, {12, 0x1, 2}, {13, 0x1, 2}, {14, 0x3, 2},
+        {7, 0x1, 3}, {8, 0x1, 3}, {9, 0x1, 3}, {10, 0x1, 3},
+        {11, 0x1, 3}, {12, 0x1, 3}, {13, 0x1, 3}, {14, 0x3, 3},
+    },
+    /* state 239: "111111111111111111111110010" */
+    {
+        {7, 0x1, 4}, {8, 0x1, 4}, {9, 0x1, 4}, {10, 0x1, 4},
+        {11, 0x1, 4}, {12, 0x1, 4}, {13, 0x1, 4}, {14, 0x3, 4},
+        {7, 0x1, 5}, {8, 0x1, 5}, {9, 0x1, 5}, {10, 0x1, 5},
+        {11, 0x1, 5}, {12, 0x1, 5}, {13, 0x1, 5}, {14, 0x3, 5},
+    },
+    /* state 240: "111111111111111111111110011" */
+    {
+        {7, 0x1, 6}, {8, 0x1, 6}, {9, 0x1, 6}, {10, 0x1, 6},
+        {11, 0x1, 6}, {12, 0x1, 6}, {13, 0x1, 6}, {14, 0x3, 6},
+        {7, 0x1, 7}, {8, 0x1, 7}, {9, 0x1, 7}, {10, 0x1, 7},
+        {11, 0x1, 7}, {12, 0x1, 7}, {13, 0x1, 7}, {14, 0x3, 7},
+    },
+    /* state 241: "111111111111111111111110100" */
+    {
+        {7, 0x1, 8}, {8, 0x1, 8}, {9, 0x1, 8}, {10, 0x1, 8},
+        {11, 0x1, 8}, {12, 0x1, 8}, {13, 0x1, 8}, {14, 0x3, 8},
+        {7, 0x1, 11}, {8, 0x1, 11}, {9, 0x1, 11}, {10, 0x1, 11},
+        {11, 0x1, 11}, {12, 0x1, 11}, {13, 0x1, 11}, {14, 0x3, 11},
+    },
+    /* state 242: "111111111111111111111110101" */
+    {
+        {7, 0x1, 12}, {8, 0x1, 12}, {9, 0x1, 12}, {10, 0x1, 12},
+        {11, 0x1, 12}, {12, 0x1, 12}, {13, 0x1, 12}, {14, 0x3, 12},
+        {7, 0x1, 14}, {8, 0x1, 14}, {9, 0x1, 14}, {10, 0x1, 14},
+        {11, 0x1, 14}, {12, 0x1, 14}, {13, 0x1, 14}, {14, 0x3, 14},
+    },
+    /* state 243: "111111111111111111111110110" */
+    {
+        {7, 0x1, 15}, {8, 0x1, 15}, {9, 0x1, 15}, {10, 0x1, 15},
+        {11, 0x1, 15}, {12, 0x1, 15}, {13, 0x1, 15}, {14, 0x3, 15},
+        {7, 0x1, 16}, {8, 0x1, 16}, {9, 0x1, 16}, {10, 0x1, 16},
+        {11, 0x1, 16}, {12, 0x1, 16}, {13, 0x1, 16}, {14, 0x3, 16},
+    },
+    /* state 244: "111111111111111111111110111" */
+    {
+        {7, 0x1, 17}, {8, 0x1, 17}, {9, 0x1, 17}, {10, 0x1, 17},
+        {11, 0x1, 17}, {12, 0x1, 17}, {13, 0x1, 17}, {14, 0x3, 17},
+        {7, 0x1, 18}, {8, 0x1, 18}, {9, 0x1, 18}, {10, 0x1, 18},
+        {11, 0x1, 18}, {12, 0x1, 18}, {13, 0x1, 18}, {14, 0x3, 18},
+    },
+    /* state 245: "111111111111111111111111000" */
+    {
+        {7, 0x1, 19}, {8, 0x1, 19}, {9, 0x1, 19}, {10, 0x1, 19},
+        {11, 0x1, 19}, {12, 0x1, 19}, {13, 0x1, 19}, {14, 0x3, 19},
+        {7, 0x1, 20}, {8, 0x1, 20}, {9, 0x1, 20}, {10, 0x1, 20},
+        {11, 0x1, 20}, {12, 0x1, 20}, {13, 0x1, 20}, {14, 0x3, 20},
+    },
+    /* state 246: "111111111111111111111111001" */
+    {
+        {7, 0x1, 21}, {8, 0x1, 21}, {9, 0x1, 21}, {10, 0x1, 21},
+        {11, 0x1, 21}, {12, 0x1, 21}, {13, 0x1, 21}, {14, 0x3, 21},
+        {7, 0x1, 23}, {8, 0x1, 23}, {9, 0x1, 23}, {10, 0x1, 23},
+        {11, 0x1, 23}, {12, 0x1, 23}, {13, 0x1, 23}, {14, 0x3, 23},
+    },
+    /* state 247: "111111111111111111111111010" */
+    {
+        {7, 0x1, 24}, {8, 0x1, 24}, {9, 0x1, 24}, {10, 0x1, 24},
+        {11, 0x1, 24}, {12, 0x1, 24}, {13, 0x1, 24}, {14, 0x3, 24},
+        {7, 0x1, 25}, {8, 0x1, 25}, {9, 0x1, 25}, {10, 0x1, 25},
+        {11, 0x1, 25}, {12, 0x1, 25}, {13, 0x1, 25}, {14, 0x3, 25},
+    },
+    /* state 248: "111111111111111111111111011" */
+    {
+        {7, 0x1, 26}, {8, 0x1, 26}, {9, 0x1, 26}, {10, 0x1, 26},
+        {11, 0x1, 26}, {12, 0x1, 26}, {13, 0x1, 26}, {14, 0x3, 26},
+        {7, 0x1, 27}, {8, 0x1, 27}, {9, 0x1, 27}, {10, 0x1, 27},
+        {11, 0x1, 27}, {12, 0x1, 27}, {13, 0x1, 27}, {14, 0x3, 27},
+    },
+    /* state 249: "111111111111111111111111100" */
+    {
+        {7, 0x1, 28}, {8, 0x1, 28}, {9, 0x1, 28}, {10, 0x1, 28},
+        {11, 0x1, 28}, {12, 0x1, 28}, {13, 0x1, 28}, {14, 0x3, 28},
+        {7, 0x1, 29}, {8, 0x1, 29}, {9, 0x1, 29}, {10, 0x1, 29},
+        {11, 0x1, 29}, {12, 0x1, 29}, {13, 0x1, 29}, {14, 0x3, 29},
+    },
+    /* state 250: "111111111111111111111111101" */
+    {
+        {7, 0x1, 30}, {8, 0x1, 30}, {9, 0x1, 30}, {10, 0x1, 30},
+        {11, 0x1, 30}, {12, 0x1, 30}, {13, 0x1, 30}, {14, 0x3, 30},
+        {7, 0x1, 31}, {8, 0x1, 31}, {9, 0x1, 31}, {10, 0x1, 31},
+        {11, 0x1, 31}, {12, 0x1, 31}, {13, 0x1, 31}, {14, 0x3, 31},
+    },
+    /* state 251: "111111111111111111111111110" */
+    {
+        {7, 0x1, 127}, {8, 0x1, 127}, {9, 0x1, 127}, {10, 0x1, 127},
+        {11, 0x1, 127}, {12, 0x1, 127}, {13, 0x1, 127}, {14, 0x3, 127},
+        {7, 0x1, 220}, {8, 0x1, 220}, {9, 0x1, 220}, {10, 0x1, 220},
+        {11, 0x1, 220}, {12, 0x1, 220}, {13, 0x1, 220}, {14, 0x3, 220},
+    },
+    /* state 252: "111111111111111111111111111" */
+    {
+        {7, 0x1, 249}, {8, 0x1, 249}, {9, 0x1, 249}, {10, 0x1, 249},
+        {11, 0x1, 249}, {12, 0x1, 249}, {13, 0x1, 249}, {14, 0x3, 249},
+        {1, 0x1, 10}, {2, 0x3, 10}, {1, 0x1, 13}, {2, 0x3, 13},
+        {1, 0x1, 22}, {2, 0x3, 22}, {0, 0x4, 0}, {0, 0x4, 0},
+    },
+    /* state 253: "1111111111111111111111111111" */
+    {
+        {3, 0x1, 10}, {4, 0x1, 10}, {5, 0x1, 10}, {6, 0x3, 10},
+        {3, 0x1, 13}, {4, 0x1, 13}, {5, 0x1, 13}, {6, 0x3, 13},
+        {3, 0x1, 22}, {4, 0x1, 22}, {5, 0x1, 22}, {6, 0x3, 22},
+        {0, 0x4, 0}, {0, 0x4, 0}, {0, 0x4, 0}, {0, 0x4, 0},
+    },
+    /* state 254: "11111111111111111111111111110" */
+    {
+        {7, 0x1, 10}, {8, 0x1, 10}, {9, 0x1, 10}, {10, 0x1, 10},
+        {11, 0x1, 10}, {12, 0x1, 10}, {13, 0x1, 10}, {14, 0x3, 10},
+        {7, 0x1, 13}, {8, 0x1, 13}, {9, 0x1, 13}, {10, 0x1, 13},
+        {11, 0x1, 13}, {12, 0x1, 13}, {13, 0x1, 13}, {14, 0x3, 13},
+    },
+    /* state 255: "11111111111111111111111111111" */
+    {
+        {7, 0x1, 22}, {8, 0x1, 22}, {9, 0x1, 22}, {10, 0x1, 22},
+        {11, 0x1, 22}, {12, 0x1, 22}, {13, 0x1, 22}, {14, 0x3, 22},
+        {0, 0x4, 0}, {0, 0x4, 0}, {0, 0x4, 0}, {0, 0x4, 0},
+        {0, 0x4, 0}, {0, 0x4, 0}, {0, 0x4, 0}, {0, 0x4, 0},
+    },
+};
@@ -0,0 +1,65 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+/* WARNING: THIS FILE WAS AUTOMATICALLY GENERATED BY scripts/generate_hpack_tables.py. DO NOT EDIT. */
+/* clang-format off */
+
+#include <aws/http/private/hpack.h>
+
+const struct aws_hpack_static_name_bucket
+    aws_hpack_static_name_buckets[AWS_HPACK_STATIC_NAME_HASH_SIZE] = {
+    [6] = {48, 1}, /* proxy-authenticate */
+    [13] = {50, 1}, /* range */
+    [23] = {8, 7}, /* :status */
+    [26] = {47, 1}, /* max-forwards */
+    [27] = {52, 1}, /* refresh */
+    [28] = {55, 1}, /* set-cookie */
+    [35] = {60, 1}, /* via */
+    [43] = {49, 1}, /* proxy-authorization */
+    [50] = {1, 1}, /* :authority */
+    [53] = {57, 1}, /* transfer-encoding */
+    [67] = {51, 1}, /* referer */
+    [71] = {53, 1}, /* retry-after */
+    [74] = {61, 1}, /* www-authenticate */
+    [76] = {54, 1}, /* server */
+    [97] = {21, 1}, /* age */
+    [108] = {58, 1}, /* user-agent */
+    [109] = {17, 1}, /* accept-language */
+    [117] = {16, 1}, /* accept-encoding */
+    [120] = {32, 1}, /* cookie */
+    [123] = {56, 1}, /* strict-transport-security */
+    [126] = {31, 1}, /* content-type */
+    [127] = {30, 1}, /* content-range */
+    [128] = {33, 1}, /* date */
+    [130] = {27, 1}, /* content-language */
+    [132] = {59, 1}, /* vary */
+    [138] = {26, 1}, /* content-encoding */
+    [140] = {28, 1}, /* content-length */
+    [143] = {23, 1}, /* authorization */
+    [146] = {34, 1}, /* etag */
+    [155] = {24, 1}, /* cache-control */
+    [157] = {20, 1}, /* access-control-allow-origin */
+    [160] = {19, 1}, /* accept */
+    [163] = {18, 1}, /* accept-ranges */
+    [166] = {29, 1}, /* content-location */
+    [168] = {15, 1}, /* accept-charset */
+    [169] = {25, 1}, /* content-disposition */
+    [171] = {22, 1}, /* allow */
+    [180] = {37, 1}, /* from */
+    [182] = {42, 1}, /* if-range */
+    [191] = {40, 1}, /* if-modified-since */
+    [193] = {43, 1}, /* if-unmodified-since */
+    [194] = {39, 1}, /* if-match */
+    [197] = {36, 1}, /* expires */
+    [199] = {41, 1}, /* if-none-match */
+    [200] = {35, 1}, /* expect */
+    [213] = {44, 1}, /* last-modified */
+    [219] = {2, 2}, /* :method */
+    [223] = {6, 2}, /* :scheme */
+    [228] = {38, 1}, /* host */
+    [232] = {45, 1}, /* link */
+    [233] = {4, 2}, /* :path */
+    [248] = {46, 1}, /* location */
+};
@@ -3,7 +3,6 @@
  * SPDX-License-Identifier: Apache-2.0.
  */
 
-#include <aws/common/hash_table.h>
 #include <aws/compression/compression.h>
 #include <aws/http/private/hpack.h>
 #include <aws/http/private/http_impl.h>
@@ -139,6 +138,9 @@ static struct aws_error_info s_errors[] = {
     AWS_DEFINE_ERROR_INFO_HTTP(
         AWS_ERROR_HTTP_STREAM_MANAGER_UNEXPECTED_HTTP_VERSION,
         "Stream acquisition failed because stream manager got an unexpected version of HTTP connection"),
+    AWS_DEFINE_ERROR_INFO_HTTP(
+        AWS_ERROR_HTTP_CONTENT_DECODING_FAILURE,
+        "Failed to decode a compressed body"),
 };
 /* clang-format on */
 
@@ -169,92 +171,33 @@ static struct aws_log_subject_info_list s_log_subject_list = {
     .count = AWS_ARRAY_SIZE(s_log_subject_infos),
 };
 
-struct aws_enum_value {
-    struct aws_allocator *allocator;
-    int value;
+/* METHODS */
+static const struct aws_byte_cursor s_method_enum_to_str[AWS_HTTP_METHOD_COUNT] = {
+    [AWS_HTTP_METHOD_GET] = AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("GET"),
+    [AWS_HTTP_METHOD_HEAD] = AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("HEAD"),
+    [AWS_HTTP_METHOD_CONNECT] = AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("CONNECT"),
 };
 
-static void s_destroy_enum_value(void *value) {
-    struct aws_enum_value *enum_value = value;
-    aws_mem_release(enum_value->allocator, enum_value);
-}
-
-/**
- * Given array of aws_byte_cursors, init hashtable where...
- * Key is aws_byte_cursor* (pointing into cursor from array) and comparisons are case-insensitive.
- * Value is the array index cast to a void*.
- */
-static void s_init_str_to_enum_hash_table(
-    struct aws_hash_table *table,
-    struct aws_allocator *alloc,
-    struct aws_byte_cursor *str_array,
-    int start_index,
-    int end_index,
-    bool ignore_case) {
-
-    int err = aws_hash_table_init(
-        table,
-        alloc,
-        end_index - start_index,
-        ignore_case ? aws_hash_byte_cursor_ptr_ignore_case : aws_hash_byte_cursor_ptr,
-        (aws_hash_callback_eq_fn *)(ignore_case ? aws_byte_cursor_eq_ignore_case : aws_byte_cursor_eq),
-        NULL,
-        s_destroy_enum_value);
-    AWS_FATAL_ASSERT(!err);
-
-    for (int i = start_index; i < end_index; ++i) {
-        int was_created = 0;
-        struct aws_enum_value *enum_value = aws_mem_calloc(alloc, 1, sizeof(struct aws_enum_value));
-        AWS_FATAL_ASSERT(enum_value);
-        enum_value->allocator = alloc;
-        enum_value->value = i;
-
-        AWS_FATAL_ASSERT(str_array[i].ptr && "Missing enum string");
-        err = aws_hash_table_put(table, &str_array[i], (void *)enum_value, &was_created);
-        AWS_FATAL_ASSERT(!err && was_created);
+enum aws_http_method aws_http_str_to_method(struct aws_byte_cursor cursor) {
+    /* Every known method has a unique length, so that's all it takes to find the only candidate */
+    enum aws_http_method candidate;
+    switch (cursor.len) {
+        case 3:
+            candidate = AWS_HTTP_METHOD_GET;
+            break;
+        case 4:
+            candidate = AWS_HTTP_METHOD_HEAD;
+            break;
+        case 7:
+            candidate = AWS_HTTP_METHOD_CONNECT;
+            break;
+        default:
+            return AWS_HTTP_METHOD_UNKNOWN;
     }
-}
 
-/**
- * Given key, get value from table initialized by s_init_str_to_enum_hash_table().
- * Returns -1 if key not found.
- */
-static int s_find_in_str_to_enum_hash_table(const struct aws_hash_table *table, struct aws_byte_cursor *key) {
-    struct aws_hash_element *elem;
-    aws_hash_table_find(table, key, &elem);
-    if (elem) {
-        struct aws_enum_value *enum_value = elem->value;
-        return enum_value->value;
-    }
-    return -1;
-}
-
-/* METHODS */
-static struct aws_hash_table s_method_str_to_enum;                         /* for string -> enum lookup */
-static struct aws_byte_cursor s_method_enum_to_str[AWS_HTTP_METHOD_COUNT]; /* for enum -> string lookup */
-
-static void s_methods_init(struct aws_allocator *alloc) {
-    s_method_enum_to_str[AWS_HTTP_METHOD_GET] = aws_http_method_get;
-    s_method_enum_to_str[AWS_HTTP_METHOD_HEAD] = aws_http_method_head;
-    s_method_enum_to_str[AWS_HTTP_METHOD_CONNECT] = aws_http_method_connect;
-
-    s_init_str_to_enum_hash_table(
-        &s_method_str_to_enum,
-        alloc,
-        s_method_enum_to_str,
-        AWS_HTTP_METHOD_UNKNOWN + 1,
-        AWS_HTTP_METHOD_COUNT,
-        false /* DO NOT ignore case of method */);
-}
-
-static void s_methods_clean_up(void) {
-    aws_hash_table_clean_up(&s_method_str_to_enum);
-}
-
-enum aws_http_method aws_http_str_to_method(struct aws_byte_cursor cursor) {
-    int method = s_find_in_str_to_enum_hash_table(&s_method_str_to_enum, &cursor);
-    if (method >= 0) {
-        return (enum aws_http_method)method;
+    /* DO NOT ignore case of method */
+    if (aws_byte_cursor_eq(&cursor, &s_method_enum_to_str[candidate])) {
+        return candidate;
     }
     return AWS_HTTP_METHOD_UNKNOWN;
 }
@@ -281,81 +224,118 @@ struct aws_byte_cursor aws_http_version_to_str(enum aws_http_version version) {
 }
 
 /* HEADERS */
-static struct aws_hash_table s_header_str_to_enum;           /* for case-insensitive string -> enum lookup */
-static struct aws_hash_table s_lowercase_header_str_to_enum; /* for case-sensitive string -> enum lookup */
-static struct aws_byte_cursor s_header_enum_to_str[AWS_HTTP_HEADER_COUNT]; /* for enum -> string lookup */
-
-static void s_headers_init(struct aws_allocator *alloc) {
-    s_header_enum_to_str[AWS_HTTP_HEADER_METHOD] = aws_byte_cursor_from_c_str(":method");
-    s_header_enum_to_str[AWS_HTTP_HEADER_SCHEME] = aws_byte_cursor_from_c_str(":scheme");
-    s_header_enum_to_str[AWS_HTTP_HEADER_AUTHORITY] = aws_byte_cursor_from_c_str(":authority");
-    s_header_enum_to_str[AWS_HTTP_HEADER_PATH] = aws_byte_cursor_from_c_str(":path");
-    s_header_enum_to_str[AWS_HTTP_HEADER_STATUS] = aws_byte_cursor_from_c_str(":status");
-    s_header_enum_to_str[AWS_HTTP_HEADER_COOKIE] = aws_byte_cursor_from_c_str("cookie");
-    s_header_enum_to_str[AWS_HTTP_HEADER_SET_COOKIE] = aws_byte_cursor_from_c_str("set-cookie");
-    s_header_enum_to_str[AWS_HTTP_HEADER_HOST] = aws_byte_cursor_from_c_str("host");
-    s_header_enum_to_str[AWS_HTTP_HEADER_CONNECTION] = aws_byte_cursor_from_c_str("connection");
-    s_header_enum_to_str[AWS_HTTP_HEADER_CONTENT_LENGTH] = aws_byte_cursor_from_c_str("content-length");
-    s_header_enum_to_str[AWS_HTTP_HEADER_EXPECT] = aws_byte_cursor_from_c_str("expect");
-    s_header_enum_to_str[AWS_HTTP_HEADER_TRANSFER_ENCODING] = aws_byte_cursor_from_c_str("transfer-encoding");
-    s_header_enum_to_str[AWS_HTTP_HEADER_CACHE_CONTROL] = aws_byte_cursor_from_c_str("cache-control");
-    s_header_enum_to_str[AWS_HTTP_HEADER_MAX_FORWARDS] = aws_byte_cursor_from_c_str("max-forwards");
-    s_header_enum_to_str[AWS_HTTP_HEADER_PRAGMA] = aws_byte_cursor_from_c_str("pragma");
-    s_header_enum_to_str[AWS_HTTP_HEADER_RANGE] = aws_byte_cursor_from_c_str("range");
-    s_header_enum_to_str[AWS_HTTP_HEADER_TE] = aws_byte_cursor_from_c_str("te");
-    s_header_enum_to_str[AWS_HTTP_HEADER_CONTENT_ENCODING] = aws_byte_cursor_from_c_str("content-encoding");
-    s_header_enum_to_str[AWS_HTTP_HEADER_CONTENT_TYPE] = aws_byte_cursor_from_c_str("content-type");
-    s_header_enum_to_str[AWS_HTTP_HEADER_CONTENT_RANGE] = aws_byte_cursor_from_c_str("content-range");
-    s_header_enum_to_str[AWS_HTTP_HEADER_TRAILER] = aws_byte_cursor_from_c_str("trailer");
-    s_header_enum_to_str[AWS_HTTP_HEADER_WWW_AUTHENTICATE] = aws_byte_cursor_from_c_str("www-authenticate");
-    s_header_enum_to_str[AWS_HTTP_HEADER_AUTHORIZATION] = aws_byte_cursor_from_c_str("authorization");
-    s_header_enum_to_str[AWS_HTTP_HEADER_PROXY_AUTHENTICATE] = aws_byte_cursor_from_c_str("proxy-authenticate");
-    s_header_enum_to_str[AWS_HTTP_HEADER_PROXY_AUTHORIZATION] = aws_byte_cursor_from_c_str("proxy-authorization");
-    s_header_enum_to_str[AWS_HTTP_HEADER_AGE] = aws_byte_cursor_from_c_str("age");
-    s_header_enum_to_str[AWS_HTTP_HEADER_EXPIRES] = aws_byte_cursor_from_c_str("expires");
-    s_header_enum_to_str[AWS_HTTP_HEADER_DATE] = aws_byte_cursor_from_c_str("date");
-    s_header_enum_to_str[AWS_HTTP_HEADER_LOCATION] = aws_byte_cursor_from_c_str("location");
-    s_header_enum_to_str[AWS_HTTP_HEADER_RETRY_AFTER] = aws_byte_cursor_from_c_str("retry-after");
-    s_header_enum_to_str[AWS_HTTP_HEADER_VARY] = aws_byte_cursor_from_c_str("vary");
-    s_header_enum_to_str[AWS_HTTP_HEADER_WARNING] = aws_byte_cursor_from_c_str("warning");
-    s_header_enum_to_str[AWS_HTTP_HEADER_UPGRADE] = aws_byte_cursor_from_c_str("upgrade");
-    s_header_enum_to_str[AWS_HTTP_HEADER_KEEP_ALIVE] = aws_byte_cursor_from_c_str("keep-alive");
-    s_header_enum_to_str[AWS_HTTP_HEADER_PROXY_CONNECTION] = aws_byte_cursor_from_c_str("proxy-connection");
-
-    s_init_str_to_enum_hash_table(
-        &s_header_str_to_enum,
-        alloc,
-        s_header_enum_to_str,
-        AWS_HTTP_HEADER_UNKNOWN + 1,
-        AWS_HTTP_HEADER_COUNT,
-        true /* ignore case */);
-
-    s_init_str_to_enum_hash_table(
-        &s_lowercase_header_str_to_enum,
-        alloc,
-        s_header_enum_to_str,
-        AWS_HTTP_HEADER_UNKNOWN + 1,
-        AWS_HTTP_HEADER_COUNT,
-        false /* ignore case */);
-}
+static const struct aws_byte_cursor s_header_enum_to_str[AWS_HTTP_HEADER_COUNT] = {
+    [AWS_HTTP_HEADER_METHOD] = AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL(":method"),
+    [AWS_HTTP_HEADER_SCHEME] = AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL(":scheme"),
+    [AWS_HTTP_HEADER_AUTHORITY] = AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL(":authority"),
+    [AWS_HTTP_HEADER_PATH] = AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL(":path"),
+    [AWS_HTTP_HEADER_STATUS] = AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL(":status"),
+    [AWS_HTTP_HEADER_COOKIE] = AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("cookie"),
+    [AWS_HTTP_HEADER_SET_COOKIE] = AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("set-cookie"),
+    [AWS_HTTP_HEADER_HOST] = AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("host"),
+    [AWS_HTTP_HEADER_CONNECTION] = AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("connection"),
+    [AWS_HTTP_HEADER_CONTENT_LENGTH] = AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("content-length"),
+    [AWS_HTTP_HEADER_EXPECT] = AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("expect"),
+    [AWS_HTTP_HEADER_TRANSFER_ENCODING] = AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("transfer-encoding"),
+    [AWS_HTTP_HEADER_CACHE_CONTROL] = AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("cache-control"),
+    [AWS_HTTP_HEADER_MAX_FORWARDS] = AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("max-forwards"),
+    [AWS_HTTP_HEADER_PRAGMA] = AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("pragma"),
+    [AWS_HTTP_HEADER_RANGE] = AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("range"),
+    [AWS_HTTP_HEADER_TE] = AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("te"),
+    [AWS_HTTP_HEADER_CONTENT_ENCODING] = AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("content-encoding"),
+    [AWS_HTTP_HEADER_CONTENT_TYPE] = AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("content-type"),
+    [AWS_HTTP_HEADER_CONTENT_RANGE] = AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("content-range"),
+    [AWS_HTTP_HEADER_TRAILER] = AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("trailer"),
+    [AWS_HTTP_HEADER_WWW_AUTHENTICATE] = AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("www-authenticate"),
+    [AWS_HTTP_HEADER_AUTHORIZATION] = AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("authorization"),
+    [AWS_HTTP_HEADER_PROXY_AUTHENTICATE] = AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("proxy-authenticate"),
+    [AWS_HTTP_HEADER_PROXY_AUTHORIZATION] = AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("proxy-authorization"),
+    [AWS_HTTP_HEADER_AGE] = AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("age"),
+    [AWS_HTTP_HEADER_EXPIRES] = AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("expires"),
+    [AWS_HTTP_HEADER_DATE] = AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("date"),
+    [AWS_HTTP_HEADER_LOCATION] = AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("location"),
+    [AWS_HTTP_HEADER_RETRY_AFTER] = AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("retry-after"),
+    [AWS_HTTP_HEADER_VARY] = AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("vary"),
+    [AWS_HTTP_HEADER_WARNING] = AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("warning"),
+    [AWS_HTTP_HEADER_UPGRADE] = AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("upgrade"),
+    [AWS_HTTP_HEADER_KEEP_ALIVE] = AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("keep-alive"),
+    [AWS_HTTP_HEADER_PROXY_CONNECTION] = AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("proxy-connection"),
+};
+
+/**
+ * Perfect hash for the known header names: no two of them land in the same bucket,
+ * so a lookup costs one hash, one table read, and at most one string comparison.
+ * The hash only looks at length, first char, and last char. Chars are OR'd with 0x20,
+ * which makes ASCII letters lowercase, so names that differ only by case get the same hash.
+ * If a new header is added and collides, the compiler will warn about the overridden initializer,
+ * and the parameters must be changed (brute-force search for new multipliers, or grow the table).
+ */
+#define AWS_HTTP_HEADER_NAME_HASH_SIZE 128
+#define AWS_HTTP_HEADER_NAME_HASH(LEN, FIRST, LAST)                                                                    \
+    (((size_t)(LEN) + ((size_t)(FIRST) | 0x20) + 3 * ((size_t)(LAST) | 0x20)) & (AWS_HTTP_HEADER_NAME_HASH_SIZE - 1))
+
+/* clang-format off */
+static const uint8_t s_header_hash_to_enum[AWS_HTTP_HEADER_NAME_HASH_SIZE] = {
+    [AWS_HTTP_HEADER_NAME_HASH(7, ':', 'd')] = AWS_HTTP_HEADER_METHOD,
+    [AWS_HTTP_HEADER_NAME_HASH(7, ':', 'e')] = AWS_HTTP_HEADER_SCHEME,
+    [AWS_HTTP_HEADER_NAME_HASH(10, ':', 'y')] = AWS_HTTP_HEADER_AUTHORITY,
+    [AWS_HTTP_HEADER_NAME_HASH(5, ':', 'h')] = AWS_HTTP_HEADER_PATH,
+    [AWS_HTTP_HEADER_NAME_HASH(7, ':', 's')] = AWS_HTTP_HEADER_STATUS,
+    [AWS_HTTP_HEADER_NAME_HASH(6, 'c', 'e')] = AWS_HTTP_HEADER_COOKIE,
+    [AWS_HTTP_HEADER_NAME_HASH(10, 's', 'e')] = AWS_HTTP_HEADER_SET_COOKIE,
+    [AWS_HTTP_HEADER_NAME_HASH(4, 'h', 't')] = AWS_HTTP_HEADER_HOST,
+    [AWS_HTTP_HEADER_NAME_HASH(10, 'c', 'n')] = AWS_HTTP_HEADER_CONNECTION,
+    [AWS_HTTP_HEADER_NAME_HASH(14, 'c', 'h')] = AWS_HTTP_HEADER_CONTENT_LENGTH,
+    [AWS_HTTP_HEADER_NAME_HASH(6, 'e', 't')] = AWS_HTTP_HEADER_EXPECT,
+    [AWS_HTTP_HEADER_NAME_HASH(17, 't', 'g')] = AWS_HTTP_HEADER_TRANSFER_ENCODING,
+    [AWS_HTTP_HEADER_NAME_HASH(13, 'c', 'l')] = AWS_HTTP_HEADER_CACHE_CONTROL,
+    [AWS_HTTP_HEADER_NAME_HASH(12, 'm', 's')] = AWS_HTTP_HEADER_MAX_FORWARDS,
+    [AWS_HTTP_HEADER_NAME_HASH(6, 'p', 'a')] = AWS_HTTP_HEADER_PRAGMA,
+    [AWS_HTTP_HEADER_NAME_HASH(5, 'r', 'e')] = AWS_HTTP_HEADER_RANGE,
+    [AWS_HTTP_HEADER_NAME_HASH(2, 't', 'e')] = AWS_HTTP_HEADER_TE,
+    [AWS_HTTP_HEADER_NAME_HASH(16, 'c', 'g')] = AWS_HTTP_HEADER_CONTENT_ENCODING,
+    [AWS_HTTP_HEADER_NAME_HASH(12, 'c', 'e')] = AWS_HTTP_HEADER_CONTENT_TYPE,
+    [AWS_HTTP_HEADER_NAME_HASH(13, 'c', 'e')] = AWS_HTTP_HEADER_CONTENT_RANGE,
+    [AWS_HTTP_HEADER_NAME_HASH(7, 't', 'r')] = AWS_HTTP_HEADER_TRAILER,
+    [AWS_HTTP_HEADER_NAME_HASH(16, 'w', 'e')] = AWS_HTTP_HEADER_WWW_AUTHENTICATE,
+    [AWS_HTTP_HEADER_NAME_HASH(13, 'a', 'n')] = AWS_HTTP_HEADER_AUTHORIZATION,
+    [AWS_HTTP_HEADER_NAME_HASH(18, 'p', 'e')] = AWS_HTTP_HEADER_PROXY_AUTHENTICATE,
+    [AWS_HTTP_HEADER_NAME_HASH(19, 'p', 'n')] = AWS_HTTP_HEADER_PROXY_AUTHORIZATION,
+    [AWS_HTTP_HEADER_NAME_HASH(3, 'a', 'e')] = AWS_HTTP_HEADER_AGE,
+    [AWS_HTTP_HEADER_NAME_HASH(7, 'e', 's')] = AWS_HTTP_HEADER_EXPIRES,
+    [AWS_HTTP_HEADER_NAME_HASH(4, 'd', 'e')] = AWS_HTTP_HEADER_DATE,
+    [AWS_HTTP_HEADER_NAME_HASH(8, 'l', 'n')] = AWS_HTTP_HEADER_LOCATION,
+    [AWS_HTTP_HEADER_NAME_HASH(11, 'r', 'r')] = AWS_HTTP_HEADER_RETRY_AFTER,
+    [AWS_HTTP_HEADER_NAME_HASH(4, 'v', 'y')] = AWS_HTTP_HEADER_VARY,
+    [AWS_HTTP_HEADER_NAME_HASH(7, 'w', 'g')] = AWS_HTTP_HEADER_WARNING,
+    [AWS_HTTP_HEADER_NAME_HASH(7, 'u', 'e')] = AWS_HTTP_HEADER_UPGRADE,
+    [AWS_HTTP_HEADER_NAME_HASH(10, 'k', 'e')] = AWS_HTTP_HEADER_KEEP_ALIVE,
+    [AWS_HTTP_HEADER_NAME_HASH(16, 'p', 'n')] = AWS_HTTP_HEADER_PROXY_CONNECTION,
+};
+/* clang-format on */
+
+static enum aws_http_header_name s_find_header_name_candidate(struct aws_byte_cursor cursor) {
+    if (cursor.len == 0) {
+        return AWS_HTTP_HEADER_UNKNOWN;
+    }
 
-static void s_headers_clean_up(void) {
-    aws_hash_table_clean_up(&s_header_str_to_enum);
-    aws_hash_table_clean_up(&s_lowercase_header_str_to_enum);
+    size_t bucket = AWS_HTTP_HEADER_NAME_HASH(cursor.len, cursor.ptr[0], cursor.ptr[cursor.len - 1]);
+    return (enum aws_http_header_name)s_header_hash_to_enum[bucket];
 }
 
 enum aws_http_header_name aws_http_str_to_header_name(struct aws_byte_cursor cursor) {
-    int header = s_find_in_str_to_enum_hash_table(&s_header_str_to_enum, &cursor);
-    if (header >= 0) {
-        return (enum aws_http_header_name)header;
+    enum aws_http_header_name candidate = s_find_header_name_candidate(cursor);
+    if (candidate != AWS_HTTP_HEADER_UNKNOWN &&
+        aws_byte_cursor_eq_ignore_case(&cursor, &s_header_enum_to_str[candidate])) {
+        return candidate;
     }
     return AWS_HTTP_HEADER_UNKNOWN;
 }
 
 enum aws_http_header_name aws_http_lowercase_str_to_header_name(struct aws_byte_cursor cursor) {
-    int header = s_find_in_str_to_enum_hash_table(&s_lowercase_header_str_to_enum, &cursor);
-    if (header >= 0) {
-        return (enum aws_http_header_name)header;
+    enum aws_http_header_name candidate = s_find_header_name_candidate(cursor);
+    if (candidate != AWS_HTTP_HEADER_UNKNOWN && aws_byte_cursor_eq(&cursor, &s_header_enum_to_str[candidate])) {
+        return candidate;
     }
     return AWS_HTTP_HEADER_UNKNOWN;
 }
@@ -505,10 +485,7 @@ void aws_http_library_init(struct aws_allocator *alloc) {
     aws_compression_library_init(alloc);
     aws_register_error_info(&s_error_list);
     aws_register_log_subject_info_list(&s_log_subject_list);
-    s_methods_init(alloc);
-    s_headers_init(alloc);
     s_versions_init(alloc);
-    aws_hpack_static_table_init(alloc);
 }
 
 void aws_http_library_clean_up(void) {
@@ -520,10 +497,7 @@ void aws_http_library_clean_up(void) {
     aws_thread_join_all_managed();
     aws_unregister_error_info(&s_error_list);
     aws_unregister_log_subject_info_list(&s_log_subject_list);
-    s_methods_clean_up();
-    s_headers_clean_up();
     s_versions_clean_up();
-    aws_hpack_static_table_clean_up();
     aws_compression_library_clean_up();
     aws_io_library_clean_up();
 }
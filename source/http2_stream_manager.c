@@ -49,6 +49,10 @@ static struct aws_h2_sm_pending_stream_acquisition *s_new_pending_stream_acquisi
 
     /* Copy the options and keep the underlying message alive */
     pending_stream_acquisition->options = *options;
+    if (options->http2_priority) {
+        pending_stream_acquisition->priority = *options->http2_priority;
+        pending_stream_acquisition->options.http2_priority = &pending_stream_acquisition->priority;
+    }
     pending_stream_acquisition->request = options->request;
     aws_http_message_acquire(pending_stream_acquisition->request);
     pending_stream_acquisition->callback = callback;
@@ -871,6 +875,7 @@ static void s_make_request_task(struct aws_channel_task *task, void *arg, enum a
         .on_complete = s_on_stream_complete,
         .on_destroy = s_on_stream_destroy,
         .user_data = pending_stream_acquisition,
+        .http2_priority = pending_stream_acquisition->options.http2_priority,
     };
     /* TODO: we could put the pending acquisition back to the list if the connection is not available for new request.
      */
@@ -1137,6 +1142,7 @@ struct aws_http2_stream_manager *aws_http2_stream_manager_new(
         .num_initial_settings = options->num_initial_settings,
         .max_closed_streams = options->max_closed_streams,
         .http2_conn_manual_window_management = options->conn_manual_window_management,
+        .http2_window_auto_tuning = options->window_auto_tuning,
     };
     /* aws_http_connection_manager_new needs to be the last thing that can fail */
     stream_manager->connection_manager = aws_http_connection_manager_new(allocator, &cm_options);
@@ -0,0 +1,90 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/http/private/mpsc_queue.h>
+
+#define STATE_CLOSED ((size_t)1)
+#define STATE_PUSH_IN_PROGRESS ((size_t)2)
+
+void aws_mpsc_queue_init(struct aws_mpsc_queue *queue) {
+    AWS_PRECONDITION(queue);
+
+    aws_atomic_init_ptr(&queue->stub.next, NULL);
+    aws_atomic_init_ptr(&queue->head, &queue->stub);
+    queue->tail = &queue->stub;
+    aws_atomic_init_int(&queue->state, 0);
+}
+
+static void s_push(struct aws_mpsc_queue *queue, struct aws_mpsc_queue_node *node) {
+    aws_atomic_store_ptr(&node->next, NULL);
+    struct aws_mpsc_queue_node *prev = aws_atomic_exchange_ptr(&queue->head, node);
+    /* Between the exchange and this store, the consumer can't see `node` or anything pushed after it */
+    aws_atomic_store_ptr(&prev->next, node);
+}
+
+bool aws_mpsc_queue_try_push(struct aws_mpsc_queue *queue, struct aws_mpsc_queue_node *node) {
+    AWS_PRECONDITION(queue);
+    AWS_PRECONDITION(node);
+
+    size_t prev_state = aws_atomic_fetch_add(&queue->state, STATE_PUSH_IN_PROGRESS);
+    if (prev_state & STATE_CLOSED) {
+        aws_atomic_fetch_sub(&queue->state, STATE_PUSH_IN_PROGRESS);
+        return false;
+    }
+
+    s_push(queue, node);
+
+    aws_atomic_fetch_sub(&queue->state, STATE_PUSH_IN_PROGRESS);
+    return true;
+}
+
+struct aws_mpsc_queue_node *aws_mpsc_queue_pop(struct aws_mpsc_queue *queue) {
+    AWS_PRECONDITION(queue);
+
+    struct aws_mpsc_queue_node *tail = queue->tail;
+    struct aws_mpsc_queue_node *next = aws_atomic_load_ptr(&tail->next);
+
+    /* Step past the stub */
+    if (tail == &queue->stub) {
+        if (next == NULL) {
+            return NULL;
+        }
+        queue->tail = next;
+        tail = next;
+        next = aws_atomic_load_ptr(&next->next);
+    }
+
+    if (next != NULL) {
+        queue->tail = next;
+        return tail;
+    }
+
+    /* `tail` looks like the last node. If it isn't, a producer is mid-push, and we'll see the rest once it's done */
+    if (tail != aws_atomic_load_ptr(&queue->head)) {
+        return NULL;
+    }
+
+    /* Put the stub back behind `tail`, so `tail` can be handed out without leaving the queue empty */
+    s_push(queue, &queue->stub);
+
+    next = aws_atomic_load_ptr(&tail->next);
+    if (next != NULL) {
+        queue->tail = next;
+        return tail;
+    }
+
+    return NULL;
+}
+
+void aws_mpsc_queue_close(struct aws_mpsc_queue *queue) {
+    AWS_PRECONDITION(queue);
+
+    aws_atomic_fetch_or(&queue->state, STATE_CLOSED);
+
+    /* Producers only hold a push in progress for a couple of atomic operations */
+    while (aws_atomic_load_int(&queue->state) != STATE_CLOSED) {
+        /* spin */
+    }
+}
@@ -7,13 +7,17 @@
 #include <aws/common/mutex.h>
 #include <aws/common/string.h>
 #include <aws/http/private/connection_impl.h>
+#include <aws/http/private/content_coding.h>
 #include <aws/http/private/request_response_impl.h>
+#include <aws/http/private/request_template.h>
 #include <aws/http/private/strutil.h>
 #include <aws/http/server.h>
 #include <aws/http/status_code.h>
 #include <aws/io/logging.h>
 #include <aws/io/stream.h>
 
+#include <inttypes.h>
+
 #if _MSC_VER
 #    pragma warning(disable : 4204) /* non-constant aggregate initializer */
 #endif
@@ -424,6 +428,9 @@ struct aws_http_message {
 
     struct aws_http_message_request_data *request_data;
     struct aws_http_message_response_data *response_data;
+
+    /* If set, this request was made from a template, whose headers are sent ahead of `headers` */
+    struct aws_http_request_template *request_template;
 };
 
 static int s_set_string_from_cursor(
@@ -509,6 +516,25 @@ struct aws_http_message *aws_http2_message_new_request(struct aws_allocator *all
     return s_message_new_request_common(allocator, NULL, AWS_HTTP_VERSION_2);
 }
 
+struct aws_http_message *aws_http_message_new_request_from_template(
+    struct aws_allocator *allocator,
+    struct aws_http_request_template *request_template) {
+
+    AWS_PRECONDITION(allocator);
+    AWS_PRECONDITION(request_template);
+
+    struct aws_http_message *message = s_message_new_request_common(allocator, NULL, request_template->version);
+    if (message) {
+        message->request_template = aws_http_request_template_acquire(request_template);
+    }
+    return message;
+}
+
+struct aws_http_request_template *aws_http_message_get_request_template(const struct aws_http_message *message) {
+    AWS_PRECONDITION(message);
+    return message->request_template;
+}
+
 static struct aws_http_message *s_http_message_new_response_common(
     struct aws_allocator *allocator,
     enum aws_http_version version) {
@@ -553,6 +579,7 @@ struct aws_http_message *aws_http_message_release(struct aws_http_message *messa
 
         aws_http_headers_release(message->headers);
         aws_input_stream_release(message->body_stream);
+        aws_http_request_template_release(message->request_template);
         aws_mem_release(message->allocator, message);
     } else {
         AWS_ASSERT(prev_refcount != 0);
@@ -618,8 +645,17 @@ int aws_http_message_get_request_method(
                     *out_method = aws_byte_cursor_from_string(request_message->request_data->method);
                     return AWS_OP_SUCCESS;
                 }
+                if (request_message->request_template) {
+                    *out_method = aws_byte_cursor_from_string(request_message->request_template->method);
+                    return AWS_OP_SUCCESS;
+                }
                 break;
             case AWS_HTTP_VERSION_2:
+                if (request_message->request_template &&
+                    !aws_http_headers_has(request_message->headers, aws_http_header_method)) {
+                    *out_method = aws_byte_cursor_from_string(request_message->request_template->method);
+                    return AWS_OP_SUCCESS;
+                }
                 return aws_http2_headers_get_request_method(request_message->headers, out_method);
             default:
                 error = AWS_ERROR_UNIMPLEMENTED;
@@ -736,6 +772,64 @@ void aws_http_message_set_body_stream(struct aws_http_message *message, struct a
     }
 }
 
+int aws_http_message_compress_body(struct aws_http_message *message, enum aws_http_content_coding coding) {
+    AWS_PRECONDITION(message);
+    if (!message->body_stream || coding == AWS_HTTP_CONTENT_CODING_IDENTITY) {
+        return AWS_OP_SUCCESS;
+    }
+
+    const bool is_http2 = aws_http_message_get_protocol_version(message) == AWS_HTTP_VERSION_2;
+    const struct aws_byte_cursor content_encoding = is_http2 ? aws_byte_cursor_from_c_str("content-encoding")
+                                                             : aws_byte_cursor_from_c_str("Content-Encoding");
+    const struct aws_byte_cursor content_length = is_http2 ? aws_byte_cursor_from_c_str("content-length")
+                                                           : aws_byte_cursor_from_c_str("Content-Length");
+
+    if (aws_http_headers_has(message->headers, content_encoding)) {
+        AWS_LOGF_ERROR(
+            AWS_LS_HTTP_GENERAL, "id=%p: Cannot compress body, it already has a content-encoding.", (void *)message);
+        return aws_raise_error(AWS_ERROR_INVALID_STATE);
+    }
+
+    /* HTTP/1 needs the length up front, while HTTP/2 can send DATA frames until the body ends */
+    struct aws_input_stream *compressed_body =
+        aws_http_content_encoder_stream_new(message->allocator, message->body_stream, coding, !is_http2 /*buffer*/);
+    if (!compressed_body) {
+        return AWS_OP_ERR;
+    }
+
+    const struct aws_byte_cursor coding_str = coding == AWS_HTTP_CONTENT_CODING_GZIP
+                                                  ? aws_byte_cursor_from_c_str("gzip")
+                                                  : aws_byte_cursor_from_c_str("deflate");
+    if (aws_http_headers_set(message->headers, content_encoding, coding_str)) {
+        goto error;
+    }
+
+    if (is_http2) {
+        if (aws_http_headers_has(message->headers, content_length)) {
+            aws_http_headers_erase(message->headers, content_length);
+        }
+    } else {
+        int64_t length = 0;
+        if (aws_input_stream_get_length(compressed_body, &length)) {
+            goto error;
+        }
+        char length_str[32];
+        snprintf(length_str, sizeof(length_str), "%" PRIi64, length);
+        if (aws_http_headers_set(message->headers, content_length, aws_byte_cursor_from_c_str(length_str))) {
+            goto error;
+        }
+    }
+
+    aws_http_message_set_body_stream(message, compressed_body);
+    aws_input_stream_release(compressed_body);
+    return AWS_OP_SUCCESS;
+
+error:
+    aws_http_headers_erase(message->headers, content_encoding);
+    aws_input_stream_release(compressed_body);
+    return AWS_OP_ERR;
+}
+
 int aws_http1_stream_write_chunk(struct aws_http_stream *http1_stream, const struct aws_http1_chunk_options *options) {
     AWS_PRECONDITION(http1_stream);
     AWS_PRECONDITION(http1_stream->vtable);
@@ -751,6 +845,24 @@ int aws_http1_stream_write_chunk(struct aws_http_stream *http1_stream, const str
     return http1_stream->vtable->http1_write_chunk(http1_stream, options);
 }
 
+int aws_http1_stream_write_chunks(
+    struct aws_http_stream *http1_stream,
+    const struct aws_http1_chunk_options *options_array,
+    size_t num_chunks) {
+    AWS_PRECONDITION(http1_stream);
+    AWS_PRECONDITION(http1_stream->vtable);
+    AWS_PRECONDITION(options_array || num_chunks == 0);
+    if (!http1_stream->vtable->http1_write_chunks) {
+        AWS_LOGF_TRACE(
+            AWS_LS_HTTP_STREAM,
+            "id=%p: HTTP/1 stream only function invoked on other stream, ignoring call.",
+            (void *)http1_stream);
+        return aws_raise_error(AWS_ERROR_INVALID_STATE);
+    }
+
+    return http1_stream->vtable->http1_write_chunks(http1_stream, options_array, num_chunks);
+}
+
 int aws_http2_stream_write_data(
     struct aws_http_stream *http2_stream,
     const struct aws_http2_stream_write_data_options *options) {
@@ -822,6 +934,178 @@ int aws_http_message_get_header(
     return aws_http_headers_get_index(message->headers, index, out_header);
 }
 
+static void s_incoming_header_batch_init(struct aws_http_stream *stream) {
+    struct aws_http_incoming_header_batch *batch = &stream->incoming_header_batch;
+
+    /* Nothing is allocated until the first header arrives, so none of these can fail */
+    aws_array_list_init_dynamic(&batch->headers, stream->alloc, 0, sizeof(struct aws_http_header));
+    aws_byte_buf_init(&batch->storage, stream->alloc, 0);
+    aws_array_list_init_dynamic(&batch->delivered_storage, stream->alloc, 0, sizeof(struct aws_byte_buf));
+    batch->enabled = true;
+}
+
+static void s_incoming_header_batch_clean_up(struct aws_http_stream *stream) {
+    struct aws_http_incoming_header_batch *batch = &stream->incoming_header_batch;
+    if (!batch->enabled) {
+        return;
+    }
+
+    const size_t num_delivered = aws_array_list_length(&batch->delivered_storage);
+    for (size_t i = 0; i < num_delivered; ++i) {
+        struct aws_byte_buf *delivered = NULL;
+        aws_array_list_get_at_ptr(&batch->delivered_storage, (void **)&delivered, i);
+        aws_byte_buf_clean_up(delivered);
+    }
+    aws_array_list_clean_up(&batch->delivered_storage);
+    aws_byte_buf_clean_up(&batch->storage);
+    aws_array_list_clean_up(&batch->headers);
+    AWS_ZERO_STRUCT(*batch);
+}
+
+int aws_http_stream_on_incoming_header(
+    struct aws_http_stream *stream,
+    enum aws_http_header_block header_block,
+    const struct aws_http_header *header) {
+
+    if (!stream->on_incoming_headers) {
+        return AWS_OP_SUCCESS;
+    }
+
+    struct aws_http_incoming_header_batch *batch = &stream->incoming_header_batch;
+    if (!batch->enabled) {
+        return stream->on_incoming_headers(stream, header_block, header, 1, stream->user_data);
+    }
+
+    /* Only lengths are recorded, storage may move as it grows. Pointers are assigned on flush. */
+    struct aws_http_header collected = {
+        .name = {.len = header->name.len},
+        .value = {.len = header->value.len},
+        .compression = header->compression,
+    };
+
+    if (aws_byte_buf_append_dynamic(&batch->storage, &header->name) ||
+        aws_byte_buf_append_dynamic(&batch->storage, &header->value) ||
+        aws_array_list_push_back(&batch->headers, &collected)) {
+        return AWS_OP_ERR;
+    }
+
+    return AWS_OP_SUCCESS;
+}
+
+int aws_http_stream_flush_incoming_headers(struct aws_http_stream *stream, enum aws_http_header_block header_block) {
+    struct aws_http_incoming_header_batch *batch = &stream->incoming_header_batch;
+    const size_t num_headers = batch->enabled ? aws_array_list_length(&batch->headers) : 0;
+    if (num_headers == 0) {
+        return AWS_OP_SUCCESS;
+    }
+
+    /* Storage is kept until the stream is destroyed, so the strings stay valid after this block is delivered */
+    if (aws_array_list_push_back(&batch->delivered_storage, &batch->storage)) {
+        return AWS_OP_ERR;
+    }
+    uint8_t *next_str = batch->storage.buffer;
+    aws_byte_buf_init(&batch->storage, stream->alloc, 0);
+
+    for (size_t i = 0; i < num_headers; ++i) {
+        struct aws_http_header *header = NULL;
+        aws_array_list_get_at_ptr(&batch->headers, (void **)&header, i);
+        header->name.ptr = next_str;
+        next_str += header->name.len;
+        header->value.ptr = next_str;
+        next_str += header->value.len;
+    }
+
+    int err = stream->on_incoming_headers(stream, header_block, batch->headers.data, num_headers, stream->user_data);
+    aws_array_list_clear(&batch->headers);
+    return err;
+}
+
+void aws_http_stream_on_incoming_coding_header(
+    struct aws_http_stream *stream,
+    struct aws_byte_cursor value,
+    bool is_transfer_encoding) {
+
+    struct aws_http_incoming_body_decompression *decompression = &stream->incoming_body_decompression;
+    if (!decompression->enabled || decompression->received_body) {
+        return;
+    }
+
+    /* Value is a comma separated list of codings, in the order they were applied */
+    struct aws_byte_cursor split;
+    AWS_ZERO_STRUCT(split);
+    while (aws_byte_cursor_next_split(&value, ',', &split)) {
+        struct aws_byte_cursor token = aws_strutil_trim_http_whitespace(split);
+        if (token.len == 0) {
+            continue;
+        }
+
+        /* The HTTP/1 decoder already takes care of chunked */
+        if (is_transfer_encoding && aws_byte_cursor_eq_c_str_ignore_case(&token, "chunked")) {
+            continue;
+        }
+
+        enum aws_http_content_coding coding;
+        if (!aws_http_content_coding_from_token(token, &coding) ||
+            (coding != AWS_HTTP_CONTENT_CODING_IDENTITY &&
+             decompression->coding != AWS_HTTP_CONTENT_CODING_IDENTITY)) {
+
+            AWS_LOGF_DEBUG(
+                AWS_LS_HTTP_STREAM,
+                "id=%p: Incoming body coding '" PRInSTR "' cannot be decompressed, body will be delivered as-is.",
+                (void *)stream,
+                AWS_BYTE_CURSOR_PRI(token));
+            decompression->passthrough = true;
+            return;
+        }
+
+        if (coding != AWS_HTTP_CONTENT_CODING_IDENTITY) {
+            decompression->coding = coding;
+        }
+    }
+}
+
+static int s_on_decompressed_body(const struct aws_byte_cursor *data, void *user_data) {
+    struct aws_http_stream *stream = user_data;
+    return stream->on_incoming_body(stream, data, stream->user_data);
+}
+
+int aws_http_stream_on_incoming_body(struct aws_http_stream *stream, const struct aws_byte_cursor *data) {
+    struct aws_http_incoming_body_decompression *decompression = &stream->incoming_body_decompression;
+    decompression->received_body = true;
+
+    if (decompression->passthrough || decompression->coding == AWS_HTTP_CONTENT_CODING_IDENTITY) {
+        if (stream->on_incoming_body) {
+            return stream->on_incoming_body(stream, data, stream->user_data);
+        }
+        return AWS_OP_SUCCESS;
+    }
+
+    decompression->compressed_size += data->len;
+    if (!stream->on_incoming_body) {
+        return AWS_OP_SUCCESS;
+    }
+
+    if (!decompression->decoder) {
+        decompression->decoder = aws_http_content_decoder_new(stream->alloc, decompression->coding);
+        if (!decompression->decoder) {
+            return AWS_OP_ERR;
+        }
+    }
+
+    return aws_http_content_decoder_process(decompression->decoder, *data, s_on_decompressed_body, stream);
+}
+
+int aws_http_stream_on_incoming_body_done(struct aws_http_stream *stream) {
+    if (stream->incoming_body_decompression.decoder) {
+        return aws_http_content_decoder_finish(stream->incoming_body_decompression.decoder);
+    }
+    return AWS_OP_SUCCESS;
+}
+
+uint64_t aws_http_stream_get_incoming_body_compressed_size(const struct aws_http_stream *stream) {
+    return stream->incoming_body_decompression.compressed_size;
+}
+
 struct aws_http_stream *aws_http_connection_make_request(
     struct aws_http_connection *client_connection,
     const struct aws_http_make_request_options *options) {
@@ -839,6 +1123,28 @@ struct aws_http_stream *aws_http_connection_make_request(
         return NULL;
     }
 
+    if (options->decompress_response_body && !aws_http_content_coding_is_supported()) {
+        AWS_LOGF_ERROR(
+            AWS_LS_HTTP_CONNECTION,
+            "id=%p: Cannot create client request, decompression requested but aws-c-http was built without zlib.",
+            (void *)client_connection);
+        aws_raise_error(AWS_ERROR_UNSUPPORTED_OPERATION);
+        return NULL;
+    }
+
+    if (options->http2_priority && (options->http2_priority->urgency > AWS_HTTP2_PRIORITY_URGENCY_MAX ||
+                                    options->http2_priority->weight > AWS_HTTP2_PRIORITY_WEIGHT_MAX)) {
+        AWS_LOGF_ERROR(
+            AWS_LS_HTTP_CONNECTION,
+            "id=%p: Cannot create client request, HTTP/2 priority urgency %" PRIu8 " or weight %" PRIu16
+            " is out of range.",
+            (void *)client_connection,
+            options->http2_priority->urgency,
+            options->http2_priority->weight);
+        aws_raise_error(AWS_ERROR_INVALID_ARGUMENT);
+        return NULL;
+    }
+
     /* Connection owns stream, and must outlive stream */
     aws_http_connection_acquire(client_connection);
 
@@ -848,15 +1154,131 @@ struct aws_http_stream *aws_http_connection_make_request(
         return NULL;
     }
 
+    if (options->batch_response_headers) {
+        s_incoming_header_batch_init(stream);
+    }
+    stream->incoming_body_decompression.enabled = options->decompress_response_body;
+    stream->wait_for_body_ready = options->wait_for_body_ready;
+
     return stream;
 }
 
+int aws_http_connection_make_requests(
+    struct aws_http_connection *client_connection,
+    const struct aws_http_make_request_options *options_array,
+    size_t count,
+    struct aws_http_stream **out_streams) {
+
+    AWS_PRECONDITION(client_connection);
+    AWS_PRECONDITION(aws_http_connection_is_client(client_connection));
+    AWS_PRECONDITION(options_array || count == 0);
+    AWS_PRECONDITION(out_streams || count == 0);
+
+    for (size_t i = 0; i < count; ++i) {
+        out_streams[i] = NULL;
+    }
+
+    size_t num_created = 0;
+    for (; num_created < count; ++num_created) {
+        out_streams[num_created] = aws_http_connection_make_request(client_connection, &options_array[num_created]);
+        if (!out_streams[num_created]) {
+            goto error;
+        }
+    }
+
+    if (client_connection->vtable->activate_streams) {
+        if (client_connection->vtable->activate_streams(client_connection, out_streams, count)) {
+            goto error;
+        }
+    } else {
+        for (size_t i = 0; i < count; ++i) {
+            if (aws_http_stream_activate(out_streams[i])) {
+                goto error;
+            }
+        }
+    }
+
+    AWS_LOGF_DEBUG(AWS_LS_HTTP_CONNECTION, "id=%p: Made %zu requests in one batch.", (void *)client_connection, count);
+    return AWS_OP_SUCCESS;
+
+error:;
+    int error_code = aws_last_error();
+    AWS_LOGF_ERROR(
+        AWS_LS_HTTP_CONNECTION,
+        "id=%p: Failed to make batch of %zu requests, error %d (%s).",
+        (void *)client_connection,
+        count,
+        error_code,
+        aws_error_name(error_code));
+
+    for (size_t i = 0; i < num_created; ++i) {
+        aws_http_stream_release(out_streams[i]);
+        out_streams[i] = NULL;
+    }
+    return aws_raise_error(error_code);
+}
+
+/* Copy headers from an HTTP/1.1 message to an HTTP/2 message, with lowercase names,
+ * leaving out connection-specific headers that aren't allowed in HTTP/2 */
+static int s_copy_http1_headers_to_http2(
+    struct aws_http_headers *h2_headers,
+    const struct aws_http_headers *h1_headers,
+    struct aws_byte_buf *lower_name_buf) {
+
+    struct aws_http_header header_iter;
+    for (size_t iter = 0; iter < aws_http_headers_count(h1_headers); iter++) {
+        aws_byte_buf_reset(lower_name_buf, false);
+        bool copy_header = true;
+        /* name should be converted to lower case */
+        if (aws_http_headers_get_index(h1_headers, iter, &header_iter)) {
+            return AWS_OP_ERR;
+        }
+        /* append lower case name to the buffer */
+        aws_byte_buf_append_with_lookup(lower_name_buf, &header_iter.name, aws_lookup_table_to_lower_get());
+        struct aws_byte_cursor lower_name_cursor = aws_byte_cursor_from_buf(lower_name_buf);
+        enum aws_http_header_name name_enum = aws_http_lowercase_str_to_header_name(lower_name_cursor);
+        switch (name_enum) {
+            case AWS_HTTP_HEADER_TRANSFER_ENCODING:
+            case AWS_HTTP_HEADER_UPGRADE:
+            case AWS_HTTP_HEADER_KEEP_ALIVE:
+            case AWS_HTTP_HEADER_PROXY_CONNECTION:
+                /**
+                 * An intermediary transforming an HTTP/1.x message to HTTP/2 MUST remove connection-specific header
+                 * fields as discussed in Section 7.6.1 of [HTTP]. (RFC=9113 8.2.2)
+                 */
+                AWS_LOGF_TRACE(
+                    AWS_LS_HTTP_GENERAL,
+                    "Skip connection-specific headers - \"%.*s\" ",
+                    (int)lower_name_cursor.len,
+                    lower_name_cursor.ptr);
+                copy_header = false;
+                break;
+
+            default:
+                break;
+        }
+        if (copy_header) {
+            if (aws_http_headers_add(h2_headers, lower_name_cursor, header_iter.value)) {
+                return AWS_OP_ERR;
+            }
+            AWS_LOGF_TRACE(
+                AWS_LS_HTTP_GENERAL,
+                "Added header to new HTTP/2 header - \"%.*s\": \"%.*s\" ",
+                (int)lower_name_cursor.len,
+                lower_name_cursor.ptr,
+                (int)header_iter.value.len,
+                header_iter.value.ptr);
+        }
+    }
+
+    return AWS_OP_SUCCESS;
+}
+
 struct aws_http_message *aws_http2_message_new_from_http1(
     struct aws_allocator *alloc,
     const struct aws_http_message *http1_msg) {
 
     struct aws_http_headers *old_headers = aws_http_message_get_headers(http1_msg);
-    struct aws_http_header header_iter;
     struct aws_byte_buf lower_name_buf;
     AWS_ZERO_STRUCT(lower_name_buf);
     struct aws_http_message *message = aws_http_message_is_request(http1_msg) ? aws_http2_message_new_request(alloc)
@@ -912,8 +1334,14 @@ struct aws_http_message *aws_http2_message_new_from_http1(
          */
         struct aws_byte_cursor host_value;
         AWS_ZERO_STRUCT(host_value);
-        if (aws_http_headers_get(http1_msg->headers, aws_byte_cursor_from_c_str("host"), &host_value) ==
-            AWS_OP_SUCCESS) {
+        struct aws_byte_cursor host_name = aws_byte_cursor_from_c_str("host");
+        bool has_host = aws_http_headers_get(http1_msg->headers, host_name, &host_value) == AWS_OP_SUCCESS;
+        if (!has_host && http1_msg->request_template) {
+            /* A request made from a template probably got its host header from there */
+            const struct aws_http_headers *template_headers = http1_msg->request_template->headers;
+            has_host = aws_http_headers_get(template_headers, host_name, &host_value) == AWS_OP_SUCCESS;
+        }
+        if (has_host) {
             if (aws_http_headers_add(copied_headers, aws_http_header_authority, host_value)) {
                 goto error;
             }
@@ -973,49 +1401,15 @@ struct aws_http_message *aws_http2_message_new_from_http1(
     if (aws_byte_buf_init(&lower_name_buf, alloc, 256)) {
         goto error;
     }
-    for (size_t iter = 0; iter < aws_http_headers_count(old_headers); iter++) {
-        aws_byte_buf_reset(&lower_name_buf, false);
-        bool copy_header = true;
-        /* name should be converted to lower case */
-        if (aws_http_headers_get_index(old_headers, iter, &header_iter)) {
+    /* Headers from the request's template, if any, go before the request's own */
+    const struct aws_http_request_template *request_template = http1_msg->request_template;
+    if (request_template && request_template->version == AWS_HTTP_VERSION_1_1) {
+        if (s_copy_http1_headers_to_http2(copied_headers, request_template->headers, &lower_name_buf)) {
             goto error;
         }
-        /* append lower case name to the buffer */
-        aws_byte_buf_append_with_lookup(&lower_name_buf, &header_iter.name, aws_lookup_table_to_lower_get());
-        struct aws_byte_cursor lower_name_cursor = aws_byte_cursor_from_buf(&lower_name_buf);
-        enum aws_http_header_name name_enum = aws_http_lowercase_str_to_header_name(lower_name_cursor);
-        switch (name_enum) {
-            case AWS_HTTP_HEADER_TRANSFER_ENCODING:
-            case AWS_HTTP_HEADER_UPGRADE:
-            case AWS_HTTP_HEADER_KEEP_ALIVE:
-            case AWS_HTTP_HEADER_PROXY_CONNECTION:
-                /**
-                 * An intermediary transforming an HTTP/1.x message to HTTP/2 MUST remove connection-specific header
-                 * fields as discussed in Section 7.6.1 of [HTTP]. (RFC=9113 8.2.2)
-                 */
-                AWS_LOGF_TRACE(
-                    AWS_LS_HTTP_GENERAL,
-                    "Skip connection-specific headers - \"%.*s\" ",
-                    (int)lower_name_cursor.len,
-                    lower_name_cursor.ptr);
-                copy_header = false;
-                break;
-
-            default:
-                break;
-        }
-        if (copy_header) {
-            if (aws_http_headers_add(copied_headers, lower_name_cursor, header_iter.value)) {
-                goto error;
-            }
-            AWS_LOGF_TRACE(
-                AWS_LS_HTTP_GENERAL,
-                "Added header to new HTTP/2 header - \"%.*s\": \"%.*s\" ",
-                (int)lower_name_cursor.len,
-                lower_name_cursor.ptr,
-                (int)header_iter.value.len,
-                header_iter.value.ptr);
-        }
+    }
+    if (s_copy_http1_headers_to_http2(copied_headers, old_headers, &lower_name_buf)) {
+        goto error;
     }
     aws_byte_buf_clean_up(&lower_name_buf);
     aws_http_message_set_body_stream(message, aws_http_message_get_body_stream(http1_msg));
@@ -1051,7 +1445,17 @@ struct aws_http_stream *aws_http_stream_new_server_request_handler(
         return NULL;
     }
 
-    return options->server_connection->vtable->new_server_request_handler_stream(options);
+    struct aws_http_stream *stream = options->server_connection->vtable->new_server_request_handler_stream(options);
+    if (!stream) {
+        return NULL;
+    }
+
+    if (options->batch_request_headers) {
+        s_incoming_header_batch_init(stream);
+    }
+    stream->wait_for_body_ready = options->wait_for_body_ready;
+
+    return stream;
 }
 
 int aws_http_stream_send_response(struct aws_http_stream *stream, struct aws_http_message *response) {
@@ -1074,6 +1478,8 @@ void aws_http_stream_release(struct aws_http_stream *stream) {
         aws_http_on_stream_destroy_fn *on_destroy_callback = stream->on_destroy;
 
         struct aws_http_connection *owning_connection = stream->owning_connection;
+        s_incoming_header_batch_clean_up(stream);
+        aws_http_content_decoder_destroy(stream->incoming_body_decompression.decoder);
         stream->vtable->destroy(stream);
 
         if (on_destroy_callback) {
@@ -1132,6 +1538,11 @@ int aws_http_stream_get_incoming_request_uri(const struct aws_http_stream *strea
     return AWS_OP_SUCCESS;
 }
 
+void aws_http_stream_notify_body_ready(struct aws_http_stream *stream) {
+    AWS_PRECONDITION(stream);
+    stream->vtable->notify_body_ready(stream);
+}
+
 void aws_http_stream_update_window(struct aws_http_stream *stream, size_t increment_size) {
     stream->vtable->update_window(stream, increment_size);
 }
@@ -0,0 +1,182 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/http/private/request_template.h>
+
+#include <aws/http/private/hpack.h>
+#include <aws/http/private/strutil.h>
+
+#include <aws/common/logging.h>
+#include <aws/common/string.h>
+
+/* Initial size for the HPACK buffer, it grows as needed */
+static const size_t s_hpack_initial_size = 256;
+
+static void s_request_template_destroy(struct aws_http_request_template *request_template) {
+    aws_string_destroy(request_template->method);
+    aws_http_headers_release(request_template->headers);
+    aws_byte_buf_clean_up(&request_template->encoded_headers);
+    aws_mem_release(request_template->allocator, request_template);
+}
+
+/* Copy headers, leaving out any that vary per-request */
+static int s_copy_headers(
+    struct aws_http_headers *dst,
+    const struct aws_http_headers *src,
+    enum aws_http_version version,
+    bool *seen_regular_header) {
+
+    const size_t num_headers = aws_http_headers_count(src);
+    for (size_t i = 0; i < num_headers; ++i) {
+        struct aws_http_header header;
+        aws_http_headers_get_index(src, i, &header);
+
+        if (version == AWS_HTTP_VERSION_2) {
+            bool is_pseudo_header = header.name.len > 0 && header.name.ptr[0] == ':';
+            if (is_pseudo_header) {
+                /* The cached encoding is copied after each request's own pseudo-headers,
+                 * so all of the template's pseudo-headers must come before its regular headers */
+                if (*seen_regular_header) {
+                    AWS_LOGF_ERROR(
+                        AWS_LS_HTTP_GENERAL, "id=static: Request template has pseudo-header after regular header");
+                    return aws_raise_error(AWS_ERROR_HTTP_INVALID_HEADER_FIELD);
+                }
+                if (aws_byte_cursor_eq(&header.name, &aws_http_header_path)) {
+                    continue;
+                }
+            } else {
+                *seen_regular_header = true;
+            }
+        }
+
+        if (aws_http_headers_add_header(dst, &header)) {
+            return AWS_OP_ERR;
+        }
+    }
+
+    return AWS_OP_SUCCESS;
+}
+
+static int s_encode_h2_headers(struct aws_http_request_template *request_template) {
+    /* A fresh encoder has an empty dynamic table, so the encoding only references the static table */
+    struct aws_hpack_encoder hpack;
+    aws_hpack_encoder_init(&hpack, request_template->allocator, request_template);
+
+    int result = AWS_OP_ERR;
+    if (aws_byte_buf_init(&request_template->encoded_headers, request_template->allocator, s_hpack_initial_size)) {
+        goto done;
+    }
+
+    if (aws_hpack_encode_header_block_without_indexing(
+            &hpack, request_template->headers, &request_template->encoded_headers)) {
+        goto done;
+    }
+
+    result = AWS_OP_SUCCESS;
+done:
+    aws_hpack_encoder_clean_up(&hpack);
+    return result;
+}
+
+struct aws_http_request_template *aws_http_request_template_new(
+    struct aws_allocator *allocator,
+    const struct aws_http_message *prototype) {
+
+    AWS_PRECONDITION(allocator);
+    AWS_PRECONDITION(prototype);
+
+    if (!aws_http_message_is_request(prototype)) {
+        aws_raise_error(AWS_ERROR_INVALID_ARGUMENT);
+        return NULL;
+    }
+
+    struct aws_byte_cursor method;
+    if (aws_http_message_get_request_method(prototype, &method) || !aws_strutil_is_http_token(method)) {
+        AWS_LOGF_ERROR(AWS_LS_HTTP_GENERAL, "id=static: Request template needs a valid method");
+        aws_raise_error(AWS_ERROR_HTTP_INVALID_METHOD);
+        return NULL;
+    }
+
+    struct aws_http_request_template *request_template =
+        aws_mem_calloc(allocator, 1, sizeof(struct aws_http_request_template));
+    request_template->allocator = allocator;
+    aws_atomic_init_int(&request_template->refcount, 1);
+    request_template->version = aws_http_message_get_protocol_version(prototype);
+
+    request_template->method = aws_string_new_from_cursor(allocator, &method);
+    request_template->headers = aws_http_headers_new(allocator);
+    if (!request_template->method || !request_template->headers) {
+        goto error;
+    }
+
+    /* If the prototype was itself made from a template, its headers start with that template's */
+    bool seen_regular_header = false;
+    const struct aws_http_request_template *prototype_template = aws_http_message_get_request_template(prototype);
+    if (prototype_template) {
+        if (s_copy_headers(
+                request_template->headers,
+                prototype_template->headers,
+                request_template->version,
+                &seen_regular_header)) {
+            goto error;
+        }
+    }
+    if (s_copy_headers(
+            request_template->headers,
+            aws_http_message_get_const_headers(prototype),
+            request_template->version,
+            &seen_regular_header)) {
+        goto error;
+    }
+
+    switch (request_template->version) {
+        case AWS_HTTP_VERSION_1_1:
+            if (aws_h1_encoder_encode_template_header_lines(
+                    allocator,
+                    request_template->headers,
+                    &request_template->h1_scan,
+                    &request_template->encoded_headers)) {
+                goto error;
+            }
+            break;
+        case AWS_HTTP_VERSION_2:
+            if (s_encode_h2_headers(request_template)) {
+                goto error;
+            }
+            break;
+        default:
+            aws_raise_error(AWS_ERROR_HTTP_UNSUPPORTED_PROTOCOL);
+            goto error;
+    }
+
+    return request_template;
+
+error:
+    s_request_template_destroy(request_template);
+    return NULL;
+}
+
+struct aws_http_request_template *aws_http_request_template_acquire(
+    struct aws_http_request_template *request_template) {
+
+    if (request_template != NULL) {
+        aws_atomic_fetch_add(&request_template->refcount, 1);
+    }
+    return request_template;
+}
+
+struct aws_http_request_template *aws_http_request_template_release(
+    struct aws_http_request_template *request_template) {
+
+    if (request_template != NULL) {
+        size_t prev_refcount = aws_atomic_fetch_sub(&request_template->refcount, 1);
+        if (prev_refcount == 1) {
+            s_request_template_destroy(request_template);
+        } else {
+            AWS_ASSERT(prev_refcount != 0);
+        }
+    }
+    return NULL;
+}
@@ -114,6 +114,7 @@ static int s_on_body(struct aws_http_stream *stream, const struct aws_byte_curso
     struct client_stream_tester *tester = user_data;
     ASSERT_FALSE(tester->complete);
     ASSERT_SUCCESS(aws_byte_buf_append_dynamic(&tester->response_body, data));
+    tester->num_response_body_calls++;
     return AWS_OP_SUCCESS;
 }
 
@@ -175,6 +176,9 @@ int client_stream_tester_init(
         .on_response_body = s_on_body,
         .on_complete = s_on_complete,
         .on_destroy = s_on_destroy,
+        .decompress_response_body = options->decompress_response_body,
+        .wait_for_body_ready = options->wait_for_body_ready,
+        .http2_priority = options->http2_priority,
     };
     tester->stream = aws_http_connection_make_request(options->connection, &request_options);
     ASSERT_NOT_NULL(tester->stream);
@@ -37,6 +37,7 @@ struct client_stream_tester {
     bool response_trailer_done;
 
     struct aws_byte_buf response_body;
+    size_t num_response_body_calls;
 
     bool complete;
     int on_complete_error_code;
@@ -50,6 +51,9 @@ struct client_stream_tester {
 struct client_stream_tester_options {
     struct aws_http_message *request;
     struct aws_http_connection *connection;
+    bool decompress_response_body;
+    bool wait_for_body_ready;
+    const struct aws_http2_stream_priority *http2_priority;
 };
 
 int client_stream_tester_init(
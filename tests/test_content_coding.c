@@ -0,0 +1,220 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/http/private/content_coding.h>
+#include <aws/http/request_response.h>
+#include <aws/io/stream.h>
+#include <aws/testing/aws_test_harness.h>
+
+#define CONTENT_CODING_TEST_CASE(NAME)                                                                                 \
+    AWS_TEST_CASE(NAME, s_test_##NAME);                                                                                \
+    static int s_test_##NAME(struct aws_allocator *allocator, void *ctx)
+
+static const struct aws_byte_cursor s_plain_body = AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL(
+    "Cross-region traffic is text heavy. Cross-region traffic is text heavy. Cross-region traffic is text heavy.");
+
+static int s_append_output(const struct aws_byte_cursor *data, void *user_data) {
+    struct aws_byte_buf *output = user_data;
+    return aws_byte_buf_append_dynamic(output, data);
+}
+
+/* Read the whole stream into buf */
+static int s_drain_stream(struct aws_input_stream *stream, struct aws_byte_buf *buf) {
+    struct aws_stream_status status = {.is_valid = true};
+    while (!status.is_end_of_stream) {
+        ASSERT_SUCCESS(aws_byte_buf_reserve_relative(buf, 16));
+        ASSERT_SUCCESS(aws_input_stream_read(stream, buf));
+        ASSERT_SUCCESS(aws_input_stream_get_status(stream, &status));
+        ASSERT_TRUE(status.is_valid);
+    }
+    return AWS_OP_SUCCESS;
+}
+
+static int s_test_round_trip(struct aws_allocator *allocator, enum aws_http_content_coding coding, bool buffered) {
+    struct aws_input_stream *source = aws_input_stream_new_from_cursor(allocator, &s_plain_body);
+    ASSERT_NOT_NULL(source);
+    struct aws_input_stream *encoder = aws_http_content_encoder_stream_new(allocator, source, coding, buffered);
+    ASSERT_NOT_NULL(encoder);
+    /* encoder holds its own reference */
+    aws_input_stream_release(source);
+
+    struct aws_byte_buf compressed;
+    ASSERT_SUCCESS(aws_byte_buf_init(&compressed, allocator, 0));
+    ASSERT_SUCCESS(s_drain_stream(encoder, &compressed));
+    ASSERT_TRUE(compressed.len < s_plain_body.len);
+
+    int64_t length = 0;
+    if (buffered) {
+        ASSERT_SUCCESS(aws_input_stream_get_length(encoder, &length));
+        ASSERT_UINT_EQUALS(compressed.len, (uint64_t)length);
+    } else {
+        ASSERT_ERROR(AWS_ERROR_UNSUPPORTED_OPERATION, aws_input_stream_get_length(encoder, &length));
+    }
+    aws_input_stream_release(encoder);
+
+    /* Decode it 1 byte at a time */
+    struct aws_http_content_decoder *decoder = aws_http_content_decoder_new(allocator, coding);
+    ASSERT_NOT_NULL(decoder);
+    struct aws_byte_buf decompressed;
+    ASSERT_SUCCESS(aws_byte_buf_init(&decompressed, allocator, 0));
+    for (size_t i = 0; i < compressed.len; ++i) {
+        struct aws_byte_cursor one_byte = aws_byte_cursor_from_array(compressed.buffer + i, 1);
+        ASSERT_SUCCESS(aws_http_content_decoder_process(decoder, one_byte, s_append_output, &decompressed));
+    }
+    ASSERT_SUCCESS(aws_http_content_decoder_finish(decoder));
+    ASSERT_BIN_ARRAYS_EQUALS(s_plain_body.ptr, s_plain_body.len, decompressed.buffer, decompressed.len);
+
+    aws_http_content_decoder_destroy(decoder);
+    aws_byte_buf_clean_up(&decompressed);
+    aws_byte_buf_clean_up(&compressed);
+    return AWS_OP_SUCCESS;
+}
+
+CONTENT_CODING_TEST_CASE(content_coding_round_trip) {
+    (void)ctx;
+    if (!aws_http_content_coding_is_supported()) {
+        ASSERT_NULL(aws_http_content_decoder_new(allocator, AWS_HTTP_CONTENT_CODING_GZIP));
+        ASSERT_INT_EQUALS(AWS_ERROR_UNSUPPORTED_OPERATION, aws_last_error());
+        return AWS_OP_SUCCESS;
+    }
+
+    ASSERT_SUCCESS(s_test_round_trip(allocator, AWS_HTTP_CONTENT_CODING_GZIP, false /*buffered*/));
+    ASSERT_SUCCESS(s_test_round_trip(allocator, AWS_HTTP_CONTENT_CODING_GZIP, true /*buffered*/));
+    ASSERT_SUCCESS(s_test_round_trip(allocator, AWS_HTTP_CONTENT_CODING_DEFLATE, false /*buffered*/));
+    ASSERT_SUCCESS(s_test_round_trip(allocator, AWS_HTTP_CONTENT_CODING_DEFLATE, true /*buffered*/));
+    return AWS_OP_SUCCESS;
+}
+
+/* Some servers send "deflate" without the zlib wrapper, and gzip bodies may contain several members */
+CONTENT_CODING_TEST_CASE(content_coding_decode_variants) {
+    (void)ctx;
+    if (!aws_http_content_coding_is_supported()) {
+        return AWS_OP_SUCCESS;
+    }
+
+    /* deflate "raw deflate body" with no zlib header */
+    static const uint8_t s_raw_deflate[] = {
+        0x2b, 0x4a, 0x2c, 0x57, 0x48, 0x49, 0x4d, 0xcb, 0x49, 0x2c, 0x49, 0x55, 0x48, 0xca, 0x4f, 0xa9, 0x04, 0x00,
+    };
+    struct aws_byte_buf output;
+    ASSERT_SUCCESS(aws_byte_buf_init(&output, allocator, 0));
+
+    struct aws_http_content_decoder *decoder = aws_http_content_decoder_new(allocator, AWS_HTTP_CONTENT_CODING_DEFLATE);
+    ASSERT_NOT_NULL(decoder);
+    ASSERT_SUCCESS(aws_http_content_decoder_process(
+        decoder, aws_byte_cursor_from_array(s_raw_deflate, sizeof(s_raw_deflate)), s_append_output, &output));
+    ASSERT_SUCCESS(aws_http_content_decoder_finish(decoder));
+    ASSERT_BIN_ARRAYS_EQUALS("raw deflate body", strlen("raw deflate body"), output.buffer, output.len);
+    aws_http_content_decoder_destroy(decoder);
+
+    /* Same again, 1 byte at a time, so the data that isn't a zlib header arrives in separate calls */
+    aws_byte_buf_reset(&output, false);
+    decoder = aws_http_content_decoder_new(allocator, AWS_HTTP_CONTENT_CODING_DEFLATE);
+    ASSERT_NOT_NULL(decoder);
+    for (size_t i = 0; i < sizeof(s_raw_deflate); ++i) {
+        struct aws_byte_cursor one_byte = aws_byte_cursor_from_array(s_raw_deflate + i, 1);
+        ASSERT_SUCCESS(aws_http_content_decoder_process(decoder, one_byte, s_append_output, &output));
+    }
+    ASSERT_SUCCESS(aws_http_content_decoder_finish(decoder));
+    ASSERT_BIN_ARRAYS_EQUALS("raw deflate body", strlen("raw deflate body"), output.buffer, output.len);
+    aws_http_content_decoder_destroy(decoder);
+
+    /* gzip "first " + gzip "second" */
+    static const uint8_t s_two_members[] = {
+        0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x4b, 0xcb, 0x2c, 0x2a, 0x2e, 0x51, 0x00,
+        0x00, 0xfc, 0x7a, 0xf1, 0x1c, 0x06, 0x00, 0x00, 0x00, 0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x02, 0x03, 0x2b, 0x4e, 0x4d, 0xce, 0xcf, 0x4b, 0x01, 0x00, 0x69, 0x11, 0x1f, 0xb6, 0x06, 0x00, 0x00,
+        0x00,
+    };
+    aws_byte_buf_reset(&output, false);
+    decoder = aws_http_content_decoder_new(allocator, AWS_HTTP_CONTENT_CODING_GZIP);
+    ASSERT_NOT_NULL(decoder);
+    ASSERT_SUCCESS(aws_http_content_decoder_process(
+        decoder, aws_byte_cursor_from_array(s_two_members, sizeof(s_two_members)), s_append_output, &output));
+    ASSERT_SUCCESS(aws_http_content_decoder_finish(decoder));
+    ASSERT_BIN_ARRAYS_EQUALS("first second", strlen("first second"), output.buffer, output.len);
+    aws_http_content_decoder_destroy(decoder);
+
+    /* Truncated body must fail */
+    aws_byte_buf_reset(&output, false);
+    decoder = aws_http_content_decoder_new(allocator, AWS_HTTP_CONTENT_CODING_GZIP);
+    ASSERT_NOT_NULL(decoder);
+    ASSERT_SUCCESS(aws_http_content_decoder_process(
+        decoder, aws_byte_cursor_from_array(s_two_members, 20), s_append_output, &output));
+    ASSERT_ERROR(AWS_ERROR_HTTP_CONTENT_DECODING_FAILURE, aws_http_content_decoder_finish(decoder));
+    aws_http_content_decoder_destroy(decoder);
+
+    /* Garbage must fail */
+    decoder = aws_http_content_decoder_new(allocator, AWS_HTTP_CONTENT_CODING_GZIP);
+    ASSERT_NOT_NULL(decoder);
+    ASSERT_ERROR(
+        AWS_ERROR_HTTP_CONTENT_DECODING_FAILURE,
+        aws_http_content_decoder_process(decoder, s_plain_body, s_append_output, &output));
+    aws_http_content_decoder_destroy(decoder);
+
+    aws_byte_buf_clean_up(&output);
+    return AWS_OP_SUCCESS;
+}
+
+/* HTTP/1 messages get a Content-Length for the compressed body, HTTP/2 messages stream it */
+CONTENT_CODING_TEST_CASE(content_coding_message_compress_body) {
+    (void)ctx;
+    aws_http_library_init(allocator);
+
+    struct aws_input_stream *body = aws_input_stream_new_from_cursor(allocator, &s_plain_body);
+    ASSERT_NOT_NULL(body);
+
+    struct aws_http_message *request = aws_http_message_new_request(allocator);
+    ASSERT_NOT_NULL(request);
+    struct aws_http_header content_length = {
+        .name = aws_byte_cursor_from_c_str("Content-Length"),
+        .value = aws_byte_cursor_from_c_str("107"),
+    };
+    ASSERT_SUCCESS(aws_http_message_add_header(request, content_length));
+    aws_http_message_set_body_stream(request, body);
+
+    if (!aws_http_content_coding_is_supported()) {
+        ASSERT_ERROR(
+            AWS_ERROR_UNSUPPORTED_OPERATION, aws_http_message_compress_body(request, AWS_HTTP_CONTENT_CODING_GZIP));
+        goto done;
+    }
+
+    ASSERT_SUCCESS(aws_http_message_compress_body(request, AWS_HTTP_CONTENT_CODING_GZIP));
+    struct aws_http_headers *headers = aws_http_message_get_headers(request);
+    struct aws_byte_cursor value;
+    ASSERT_SUCCESS(aws_http_headers_get(headers, aws_byte_cursor_from_c_str("Content-Encoding"), &value));
+    ASSERT_TRUE(aws_byte_cursor_eq_c_str(&value, "gzip"));
+
+    struct aws_input_stream *compressed = aws_http_message_get_body_stream(request);
+    ASSERT_TRUE(compressed != body);
+    int64_t compressed_length = 0;
+    ASSERT_SUCCESS(aws_input_stream_get_length(compressed, &compressed_length));
+    uint64_t content_length_value = 0;
+    ASSERT_SUCCESS(aws_http_headers_get(headers, aws_byte_cursor_from_c_str("Content-Length"), &value));
+    ASSERT_SUCCESS(aws_byte_cursor_utf8_parse_u64(value, &content_length_value));
+    ASSERT_UINT_EQUALS((uint64_t)compressed_length, content_length_value);
+
+    /* Can't compress twice */
+    ASSERT_ERROR(AWS_ERROR_INVALID_STATE, aws_http_message_compress_body(request, AWS_HTTP_CONTENT_CODING_DEFLATE));
+
+    /* HTTP/2 */
+    struct aws_http_message *h2_request = aws_http2_message_new_request(allocator);
+    ASSERT_NOT_NULL(h2_request);
+    content_length.name = aws_byte_cursor_from_c_str("content-length");
+    ASSERT_SUCCESS(aws_http_message_add_header(h2_request, content_length));
+    aws_http_message_set_body_stream(h2_request, body);
+    ASSERT_SUCCESS(aws_http_message_compress_body(h2_request, AWS_HTTP_CONTENT_CODING_DEFLATE));
+    headers = aws_http_message_get_headers(h2_request);
+    ASSERT_FALSE(aws_http_headers_has(headers, aws_byte_cursor_from_c_str("content-length")));
+    ASSERT_SUCCESS(aws_http_headers_get(headers, aws_byte_cursor_from_c_str("content-encoding"), &value));
+    ASSERT_TRUE(aws_byte_cursor_eq_c_str(&value, "deflate"));
+    aws_http_message_release(h2_request);
+
+done:
+    aws_http_message_release(request);
+    aws_input_stream_release(body);
+    aws_http_library_clean_up();
+    return AWS_OP_SUCCESS;
+}
@@ -5,6 +5,7 @@
 
 #include "stream_test_helper.h"
 #include <aws/common/uuid.h>
+#include <aws/http/private/content_coding.h>
 #include <aws/http/private/h1_connection.h>
 #include <aws/http/request_response.h>
 #include <aws/http/status_code.h>
@@ -233,6 +234,104 @@ H1_CLIENT_TEST_CASE(h1_client_request_send_headers) {
     return AWS_OP_SUCCESS;
 }
 
+H1_CLIENT_TEST_CASE(h1_client_request_send_from_template) {
+    (void)ctx;
+    struct tester tester;
+    ASSERT_SUCCESS(s_tester_init(&tester, allocator));
+
+    /* make template */
+    struct aws_http_header template_headers[] = {
+        {
+            .name = AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("Host"),
+            .value = AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("example.com"),
+        },
+        {
+            .name = AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("User-Agent"),
+            .value = AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("test"),
+        },
+    };
+    struct aws_http_message *prototype = aws_http_message_new_request(allocator);
+    ASSERT_NOT_NULL(prototype);
+    ASSERT_SUCCESS(aws_http_message_set_request_method(prototype, aws_http_method_get));
+    ASSERT_SUCCESS(aws_http_message_add_header_array(prototype, template_headers, AWS_ARRAY_SIZE(template_headers)));
+    struct aws_http_request_template *request_template = aws_http_request_template_new(allocator, prototype);
+    ASSERT_NOT_NULL(request_template);
+    aws_http_message_release(prototype);
+
+    /* send requests made from the template */
+    struct aws_http_message *requests[2];
+    struct aws_http_stream *streams[2];
+    for (size_t i = 0; i < AWS_ARRAY_SIZE(requests); ++i) {
+        requests[i] = aws_http_message_new_request_from_template(allocator, request_template);
+        ASSERT_NOT_NULL(requests[i]);
+        ASSERT_SUCCESS(aws_http_message_set_request_path(
+            requests[i], i == 0 ? aws_byte_cursor_from_c_str("/a") : aws_byte_cursor_from_c_str("/b")));
+        if (i == 1) {
+            /* the request's own headers come after the template's */
+            struct aws_http_header extra_header = {
+                .name = AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("X-Id"),
+                .value = AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("2"),
+            };
+            ASSERT_SUCCESS(aws_http_message_add_header(requests[i], extra_header));
+        }
+
+        struct aws_byte_cursor method;
+        ASSERT_SUCCESS(aws_http_message_get_request_method(requests[i], &method));
+        ASSERT_TRUE(aws_byte_cursor_eq_c_str(&method, "GET"));
+
+        struct aws_http_make_request_options opt = {
+            .self_size = sizeof(opt),
+            .request = requests[i],
+        };
+        streams[i] = aws_http_connection_make_request(tester.connection, &opt);
+        ASSERT_NOT_NULL(streams[i]);
+        ASSERT_SUCCESS(aws_http_stream_activate(streams[i]));
+    }
+    /* the template outlives its use by the requests */
+    aws_http_request_template_release(request_template);
+
+    testing_channel_drain_queued_tasks(&tester.testing_channel);
+
+    /* check result */
+    const char *expected = "GET /a HTTP/1.1\r\n"
+                           "Host: example.com\r\n"
+                           "User-Agent: test\r\n"
+                           "\r\n"
+                           "GET /b HTTP/1.1\r\n"
+                           "Host: example.com\r\n"
+                           "User-Agent: test\r\n"
+                           "X-Id: 2\r\n"
+                           "\r\n";
+    ASSERT_SUCCESS(testing_channel_check_written_messages_str(&tester.testing_channel, allocator, expected));
+
+    /* clean up */
+    for (size_t i = 0; i < AWS_ARRAY_SIZE(requests); ++i) {
+        aws_http_message_release(requests[i]);
+        aws_http_stream_release(streams[i]);
+    }
+
+    ASSERT_SUCCESS(s_tester_clean_up(&tester));
+    return AWS_OP_SUCCESS;
+}
+
+H1_CLIENT_TEST_CASE(h1_client_request_template_rejects_bad_header) {
+    (void)ctx;
+    struct aws_http_message *prototype = aws_http_message_new_request(allocator);
+    ASSERT_NOT_NULL(prototype);
+    ASSERT_SUCCESS(aws_http_message_set_request_method(prototype, aws_http_method_get));
+    struct aws_http_header bad_header = {
+        .name = AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("Bad Name"),
+        .value = AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("value"),
+    };
+    ASSERT_SUCCESS(aws_http_message_add_header(prototype, bad_header));
+
+    ASSERT_NULL(aws_http_request_template_new(allocator, prototype));
+    ASSERT_INT_EQUALS(AWS_ERROR_HTTP_INVALID_HEADER_NAME, aws_last_error());
+
+    aws_http_message_release(prototype);
+    return AWS_OP_SUCCESS;
+}
+
 H1_CLIENT_TEST_CASE(h1_client_request_send_body) {
     (void)ctx;
     struct tester tester;
@@ -326,6 +425,72 @@ H1_CLIENT_TEST_CASE(h1_client_request_send_body_chunked) {
     return AWS_OP_SUCCESS;
 }
 
+H1_CLIENT_TEST_CASE(h1_client_request_send_chunks_batched) {
+    (void)ctx;
+    struct tester tester;
+    ASSERT_SUCCESS(s_tester_init(&tester, allocator));
+
+    /* send request */
+    struct aws_http_message *request = s_new_default_chunked_put_request(allocator);
+    struct aws_http_make_request_options opt = {
+        .self_size = sizeof(opt),
+        .request = request,
+    };
+    struct aws_http_stream *stream = aws_http_connection_make_request(tester.connection, &opt);
+    ASSERT_NOT_NULL(stream);
+    ASSERT_SUCCESS(aws_http_stream_activate(stream));
+
+    static const struct aws_byte_cursor bodies[] = {
+        AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("write "),
+        AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("more "),
+        AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("tests"),
+        AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL(""),
+    };
+    struct aws_http1_chunk_options options[AWS_ARRAY_SIZE(bodies)];
+    for (size_t i = 0; i < AWS_ARRAY_SIZE(bodies); ++i) {
+        struct aws_input_stream *body_stream = aws_input_stream_new_from_cursor(allocator, &bodies[i]);
+        ASSERT_NOT_NULL(body_stream);
+        options[i] = s_default_chunk_options(body_stream, bodies[i].len);
+    }
+
+    /* A final chunk anywhere but the end is rejected, and nothing is submitted */
+    struct aws_http1_chunk_options misplaced_final[] = {options[3], options[0]};
+    ASSERT_FAILS(aws_http1_stream_write_chunks(stream, misplaced_final, AWS_ARRAY_SIZE(misplaced_final)));
+    ASSERT_INT_EQUALS(AWS_ERROR_INVALID_ARGUMENT, aws_last_error());
+
+    /* Send all chunks in one call */
+    ASSERT_SUCCESS(aws_http1_stream_write_chunks(stream, options, AWS_ARRAY_SIZE(options)));
+    testing_channel_drain_queued_tasks(&tester.testing_channel);
+
+    /* check result */
+    const char *expected = "PUT /plan.txt HTTP/1.1\r\n"
+                           "Transfer-Encoding: chunked\r\n"
+                           "\r\n"
+                           "6\r\n"
+                           "write "
+                           "\r\n"
+                           "5\r\n"
+                           "more "
+                           "\r\n"
+                           "5\r\n"
+                           "tests"
+                           "\r\n"
+                           "0\r\n"
+                           "\r\n";
+
+    ASSERT_SUCCESS(testing_channel_check_written_messages_str(&tester.testing_channel, allocator, expected));
+
+    /* No chunks may follow the final chunk */
+    ASSERT_FAILS(aws_http1_stream_write_chunks(stream, options, 1));
+
+    /* clean up */
+    aws_http_message_destroy(request);
+    aws_http_stream_release(stream);
+
+    ASSERT_SUCCESS(s_tester_clean_up(&tester));
+    return AWS_OP_SUCCESS;
+}
+
 int chunked_test_helper(
     const struct aws_byte_cursor *body,
     struct aws_http_headers *trailers,
@@ -1247,6 +1412,85 @@ H1_CLIENT_TEST_CASE(h1_client_request_send_large_body) {
     return AWS_OP_SUCCESS;
 }
 
+static void s_on_memory_body_released(void *user_data) {
+    bool *released = user_data;
+    *released = true;
+}
+
+/* Send a request whose body is large and memory-backed, so it is sent by reference rather than copied */
+H1_CLIENT_TEST_CASE(h1_client_request_send_memory_body) {
+    (void)ctx;
+    struct tester tester;
+    ASSERT_SUCCESS(s_tester_init(&tester, allocator));
+
+    /* body spans several by-reference messages, with a partial one at the end */
+    size_t body_len = 1024 * 1024 * 3 + 7;
+    struct aws_byte_buf body_buf;
+    ASSERT_SUCCESS(aws_byte_buf_init(&body_buf, allocator, body_len));
+    while (body_buf.len < body_len) {
+        aws_byte_buf_write_u8(&body_buf, (uint8_t)rand());
+    }
+
+    bool body_released = false;
+    struct aws_input_stream *body_stream = aws_http_body_stream_new_from_memory(
+        allocator, aws_byte_cursor_from_buf(&body_buf), s_on_memory_body_released, &body_released);
+    ASSERT_NOT_NULL(body_stream);
+
+    char content_length_value[100];
+    snprintf(content_length_value, sizeof(content_length_value), "%zu", body_len);
+    struct aws_http_header headers[] = {
+        {
+            .name = aws_byte_cursor_from_c_str("Content-Length"),
+            .value = aws_byte_cursor_from_c_str(content_length_value),
+        },
+    };
+
+    struct aws_http_message *request = aws_http_message_new_request(allocator);
+    ASSERT_NOT_NULL(request);
+    ASSERT_SUCCESS(aws_http_message_set_request_method(request, aws_byte_cursor_from_c_str("PUT")));
+    ASSERT_SUCCESS(aws_http_message_set_request_path(request, aws_byte_cursor_from_c_str("/large.txt")));
+    aws_http_message_add_header_array(request, headers, AWS_ARRAY_SIZE(headers));
+    aws_http_message_set_body_stream(request, body_stream);
+
+    struct aws_http_make_request_options opt = {
+        .self_size = sizeof(opt),
+        .request = request,
+    };
+    struct aws_http_stream *stream = aws_http_connection_make_request(tester.connection, &opt);
+    ASSERT_NOT_NULL(stream);
+    ASSERT_SUCCESS(aws_http_stream_activate(stream));
+
+    /* check result */
+    const char *expected_head_fmt = "PUT /large.txt HTTP/1.1\r\n"
+                                    "Content-Length: %zu\r\n"
+                                    "\r\n";
+    char expected_head[1024];
+    int expected_head_len = snprintf(expected_head, sizeof(expected_head), expected_head_fmt, body_len);
+
+    struct aws_byte_buf expected_buf;
+    ASSERT_SUCCESS(aws_byte_buf_init(&expected_buf, allocator, body_len + expected_head_len));
+    ASSERT_TRUE(aws_byte_buf_write(&expected_buf, (uint8_t *)expected_head, expected_head_len));
+    ASSERT_TRUE(aws_byte_buf_write_from_whole_buffer(&expected_buf, body_buf));
+
+    testing_channel_drain_queued_tasks(&tester.testing_channel);
+    ASSERT_SUCCESS(testing_channel_check_written_messages(
+        &tester.testing_channel, allocator, aws_byte_cursor_from_buf(&expected_buf)));
+
+    /* clean up */
+    aws_input_stream_release(body_stream);
+    aws_http_message_destroy(request);
+    aws_http_stream_release(stream);
+
+    ASSERT_SUCCESS(s_tester_clean_up(&tester));
+
+    /* the written messages referenced the body, it must only be released once they're all gone */
+    ASSERT_TRUE(body_released);
+
+    aws_byte_buf_clean_up(&body_buf);
+    aws_byte_buf_clean_up(&expected_buf);
+    return AWS_OP_SUCCESS;
+}
+
 static int s_parse_chunked_extensions(
     const char *extensions,
     struct aws_http1_chunk_extension *expected_extensions,
@@ -1897,6 +2141,188 @@ H1_CLIENT_TEST_CASE(h1_client_response_get_headers) {
     return AWS_OP_SUCCESS;
 }
 
+struct batched_headers_tester {
+    size_t num_header_calls;
+    size_t num_block_done_calls;
+    /* Header blocks delivered in batched mode. Cursors point into the stream, not copies */
+    enum aws_http_header_block blocks[2];
+    struct aws_http_header headers[2][4];
+    size_t num_headers[2];
+};
+
+static int s_batched_on_headers(
+    struct aws_http_stream *stream,
+    enum aws_http_header_block header_block,
+    const struct aws_http_header *header_array,
+    size_t num_headers,
+    void *user_data) {
+
+    (void)stream;
+    struct batched_headers_tester *batch_tester = user_data;
+    size_t block_i = batch_tester->num_header_calls++;
+    ASSERT_TRUE(block_i < AWS_ARRAY_SIZE(batch_tester->blocks));
+    ASSERT_TRUE(num_headers <= AWS_ARRAY_SIZE(batch_tester->headers[0]));
+
+    batch_tester->blocks[block_i] = header_block;
+    batch_tester->num_headers[block_i] = num_headers;
+    for (size_t i = 0; i < num_headers; ++i) {
+        batch_tester->headers[block_i][i] = header_array[i];
+    }
+    return AWS_OP_SUCCESS;
+}
+
+static int s_batched_on_header_block_done(
+    struct aws_http_stream *stream,
+    enum aws_http_header_block header_block,
+    void *user_data) {
+
+    (void)stream;
+    (void)header_block;
+    struct batched_headers_tester *batch_tester = user_data;
+    /* Headers must have been delivered before the block is marked done */
+    ASSERT_UINT_EQUALS(++batch_tester->num_block_done_calls, batch_tester->num_header_calls);
+    return AWS_OP_SUCCESS;
+}
+
+/* With batch_response_headers, each header block arrives in 1 callback and its strings outlive the block */
+H1_CLIENT_TEST_CASE(h1_client_response_get_batched_headers) {
+    (void)ctx;
+    struct tester tester;
+    ASSERT_SUCCESS(s_tester_init(&tester, allocator));
+
+    struct batched_headers_tester batch_tester;
+    AWS_ZERO_STRUCT(batch_tester);
+
+    struct aws_http_make_request_options opt = {
+        .self_size = sizeof(opt),
+        .request = s_new_default_get_request(allocator),
+        .user_data = &batch_tester,
+        .on_response_headers = s_batched_on_headers,
+        .on_response_header_block_done = s_batched_on_header_block_done,
+        .batch_response_headers = true,
+    };
+    struct aws_http_stream *stream = aws_http_connection_make_request(tester.connection, &opt);
+    ASSERT_NOT_NULL(stream);
+    ASSERT_SUCCESS(aws_http_stream_activate(stream));
+
+    testing_channel_drain_queued_tasks(&tester.testing_channel);
+
+    /* send response, split mid-header so the decoder's buffers are reused before the block is done */
+    ASSERT_SUCCESS(testing_channel_push_read_str(
+        &tester.testing_channel,
+        "HTTP/1.1 100 Continue\r\n"
+        "Hint: one\r\n"
+        "\r\n"
+        "HTTP/1.1 200 OK\r\n"
+        "Date: Fri, 01 Mar 2019 17:18:55 GMT\r\n"
+        "Loca"));
+    testing_channel_drain_queued_tasks(&tester.testing_channel);
+    ASSERT_UINT_EQUALS(1, batch_tester.num_header_calls);
+
+    ASSERT_SUCCESS(testing_channel_push_read_str(
+        &tester.testing_channel,
+        "tion: /index.html\r\n"
+        "Empty:\r\n"
+        "Content-Length: 0\r\n"
+        "\r\n"));
+    testing_channel_drain_queued_tasks(&tester.testing_channel);
+
+    /* check result */
+    ASSERT_UINT_EQUALS(2, batch_tester.num_header_calls);
+    ASSERT_UINT_EQUALS(2, batch_tester.num_block_done_calls);
+
+    ASSERT_INT_EQUALS(AWS_HTTP_HEADER_BLOCK_INFORMATIONAL, batch_tester.blocks[0]);
+    ASSERT_UINT_EQUALS(1, batch_tester.num_headers[0]);
+    ASSERT_TRUE(aws_byte_cursor_eq_c_str(&batch_tester.headers[0][0].name, "Hint"));
+    ASSERT_TRUE(aws_byte_cursor_eq_c_str(&batch_tester.headers[0][0].value, "one"));
+
+    ASSERT_INT_EQUALS(AWS_HTTP_HEADER_BLOCK_MAIN, batch_tester.blocks[1]);
+    ASSERT_UINT_EQUALS(4, batch_tester.num_headers[1]);
+    ASSERT_TRUE(aws_byte_cursor_eq_c_str(&batch_tester.headers[1][0].name, "Date"));
+    ASSERT_TRUE(aws_byte_cursor_eq_c_str(&batch_tester.headers[1][0].value, "Fri, 01 Mar 2019 17:18:55 GMT"));
+    ASSERT_TRUE(aws_byte_cursor_eq_c_str(&batch_tester.headers[1][1].name, "Location"));
+    ASSERT_TRUE(aws_byte_cursor_eq_c_str(&batch_tester.headers[1][1].value, "/index.html"));
+    ASSERT_TRUE(aws_byte_cursor_eq_c_str(&batch_tester.headers[1][2].name, "Empty"));
+    ASSERT_UINT_EQUALS(0, batch_tester.headers[1][2].value.len);
+    ASSERT_TRUE(aws_byte_cursor_eq_c_str(&batch_tester.headers[1][3].name, "Content-Length"));
+    ASSERT_TRUE(aws_byte_cursor_eq_c_str(&batch_tester.headers[1][3].value, "0"));
+
+    /* clean up */
+    aws_http_message_destroy(opt.request);
+    aws_http_stream_release(stream);
+
+    ASSERT_SUCCESS(s_tester_clean_up(&tester));
+    return AWS_OP_SUCCESS;
+}
+
+/* With decompress_response_body, a gzip body is inflated before reaching the body callback */
+H1_CLIENT_TEST_CASE(h1_client_response_decompress_gzip_body) {
+    (void)ctx;
+    struct tester tester;
+    ASSERT_SUCCESS(s_tester_init(&tester, allocator));
+
+    if (!aws_http_content_coding_is_supported()) {
+        struct aws_http_make_request_options opt = {
+            .self_size = sizeof(opt),
+            .request = s_new_default_get_request(allocator),
+            .decompress_response_body = true,
+        };
+        ASSERT_NULL(aws_http_connection_make_request(tester.connection, &opt));
+        ASSERT_INT_EQUALS(AWS_ERROR_UNSUPPORTED_OPERATION, aws_last_error());
+        aws_http_message_destroy(opt.request);
+        ASSERT_SUCCESS(s_tester_clean_up(&tester));
+        return AWS_OP_SUCCESS;
+    }
+
+    struct aws_http_message *request = s_new_default_get_request(allocator);
+    struct client_stream_tester stream_tester;
+    struct client_stream_tester_options stream_options = {
+        .request = request,
+        .connection = tester.connection,
+        .decompress_response_body = true,
+    };
+    ASSERT_SUCCESS(client_stream_tester_init(&stream_tester, allocator, &stream_options));
+    testing_channel_drain_queued_tasks(&tester.testing_channel);
+
+    /* gzip of "Hello, compressed world! " repeated 4 times */
+    static const uint8_t s_gzip_body[] = {
+        0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xf3, 0x48, 0xcd, 0xc9, 0xc9, 0xd7,
+        0x51, 0x48, 0xce, 0xcf, 0x2d, 0x28, 0x4a, 0x2d, 0x2e, 0x4e, 0x4d, 0x51, 0x28, 0xcf, 0x2f, 0xca,
+        0x49, 0x51, 0x54, 0xf0, 0xa0, 0x9e, 0x04, 0x00, 0x76, 0x7c, 0x97, 0xfc, 0x64, 0x00, 0x00, 0x00,
+    };
+
+    /* send response in 2 chunks, so the compressed data is split */
+    ASSERT_SUCCESS(testing_channel_push_read_str(
+        &tester.testing_channel,
+        "HTTP/1.1 200 OK\r\n"
+        "Content-Encoding: gzip\r\n"
+        "Transfer-Encoding: chunked\r\n"
+        "\r\n"
+        "14\r\n"));
+    ASSERT_SUCCESS(testing_channel_push_read_data(
+        &tester.testing_channel, aws_byte_cursor_from_array(s_gzip_body, 0x14)));
+    ASSERT_SUCCESS(testing_channel_push_read_str(&tester.testing_channel, "\r\n1C\r\n"));
+    ASSERT_SUCCESS(testing_channel_push_read_data(
+        &tester.testing_channel, aws_byte_cursor_from_array(s_gzip_body + 0x14, sizeof(s_gzip_body) - 0x14)));
+    ASSERT_SUCCESS(testing_channel_push_read_str(&tester.testing_channel, "\r\n0\r\n\r\n"));
+    testing_channel_drain_queued_tasks(&tester.testing_channel);
+
+    /* check result */
+    ASSERT_TRUE(stream_tester.complete);
+    ASSERT_INT_EQUALS(AWS_ERROR_SUCCESS, stream_tester.on_complete_error_code);
+    ASSERT_INT_EQUALS(200, stream_tester.response_status);
+    ASSERT_TRUE(aws_byte_buf_eq_c_str(
+        &stream_tester.response_body,
+        "Hello, compressed world! Hello, compressed world! Hello, compressed world! Hello, compressed world! "));
+    ASSERT_UINT_EQUALS(sizeof(s_gzip_body), aws_http_stream_get_incoming_body_compressed_size(stream_tester.stream));
+
+    /* clean up */
+    aws_http_message_destroy(request);
+    client_stream_tester_clean_up(&stream_tester);
+    ASSERT_SUCCESS(s_tester_clean_up(&tester));
+    return AWS_OP_SUCCESS;
+}
+
 H1_CLIENT_TEST_CASE(h1_client_response_get_body) {
     (void)ctx;
     struct tester tester;
@@ -2343,6 +2769,92 @@ H1_CLIENT_TEST_CASE(h1_client_response_arrives_before_request_done_sending_is_ok
     return AWS_OP_SUCCESS;
 }
 
+/* With wait_for_body_ready, a stalled body is not polled every tick.
+ * It's only read again after aws_http_stream_notify_body_ready() */
+H1_CLIENT_TEST_CASE(h1_client_request_waits_for_body_ready) {
+    (void)ctx;
+    struct tester tester;
+    ASSERT_SUCCESS(s_tester_init(&tester, allocator));
+
+    /* set up request whose body won't send immediately */
+    struct aws_input_stream empty_stream_base;
+    AWS_ZERO_STRUCT(empty_stream_base);
+    struct slow_body_sender body_sender = {
+        .base = empty_stream_base,
+        .status =
+            {
+                .is_end_of_stream = false,
+                .is_valid = true,
+            },
+        .cursor = AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("write more tests"),
+        .delay_ticks = 3,
+    };
+    body_sender.base.vtable = &s_slow_stream_vtable;
+    aws_ref_count_init(
+        &body_sender.base.ref_count, &body_sender, (aws_simple_completion_callback *)s_slow_stream_destroy);
+
+    struct aws_input_stream *body_stream = &body_sender.base;
+
+    struct aws_http_header headers[] = {
+        {
+            .name = aws_byte_cursor_from_c_str("Content-Length"),
+            .value = aws_byte_cursor_from_c_str("16"),
+        },
+    };
+
+    struct aws_http_message *request = aws_http_message_new_request(allocator);
+    ASSERT_NOT_NULL(request);
+    ASSERT_SUCCESS(aws_http_message_set_request_method(request, aws_byte_cursor_from_c_str("PUT")));
+    ASSERT_SUCCESS(aws_http_message_set_request_path(request, aws_byte_cursor_from_c_str("/plan.txt")));
+    ASSERT_SUCCESS(aws_http_message_add_header_array(request, headers, AWS_ARRAY_SIZE(headers)));
+    aws_http_message_set_body_stream(request, body_stream);
+
+    struct client_stream_tester stream_tester;
+    struct client_stream_tester_options stream_options = {
+        .request = request,
+        .connection = tester.connection,
+        .wait_for_body_ready = true,
+    };
+    ASSERT_SUCCESS(client_stream_tester_init(&stream_tester, allocator, &stream_options));
+
+    /* Draining would never finish if the stalled body were polled.
+     * The body is read while writing the head, and once more after the head is written, then never again */
+    testing_channel_drain_queued_tasks(&tester.testing_channel);
+    ASSERT_UINT_EQUALS(1, body_sender.delay_ticks);
+    ASSERT_SUCCESS(testing_channel_check_written_messages_str(
+        &tester.testing_channel,
+        allocator,
+        "PUT /plan.txt HTTP/1.1\r\n"
+        "Content-Length: 16\r\n"
+        "\r\n"));
+
+    /* Each notification results in one more read */
+    aws_http_stream_notify_body_ready(stream_tester.stream);
+    testing_channel_drain_queued_tasks(&tester.testing_channel);
+    ASSERT_UINT_EQUALS(0, body_sender.delay_ticks);
+
+    while (body_sender.cursor.len > 0) {
+        aws_http_stream_notify_body_ready(stream_tester.stream);
+        testing_channel_drain_queued_tasks(&tester.testing_channel);
+    }
+
+    ASSERT_SUCCESS(testing_channel_check_written_messages_str(&tester.testing_channel, allocator, "write more tests"));
+
+    /* send response */
+    ASSERT_SUCCESS(testing_channel_push_read_str(&tester.testing_channel, "HTTP/1.1 200 OK\r\n\r\n"));
+    testing_channel_drain_queued_tasks(&tester.testing_channel);
+
+    ASSERT_TRUE(stream_tester.complete);
+    ASSERT_INT_EQUALS(AWS_ERROR_SUCCESS, stream_tester.on_complete_error_code);
+
+    /* clean up */
+    aws_http_message_destroy(request);
+    aws_input_stream_release(body_stream);
+    client_stream_tester_clean_up(&stream_tester);
+    ASSERT_SUCCESS(s_tester_clean_up(&tester));
+    return AWS_OP_SUCCESS;
+}
+
 /* It should be fine to receive a response before the request has finished sending */
 H1_CLIENT_TEST_CASE(h1_client_response_arrives_before_request_chunks_done_sending_is_ok) {
     (void)ctx;
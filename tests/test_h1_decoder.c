@@ -849,3 +849,137 @@ static int s_h1_test_ignore_chunk_extensions(struct aws_allocator *allocator, vo
     s_test_clean_up();
     return AWS_OP_SUCCESS;
 }
+
+struct s_header_value_params {
+    size_t index;
+    const char **names;
+    const char **values;
+    size_t count;
+};
+
+static int s_got_header_value(const struct aws_h1_decoded_header *header, void *user_data) {
+    struct s_header_value_params *params = user_data;
+    if (params->index >= params->count ||
+        !aws_byte_cursor_eq_c_str(&header->name_data, params->names[params->index]) ||
+        !aws_byte_cursor_eq_c_str(&header->value_data, params->values[params->index])) {
+        return aws_raise_error(AWS_ERROR_UNKNOWN);
+    }
+    params->index++;
+    return AWS_OP_SUCCESS;
+}
+
+/* Delimiters are found while scanning for CRLF (16 bytes at a time where SIMD is available).
+ * Ensure they're found correctly when they straddle block boundaries and fragments of input. */
+AWS_TEST_CASE(h1_test_line_delimiters_across_fragments, s_h1_test_line_delimiters_across_fragments);
+static int s_h1_test_line_delimiters_across_fragments(struct aws_allocator *allocator, void *ctx) {
+    (void)ctx;
+    s_test_init(allocator);
+    const struct aws_byte_cursor request =
+        AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("GET /path/with:colon/and/a/long/segment HTTP/1.1\r\n"
+                                              "Host: amazon.com\r\n"
+                                              "X-A-Header-Name-Longer-Than-Sixteen: value:with:colons and  spaces\r\n"
+                                              "x:y\r\n"
+                                              "Empty-Value:\r\n"
+                                              "\r\n");
+
+    const char *names[] = {"Host", "X-A-Header-Name-Longer-Than-Sixteen", "x", "Empty-Value"};
+    const char *values[] = {"amazon.com", "value:with:colons and  spaces", "y", ""};
+
+    /* Decode the message split into 2 fragments, at every possible split point */
+    for (size_t split = 0; split <= request.len; ++split) {
+        struct s_header_value_params header_params = {
+            .names = names,
+            .values = values,
+            .count = AWS_ARRAY_SIZE(names),
+        };
+        struct request_data request_data;
+
+        struct aws_h1_decoder_params params;
+        s_common_decoder_setup(allocator, 4, &params, s_request, &header_params);
+        params.vtable.on_header = s_got_header_value;
+        struct aws_h1_decoder *decoder = aws_h1_decoder_new(&params);
+
+        struct aws_byte_cursor msg = request;
+        struct aws_byte_cursor fragment = aws_byte_cursor_advance(&msg, split);
+        ASSERT_SUCCESS(aws_h1_decode(decoder, &fragment));
+        ASSERT_SUCCESS(aws_h1_decode(decoder, &msg));
+        ASSERT_UINT_EQUALS(AWS_ARRAY_SIZE(names), header_params.index);
+
+        aws_h1_decoder_destroy(decoder);
+
+        /* Run it again, checking the request-line */
+        s_common_decoder_setup(allocator, 4, &params, s_request, &request_data);
+        params.vtable.on_request = s_on_request;
+        decoder = aws_h1_decoder_new(&params);
+
+        msg = request;
+        fragment = aws_byte_cursor_advance(&msg, split);
+        ASSERT_SUCCESS(aws_h1_decode(decoder, &fragment));
+        ASSERT_SUCCESS(aws_h1_decode(decoder, &msg));
+        ASSERT_TRUE(aws_byte_cursor_eq_c_str(&request_data.method_str, "GET"));
+        ASSERT_TRUE(aws_byte_cursor_eq_c_str(&request_data.uri, "/path/with:colon/and/a/long/segment"));
+
+        aws_h1_decoder_destroy(decoder);
+    }
+
+    s_test_clean_up();
+    return AWS_OP_SUCCESS;
+}
+
+/* With `retain_input`, partial lines are referenced rather than copied.
+ * Ensure lines are only copied when they actually span multiple inputs, and that stats count the copies. */
+AWS_TEST_CASE(h1_test_retain_input_defers_line_copies, s_h1_test_retain_input_defers_line_copies);
+static int s_h1_test_retain_input_defers_line_copies(struct aws_allocator *allocator, void *ctx) {
+    (void)ctx;
+    s_test_init(allocator);
+
+    const char *names[] = {"Host", "Accept-Language", "Content-Length"};
+    const char *values[] = {"amazon.com", "fr", "0"};
+    struct s_header_value_params header_params = {
+        .names = names,
+        .values = values,
+        .count = AWS_ARRAY_SIZE(names),
+    };
+
+    struct aws_h1_decoder_params params;
+    s_common_decoder_setup(allocator, 4, &params, s_request, &header_params);
+    params.vtable.on_header = s_got_header_value;
+    params.retain_input = true;
+    struct aws_h1_decoder *decoder = aws_h1_decoder_new(&params);
+
+    /* Each fragment lives in its own buffer, like separate aws_io_messages */
+    const char *fragments[] = {
+        "GET / HTTP/1.1\r\nHost: amazon.com\r\n", /* only whole lines, no copies */
+        "Accept-Lan",                              /* partial line, referenced */
+        "guage",                                   /* still partial */
+        ": fr\r\nContent-Length: 0\r\n\r\n",       /* line completes, must be copied */
+    };
+
+    struct aws_byte_cursor fragment = aws_byte_cursor_from_c_str(fragments[0]);
+    ASSERT_SUCCESS(aws_h1_decode(decoder, &fragment));
+    ASSERT_FALSE(aws_h1_decoder_is_referencing_input(decoder));
+    ASSERT_UINT_EQUALS(0, aws_h1_decoder_get_stats(decoder).scratch_bytes_copied);
+
+    fragment = aws_byte_cursor_from_c_str(fragments[1]);
+    ASSERT_SUCCESS(aws_h1_decode(decoder, &fragment));
+    ASSERT_TRUE(aws_h1_decoder_is_referencing_input(decoder));
+
+    fragment = aws_byte_cursor_from_c_str(fragments[2]);
+    ASSERT_SUCCESS(aws_h1_decode(decoder, &fragment));
+    ASSERT_TRUE(aws_h1_decoder_is_referencing_input(decoder));
+    ASSERT_UINT_EQUALS(0, aws_h1_decoder_get_stats(decoder).scratch_bytes_copied);
+
+    fragment = aws_byte_cursor_from_c_str(fragments[3]);
+    ASSERT_SUCCESS(aws_h1_decode(decoder, &fragment));
+    ASSERT_FALSE(aws_h1_decoder_is_referencing_input(decoder));
+    ASSERT_UINT_EQUALS(AWS_ARRAY_SIZE(names), header_params.index);
+
+    /* Only "Accept-Language: fr\r\n" was copied */
+    struct aws_h1_decoder_stats stats = aws_h1_decoder_get_stats(decoder);
+    ASSERT_UINT_EQUALS(strlen("Accept-Language: fr\r\n"), stats.scratch_bytes_copied);
+    ASSERT_UINT_EQUALS(1, stats.split_lines);
+
+    aws_h1_decoder_destroy(decoder);
+    s_test_clean_up();
+    return AWS_OP_SUCCESS;
+}
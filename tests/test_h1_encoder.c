@@ -564,3 +564,44 @@ H1_ENCODER_TEST_CASE(h1_encoder_rejects_bad_header_value) {
         AWS_ARRAY_SIZE(headers) /*header_count*/,
         AWS_ERROR_HTTP_INVALID_HEADER_VALUE /*expected_error*/);
 }
+
+H1_ENCODER_TEST_CASE(h1_encoder_chunk_pool_reuses_chunks) {
+    (void)ctx;
+    s_test_init(allocator);
+
+    struct aws_h1_chunk_pool pool;
+    aws_h1_chunk_pool_init(&pool, allocator);
+
+    struct aws_byte_cursor data = aws_byte_cursor_from_c_str("chunk data");
+    struct aws_input_stream *data_stream = aws_input_stream_new_from_cursor(allocator, &data);
+    ASSERT_NOT_NULL(data_stream);
+    struct aws_http1_chunk_options options = {
+        .chunk_data = data_stream,
+        .chunk_data_size = data.len,
+    };
+
+    struct aws_h1_chunk *chunk = aws_h1_chunk_pool_acquire(&pool, &options);
+    ASSERT_NOT_NULL(chunk);
+    ASSERT_BIN_ARRAYS_EQUALS("A\r\n", 3, chunk->chunk_line.buffer, chunk->chunk_line.len);
+
+    /* A destroyed chunk can't be reused until it's reclaimed */
+    aws_h1_chunk_destroy(chunk);
+    ASSERT_UINT_EQUALS(1, pool.num_returned);
+    ASSERT_UINT_EQUALS(0, pool.num_available);
+    aws_h1_chunk_pool_reclaim(&pool);
+    ASSERT_UINT_EQUALS(0, pool.num_returned);
+    ASSERT_UINT_EQUALS(1, pool.num_available);
+
+    struct aws_h1_chunk *reused = aws_h1_chunk_pool_acquire(&pool, &options);
+    ASSERT_PTR_EQUALS(chunk, reused);
+    ASSERT_UINT_EQUALS(0, pool.num_available);
+
+    /* A chunk that was never used goes straight back */
+    aws_h1_chunk_pool_put_back(&pool, reused);
+    ASSERT_UINT_EQUALS(1, pool.num_available);
+
+    aws_h1_chunk_pool_clean_up(&pool);
+    aws_input_stream_release(data_stream);
+    s_test_clean_up();
+    return AWS_OP_SUCCESS;
+}
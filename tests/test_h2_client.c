@@ -78,6 +78,8 @@ static struct tester {
     struct connection_user_data user_data;
 
     bool no_conn_manual_win_management;
+    bool window_auto_tuning;
+    bool coalesce_incoming_body;
 } s_tester;
 
 static int s_tester_init(struct aws_allocator *alloc, void *ctx) {
@@ -102,6 +104,8 @@ static int s_tester_init(struct aws_allocator *alloc, void *ctx) {
         .on_goaway_received = s_on_goaway_received,
         .on_remote_settings_change = s_on_remote_settings_change,
         .conn_manual_window_management = !s_tester.no_conn_manual_win_management,
+        .window_auto_tuning = s_tester.window_auto_tuning,
+        .coalesce_incoming_body = s_tester.coalesce_incoming_body,
     };
 
     s_tester.connection =
@@ -515,6 +519,76 @@ TEST_CASE(h2_client_close) {
     return s_tester_clean_up();
 }
 
+/* aws_http_connection_make_requests() should activate the whole batch, and send all HEADERS frames together */
+TEST_CASE(h2_client_make_requests_batch) {
+    ASSERT_SUCCESS(s_tester_init(allocator, ctx));
+
+    /* fake peer sends connection preface */
+    ASSERT_SUCCESS(h2_fake_peer_send_connection_preface_default_settings(&s_tester.peer));
+    testing_channel_drain_queued_tasks(&s_tester.testing_channel);
+    ASSERT_SUCCESS(h2_fake_peer_decode_messages_from_testing_channel(&s_tester.peer));
+    size_t frames_before = h2_decode_tester_frame_count(&s_tester.peer.decode);
+
+    struct aws_http_message *request = aws_http2_message_new_request(allocator);
+    ASSERT_NOT_NULL(request);
+
+    struct aws_http_header request_headers_src[] = {
+        DEFINE_HEADER(":method", "GET"),
+        DEFINE_HEADER(":scheme", "https"),
+        DEFINE_HEADER(":path", "/"),
+    };
+    aws_http_message_add_header_array(request, request_headers_src, AWS_ARRAY_SIZE(request_headers_src));
+
+    enum { NUM_REQUESTS = 10 };
+    struct aws_http_make_request_options options_array[NUM_REQUESTS];
+    for (size_t i = 0; i < NUM_REQUESTS; ++i) {
+        struct aws_http_make_request_options options = {
+            .self_size = sizeof(options),
+            .request = request,
+        };
+        options_array[i] = options;
+    }
+
+    struct aws_http_stream *streams[NUM_REQUESTS];
+    ASSERT_SUCCESS(aws_http_connection_make_requests(s_tester.connection, options_array, NUM_REQUESTS, streams));
+    for (size_t i = 0; i < NUM_REQUESTS; ++i) {
+        ASSERT_NOT_NULL(streams[i]);
+        ASSERT_UINT_EQUALS(1 + i * 2, aws_http_stream_get_id(streams[i]));
+    }
+
+    /* validate that every HEADERS frame went out in a single message */
+    testing_channel_drain_queued_tasks(&s_tester.testing_channel);
+    struct aws_linked_list *written_msgs = testing_channel_get_written_message_queue(&s_tester.testing_channel);
+    ASSERT_FALSE(aws_linked_list_empty(written_msgs));
+    ASSERT_PTR_EQUALS(aws_linked_list_begin(written_msgs), aws_linked_list_rbegin(written_msgs));
+
+    ASSERT_SUCCESS(h2_fake_peer_decode_messages_from_testing_channel(&s_tester.peer));
+    ASSERT_UINT_EQUALS(frames_before + NUM_REQUESTS, h2_decode_tester_frame_count(&s_tester.peer.decode));
+    for (size_t i = 0; i < NUM_REQUESTS; ++i) {
+        struct h2_decoded_frame *sent_headers_frame =
+            h2_decode_tester_get_frame(&s_tester.peer.decode, frames_before + i);
+        ASSERT_INT_EQUALS(AWS_H2_FRAME_T_HEADERS, sent_headers_frame->type);
+        ASSERT_UINT_EQUALS(1 + i * 2, sent_headers_frame->stream_id);
+        ASSERT_TRUE(sent_headers_frame->end_stream);
+    }
+
+    /* once the connection is closed, a batch fails as a whole */
+    aws_http_connection_close(s_tester.connection);
+    struct aws_http_stream *failed_streams[NUM_REQUESTS];
+    ASSERT_FAILS(aws_http_connection_make_requests(s_tester.connection, options_array, NUM_REQUESTS, failed_streams));
+    for (size_t i = 0; i < NUM_REQUESTS; ++i) {
+        ASSERT_NULL(failed_streams[i]);
+    }
+
+    /* clean up */
+    testing_channel_drain_queued_tasks(&s_tester.testing_channel);
+    for (size_t i = 0; i < NUM_REQUESTS; ++i) {
+        aws_http_stream_release(streams[i]);
+    }
+    aws_http_message_release(request);
+    return s_tester_clean_up();
+}
+
 /* Test that client automatically sends the HTTP/2 Connection Preface (magic string, followed by initial SETTINGS frame,
  * which we disabled the push_promise) And it will not be applied until the SETTINGS ack is received. Once SETTINGS ack
  * received, the initial settings will be applied and callback will be invoked */
@@ -657,6 +731,85 @@ TEST_CASE(h2_client_stream_with_h1_request_message) {
     return s_tester_clean_up();
 }
 
+/* Test that requests made from a template send the template's headers after their own pseudo-headers,
+ * and that the template's cached encoding stays valid as the connection's HPACK state changes */
+TEST_CASE(h2_client_stream_from_template) {
+    ASSERT_SUCCESS(s_tester_init(allocator, ctx));
+
+    /* fake peer sends connection preface */
+    ASSERT_SUCCESS(h2_fake_peer_send_connection_preface_default_settings(&s_tester.peer));
+    testing_channel_drain_queued_tasks(&s_tester.testing_channel);
+
+    /* make template */
+    struct aws_http_message *prototype = aws_http2_message_new_request(allocator);
+    ASSERT_NOT_NULL(prototype);
+    struct aws_http_header template_headers_src[] = {
+        DEFINE_HEADER(":method", "GET"),
+        DEFINE_HEADER(":scheme", "https"),
+        DEFINE_HEADER(":authority", "example.com"),
+        DEFINE_HEADER("user-agent", "test"),
+    };
+    ASSERT_SUCCESS(
+        aws_http_message_add_header_array(prototype, template_headers_src, AWS_ARRAY_SIZE(template_headers_src)));
+    struct aws_http_request_template *request_template = aws_http_request_template_new(allocator, prototype);
+    ASSERT_NOT_NULL(request_template);
+    aws_http_message_release(prototype);
+
+    const char *paths[] = {"/a", "/b"};
+    for (size_t i = 0; i < AWS_ARRAY_SIZE(paths); ++i) {
+        /* send request made from template */
+        struct aws_http_message *request = aws_http_message_new_request_from_template(allocator, request_template);
+        ASSERT_NOT_NULL(request);
+        ASSERT_SUCCESS(aws_http_message_set_request_path(request, aws_byte_cursor_from_c_str(paths[i])));
+        struct aws_http_header request_header = DEFINE_HEADER("x-id", "1");
+        ASSERT_SUCCESS(aws_http_message_add_header(request, request_header));
+
+        struct client_stream_tester stream_tester;
+        ASSERT_SUCCESS(s_stream_tester_init(&stream_tester, request));
+
+        /* validate sent request. Template's literals are never added to the dynamic table */
+        struct aws_http_header expected_headers_src[] = {
+            {
+                .name = aws_byte_cursor_from_c_str(":path"),
+                .value = aws_byte_cursor_from_c_str(paths[i]),
+            },
+            DEFINE_HEADER(":method", "GET"),
+            DEFINE_HEADER(":scheme", "https"),
+            {
+                .name = aws_byte_cursor_from_c_str(":authority"),
+                .value = aws_byte_cursor_from_c_str("example.com"),
+                .compression = AWS_HTTP_HEADER_COMPRESSION_NO_CACHE,
+            },
+            {
+                .name = aws_byte_cursor_from_c_str("user-agent"),
+                .value = aws_byte_cursor_from_c_str("test"),
+                .compression = AWS_HTTP_HEADER_COMPRESSION_NO_CACHE,
+            },
+            DEFINE_HEADER("x-id", "1"),
+        };
+        struct aws_http_headers *expected_headers = aws_http_headers_new(allocator);
+        ASSERT_SUCCESS(
+            aws_http_headers_add_array(expected_headers, expected_headers_src, AWS_ARRAY_SIZE(expected_headers_src)));
+
+        testing_channel_drain_queued_tasks(&s_tester.testing_channel);
+        ASSERT_SUCCESS(h2_fake_peer_decode_messages_from_testing_channel(&s_tester.peer));
+
+        struct h2_decoded_frame *sent_headers_frame = h2_decode_tester_latest_frame(&s_tester.peer.decode);
+        ASSERT_INT_EQUALS(AWS_H2_FRAME_T_HEADERS, sent_headers_frame->type);
+        ASSERT_UINT_EQUALS(aws_http_stream_get_id(stream_tester.stream), sent_headers_frame->stream_id);
+        ASSERT_TRUE(sent_headers_frame->end_stream);
+        ASSERT_SUCCESS(s_compare_headers(expected_headers, sent_headers_frame->headers));
+
+        aws_http_headers_release(expected_headers);
+        aws_http_message_release(request);
+        client_stream_tester_clean_up(&stream_tester);
+    }
+
+    /* clean up */
+    aws_http_request_template_release(request_template);
+    return s_tester_clean_up();
+}
+
 /* Test that h2 stream can split the cookies header correctly */
 TEST_CASE(h2_client_stream_with_cookies_headers) {
     ASSERT_SUCCESS(s_tester_init(allocator, ctx));
@@ -1791,6 +1944,116 @@ TEST_CASE(h2_client_stream_send_lots_of_data) {
     return s_tester_clean_up();
 }
 
+/* Test that DATA from more urgent streams is sent first, regardless of the order streams were made in,
+ * and that a non-incremental stream sends all its DATA before the next stream of the same urgency starts */
+TEST_CASE(h2_client_stream_send_data_by_priority) {
+    ASSERT_SUCCESS(s_tester_init(allocator, ctx));
+
+    /* get connection preface and acks out of the way */
+    ASSERT_SUCCESS(h2_fake_peer_send_connection_preface_default_settings(&s_tester.peer));
+    testing_channel_drain_queued_tasks(&s_tester.testing_channel);
+    ASSERT_SUCCESS(h2_fake_peer_decode_messages_from_testing_channel(&s_tester.peer));
+    const size_t preface_frame_count = h2_decode_tester_frame_count(&s_tester.peer.decode);
+
+    /* bodies span multiple frames. Each fits in the initial stream window, open up the connection window to fit all */
+    size_t body_size = aws_h2_settings_initial[AWS_HTTP2_SETTINGS_MAX_FRAME_SIZE] + 1000;
+    uint32_t window_increment = aws_h2_settings_initial[AWS_HTTP2_SETTINGS_INITIAL_WINDOW_SIZE];
+    struct aws_h2_frame *connection_window_update = aws_h2_frame_new_window_update(allocator, 0, window_increment);
+    ASSERT_SUCCESS(h2_fake_peer_send_frame(&s_tester.peer, connection_window_update));
+    testing_channel_drain_queued_tasks(&s_tester.testing_channel);
+
+    /* streams are listed in the order they're made, and sorted by the order their DATA should be sent */
+    enum { NUM_STREAMS = 4 };
+    struct aws_http2_stream_priority priorities[NUM_STREAMS] = {
+        {.urgency = 7, .incremental = true},
+        {.urgency = AWS_HTTP2_PRIORITY_URGENCY_DEFAULT, .incremental = false},
+        {.urgency = AWS_HTTP2_PRIORITY_URGENCY_DEFAULT, .incremental = false},
+        {.urgency = 0, .incremental = false},
+    };
+    size_t expected_send_order[NUM_STREAMS] = {3, 1, 2, 0};
+
+    struct aws_http_message *requests[NUM_STREAMS];
+    struct aws_http_header request_headers_src[] = {
+        DEFINE_HEADER(":method", "POST"),
+        DEFINE_HEADER(":scheme", "https"),
+        DEFINE_HEADER(":path", "/"),
+    };
+    requests[0] = aws_http2_message_new_request(allocator);
+    ASSERT_SUCCESS(
+        aws_http_message_add_header_array(requests[0], request_headers_src, AWS_ARRAY_SIZE(request_headers_src)));
+    /* out of range priority is rejected */
+    struct aws_http2_stream_priority bad_priority = {.urgency = AWS_HTTP2_PRIORITY_URGENCY_MAX + 1};
+    struct aws_http_make_request_options bad_options = {
+        .self_size = sizeof(bad_options),
+        .request = requests[0],
+        .http2_priority = &bad_priority,
+    };
+    ASSERT_NULL(aws_http_connection_make_request(s_tester.connection, &bad_options));
+    ASSERT_INT_EQUALS(AWS_ERROR_INVALID_ARGUMENT, aws_last_error());
+    aws_http_message_release(requests[0]);
+
+    struct aws_byte_buf request_body_bufs[NUM_STREAMS];
+    struct aws_input_stream *request_bodies[NUM_STREAMS];
+    struct client_stream_tester stream_testers[NUM_STREAMS];
+    for (size_t i = 0; i < NUM_STREAMS; ++i) {
+        requests[i] = aws_http2_message_new_request(allocator);
+        ASSERT_SUCCESS(
+            aws_http_message_add_header_array(requests[i], request_headers_src, AWS_ARRAY_SIZE(request_headers_src)));
+
+        ASSERT_SUCCESS(aws_byte_buf_init(&request_body_bufs[i], allocator, body_size));
+        ASSERT_TRUE(aws_byte_buf_write_u8_n(&request_body_bufs[i], (uint8_t)('a' + i), body_size));
+        struct aws_byte_cursor body_cursor = aws_byte_cursor_from_buf(&request_body_bufs[i]);
+        request_bodies[i] = aws_input_stream_new_from_cursor(allocator, &body_cursor);
+        ASSERT_NOT_NULL(request_bodies[i]);
+        aws_http_message_set_body_stream(requests[i], request_bodies[i]);
+
+        struct client_stream_tester_options options = {
+            .request = requests[i],
+            .connection = s_tester.connection,
+            .http2_priority = &priorities[i],
+        };
+        ASSERT_SUCCESS(client_stream_tester_init(&stream_testers[i], allocator, &options));
+    }
+
+    /* all streams are activated together, then send all their DATA */
+    testing_channel_drain_queued_tasks(&s_tester.testing_channel);
+    ASSERT_SUCCESS(h2_fake_peer_decode_messages_from_testing_channel(&s_tester.peer));
+
+    /* each stream's DATA must all be sent before the next stream's starts */
+    size_t send_order_i = 0;
+    size_t frame_count = h2_decode_tester_frame_count(&s_tester.peer.decode);
+    for (size_t i = preface_frame_count; i < frame_count; ++i) {
+        struct h2_decoded_frame *frame = h2_decode_tester_get_frame(&s_tester.peer.decode, i);
+        if (frame->type != AWS_H2_FRAME_T_DATA) {
+            continue;
+        }
+        ASSERT_TRUE(send_order_i < NUM_STREAMS);
+        struct aws_http_stream *expected_stream = stream_testers[expected_send_order[send_order_i]].stream;
+        ASSERT_UINT_EQUALS(aws_http_stream_get_id(expected_stream), frame->stream_id);
+        if (frame->end_stream) {
+            ++send_order_i;
+        }
+    }
+    ASSERT_UINT_EQUALS(NUM_STREAMS, send_order_i);
+
+    for (size_t i = 0; i < NUM_STREAMS; ++i) {
+        ASSERT_SUCCESS(h2_decode_tester_check_data_across_frames(
+            &s_tester.peer.decode,
+            aws_http_stream_get_id(stream_testers[i].stream),
+            aws_byte_cursor_from_buf(&request_body_bufs[i]),
+            true /*expect_end_frame*/));
+    }
+
+    /* clean up */
+    for (size_t i = 0; i < NUM_STREAMS; ++i) {
+        client_stream_tester_clean_up(&stream_testers[i]);
+        aws_http_message_release(requests[i]);
+        aws_input_stream_release(request_bodies[i]);
+        aws_byte_buf_clean_up(&request_body_bufs[i]);
+    }
+    return s_tester_clean_up();
+}
+
 /* Test sending a request whose aws_input_stream is not providing body data all at once */
 TEST_CASE(h2_client_stream_send_stalled_data) {
     ASSERT_SUCCESS(s_tester_init(allocator, ctx));
@@ -1863,6 +2126,64 @@ TEST_CASE(h2_client_stream_send_stalled_data) {
     return s_tester_clean_up();
 }
 
+/* Test that a stream with wait_for_body_ready isn't polled while its body is stalled */
+TEST_CASE(h2_client_stream_send_stalled_data_waits_for_body_ready) {
+    ASSERT_SUCCESS(s_tester_init(allocator, ctx));
+
+    /* get connection preface and acks out of the way */
+    ASSERT_SUCCESS(h2_fake_peer_send_connection_preface_default_settings(&s_tester.peer));
+    testing_channel_drain_queued_tasks(&s_tester.testing_channel);
+    ASSERT_SUCCESS(h2_fake_peer_decode_messages_from_testing_channel(&s_tester.peer));
+
+    struct aws_http_message *request = aws_http2_message_new_request(allocator);
+    ASSERT_NOT_NULL(request);
+
+    struct aws_http_header request_headers_src[] = {
+        DEFINE_HEADER(":method", "POST"),
+        DEFINE_HEADER(":scheme", "https"),
+        DEFINE_HEADER(":path", "/"),
+    };
+    aws_http_message_add_header_array(request, request_headers_src, AWS_ARRAY_SIZE(request_headers_src));
+
+    const char *body_src = "hello";
+    struct aws_byte_cursor body_cursor = aws_byte_cursor_from_c_str(body_src);
+    struct aws_input_stream *request_body = aws_input_stream_new_tester(allocator, body_cursor);
+    aws_input_stream_tester_set_max_bytes_per_read(request_body, 0);
+
+    aws_http_message_set_body_stream(request, request_body);
+
+    struct client_stream_tester stream_tester;
+    struct client_stream_tester_options options = {
+        .request = request,
+        .connection = s_tester.connection,
+        .wait_for_body_ready = true,
+    };
+    ASSERT_SUCCESS(client_stream_tester_init(&stream_tester, s_tester.alloc, &options));
+
+    /* Draining would never finish if the stalled body were polled every tick */
+    testing_channel_drain_queued_tasks(&s_tester.testing_channel);
+    uint32_t stream_id = aws_http_stream_get_id(stream_tester.stream);
+    ASSERT_SUCCESS(h2_fake_peer_decode_messages_from_testing_channel(&s_tester.peer));
+    ASSERT_NULL(h2_decode_tester_find_frame(&s_tester.peer.decode, AWS_H2_FRAME_T_DATA, 0 /*search_start_idx*/, NULL));
+
+    /* Data becoming available isn't noticed until the user says so */
+    aws_input_stream_tester_set_max_bytes_per_read(request_body, SIZE_MAX);
+    testing_channel_drain_queued_tasks(&s_tester.testing_channel);
+    ASSERT_TRUE(aws_linked_list_empty(testing_channel_get_written_message_queue(&s_tester.testing_channel)));
+
+    aws_http_stream_notify_body_ready(stream_tester.stream);
+    testing_channel_drain_queued_tasks(&s_tester.testing_channel);
+    ASSERT_SUCCESS(h2_fake_peer_decode_messages_from_testing_channel(&s_tester.peer));
+    ASSERT_SUCCESS(
+        h2_decode_tester_check_data_str_across_frames(&s_tester.peer.decode, stream_id, body_src, true /*end_stream*/));
+
+    /* clean up */
+    aws_http_message_release(request);
+    client_stream_tester_clean_up(&stream_tester);
+    aws_input_stream_release(request_body);
+    return s_tester_clean_up();
+}
+
 static int s_fake_peer_window_update_check(
     struct aws_allocator *alloc,
     uint32_t stream_id,
@@ -2414,7 +2735,8 @@ TEST_CASE(h2_client_stream_send_data_controlled_by_connection_and_stream_window_
     return s_tester_clean_up();
 }
 
-/* Test receiving a response with DATA frames, the window update frame will be sent */
+/* Test receiving a response with DATA frames. Small window increments are held back, and one WINDOW_UPDATE covering
+ * all the DATA so far is sent once half the stream window is consumed */
 TEST_CASE(h2_client_stream_send_window_update) {
     /* Enable automatic window manager management */
     s_tester.no_conn_manual_win_management = true;
@@ -2461,28 +2783,273 @@ TEST_CASE(h2_client_stream_send_window_update) {
         aws_h2_frame_new_headers(allocator, stream_id, response_headers, false /*end_stream*/, 0, NULL);
     ASSERT_SUCCESS(h2_fake_peer_send_frame(&s_tester.peer, response_frame));
 
-    /* fake peer sends 1 DATA frame */
+    /* fake peer sends 1 small DATA frame, too small to be worth a WINDOW_UPDATE */
     const char *body_src = "hello";
     ASSERT_SUCCESS(h2_fake_peer_send_data_frame_str(&s_tester.peer, stream_id, body_src, false /*end_stream*/));
-
-    /* check that 2 WINDOW_UPDATE frames have been sent.
-     * 1 for the connection, and 1 for the stream */
     testing_channel_drain_queued_tasks(&s_tester.testing_channel);
     ASSERT_SUCCESS(h2_fake_peer_decode_messages_from_testing_channel(&s_tester.peer));
+    ASSERT_NULL(h2_decode_tester_find_stream_frame(
+        &s_tester.peer.decode, AWS_H2_FRAME_T_WINDOW_UPDATE, stream_id, 0 /*idx*/, NULL));
 
-    struct h2_decoded_frame *stream_window_update_frame = h2_decode_tester_find_stream_frame(
-        &s_tester.peer.decode, AWS_H2_FRAME_T_WINDOW_UPDATE, stream_id, 0 /*idx*/, NULL);
-    ASSERT_NOT_NULL(stream_window_update_frame);
-    ASSERT_UINT_EQUALS(5, stream_window_update_frame->window_size_increment);
+    /* fake peer sends more DATA, until over half the stream window is consumed */
+    struct aws_byte_buf body_buf;
+    ASSERT_SUCCESS(aws_byte_buf_init(&body_buf, allocator, 8192));
+    memset(body_buf.buffer, 'a', body_buf.capacity);
+    body_buf.len = body_buf.capacity;
+    size_t total_received = strlen(body_src);
+    for (int i = 0; i < 4; ++i) {
+        ASSERT_SUCCESS(h2_fake_peer_send_data_frame(
+            &s_tester.peer, stream_id, aws_byte_cursor_from_buf(&body_buf), false /*end_stream*/));
+        total_received += body_buf.len;
+        testing_channel_drain_queued_tasks(&s_tester.testing_channel);
+        ASSERT_SUCCESS(h2_fake_peer_decode_messages_from_testing_channel(&s_tester.peer));
+
+        size_t window_update_index = 0;
+        struct h2_decoded_frame *stream_window_update_frame = h2_decode_tester_find_stream_frame(
+            &s_tester.peer.decode, AWS_H2_FRAME_T_WINDOW_UPDATE, stream_id, 0 /*idx*/, &window_update_index);
+        if (total_received * 2 < AWS_H2_INIT_WINDOW_SIZE) {
+            ASSERT_NULL(stream_window_update_frame);
+        } else {
+            /* check that 1 WINDOW_UPDATE covers everything received */
+            ASSERT_NOT_NULL(stream_window_update_frame);
+            ASSERT_UINT_EQUALS(total_received, stream_window_update_frame->window_size_increment);
+            ASSERT_NULL(h2_decode_tester_find_stream_frame(
+                &s_tester.peer.decode, AWS_H2_FRAME_T_WINDOW_UPDATE, stream_id, window_update_index + 1, NULL));
+        }
+    }
 
-    struct h2_decoded_frame *connection_window_update_frame = h2_decode_tester_find_stream_frame(
+    /* the connection window is still far from half consumed, so no WINDOW_UPDATE for it beyond the initial one */
+    ASSERT_NULL(h2_decode_tester_find_stream_frame(
         &s_tester.peer.decode,
         AWS_H2_FRAME_T_WINDOW_UPDATE,
         0 /*stream_id*/,
         initial_window_update_index + 1 /*idx*/,
-        NULL);
-    ASSERT_NOT_NULL(connection_window_update_frame);
-    ASSERT_UINT_EQUALS(5, connection_window_update_frame->window_size_increment);
+        NULL));
+
+    aws_byte_buf_clean_up(&body_buf);
+
+    /* clean up */
+    aws_http_headers_release(response_headers);
+    aws_http_message_release(request);
+    client_stream_tester_clean_up(&stream_tester);
+    return s_tester_clean_up();
+}
+
+/* With window auto-tuning, a PING measures the round trip while DATA arrives.
+ * If a full window arrives before the PING ACK, the initial stream window grows */
+TEST_CASE(h2_client_stream_window_auto_tuning) {
+    s_tester.no_conn_manual_win_management = true;
+    s_tester.window_auto_tuning = true;
+    ASSERT_SUCCESS(s_tester_init(allocator, ctx));
+
+    /* fake peer sends connection preface */
+    ASSERT_SUCCESS(h2_fake_peer_send_connection_preface_default_settings(&s_tester.peer));
+    testing_channel_drain_queued_tasks(&s_tester.testing_channel);
+
+    /* send request */
+    struct aws_http_message *request = aws_http2_message_new_request(allocator);
+    ASSERT_NOT_NULL(request);
+
+    struct aws_http_header request_headers_src[] = {
+        DEFINE_HEADER(":method", "GET"),
+        DEFINE_HEADER(":scheme", "https"),
+        DEFINE_HEADER(":path", "/"),
+    };
+    aws_http_message_add_header_array(request, request_headers_src, AWS_ARRAY_SIZE(request_headers_src));
+
+    struct client_stream_tester stream_tester;
+    ASSERT_SUCCESS(s_stream_tester_init(&stream_tester, request));
+    testing_channel_drain_queued_tasks(&s_tester.testing_channel);
+    uint32_t stream_id = aws_http_stream_get_id(stream_tester.stream);
+
+    /* fake peer sends response headers */
+    struct aws_http_header response_headers_src[] = {
+        DEFINE_HEADER(":status", "200"),
+    };
+
+    struct aws_http_headers *response_headers = aws_http_headers_new(allocator);
+    aws_http_headers_add_array(response_headers, response_headers_src, AWS_ARRAY_SIZE(response_headers_src));
+
+    struct aws_h2_frame *response_frame =
+        aws_h2_frame_new_headers(allocator, stream_id, response_headers, false /*end_stream*/, 0, NULL);
+    ASSERT_SUCCESS(h2_fake_peer_send_frame(&s_tester.peer, response_frame));
+
+    /* fake peer sends the first DATA frame, which starts a measurement */
+    struct aws_byte_buf body_buf;
+    ASSERT_SUCCESS(aws_byte_buf_init(&body_buf, allocator, 8192));
+    memset(body_buf.buffer, 'a', body_buf.capacity);
+    body_buf.len = body_buf.capacity;
+    ASSERT_SUCCESS(h2_fake_peer_send_data_frame(
+        &s_tester.peer, stream_id, aws_byte_cursor_from_buf(&body_buf), false /*end_stream*/));
+    testing_channel_drain_queued_tasks(&s_tester.testing_channel);
+
+    ASSERT_SUCCESS(h2_fake_peer_decode_messages_from_testing_channel(&s_tester.peer));
+    size_t ping_idx;
+    struct h2_decoded_frame *ping_frame =
+        h2_decode_tester_find_frame(&s_tester.peer.decode, AWS_H2_FRAME_T_PING, 0 /*search_start_idx*/, &ping_idx);
+    ASSERT_NOT_NULL(ping_frame);
+    ASSERT_FALSE(ping_frame->ack);
+    uint8_t opaque_data[AWS_HTTP2_PING_DATA_SIZE];
+    memcpy(opaque_data, ping_frame->ping_opaque_data, AWS_HTTP2_PING_DATA_SIZE);
+
+    /* fake peer sends the rest of the initial window before the PING ACK */
+    size_t window_remaining = AWS_H2_INIT_WINDOW_SIZE - body_buf.len;
+    while (window_remaining > 0) {
+        struct aws_byte_cursor chunk = aws_byte_cursor_from_buf(&body_buf);
+        chunk.len = aws_min_size(chunk.len, window_remaining);
+        ASSERT_SUCCESS(h2_fake_peer_send_data_frame(&s_tester.peer, stream_id, chunk, false /*end_stream*/));
+        window_remaining -= chunk.len;
+    }
+    /* no more PINGs while one is in flight */
+    testing_channel_drain_queued_tasks(&s_tester.testing_channel);
+    ASSERT_SUCCESS(h2_fake_peer_decode_messages_from_testing_channel(&s_tester.peer));
+    ASSERT_NULL(h2_decode_tester_find_frame(&s_tester.peer.decode, AWS_H2_FRAME_T_PING, ping_idx + 1, NULL));
+
+    struct aws_h2_frame *peer_frame = aws_h2_frame_new_ping(allocator, true /*ACK*/, opaque_data);
+    ASSERT_SUCCESS(h2_fake_peer_send_frame(&s_tester.peer, peer_frame));
+    testing_channel_drain_queued_tasks(&s_tester.testing_channel);
+
+    /* check that SETTINGS_INITIAL_WINDOW_SIZE grew to twice what arrived during the round trip */
+    ASSERT_SUCCESS(h2_fake_peer_decode_messages_from_testing_channel(&s_tester.peer));
+    size_t settings_idx;
+    struct h2_decoded_frame *settings_frame =
+        h2_decode_tester_find_frame(&s_tester.peer.decode, AWS_H2_FRAME_T_SETTINGS, ping_idx + 1, &settings_idx);
+    ASSERT_NOT_NULL(settings_frame);
+    ASSERT_FALSE(settings_frame->ack);
+    ASSERT_UINT_EQUALS(1, aws_array_list_length(&settings_frame->settings));
+    struct aws_http2_setting setting;
+    aws_array_list_front(&settings_frame->settings, &setting);
+    ASSERT_INT_EQUALS(AWS_HTTP2_SETTINGS_INITIAL_WINDOW_SIZE, setting.id);
+    ASSERT_UINT_EQUALS(AWS_H2_INIT_WINDOW_SIZE * 2, setting.value);
+
+    /* fake peer ACKs the initial settings, and the new window */
+    peer_frame = aws_h2_frame_new_settings(allocator, NULL, 0, true /*ACK*/);
+    ASSERT_SUCCESS(h2_fake_peer_send_frame(&s_tester.peer, peer_frame));
+    peer_frame = aws_h2_frame_new_settings(allocator, NULL, 0, true /*ACK*/);
+    ASSERT_SUCCESS(h2_fake_peer_send_frame(&s_tester.peer, peer_frame));
+
+    /* next DATA starts another measurement. Only a little arrives this time, so the window stays put */
+    ASSERT_SUCCESS(h2_fake_peer_send_data_frame_str(&s_tester.peer, stream_id, "hello", false /*end_stream*/));
+    testing_channel_drain_queued_tasks(&s_tester.testing_channel);
+    ASSERT_SUCCESS(h2_fake_peer_decode_messages_from_testing_channel(&s_tester.peer));
+    ping_frame = h2_decode_tester_find_frame(&s_tester.peer.decode, AWS_H2_FRAME_T_PING, settings_idx + 1, &ping_idx);
+    ASSERT_NOT_NULL(ping_frame);
+    memcpy(opaque_data, ping_frame->ping_opaque_data, AWS_HTTP2_PING_DATA_SIZE);
+
+    peer_frame = aws_h2_frame_new_ping(allocator, true /*ACK*/, opaque_data);
+    ASSERT_SUCCESS(h2_fake_peer_send_frame(&s_tester.peer, peer_frame));
+    testing_channel_drain_queued_tasks(&s_tester.testing_channel);
+    ASSERT_SUCCESS(h2_fake_peer_decode_messages_from_testing_channel(&s_tester.peer));
+    ASSERT_NULL(h2_decode_tester_find_frame(&s_tester.peer.decode, AWS_H2_FRAME_T_SETTINGS, ping_idx + 1, NULL));
+
+    /* connection is still healthy */
+    ASSERT_TRUE(aws_http_connection_is_open(s_tester.connection));
+
+    /* clean up */
+    aws_byte_buf_clean_up(&body_buf);
+    aws_http_headers_release(response_headers);
+    aws_http_message_release(request);
+    client_stream_tester_clean_up(&stream_tester);
+    return s_tester_clean_up();
+}
+
+/* Fake peer sends several DATA frames, all in one aws_io_message */
+static int s_peer_send_data_frames_in_one_message(
+    uint32_t stream_id,
+    const char **data_array,
+    size_t num_data,
+    bool last_ends_stream) {
+
+    struct aws_io_message *msg = aws_channel_acquire_message_from_pool(
+        s_tester.testing_channel.channel, AWS_IO_MESSAGE_APPLICATION_DATA, g_aws_channel_max_fragment_size);
+    ASSERT_NOT_NULL(msg);
+
+    for (size_t i = 0; i < num_data; ++i) {
+        struct aws_byte_cursor data = aws_byte_cursor_from_c_str(data_array[i]);
+        struct aws_input_stream *body_stream = aws_input_stream_new_from_cursor(s_tester.alloc, &data);
+        ASSERT_NOT_NULL(body_stream);
+
+        bool body_complete;
+        bool body_stalled;
+        int32_t stream_window_size_peer = AWS_H2_WINDOW_UPDATE_MAX;
+        size_t connection_window_size_peer = AWS_H2_WINDOW_UPDATE_MAX;
+        ASSERT_SUCCESS(aws_h2_encode_data_frame(
+            &s_tester.peer.encoder,
+            stream_id,
+            body_stream,
+            last_ends_stream && (i == num_data - 1),
+            0 /*pad_length*/,
+            &stream_window_size_peer,
+            &connection_window_size_peer,
+            &msg->message_data,
+            &body_complete,
+            &body_stalled));
+        ASSERT_TRUE(body_complete);
+        aws_input_stream_release(body_stream);
+    }
+
+    ASSERT_SUCCESS(testing_channel_push_read_message(&s_tester.testing_channel, msg));
+    return AWS_OP_SUCCESS;
+}
+
+/* With coalesce_incoming_body, DATA frames for a stream that arrive in the same read reach the user as one callback */
+TEST_CASE(h2_client_stream_coalesce_incoming_body) {
+    s_tester.coalesce_incoming_body = true;
+    ASSERT_SUCCESS(s_tester_init(allocator, ctx));
+
+    /* fake peer sends connection preface */
+    ASSERT_SUCCESS(h2_fake_peer_send_connection_preface_default_settings(&s_tester.peer));
+    testing_channel_drain_queued_tasks(&s_tester.testing_channel);
+
+    /* send request */
+    struct aws_http_message *request = aws_http2_message_new_request(allocator);
+    ASSERT_NOT_NULL(request);
+
+    struct aws_http_header request_headers_src[] = {
+        DEFINE_HEADER(":method", "GET"),
+        DEFINE_HEADER(":scheme", "https"),
+        DEFINE_HEADER(":path", "/"),
+    };
+    aws_http_message_add_header_array(request, request_headers_src, AWS_ARRAY_SIZE(request_headers_src));
+
+    struct client_stream_tester stream_tester;
+    ASSERT_SUCCESS(s_stream_tester_init(&stream_tester, request));
+    testing_channel_drain_queued_tasks(&s_tester.testing_channel);
+    uint32_t stream_id = aws_http_stream_get_id(stream_tester.stream);
+
+    /* fake peer sends response headers */
+    struct aws_http_header response_headers_src[] = {
+        DEFINE_HEADER(":status", "200"),
+    };
+
+    struct aws_http_headers *response_headers = aws_http_headers_new(allocator);
+    aws_http_headers_add_array(response_headers, response_headers_src, AWS_ARRAY_SIZE(response_headers_src));
+
+    struct aws_h2_frame *response_frame =
+        aws_h2_frame_new_headers(allocator, stream_id, response_headers, false /*end_stream*/, 0, NULL);
+    ASSERT_SUCCESS(h2_fake_peer_send_frame(&s_tester.peer, response_frame));
+
+    /* three DATA frames in one read are delivered together */
+    const char *first_read[] = {"Hello", ", ", "coalesced "};
+    ASSERT_SUCCESS(s_peer_send_data_frames_in_one_message(
+        stream_id, first_read, AWS_ARRAY_SIZE(first_read), false /*last_ends_stream*/));
+    testing_channel_drain_queued_tasks(&s_tester.testing_channel);
+    ASSERT_UINT_EQUALS(1, stream_tester.num_response_body_calls);
+    ASSERT_TRUE(aws_byte_buf_eq_c_str(&stream_tester.response_body, "Hello, coalesced "));
+    ASSERT_FALSE(stream_tester.complete);
+
+    /* body is never held back across reads, and all of it arrives before the stream completes */
+    const char *second_read[] = {"wor", "ld"};
+    ASSERT_SUCCESS(s_peer_send_data_frames_in_one_message(
+        stream_id, second_read, AWS_ARRAY_SIZE(second_read), true /*last_ends_stream*/));
+    testing_channel_drain_queued_tasks(&s_tester.testing_channel);
+    ASSERT_UINT_EQUALS(2, stream_tester.num_response_body_calls);
+    ASSERT_TRUE(aws_byte_buf_eq_c_str(&stream_tester.response_body, "Hello, coalesced world"));
+    ASSERT_TRUE(stream_tester.complete);
+    ASSERT_INT_EQUALS(AWS_ERROR_SUCCESS, stream_tester.on_complete_error_code);
+
+    /* connection is still healthy */
+    ASSERT_TRUE(aws_http_connection_is_open(s_tester.connection));
 
     /* clean up */
     aws_http_headers_release(response_headers);
@@ -3937,28 +4504,45 @@ TEST_CASE(h2_client_manual_window_management_user_send_conn_window_update) {
     /* number of bodies peer will send, just to ensure the connection flow-control window will not be blocked when we
      * manually update it */
     size_t body_number = 2 * aws_h2_settings_initial[AWS_HTTP2_SETTINGS_INITIAL_WINDOW_SIZE] / body_size;
+    /* The stream window is automatic, so its WINDOW_UPDATE is held back until half the window is consumed */
+    size_t stream_window_size = aws_h2_settings_initial[AWS_HTTP2_SETTINGS_INITIAL_WINDOW_SIZE];
+    size_t stream_window_unacked = 0;
+    size_t stream_window_update_count = 0;
+    size_t stream_search_idx = 0;
+    size_t connection_search_idx = 0;
     for (size_t i = 0; i < body_number; i++) {
-        if (i == body_number - 1) {
-            ASSERT_SUCCESS(h2_fake_peer_send_data_frame(&s_tester.peer, stream_id, body_cursor, true /*end_stream*/));
-        } else {
-            ASSERT_SUCCESS(h2_fake_peer_send_data_frame(&s_tester.peer, stream_id, body_cursor, false /*end_stream*/));
-        }
-        /* manually update the stream and connection flow-control window. */
-        aws_http_stream_update_window(stream_tester.stream, body_size);
+        bool end_stream = i == body_number - 1;
+        ASSERT_SUCCESS(h2_fake_peer_send_data_frame(&s_tester.peer, stream_id, body_cursor, end_stream));
+        /* manually update the connection flow-control window. */
         aws_http2_connection_update_window(s_tester.connection, (uint32_t)body_size);
         testing_channel_drain_queued_tasks(&s_tester.testing_channel);
         ASSERT_SUCCESS(h2_fake_peer_decode_messages_from_testing_channel(&s_tester.peer));
 
+        size_t out_index = 0;
         struct h2_decoded_frame *stream_window_update_frame = h2_decode_tester_find_stream_frame(
-            &s_tester.peer.decode, AWS_H2_FRAME_T_WINDOW_UPDATE, stream_id, 0 /*idx*/, NULL);
-        ASSERT_NOT_NULL(stream_window_update_frame);
-        ASSERT_UINT_EQUALS(body_size, stream_window_update_frame->window_size_increment);
+            &s_tester.peer.decode, AWS_H2_FRAME_T_WINDOW_UPDATE, stream_id, stream_search_idx, &out_index);
+        stream_window_size -= body_size;
+        stream_window_unacked += body_size;
+        if (!end_stream && stream_window_unacked >= stream_window_size) {
+            /* 1 WINDOW_UPDATE covers everything received since the last one */
+            ASSERT_NOT_NULL(stream_window_update_frame);
+            ASSERT_UINT_EQUALS(stream_window_unacked, stream_window_update_frame->window_size_increment);
+            stream_window_size += stream_window_unacked;
+            stream_window_unacked = 0;
+            stream_search_idx = out_index + 1;
+            ++stream_window_update_count;
+        } else {
+            ASSERT_NULL(stream_window_update_frame);
+        }
 
+        /* manual updates are sent right away, however small */
         struct h2_decoded_frame *connection_window_update_frame = h2_decode_tester_find_stream_frame(
-            &s_tester.peer.decode, AWS_H2_FRAME_T_WINDOW_UPDATE, 0 /*stream_id*/, 0 /*idx*/, NULL);
+            &s_tester.peer.decode, AWS_H2_FRAME_T_WINDOW_UPDATE, 0 /*stream_id*/, connection_search_idx, &out_index);
         ASSERT_NOT_NULL(connection_window_update_frame);
         ASSERT_UINT_EQUALS(body_size, connection_window_update_frame->window_size_increment);
+        connection_search_idx = out_index + 1;
     }
+    ASSERT_TRUE(stream_window_update_count > 0);
     ASSERT_TRUE(aws_http_connection_is_open(s_tester.connection));
     /* validate that stream received complete response */
     struct aws_byte_buf expected_body;
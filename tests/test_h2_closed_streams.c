@@ -0,0 +1,96 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/http/private/h2_closed_streams.h>
+
+#include <aws/testing/aws_test_harness.h>
+
+static int s_h2_closed_streams_record_find_fn(struct aws_allocator *allocator, void *ctx) {
+    (void)ctx;
+
+    struct aws_h2_closed_streams closed_streams;
+    ASSERT_SUCCESS(aws_h2_closed_streams_init(&closed_streams, allocator, 64 /*max_closed_streams*/));
+
+    ASSERT_INT_EQUALS(AWS_H2_STREAM_CLOSED_UNKNOWN, aws_h2_closed_streams_find(&closed_streams, 1));
+    ASSERT_INT_EQUALS(AWS_H2_STREAM_CLOSED_UNKNOWN, aws_h2_closed_streams_find(&closed_streams, 2));
+
+    /* Closed out of order, and client and server ids interleaved */
+    aws_h2_closed_streams_record(&closed_streams, 5, AWS_H2_STREAM_CLOSED_WHEN_RST_STREAM_SENT);
+    aws_h2_closed_streams_record(&closed_streams, 1, AWS_H2_STREAM_CLOSED_WHEN_BOTH_SIDES_END_STREAM);
+    aws_h2_closed_streams_record(&closed_streams, 2, AWS_H2_STREAM_CLOSED_WHEN_RST_STREAM_RECEIVED);
+
+    ASSERT_INT_EQUALS(AWS_H2_STREAM_CLOSED_WHEN_BOTH_SIDES_END_STREAM, aws_h2_closed_streams_find(&closed_streams, 1));
+    ASSERT_INT_EQUALS(AWS_H2_STREAM_CLOSED_WHEN_RST_STREAM_RECEIVED, aws_h2_closed_streams_find(&closed_streams, 2));
+    ASSERT_INT_EQUALS(AWS_H2_STREAM_CLOSED_UNKNOWN, aws_h2_closed_streams_find(&closed_streams, 3));
+    ASSERT_INT_EQUALS(AWS_H2_STREAM_CLOSED_UNKNOWN, aws_h2_closed_streams_find(&closed_streams, 4));
+    ASSERT_INT_EQUALS(AWS_H2_STREAM_CLOSED_WHEN_RST_STREAM_SENT, aws_h2_closed_streams_find(&closed_streams, 5));
+    ASSERT_INT_EQUALS(AWS_H2_STREAM_CLOSED_UNKNOWN, aws_h2_closed_streams_find(&closed_streams, 7));
+
+    /* Stream 3 closes late, but it's still in the window */
+    aws_h2_closed_streams_record(&closed_streams, 3, AWS_H2_STREAM_CLOSED_WHEN_RST_STREAM_RECEIVED);
+    ASSERT_INT_EQUALS(AWS_H2_STREAM_CLOSED_WHEN_RST_STREAM_RECEIVED, aws_h2_closed_streams_find(&closed_streams, 3));
+
+    aws_h2_closed_streams_clean_up(&closed_streams);
+    return AWS_OP_SUCCESS;
+}
+AWS_TEST_CASE(h2_closed_streams_record_find, s_h2_closed_streams_record_find_fn)
+
+/* Old ids are forgotten as the window slides forward, and stale entries don't come back when it wraps around */
+static int s_h2_closed_streams_window_slides_fn(struct aws_allocator *allocator, void *ctx) {
+    (void)ctx;
+
+    struct aws_h2_closed_streams closed_streams;
+    ASSERT_SUCCESS(aws_h2_closed_streams_init(&closed_streams, allocator, 64 /*max_closed_streams*/));
+    ASSERT_UINT_EQUALS(64, closed_streams.window_size);
+
+    /* Close every client stream 1 through 127 */
+    for (uint32_t id = 1; id < 128; id += 2) {
+        aws_h2_closed_streams_record(&closed_streams, id, AWS_H2_STREAM_CLOSED_WHEN_BOTH_SIDES_END_STREAM);
+    }
+    for (uint32_t id = 1; id < 128; id += 2) {
+        ASSERT_INT_EQUALS(
+            AWS_H2_STREAM_CLOSED_WHEN_BOTH_SIDES_END_STREAM, aws_h2_closed_streams_find(&closed_streams, id));
+    }
+
+    /* Closing 133 slides the window past 1, 3 and 5. Streams 129 and 131 are still open, and their slots
+     * (last used by 1 and 3) must read as unknown */
+    aws_h2_closed_streams_record(&closed_streams, 133, AWS_H2_STREAM_CLOSED_WHEN_RST_STREAM_SENT);
+    ASSERT_INT_EQUALS(AWS_H2_STREAM_CLOSED_UNKNOWN, aws_h2_closed_streams_find(&closed_streams, 1));
+    ASSERT_INT_EQUALS(AWS_H2_STREAM_CLOSED_UNKNOWN, aws_h2_closed_streams_find(&closed_streams, 3));
+    ASSERT_INT_EQUALS(AWS_H2_STREAM_CLOSED_UNKNOWN, aws_h2_closed_streams_find(&closed_streams, 5));
+    ASSERT_INT_EQUALS(AWS_H2_STREAM_CLOSED_WHEN_BOTH_SIDES_END_STREAM, aws_h2_closed_streams_find(&closed_streams, 7));
+    ASSERT_INT_EQUALS(AWS_H2_STREAM_CLOSED_UNKNOWN, aws_h2_closed_streams_find(&closed_streams, 129));
+    ASSERT_INT_EQUALS(AWS_H2_STREAM_CLOSED_UNKNOWN, aws_h2_closed_streams_find(&closed_streams, 131));
+    ASSERT_INT_EQUALS(AWS_H2_STREAM_CLOSED_WHEN_RST_STREAM_SENT, aws_h2_closed_streams_find(&closed_streams, 133));
+
+    /* Closing a stream that already slid out of the window is ignored */
+    aws_h2_closed_streams_record(&closed_streams, 3, AWS_H2_STREAM_CLOSED_WHEN_RST_STREAM_SENT);
+    ASSERT_INT_EQUALS(AWS_H2_STREAM_CLOSED_UNKNOWN, aws_h2_closed_streams_find(&closed_streams, 3));
+    ASSERT_INT_EQUALS(AWS_H2_STREAM_CLOSED_WHEN_RST_STREAM_SENT, aws_h2_closed_streams_find(&closed_streams, 133));
+
+    /* Jump far ahead, everything before is forgotten */
+    aws_h2_closed_streams_record(&closed_streams, 10001, AWS_H2_STREAM_CLOSED_WHEN_RST_STREAM_RECEIVED);
+    for (uint32_t id = 10001 - 126; id < 10001; id += 2) {
+        ASSERT_INT_EQUALS(AWS_H2_STREAM_CLOSED_UNKNOWN, aws_h2_closed_streams_find(&closed_streams, id));
+    }
+    ASSERT_INT_EQUALS(AWS_H2_STREAM_CLOSED_UNKNOWN, aws_h2_closed_streams_find(&closed_streams, 133));
+    ASSERT_INT_EQUALS(
+        AWS_H2_STREAM_CLOSED_WHEN_RST_STREAM_RECEIVED, aws_h2_closed_streams_find(&closed_streams, 10001));
+
+    /* Server-initiated ids have their own window */
+    ASSERT_INT_EQUALS(AWS_H2_STREAM_CLOSED_UNKNOWN, aws_h2_closed_streams_find(&closed_streams, 2));
+    aws_h2_closed_streams_record(&closed_streams, 2, AWS_H2_STREAM_CLOSED_WHEN_RST_STREAM_SENT);
+    ASSERT_INT_EQUALS(AWS_H2_STREAM_CLOSED_WHEN_RST_STREAM_SENT, aws_h2_closed_streams_find(&closed_streams, 2));
+
+    /* Largest possible id */
+    aws_h2_closed_streams_record(&closed_streams, 0x7FFFFFFF, AWS_H2_STREAM_CLOSED_WHEN_BOTH_SIDES_END_STREAM);
+    ASSERT_INT_EQUALS(
+        AWS_H2_STREAM_CLOSED_WHEN_BOTH_SIDES_END_STREAM, aws_h2_closed_streams_find(&closed_streams, 0x7FFFFFFF));
+    ASSERT_INT_EQUALS(AWS_H2_STREAM_CLOSED_UNKNOWN, aws_h2_closed_streams_find(&closed_streams, 10001));
+
+    aws_h2_closed_streams_clean_up(&closed_streams);
+    return AWS_OP_SUCCESS;
+}
+AWS_TEST_CASE(h2_closed_streams_window_slides, s_h2_closed_streams_window_slides_fn)
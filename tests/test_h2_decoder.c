@@ -681,6 +681,47 @@ H2_DECODER_ON_SERVER_TEST(h2_decoder_headers_cookies) {
     return AWS_OP_SUCCESS;
 }
 
+/* A pseudo-header from the dynamic table must outlive changes to the table, since it's delivered later */
+H2_DECODER_ON_CLIENT_TEST(h2_decoder_headers_pseudoheader_from_dynamic_table) {
+    (void)allocator;
+    struct fixture *fixture = ctx;
+
+    /* clang-format off */
+    uint8_t input[] = {
+        /* HEADERS FRAME*/
+        0x00, 0x00, 0x05,           /* Length (24) */
+        AWS_H2_FRAME_T_HEADERS,     /* Type (8) */
+        AWS_H2_FRAME_F_END_STREAM | AWS_H2_FRAME_F_END_HEADERS, /* Flags (8) */
+        0x00, 0x00, 0x00, 0x01,     /* Reserved (1) | Stream Identifier (31) */
+        /* PAYLOAD */
+        0x48, 0x03, '3', '0', '2',  /* ":status: 302" - indexed name, uncompressed value, stored to dynamic table */
+
+        /* HEADERS FRAME*/
+        0x00, 0x00, 0x0b,           /* Length (24) */
+        AWS_H2_FRAME_T_HEADERS,     /* Type (8) */
+        AWS_H2_FRAME_F_END_STREAM | AWS_H2_FRAME_F_END_HEADERS, /* Flags (8) */
+        0x00, 0x00, 0x00, 0x03,     /* Reserved (1) | Stream Identifier (31) */
+        /* PAYLOAD */
+        0xbe,                       /* ":status: 302" - indexed from dynamic table */
+        0x20,                       /* Dynamic Table Size Update to 0, evicting everything */
+        0x58, 0x07, 'p', 'r', 'i', 'v', 'a', 't', 'e', /* "cache-control: private" */
+    };
+    /* clang-format on */
+
+    /* Decode */
+    ASSERT_H2ERR_SUCCESS(s_decode_all(fixture, aws_byte_cursor_from_array(input, sizeof(input))));
+
+    /* Validate */
+    struct h2_decoded_frame *frame = h2_decode_tester_latest_frame(&fixture->decode);
+    ASSERT_SUCCESS(h2_decoded_frame_check_finished(frame, AWS_H2_FRAME_T_HEADERS, 3 /*stream_id*/));
+    ASSERT_FALSE(frame->headers_malformed);
+    ASSERT_UINT_EQUALS(2, aws_http_headers_count(frame->headers));
+    ASSERT_SUCCESS(s_check_header(frame, 0, ":status", "302", AWS_HTTP_HEADER_COMPRESSION_USE_CACHE));
+    ASSERT_SUCCESS(s_check_header(frame, 1, "cache-control", "private", AWS_HTTP_HEADER_COMPRESSION_USE_CACHE));
+    ASSERT_INT_EQUALS(AWS_HTTP_HEADER_BLOCK_MAIN, frame->header_block_type);
+    return AWS_OP_SUCCESS;
+}
+
 /* A trailing header has no pseudo-headers, and always ends the stream */
 H2_DECODER_ON_CLIENT_TEST(h2_decoder_headers_trailer) {
     (void)allocator;
@@ -2784,6 +2825,78 @@ H2_DECODER_ON_CLIENT_TEST(h2_decoder_many_frames_in_a_row) {
     return AWS_OP_SUCCESS;
 }
 
+/* Test input that ends part way through a frame, with whole frames on either side of the split.
+ * Whole frames are decoded straight from the input, while the split frame has to be resumed by the state machine */
+H2_DECODER_ON_CLIENT_TEST(h2_decoder_whole_frames_around_split_frame) {
+    (void)allocator;
+    struct fixture *fixture = ctx;
+
+    /* clang-format off */
+    uint8_t input[] = {
+        /* SETTINGS FRAME */
+        0x00, 0x00, 0x06,           /* Length (24) */
+        AWS_H2_FRAME_T_SETTINGS,    /* Type (8) */
+        0x00,                       /* Flags (8) */
+        0x00, 0x00, 0x00, 0x00,     /* Reserved (1) | Stream Identifier (31) */
+        /* Payload */
+        0x00, 0x05,                 /* Identifier (16) */
+        0x00, 0xFF, 0xFF, 0xFF,     /* Value (32) */
+
+        /* DATA FRAME */
+        0x00, 0x00, 0x08,           /* Length (24) */
+        AWS_H2_FRAME_T_DATA,        /* Type (8) */
+        AWS_H2_FRAME_F_PADDED,      /* Flags (8) */
+        0x00, 0x00, 0x00, 0x01,     /* Reserved (1) | Stream Identifier (31) */
+        /* Payload */
+        0x02,                       /* Pad Length (8) */
+        'h', 'e', 'l', 'l', 'o',    /* Data (*) */
+        0x00, 0x00,                 /* Padding (*) */
+
+        /* PING FRAME */
+        0x00, 0x00, 0x08,           /* Length (24) */
+        AWS_H2_FRAME_T_PING,        /* Type (8) */
+        0x00,                       /* Flags (8) */
+        0x00, 0x00, 0x00, 0x00,     /* Reserved (1) | Stream Identifier (31) */
+        /* Payload */
+        'p', 'i', 'n', 'g', 'p', 'o', 'n', 'g', /* Opaque Data (64) */
+
+        /* WINDOW_UPDATE FRAME */
+        0x00, 0x00, 0x04,           /* Length (24) */
+        AWS_H2_FRAME_T_WINDOW_UPDATE,/* Type (8) */
+        0x00,                       /* Flags (8) */
+        0x00, 0x00, 0x00, 0x01,     /* Reserved (1) | Stream Identifier (31) */
+        /* Payload */
+        0x00, 0x00, 0x00, 0x07,     /* Reserved (1) | Window Size Increment (31) */
+    };
+    /* clang-format on */
+
+    /* Split the input between the "he" and "llo" of the DATA frame */
+    const size_t split_at = 15 + 9 + 3;
+    ASSERT_H2ERR_SUCCESS(s_decode_all(fixture, aws_byte_cursor_from_array(input, split_at)));
+    ASSERT_H2ERR_SUCCESS(s_decode_all(fixture, aws_byte_cursor_from_array(input + split_at, sizeof(input) - split_at)));
+
+    size_t frame_i = 0;
+    struct h2_decoded_frame *frame;
+
+    ASSERT_SUCCESS(s_get_finished_frame_i(fixture, frame_i++, AWS_H2_FRAME_T_SETTINGS, 0x0 /*stream-id*/, &frame));
+    ASSERT_UINT_EQUALS(1, aws_array_list_length(&frame->settings));
+
+    ASSERT_SUCCESS(s_get_finished_frame_i(fixture, frame_i++, AWS_H2_FRAME_T_DATA, 0x1 /*stream-id*/, &frame));
+    ASSERT_UINT_EQUALS(8, frame->data_payload_len);
+    ASSERT_TRUE(aws_byte_buf_eq_c_str(&frame->data, "hello"));
+    ASSERT_FALSE(frame->end_stream);
+
+    ASSERT_SUCCESS(s_get_finished_frame_i(fixture, frame_i++, AWS_H2_FRAME_T_PING, 0x0 /*stream-id*/, &frame));
+    ASSERT_FALSE(frame->ack);
+    ASSERT_BIN_ARRAYS_EQUALS("pingpong", 8, frame->ping_opaque_data, AWS_HTTP2_PING_DATA_SIZE);
+
+    ASSERT_SUCCESS(s_get_finished_frame_i(fixture, frame_i++, AWS_H2_FRAME_T_WINDOW_UPDATE, 0x1 /*stream-id*/, &frame));
+    ASSERT_UINT_EQUALS(7, frame->window_size_increment);
+
+    ASSERT_UINT_EQUALS(frame_i, h2_decode_tester_frame_count(&fixture->decode));
+    return AWS_OP_SUCCESS;
+}
+
 /* Test that client can decode a proper connection preface sent by the server.
  * A server connection preface is just a settings frame */
 H2_DECODER_ON_CLIENT_PREFACE_TEST(h2_decoder_preface_from_server) {
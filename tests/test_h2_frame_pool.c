@@ -0,0 +1,111 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/http/private/h2_frame_pool.h>
+#include <aws/http/private/h2_frames.h>
+#include <aws/http/request_response.h>
+
+#include <aws/testing/aws_test_harness.h>
+
+/* Create and destroy the frames a connection typically sends for one request */
+static int s_create_and_destroy_request_frames(struct aws_allocator *frame_alloc, struct aws_http_headers *headers) {
+    uint8_t opaque_data[AWS_HTTP2_PING_DATA_SIZE] = {0};
+    struct aws_h2_frame *frames[] = {
+        aws_h2_frame_new_headers(frame_alloc, 1 /*stream_id*/, headers, true /*end_stream*/, 0, NULL),
+        aws_h2_frame_new_window_update(frame_alloc, 1 /*stream_id*/, 1024),
+        aws_h2_frame_new_window_update(frame_alloc, 0 /*stream_id*/, 4096),
+        aws_h2_frame_new_ping(frame_alloc, true /*ack*/, opaque_data),
+        aws_h2_frame_new_settings(frame_alloc, NULL, 0, true /*ack*/),
+        aws_h2_frame_new_rst_stream(frame_alloc, 1 /*stream_id*/, AWS_HTTP2_ERR_CANCEL),
+    };
+    for (size_t i = 0; i < AWS_ARRAY_SIZE(frames); ++i) {
+        ASSERT_NOT_NULL(frames[i]);
+    }
+    for (size_t i = 0; i < AWS_ARRAY_SIZE(frames); ++i) {
+        aws_h2_frame_destroy(frames[i]);
+    }
+    return AWS_OP_SUCCESS;
+}
+
+/* After the first request, frames for later requests are built entirely from recycled memory */
+static int s_h2_frame_pool_recycles_frames_fn(struct aws_allocator *allocator, void *ctx) {
+    (void)ctx;
+
+    struct aws_http_headers *headers = aws_http_headers_new(allocator);
+    ASSERT_SUCCESS(
+        aws_http_headers_add(headers, aws_byte_cursor_from_c_str(":method"), aws_byte_cursor_from_c_str("GET")));
+
+    struct aws_h2_frame_pool pool;
+    aws_h2_frame_pool_init(&pool, allocator);
+
+    ASSERT_SUCCESS(s_create_and_destroy_request_frames(&pool.allocator, headers));
+    uint64_t first_request_parent_acquire_count = pool.stats.parent_acquire_count;
+    ASSERT_TRUE(first_request_parent_acquire_count > 0);
+    ASSERT_UINT_EQUALS(0, pool.stats.live_count);
+
+    for (int i = 0; i < 100; ++i) {
+        ASSERT_SUCCESS(s_create_and_destroy_request_frames(&pool.allocator, headers));
+    }
+    ASSERT_UINT_EQUALS(first_request_parent_acquire_count, pool.stats.parent_acquire_count);
+    ASSERT_TRUE(pool.stats.recycled_count >= 100 * first_request_parent_acquire_count);
+    ASSERT_UINT_EQUALS(0, pool.stats.live_count);
+
+    aws_h2_frame_pool_clean_up(&pool);
+    aws_http_headers_release(headers);
+    return AWS_OP_SUCCESS;
+}
+AWS_TEST_CASE(h2_frame_pool_recycles_frames, s_h2_frame_pool_recycles_frames_fn)
+
+/* Big allocations pass through, memory can grow, and free lists don't hold on to unlimited memory */
+static int s_h2_frame_pool_limits_fn(struct aws_allocator *allocator, void *ctx) {
+    (void)ctx;
+
+    struct aws_h2_frame_pool pool;
+    aws_h2_frame_pool_init(&pool, allocator);
+    struct aws_allocator *pool_alloc = &pool.allocator;
+
+    /* Too big for any size class */
+    void *big = aws_mem_acquire(pool_alloc, 4096);
+    ASSERT_NOT_NULL(big);
+    aws_mem_release(pool_alloc, big);
+    big = aws_mem_acquire(pool_alloc, 4096);
+    ASSERT_NOT_NULL(big);
+    aws_mem_release(pool_alloc, big);
+    ASSERT_UINT_EQUALS(2, pool.stats.parent_acquire_count);
+    ASSERT_UINT_EQUALS(0, pool.stats.recycled_count);
+
+    /* Growing keeps the contents, whether it stays in the block's size class or moves to a bigger one */
+    uint8_t *ptr = aws_mem_calloc(pool_alloc, 1, 20);
+    ASSERT_NOT_NULL(ptr);
+    memset(ptr, 'a', 20);
+    ASSERT_SUCCESS(aws_mem_realloc(pool_alloc, (void **)&ptr, 20, 60));
+    memset(ptr + 20, 'b', 40);
+    ASSERT_SUCCESS(aws_mem_realloc(pool_alloc, (void **)&ptr, 60, 1000));
+    for (size_t i = 0; i < 60; ++i) {
+        ASSERT_UINT_EQUALS(i < 20 ? 'a' : 'b', ptr[i]);
+    }
+    aws_mem_release(pool_alloc, ptr);
+    ASSERT_UINT_EQUALS(0, pool.stats.live_count);
+
+    /* Lots of blocks at once. Only some are kept when released */
+    void *blocks[100];
+    for (size_t i = 0; i < AWS_ARRAY_SIZE(blocks); ++i) {
+        blocks[i] = aws_mem_acquire(pool_alloc, 100);
+        ASSERT_NOT_NULL(blocks[i]);
+    }
+    for (size_t i = 0; i < AWS_ARRAY_SIZE(blocks); ++i) {
+        aws_mem_release(pool_alloc, blocks[i]);
+    }
+    size_t num_kept = 0;
+    for (size_t i = 0; i < AWS_H2_FRAME_POOL_SIZE_CLASS_COUNT; ++i) {
+        num_kept += pool.free_lists[i].count;
+    }
+    ASSERT_TRUE(num_kept > 0);
+    ASSERT_TRUE(num_kept < AWS_ARRAY_SIZE(blocks));
+
+    aws_h2_frame_pool_clean_up(&pool);
+    return AWS_OP_SUCCESS;
+}
+AWS_TEST_CASE(h2_frame_pool_limits, s_h2_frame_pool_limits_fn)
@@ -0,0 +1,230 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/http/private/h2_stream_table.h>
+
+#include <aws/testing/aws_test_harness.h>
+
+/* The table never looks inside a stream, so any unique address works */
+static char s_fake_streams[4096];
+
+static struct aws_h2_stream *s_fake_stream(uint32_t stream_id) {
+    AWS_FATAL_ASSERT(stream_id < AWS_ARRAY_SIZE(s_fake_streams));
+    return (struct aws_h2_stream *)&s_fake_streams[stream_id];
+}
+
+/* Check that iterating visits exactly the streams with ids in `expected_ids` */
+static int s_check_iteration(struct aws_h2_stream_table *table, const uint32_t *expected_ids, size_t num_expected) {
+    bool visited[AWS_ARRAY_SIZE(s_fake_streams)] = {false};
+    size_t num_visited = 0;
+
+    struct aws_h2_stream_table_iter iter;
+    aws_h2_stream_table_iter_init(&iter, table);
+    struct aws_h2_stream *stream;
+    while ((stream = aws_h2_stream_table_iter_next(&iter))) {
+        size_t stream_id = (size_t)((char *)stream - s_fake_streams);
+        ASSERT_FALSE(visited[stream_id]);
+        visited[stream_id] = true;
+        num_visited++;
+    }
+
+    ASSERT_UINT_EQUALS(num_expected, num_visited);
+    for (size_t i = 0; i < num_expected; ++i) {
+        ASSERT_TRUE(visited[expected_ids[i]]);
+    }
+    return AWS_OP_SUCCESS;
+}
+
+static int s_h2_stream_table_insert_find_remove_fn(struct aws_allocator *allocator, void *ctx) {
+    (void)ctx;
+
+    struct aws_h2_stream_table table;
+    ASSERT_SUCCESS(aws_h2_stream_table_init(&table, allocator, 1 /*local_first_id*/));
+    ASSERT_UINT_EQUALS(0, aws_h2_stream_table_count(&table));
+    ASSERT_NULL(aws_h2_stream_table_find(&table, 1));
+
+    /* Enough client-initiated streams that the ring must grow */
+    const uint32_t max_id = 1999;
+    for (uint32_t id = 1; id <= max_id; id += 2) {
+        ASSERT_SUCCESS(aws_h2_stream_table_insert(&table, id, s_fake_stream(id)));
+    }
+    ASSERT_UINT_EQUALS(1000, aws_h2_stream_table_count(&table));
+
+    for (uint32_t id = 1; id <= max_id; id += 2) {
+        ASSERT_PTR_EQUALS(s_fake_stream(id), aws_h2_stream_table_find(&table, id));
+        ASSERT_NULL(aws_h2_stream_table_find(&table, id + 1));
+    }
+    ASSERT_NULL(aws_h2_stream_table_find(&table, max_id + 2));
+
+    /* Remove every other stream, then the rest in reverse */
+    for (uint32_t id = 1; id <= max_id; id += 4) {
+        aws_h2_stream_table_remove(&table, id);
+        ASSERT_NULL(aws_h2_stream_table_find(&table, id));
+    }
+    ASSERT_UINT_EQUALS(500, aws_h2_stream_table_count(&table));
+    ASSERT_PTR_EQUALS(s_fake_stream(3), aws_h2_stream_table_find(&table, 3));
+
+    for (uint32_t i = 0; i < 500; ++i) {
+        aws_h2_stream_table_remove(&table, max_id - (i * 4));
+    }
+    ASSERT_UINT_EQUALS(0, aws_h2_stream_table_count(&table));
+
+    /* Removing something that isn't there is fine */
+    aws_h2_stream_table_remove(&table, 1);
+
+    /* Table works again after emptying out */
+    ASSERT_SUCCESS(aws_h2_stream_table_insert(&table, 2001, s_fake_stream(2001)));
+    ASSERT_PTR_EQUALS(s_fake_stream(2001), aws_h2_stream_table_find(&table, 2001));
+    ASSERT_UINT_EQUALS(1, aws_h2_stream_table_count(&table));
+
+    aws_h2_stream_table_clean_up(&table);
+    return AWS_OP_SUCCESS;
+}
+AWS_TEST_CASE(h2_stream_table_insert_find_remove, s_h2_stream_table_insert_find_remove_fn)
+
+/* A long-lived stream at the front shouldn't make the ring grow forever as newer streams come and go */
+static int s_h2_stream_table_long_lived_stream_fn(struct aws_allocator *allocator, void *ctx) {
+    (void)ctx;
+
+    struct aws_h2_stream_table table;
+    ASSERT_SUCCESS(aws_h2_stream_table_init(&table, allocator, 1 /*local_first_id*/));
+
+    ASSERT_SUCCESS(aws_h2_stream_table_insert(&table, 1, s_fake_stream(1)));
+    for (uint32_t id = 3; id < 4000; id += 2) {
+        ASSERT_SUCCESS(aws_h2_stream_table_insert(&table, id, s_fake_stream(id)));
+        ASSERT_PTR_EQUALS(s_fake_stream(1), aws_h2_stream_table_find(&table, 1));
+        aws_h2_stream_table_remove(&table, id);
+    }
+
+    ASSERT_UINT_EQUALS(1, aws_h2_stream_table_count(&table));
+    ASSERT_PTR_EQUALS(s_fake_stream(1), aws_h2_stream_table_find(&table, 1));
+    ASSERT_TRUE(table.ring.capacity <= 256);
+
+    aws_h2_stream_table_remove(&table, 1);
+    ASSERT_UINT_EQUALS(0, aws_h2_stream_table_count(&table));
+    ASSERT_NULL(aws_h2_stream_table_find(&table, 1));
+
+    aws_h2_stream_table_clean_up(&table);
+    return AWS_OP_SUCCESS;
+}
+AWS_TEST_CASE(h2_stream_table_long_lived_stream, s_h2_stream_table_long_lived_stream_fn)
+
+/* Peer-initiated ids, and ids older than the ring, still work */
+static int s_h2_stream_table_outliers_fn(struct aws_allocator *allocator, void *ctx) {
+    (void)ctx;
+
+    struct aws_h2_stream_table table;
+    ASSERT_SUCCESS(aws_h2_stream_table_init(&table, allocator, 2 /*local_first_id*/));
+
+    const uint32_t ids[] = {10, 12, 7, 1, 4, 3000};
+    for (size_t i = 0; i < AWS_ARRAY_SIZE(ids); ++i) {
+        ASSERT_SUCCESS(aws_h2_stream_table_insert(&table, ids[i], s_fake_stream(ids[i])));
+    }
+    ASSERT_UINT_EQUALS(AWS_ARRAY_SIZE(ids), aws_h2_stream_table_count(&table));
+    for (size_t i = 0; i < AWS_ARRAY_SIZE(ids); ++i) {
+        ASSERT_PTR_EQUALS(s_fake_stream(ids[i]), aws_h2_stream_table_find(&table, ids[i]));
+    }
+    ASSERT_SUCCESS(s_check_iteration(&table, ids, AWS_ARRAY_SIZE(ids)));
+
+    aws_h2_stream_table_remove(&table, 7);
+    aws_h2_stream_table_remove(&table, 4);
+    ASSERT_NULL(aws_h2_stream_table_find(&table, 7));
+    ASSERT_NULL(aws_h2_stream_table_find(&table, 4));
+    const uint32_t remaining_ids[] = {10, 12, 1, 3000};
+    ASSERT_SUCCESS(s_check_iteration(&table, remaining_ids, AWS_ARRAY_SIZE(remaining_ids)));
+
+    aws_h2_stream_table_clean_up(&table);
+    return AWS_OP_SUCCESS;
+}
+AWS_TEST_CASE(h2_stream_table_outliers, s_h2_stream_table_outliers_fn)
+
+/* The connection completes streams (removing them from the table) while iterating over them */
+static int s_h2_stream_table_remove_while_iterating_fn(struct aws_allocator *allocator, void *ctx) {
+    (void)ctx;
+
+    struct aws_h2_stream_table table;
+    ASSERT_SUCCESS(aws_h2_stream_table_init(&table, allocator, 1 /*local_first_id*/));
+
+    /* Mix of ring and outlier streams */
+    uint32_t ids[64];
+    size_t num_ids = 0;
+    for (uint32_t id = 1; id < 80; id += 2) {
+        ids[num_ids++] = id;
+    }
+    for (uint32_t id = 2; id < 48; id += 2) {
+        ids[num_ids++] = id;
+    }
+    for (size_t i = 0; i < num_ids; ++i) {
+        ASSERT_SUCCESS(aws_h2_stream_table_insert(&table, ids[i], s_fake_stream(ids[i])));
+    }
+
+    /* Remove every stream as it's visited, plus a couple not yet visited */
+    size_t num_visited = 0;
+    struct aws_h2_stream_table_iter iter;
+    aws_h2_stream_table_iter_init(&iter, &table);
+    struct aws_h2_stream *stream;
+    while ((stream = aws_h2_stream_table_iter_next(&iter))) {
+        uint32_t stream_id = (uint32_t)((char *)stream - s_fake_streams);
+        aws_h2_stream_table_remove(&table, stream_id);
+        ASSERT_NULL(aws_h2_stream_table_find(&table, stream_id));
+        num_visited++;
+
+        if (stream_id == 1) {
+            aws_h2_stream_table_remove(&table, 3);
+            aws_h2_stream_table_remove(&table, 46);
+            num_visited += 2;
+        }
+    }
+
+    ASSERT_UINT_EQUALS(num_ids, num_visited);
+    ASSERT_UINT_EQUALS(0, aws_h2_stream_table_count(&table));
+    ASSERT_SUCCESS(s_check_iteration(&table, NULL, 0));
+
+    /* Table works normally after iteration */
+    ASSERT_SUCCESS(aws_h2_stream_table_insert(&table, 81, s_fake_stream(81)));
+    ASSERT_SUCCESS(aws_h2_stream_table_insert(&table, 2, s_fake_stream(2)));
+    ASSERT_UINT_EQUALS(2, aws_h2_stream_table_count(&table));
+
+    aws_h2_stream_table_clean_up(&table);
+    return AWS_OP_SUCCESS;
+}
+AWS_TEST_CASE(h2_stream_table_remove_while_iterating, s_h2_stream_table_remove_while_iterating_fn)
+
+/* The connection may bail out of an iteration early, after removing streams during it */
+static int s_h2_stream_table_iter_stop_early_fn(struct aws_allocator *allocator, void *ctx) {
+    (void)ctx;
+
+    struct aws_h2_stream_table table;
+    ASSERT_SUCCESS(aws_h2_stream_table_init(&table, allocator, 1 /*local_first_id*/));
+
+    const uint32_t ids[] = {1, 3, 5, 2, 4};
+    for (size_t i = 0; i < AWS_ARRAY_SIZE(ids); ++i) {
+        ASSERT_SUCCESS(aws_h2_stream_table_insert(&table, ids[i], s_fake_stream(ids[i])));
+    }
+
+    struct aws_h2_stream_table_iter iter;
+    aws_h2_stream_table_iter_init(&iter, &table);
+    ASSERT_NOT_NULL(aws_h2_stream_table_iter_next(&iter));
+    aws_h2_stream_table_remove(&table, 4);
+    aws_h2_stream_table_iter_clean_up(&iter);
+
+    ASSERT_UINT_EQUALS(4, aws_h2_stream_table_count(&table));
+    ASSERT_NULL(aws_h2_stream_table_find(&table, 4));
+
+    /* Table works normally after the iteration stopped */
+    ASSERT_SUCCESS(aws_h2_stream_table_insert(&table, 6, s_fake_stream(6)));
+    ASSERT_PTR_EQUALS(s_fake_stream(6), aws_h2_stream_table_find(&table, 6));
+    ASSERT_UINT_EQUALS(5, aws_h2_stream_table_count(&table));
+    aws_h2_stream_table_remove(&table, 6);
+    ASSERT_NULL(aws_h2_stream_table_find(&table, 6));
+    ASSERT_UINT_EQUALS(4, aws_h2_stream_table_count(&table));
+
+    const uint32_t remaining_ids[] = {1, 3, 5, 2};
+    ASSERT_SUCCESS(s_check_iteration(&table, remaining_ids, AWS_ARRAY_SIZE(remaining_ids)));
+
+    aws_h2_stream_table_clean_up(&table);
+    return AWS_OP_SUCCESS;
+}
+AWS_TEST_CASE(h2_stream_table_iter_stop_early, s_h2_stream_table_iter_stop_early_fn)
@@ -8,6 +8,8 @@
 
 #include <aws/http/request_response.h>
 
+#include <stdio.h>
+
 /* #TODO test that buffer is resized if space is insufficient */
 
 AWS_TEST_CASE(hpack_encode_integer, test_hpack_encode_integer)
@@ -90,6 +92,36 @@ static int test_hpack_encode_integer(struct aws_allocator *allocator, void *ctx)
     return AWS_OP_SUCCESS;
 }
 
+/* In SMALLEST mode, Huffman is only used if it makes the string shorter */
+AWS_TEST_CASE(hpack_encode_string_huffman_smallest, test_hpack_encode_string_huffman_smallest)
+static int test_hpack_encode_string_huffman_smallest(struct aws_allocator *allocator, void *ctx) {
+    (void)ctx;
+
+    struct aws_hpack_encoder encoder;
+    aws_hpack_encoder_init(&encoder, allocator, NULL);
+    aws_hpack_encoder_set_huffman_mode(&encoder, AWS_HPACK_HUFFMAN_SMALLEST);
+
+    struct aws_byte_buf output;
+    ASSERT_SUCCESS(aws_byte_buf_init(&output, allocator, 1));
+
+    /* RFC-7541 - Request Examples with Huffman Coding - C.4.1. First Request */
+    ASSERT_SUCCESS(aws_hpack_encode_string(&encoder, aws_byte_cursor_from_c_str("www.example.com"), &output));
+    uint8_t expected_huffman[] = {0x8c, 0xf1, 0xe3, 0xc2, 0xe5, 0xf2, 0x3a, 0x6b, 0xa0, 0xab, 0x90, 0xf4, 0xff};
+    ASSERT_BIN_ARRAYS_EQUALS(expected_huffman, sizeof(expected_huffman), output.buffer, output.len);
+
+    /* Control characters have long codes, so these are sent as-is */
+    output.len = 0;
+    uint8_t control_chars[] = {0x01, 0x02, 0x03};
+    ASSERT_SUCCESS(
+        aws_hpack_encode_string(&encoder, aws_byte_cursor_from_array(control_chars, sizeof(control_chars)), &output));
+    uint8_t expected_raw[] = {0x03, 0x01, 0x02, 0x03};
+    ASSERT_BIN_ARRAYS_EQUALS(expected_raw, sizeof(expected_raw), output.buffer, output.len);
+
+    aws_byte_buf_clean_up(&output);
+    aws_hpack_encoder_clean_up(&encoder);
+    return AWS_OP_SUCCESS;
+}
+
 struct decode_fixture {
     struct aws_hpack_decoder hpack;
     bool one_byte_at_a_time;
@@ -468,6 +500,88 @@ TEST_DECODE_ONE_BYTE_AT_A_TIME(hpack_decode_string_huffman) {
     return AWS_OP_SUCCESS;
 }
 
+/* Every octet value, so every code in the Huffman table gets decoded at least once */
+TEST_DECODE_ONE_BYTE_AT_A_TIME(hpack_decode_string_huffman_all_octets) {
+    struct decode_fixture *fixture = ctx;
+
+    uint8_t expected[256];
+    for (size_t i = 0; i < AWS_ARRAY_SIZE(expected); ++i) {
+        expected[i] = (uint8_t)i;
+    }
+
+    struct aws_hpack_encoder encoder;
+    aws_hpack_encoder_init(&encoder, allocator, NULL);
+    aws_hpack_encoder_set_huffman_mode(&encoder, AWS_HPACK_HUFFMAN_ALWAYS);
+
+    struct aws_byte_buf input;
+    ASSERT_SUCCESS(aws_byte_buf_init(&input, allocator, 1024));
+    ASSERT_SUCCESS(
+        aws_hpack_encode_string(&encoder, aws_byte_cursor_from_array(expected, sizeof(expected)), &input));
+    aws_hpack_encoder_clean_up(&encoder);
+
+    struct aws_byte_cursor to_decode = aws_byte_cursor_from_buf(&input);
+    struct aws_byte_buf output;
+    ASSERT_SUCCESS(aws_byte_buf_init(&output, allocator, 1));
+    bool complete;
+    ASSERT_SUCCESS(s_decode_string(fixture, &to_decode, &output, &complete));
+
+    ASSERT_TRUE(complete);
+    ASSERT_UINT_EQUALS(0, to_decode.len);
+    ASSERT_BIN_ARRAYS_EQUALS(expected, sizeof(expected), output.buffer, output.len);
+
+    aws_byte_buf_clean_up(&output);
+    aws_byte_buf_clean_up(&input);
+    return AWS_OP_SUCCESS;
+}
+
+/* Padding must be the most significant bits of the EOS code, which are all 1s */
+TEST_DECODE_ONE_BYTE_AT_A_TIME(hpack_decode_string_huffman_padding_not_eos) {
+    struct decode_fixture *fixture = ctx;
+
+    /* 'a' is 00011, followed by padding 110 */
+    uint8_t input[] = {0x81, 0x1e};
+    struct aws_byte_cursor to_decode = aws_byte_cursor_from_array(input, AWS_ARRAY_SIZE(input));
+    struct aws_byte_buf output;
+    ASSERT_SUCCESS(aws_byte_buf_init(&output, allocator, 4));
+    bool complete;
+    ASSERT_FAILS(s_decode_string(fixture, &to_decode, &output, &complete));
+
+    aws_byte_buf_clean_up(&output);
+    return AWS_OP_SUCCESS;
+}
+
+/* "Padding strictly longer than 7 bits MUST be treated as a decoding error" */
+TEST_DECODE_ONE_BYTE_AT_A_TIME(hpack_decode_string_huffman_padding_too_long) {
+    struct decode_fixture *fixture = ctx;
+
+    /* 'a' is 00011, followed by 11 bits of padding */
+    uint8_t input[] = {0x82, 0x1f, 0xff};
+    struct aws_byte_cursor to_decode = aws_byte_cursor_from_array(input, AWS_ARRAY_SIZE(input));
+    struct aws_byte_buf output;
+    ASSERT_SUCCESS(aws_byte_buf_init(&output, allocator, 4));
+    bool complete;
+    ASSERT_FAILS(s_decode_string(fixture, &to_decode, &output, &complete));
+
+    aws_byte_buf_clean_up(&output);
+    return AWS_OP_SUCCESS;
+}
+
+/* "A Huffman-encoded string literal containing the EOS symbol MUST be treated as a decoding error" */
+TEST_DECODE_ONE_BYTE_AT_A_TIME(hpack_decode_string_huffman_eos) {
+    struct decode_fixture *fixture = ctx;
+
+    /* EOS is 30 1s, then 'a' */
+    uint8_t input[] = {0x85, 0xff, 0xff, 0xff, 0xfc, 0x7f};
+    struct aws_byte_cursor to_decode = aws_byte_cursor_from_array(input, AWS_ARRAY_SIZE(input));
+    struct aws_byte_buf output;
+    ASSERT_SUCCESS(aws_byte_buf_init(&output, allocator, 4));
+    bool complete;
+    ASSERT_FAILS(s_decode_string(fixture, &to_decode, &output, &complete));
+
+    aws_byte_buf_clean_up(&output);
+    return AWS_OP_SUCCESS;
+}
+
 /* Test that partial input doesn't register as "complete" */
 TEST_DECODE_ONE_BYTE_AT_A_TIME(hpack_decode_string_ongoing) {
     struct decode_fixture *fixture = ctx;
@@ -546,6 +660,37 @@ static int test_hpack_static_table_find(struct aws_allocator *allocator, void *c
     return AWS_OP_SUCCESS;
 }
 
+/* Every entry in the static table is found at its own index */
+AWS_TEST_CASE(hpack_static_table_find_every_entry, test_hpack_static_table_find_every_entry)
+static int test_hpack_static_table_find_every_entry(struct aws_allocator *allocator, void *ctx) {
+    (void)ctx;
+
+    aws_http_library_init(allocator);
+    struct aws_hpack_context context;
+    aws_hpack_context_init(&context, allocator, AWS_LS_HTTP_GENERAL, NULL);
+    ASSERT_SUCCESS(aws_hpack_resize_dynamic_table(&context, 0));
+
+    bool found_value = false;
+    for (size_t i = 1; i <= 61; ++i) {
+        const struct aws_http_header *entry = aws_hpack_get_header(&context, i);
+        ASSERT_NOT_NULL(entry);
+        ASSERT_UINT_EQUALS(i, aws_hpack_find_index(&context, entry, true, &found_value));
+        ASSERT_UINT_EQUALS(entry->value.len != 0, found_value);
+    }
+
+    /* Same length, first char, and last char as "age", so it lands in the same bucket */
+    DEFINE_STATIC_HEADER(s_axe, "axe", "25");
+    ASSERT_UINT_EQUALS(0, aws_hpack_find_index(&context, &s_axe, true, &found_value));
+
+    /* Names are case-sensitive */
+    DEFINE_STATIC_HEADER(s_upper_age, "Age", "25");
+    ASSERT_UINT_EQUALS(0, aws_hpack_find_index(&context, &s_upper_age, true, &found_value));
+
+    aws_hpack_context_clean_up(&context);
+    aws_http_library_clean_up();
+    return AWS_OP_SUCCESS;
+}
+
 AWS_TEST_CASE(hpack_static_table_get, test_hpack_static_table_get)
 static int test_hpack_static_table_get(struct aws_allocator *allocator, void *ctx) {
     (void)ctx;
@@ -691,6 +836,108 @@ static int test_hpack_dynamic_table_get(struct aws_allocator *allocator, void *c
     return AWS_OP_SUCCESS;
 }
 
+enum {
+    CHURN_MAX_ENTRIES = 64,
+    CHURN_MAX_VALUE_LEN = 100,
+};
+
+struct churn_entry {
+    char name[16];
+    uint8_t value[CHURN_MAX_VALUE_LEN];
+    struct aws_http_header header;
+};
+
+/* Insert lots of headers of varying size, with some repeats, while occasionally resizing the table.
+ * Check everything against a simple model, so the arena wraps and the lookups see every kind of eviction. */
+AWS_TEST_CASE(hpack_dynamic_table_churn, test_hpack_dynamic_table_churn)
+static int test_hpack_dynamic_table_churn(struct aws_allocator *allocator, void *ctx) {
+    (void)ctx;
+
+    aws_http_library_init(allocator);
+    struct aws_hpack_context context;
+    aws_hpack_context_init(&context, allocator, AWS_LS_HTTP_GENERAL, NULL);
+
+    const size_t max_sizes[] = {512, 256, 1024, 0, 700};
+    size_t max_size = max_sizes[0];
+    ASSERT_SUCCESS(aws_hpack_resize_dynamic_table(&context, max_size));
+
+    /* Model of the dynamic table, newest first */
+    struct churn_entry model[CHURN_MAX_ENTRIES];
+    size_t model_count = 0;
+    size_t model_size = 0;
+
+    uint32_t rand_state = 12345;
+    for (size_t i = 0; i < 5000; ++i) {
+        if (i % 1000 == 999) {
+            max_size = max_sizes[(i / 1000 + 1) % AWS_ARRAY_SIZE(max_sizes)];
+            ASSERT_SUCCESS(aws_hpack_resize_dynamic_table(&context, max_size));
+            while (model_size > max_size) {
+                model_size -= aws_hpack_get_header_size(&model[--model_count].header);
+            }
+        }
+
+        /* Few names and values, so the same name, and the same name+value, show up again while still in the table */
+        rand_state = rand_state * 1103515245 + 12345;
+        struct churn_entry entry;
+        snprintf(entry.name, sizeof(entry.name), "x-churn-%u", (unsigned)((rand_state >> 8) % 8));
+        const size_t value_len = (rand_state >> 16) % 4 == 0 ? 0 : (rand_state >> 20) % CHURN_MAX_VALUE_LEN;
+        memset(entry.value, 'a' + (int)((rand_state >> 12) % 3), value_len);
+        entry.header.name = aws_byte_cursor_from_c_str(entry.name);
+        entry.header.value = aws_byte_cursor_from_array(entry.value, value_len);
+        entry.header.compression = AWS_HTTP_HEADER_COMPRESSION_USE_CACHE;
+
+        ASSERT_SUCCESS(aws_hpack_insert_header(&context, &entry.header));
+
+        if (max_size > 0) {
+            const size_t entry_size = aws_hpack_get_header_size(&entry.header);
+            while (model_count > 0 && model_size + entry_size > max_size) {
+                model_size -= aws_hpack_get_header_size(&model[--model_count].header);
+            }
+            memmove(&model[1], &model[0], model_count * sizeof(struct churn_entry));
+            model[0] = entry;
+            ++model_count;
+            model_size += entry_size;
+            /* Fix up pointers, since the entries moved */
+            for (size_t m = 0; m < model_count; ++m) {
+                model[m].header.name = aws_byte_cursor_from_c_str(model[m].name);
+                model[m].header.value = aws_byte_cursor_from_array(model[m].value, model[m].header.value.len);
+            }
+        }
+
+        ASSERT_UINT_EQUALS(model_count, aws_hpack_get_dynamic_table_num_elements(&context));
+        for (size_t m = 0; m < model_count; ++m) {
+            const struct aws_http_header *found = aws_hpack_get_header(&context, 62 + m);
+            ASSERT_NOT_NULL(found);
+            ASSERT_TRUE(aws_byte_cursor_eq(&model[m].header.name, &found->name));
+            ASSERT_TRUE(aws_byte_cursor_eq(&model[m].header.value, &found->value));
+
+            /* Lookups find the newest match */
+            size_t expected_name_value_index = 0;
+            size_t expected_name_index = 0;
+            for (size_t n = 0; n < model_count; ++n) {
+                if (!aws_byte_cursor_eq(&model[n].header.name, &model[m].header.name)) {
+                    continue;
+                }
+                if (!expected_name_index) {
+                    expected_name_index = 62 + n;
+                }
+                if (!expected_name_value_index && aws_byte_cursor_eq(&model[n].header.value, &model[m].header.value)) {
+                    expected_name_value_index = 62 + n;
+                }
+            }
+            bool found_value = false;
+            ASSERT_UINT_EQUALS(
+                expected_name_value_index, aws_hpack_find_index(&context, &model[m].header, true, &found_value));
+            ASSERT_UINT_EQUALS(
+                expected_name_index, aws_hpack_find_index(&context, &model[m].header, false, &found_value));
+        }
+    }
+
+    aws_hpack_context_clean_up(&context);
+    aws_http_library_clean_up();
+    return AWS_OP_SUCCESS;
+}
+
 static int s_check_header(
     const struct aws_http_header *header_field,
     const char *name,
@@ -748,6 +995,141 @@ static int test_hpack_decode_indexed_from_dynamic_table(struct aws_allocator *al
     return AWS_OP_SUCCESS;
 }
 
+/* Decoded names and values must stay valid until the header-block ends,
+ * even if they're evicted from the dynamic table, or later strings don't fit in the decoder's buffer */
+AWS_TEST_CASE(hpack_decode_header_block_strings_stay_valid, test_hpack_decode_header_block_strings_stay_valid)
+static int test_hpack_decode_header_block_strings_stay_valid(struct aws_allocator *allocator, void *ctx) {
+    (void)ctx;
+
+    aws_http_library_init(allocator);
+    struct aws_hpack_decoder decoder;
+    aws_hpack_decoder_init(&decoder, allocator, NULL);
+    /* Only room for one of these entries at a time */
+    ASSERT_SUCCESS(aws_hpack_resize_dynamic_table(&decoder.context, 64));
+
+    char long_value[600];
+    memset(long_value, 'v', sizeof(long_value) - 1);
+    long_value[sizeof(long_value) - 1] = '\0';
+
+    /* clang-format off */
+    uint8_t entries[] = {
+        0x40, 0x01, 'a', 0x01, 'b',     /* "a: b" - stored to dynamic table */
+        0xbe,                           /* "a: b" - indexed from dynamic table */
+        0x7e, 0x01, 'c',                /* "a: c" - name indexed from dynamic table, evicts "a: b" */
+        0x00, 0x01, 'x', 0x7f, 0xd8, 0x03, /* "x: vvv..." - 599 byte value, not indexed */
+    };
+    /* clang-format on */
+    struct aws_byte_buf input;
+    ASSERT_SUCCESS(aws_byte_buf_init(&input, allocator, sizeof(entries) + sizeof(long_value)));
+    ASSERT_TRUE(aws_byte_buf_write(&input, entries, sizeof(entries)));
+    ASSERT_TRUE(aws_byte_buf_write(&input, (const uint8_t *)long_value, strlen(long_value)));
+
+    /* Decode one byte at a time, so the long value has to move while it's decoded */
+    struct aws_http_header headers[4];
+    size_t num_headers = 0;
+    struct aws_byte_cursor input_cursor = aws_byte_cursor_from_buf(&input);
+    while (input_cursor.len) {
+        struct aws_byte_cursor one_byte = aws_byte_cursor_advance(&input_cursor, 1);
+        struct aws_hpack_decode_result result;
+        ASSERT_SUCCESS(aws_hpack_decode(&decoder, &one_byte, &result));
+        if (result.type == AWS_HPACK_DECODE_T_HEADER_FIELD) {
+            ASSERT_TRUE(num_headers < AWS_ARRAY_SIZE(headers));
+            struct aws_http_header *header = &headers[num_headers++];
+            *header = result.data.header_field;
+            /* Strings from the dynamic table must be kept explicitly */
+            if (result.name_is_transient) {
+                ASSERT_SUCCESS(aws_hpack_decoder_keep_string(&decoder, &header->name));
+            }
+            if (result.value_is_transient) {
+                ASSERT_SUCCESS(aws_hpack_decoder_keep_string(&decoder, &header->value));
+            }
+        }
+    }
+    ASSERT_UINT_EQUALS(4, num_headers);
+    ASSERT_UINT_EQUALS(1, aws_hpack_get_dynamic_table_num_elements(&decoder.context));
+
+    ASSERT_SUCCESS(s_check_header(&headers[0], "a", "b", AWS_HTTP_HEADER_COMPRESSION_USE_CACHE));
+    ASSERT_SUCCESS(s_check_header(&headers[1], "a", "b", AWS_HTTP_HEADER_COMPRESSION_USE_CACHE));
+    ASSERT_SUCCESS(s_check_header(&headers[2], "a", "c", AWS_HTTP_HEADER_COMPRESSION_USE_CACHE));
+    ASSERT_SUCCESS(s_check_header(&headers[3], "x", long_value, AWS_HTTP_HEADER_COMPRESSION_NO_CACHE));
+
+    /* Decoder keeps working after its memory is recycled */
+    aws_hpack_decoder_end_header_block(&decoder);
+    uint8_t next_block[] = {0xbe}; /* "a: c" - indexed from dynamic table */
+    input_cursor = aws_byte_cursor_from_array(next_block, sizeof(next_block));
+    struct aws_hpack_decode_result result;
+    ASSERT_SUCCESS(aws_hpack_decode(&decoder, &input_cursor, &result));
+    ASSERT_TRUE(result.type == AWS_HPACK_DECODE_T_HEADER_FIELD);
+    ASSERT_SUCCESS(s_check_header(&result.data.header_field, "a", "c", AWS_HTTP_HEADER_COMPRESSION_USE_CACHE));
+
+    aws_byte_buf_clean_up(&input);
+    aws_hpack_decoder_clean_up(&decoder);
+    aws_http_library_clean_up();
+    return AWS_OP_SUCCESS;
+}
+
+/* A header-block that references the dynamic table over and over mustn't make the decoder hold more memory */
+AWS_TEST_CASE(hpack_decode_repeated_indexed_fields, test_hpack_decode_repeated_indexed_fields)
+static int test_hpack_decode_repeated_indexed_fields(struct aws_allocator *allocator, void *ctx) {
+    (void)ctx;
+
+    aws_http_library_init(allocator);
+    struct aws_hpack_decoder decoder;
+    aws_hpack_decoder_init(&decoder, allocator, NULL);
+
+    char long_value[2000];
+    memset(long_value, 'v', sizeof(long_value) - 1);
+    long_value[sizeof(long_value) - 1] = '\0';
+
+    /* "a: vvv..." - 1999 byte value, stored to dynamic table */
+    uint8_t literal[] = {0x40, 0x01, 'a', 0x7f, 0xd0, 0x0e};
+    struct aws_byte_buf input;
+    ASSERT_SUCCESS(aws_byte_buf_init(&input, allocator, sizeof(literal) + sizeof(long_value)));
+    ASSERT_TRUE(aws_byte_buf_write(&input, literal, sizeof(literal)));
+    ASSERT_TRUE(aws_byte_buf_write(&input, (const uint8_t *)long_value, strlen(long_value)));
+
+    struct aws_byte_cursor input_cursor = aws_byte_cursor_from_buf(&input);
+    struct aws_hpack_decode_result result;
+    ASSERT_SUCCESS(aws_hpack_decode(&decoder, &input_cursor, &result));
+    ASSERT_TRUE(result.type == AWS_HPACK_DECODE_T_HEADER_FIELD);
+    ASSERT_FALSE(result.value_is_transient);
+    ASSERT_SUCCESS(s_check_header(&result.data.header_field, "a", long_value, AWS_HTTP_HEADER_COMPRESSION_USE_CACHE));
+    const size_t arena_len = decoder.block_arena.current.len;
+    const size_t num_full = aws_array_list_length(&decoder.block_arena.full);
+
+    /* Same header-block goes on to reference it many times, 1 byte each */
+    uint8_t indexed[] = {0xbe}; /* "a: vvv..." - indexed from dynamic table */
+    for (size_t i = 0; i < 1000; ++i) {
+        input_cursor = aws_byte_cursor_from_array(indexed, sizeof(indexed));
+        ASSERT_SUCCESS(aws_hpack_decode(&decoder, &input_cursor, &result));
+        ASSERT_TRUE(result.type == AWS_HPACK_DECODE_T_HEADER_FIELD);
+        ASSERT_TRUE(result.name_is_transient);
+        ASSERT_TRUE(result.value_is_transient);
+        ASSERT_SUCCESS(
+            s_check_header(&result.data.header_field, "a", long_value, AWS_HTTP_HEADER_COMPRESSION_USE_CACHE));
+    }
+
+    /* A literal with its name from the dynamic table doesn't copy the name into the header-block's memory either */
+    uint8_t indexed_name[] = {0x0f, 0x2f, 0x00}; /* "a: " - name indexed from dynamic table, not indexed */
+    for (size_t i = 0; i < 1000; ++i) {
+        input_cursor = aws_byte_cursor_from_array(indexed_name, sizeof(indexed_name));
+        ASSERT_SUCCESS(aws_hpack_decode(&decoder, &input_cursor, &result));
+        ASSERT_TRUE(result.type == AWS_HPACK_DECODE_T_HEADER_FIELD);
+        ASSERT_TRUE(result.name_is_transient);
+        ASSERT_FALSE(result.value_is_transient);
+        ASSERT_SUCCESS(s_check_header(&result.data.header_field, "a", "", AWS_HTTP_HEADER_COMPRESSION_NO_CACHE));
+    }
+
+    ASSERT_UINT_EQUALS(arena_len, decoder.block_arena.current.len);
+    ASSERT_UINT_EQUALS(num_full, aws_array_list_length(&decoder.block_arena.full));
+
+    aws_hpack_decoder_end_header_block(&decoder);
+    aws_byte_buf_clean_up(&input);
+    aws_hpack_decoder_clean_up(&decoder);
+    aws_http_library_clean_up();
+    return AWS_OP_SUCCESS;
+}
+
 /* Test header with empty value */
 AWS_TEST_CASE(hpack_dynamic_table_empty_value, test_hpack_dynamic_table_empty_value)
 static int test_hpack_dynamic_table_empty_value(struct aws_allocator *allocator, void *ctx) {
@@ -875,3 +1257,104 @@ static int test_hpack_dynamic_table_size_update_from_setting(struct aws_allocato
     aws_http_library_clean_up();
     return AWS_OP_SUCCESS;
 }
+
+/* Encode a header-block containing one header */
+static int s_encode_one_header(
+    struct aws_hpack_encoder *encoder,
+    struct aws_http_headers *headers,
+    const char *name,
+    const char *value,
+    struct aws_byte_buf *output) {
+
+    aws_http_headers_clear(headers);
+    ASSERT_SUCCESS(aws_http_headers_add(headers, aws_byte_cursor_from_c_str(name), aws_byte_cursor_from_c_str(value)));
+    output->len = 0;
+    ASSERT_SUCCESS(aws_hpack_encode_header_block(encoder, headers, output));
+    return AWS_OP_SUCCESS;
+}
+
+AWS_TEST_CASE(hpack_encoder_indexing_policy_builtin, test_hpack_encoder_indexing_policy_builtin)
+static int test_hpack_encoder_indexing_policy_builtin(struct aws_allocator *allocator, void *ctx) {
+    (void)ctx;
+
+    aws_http_library_init(allocator);
+    struct aws_hpack_encoder encoder;
+    aws_hpack_encoder_init(&encoder, allocator, NULL);
+    aws_hpack_encoder_set_indexing_policy(&encoder, aws_hpack_indexing_policy_builtin, NULL);
+
+    struct aws_http_headers *headers = aws_http_headers_new(allocator);
+    ASSERT_NOT_NULL(headers);
+    struct aws_byte_buf output;
+    ASSERT_SUCCESS(aws_byte_buf_init(&output, allocator, 128));
+
+    /* Values that change every request stay out of the dynamic table */
+    ASSERT_SUCCESS(s_encode_one_header(&encoder, headers, "X-Amz-Date", "20240601T120000Z", &output));
+    ASSERT_UINT_EQUALS(0, aws_hpack_get_dynamic_table_num_elements(&encoder.context));
+
+    /* Values that are sent again and again go in, and are sent as an index the next time */
+    ASSERT_SUCCESS(s_encode_one_header(&encoder, headers, "user-agent", "aws-sdk/1.0", &output));
+    ASSERT_UINT_EQUALS(1, aws_hpack_get_dynamic_table_num_elements(&encoder.context));
+    ASSERT_SUCCESS(s_encode_one_header(&encoder, headers, "user-agent", "aws-sdk/1.0", &output));
+    ASSERT_UINT_EQUALS(1, output.len);
+
+    /* Everything else is indexed as usual */
+    ASSERT_SUCCESS(s_encode_one_header(&encoder, headers, "x-custom", "value", &output));
+    ASSERT_UINT_EQUALS(2, aws_hpack_get_dynamic_table_num_elements(&encoder.context));
+
+    struct aws_hpack_encoder_metrics metrics;
+    aws_hpack_encoder_get_metrics(&encoder, &metrics);
+    ASSERT_UINT_EQUALS(1, metrics.num_indexed);
+    ASSERT_UINT_EQUALS(2, metrics.num_inserted);
+    ASSERT_UINT_EQUALS(1, metrics.num_not_inserted);
+    ASSERT_UINT_EQUALS(0, metrics.num_evicted);
+    ASSERT_UINT_EQUALS(10 + 16 + 2 * (10 + 11) + 8 + 5, metrics.header_bytes);
+    ASSERT_TRUE(metrics.encoded_bytes < metrics.header_bytes);
+
+    aws_byte_buf_clean_up(&output);
+    aws_http_headers_release(headers);
+    aws_hpack_encoder_clean_up(&encoder);
+    aws_http_library_clean_up();
+    return AWS_OP_SUCCESS;
+}
+
+AWS_TEST_CASE(hpack_encoder_adaptive_indexing, test_hpack_encoder_adaptive_indexing)
+static int test_hpack_encoder_adaptive_indexing(struct aws_allocator *allocator, void *ctx) {
+    (void)ctx;
+
+    aws_http_library_init(allocator);
+    struct aws_hpack_encoder encoder;
+    aws_hpack_encoder_init(&encoder, allocator, NULL);
+    aws_hpack_encoder_set_adaptive_indexing(&encoder, true);
+
+    struct aws_http_headers *headers = aws_http_headers_new(allocator);
+    ASSERT_NOT_NULL(headers);
+    struct aws_byte_buf output;
+    ASSERT_SUCCESS(aws_byte_buf_init(&output, allocator, 128));
+
+    /* A name whose values never repeat is indexed for a while, then it isn't worth the space */
+    char value[32];
+    for (int i = 0; i < 40; ++i) {
+        snprintf(value, sizeof(value), "unique-%d", i);
+        ASSERT_SUCCESS(s_encode_one_header(&encoder, headers, "x-request-nonce", value, &output));
+    }
+
+    struct aws_hpack_encoder_metrics metrics;
+    aws_hpack_encoder_get_metrics(&encoder, &metrics);
+    ASSERT_UINT_EQUALS(16, metrics.num_inserted);
+    ASSERT_UINT_EQUALS(24, metrics.num_not_inserted);
+
+    /* A name whose value repeats keeps getting hits */
+    for (int i = 0; i < 40; ++i) {
+        ASSERT_SUCCESS(s_encode_one_header(&encoder, headers, "x-client-id", "abc123", &output));
+    }
+
+    aws_hpack_encoder_get_metrics(&encoder, &metrics);
+    ASSERT_UINT_EQUALS(17, metrics.num_inserted);
+    ASSERT_UINT_EQUALS(39, metrics.num_indexed);
+
+    aws_byte_buf_clean_up(&output);
+    aws_http_headers_release(headers);
+    aws_hpack_encoder_clean_up(&encoder);
+    aws_http_library_clean_up();
+    return AWS_OP_SUCCESS;
+}
@@ -4,6 +4,7 @@
  */
 
 #include <aws/common/string.h>
+#include <aws/http/private/http_impl.h>
 #include <aws/http/private/request_response_impl.h>
 #include <aws/http/request_response.h>
 #include <aws/http/status_code.h>
@@ -452,3 +453,45 @@ TEST_CASE(message_with_existing_headers) {
     aws_http_message_release(message);
     return AWS_OP_SUCCESS;
 }
+
+TEST_CASE(message_str_to_header_name) {
+    (void)ctx;
+    (void)allocator;
+    struct {
+        const char *str;
+        enum aws_http_header_name expected;
+        enum aws_http_header_name expected_lowercase;
+    } cases[] = {
+        {":method", AWS_HTTP_HEADER_METHOD, AWS_HTTP_HEADER_METHOD},
+        {"te", AWS_HTTP_HEADER_TE, AWS_HTTP_HEADER_TE},
+        {"content-length", AWS_HTTP_HEADER_CONTENT_LENGTH, AWS_HTTP_HEADER_CONTENT_LENGTH},
+        {"Content-Length", AWS_HTTP_HEADER_CONTENT_LENGTH, AWS_HTTP_HEADER_UNKNOWN},
+        {"TRANSFER-ENCODING", AWS_HTTP_HEADER_TRANSFER_ENCODING, AWS_HTTP_HEADER_UNKNOWN},
+        {"proxy-connection", AWS_HTTP_HEADER_PROXY_CONNECTION, AWS_HTTP_HEADER_PROXY_CONNECTION},
+        /* same length, first, and last char as a known header, but not a match */
+        {"content-lxxxxth", AWS_HTTP_HEADER_UNKNOWN, AWS_HTTP_HEADER_UNKNOWN},
+        {"x-amz-date", AWS_HTTP_HEADER_UNKNOWN, AWS_HTTP_HEADER_UNKNOWN},
+        {"", AWS_HTTP_HEADER_UNKNOWN, AWS_HTTP_HEADER_UNKNOWN},
+    };
+
+    for (size_t i = 0; i < AWS_ARRAY_SIZE(cases); ++i) {
+        struct aws_byte_cursor cursor = aws_byte_cursor_from_c_str(cases[i].str);
+        ASSERT_INT_EQUALS(cases[i].expected, aws_http_str_to_header_name(cursor));
+        ASSERT_INT_EQUALS(cases[i].expected_lowercase, aws_http_lowercase_str_to_header_name(cursor));
+    }
+
+    return AWS_OP_SUCCESS;
+}
+
+TEST_CASE(message_str_to_method) {
+    (void)ctx;
+    (void)allocator;
+    ASSERT_INT_EQUALS(AWS_HTTP_METHOD_GET, aws_http_str_to_method(aws_byte_cursor_from_c_str("GET")));
+    ASSERT_INT_EQUALS(AWS_HTTP_METHOD_HEAD, aws_http_str_to_method(aws_byte_cursor_from_c_str("HEAD")));
+    ASSERT_INT_EQUALS(AWS_HTTP_METHOD_CONNECT, aws_http_str_to_method(aws_byte_cursor_from_c_str("CONNECT")));
+    /* methods are case-sensitive */
+    ASSERT_INT_EQUALS(AWS_HTTP_METHOD_UNKNOWN, aws_http_str_to_method(aws_byte_cursor_from_c_str("get")));
+    ASSERT_INT_EQUALS(AWS_HTTP_METHOD_UNKNOWN, aws_http_str_to_method(aws_byte_cursor_from_c_str("PUT")));
+    ASSERT_INT_EQUALS(AWS_HTTP_METHOD_UNKNOWN, aws_http_str_to_method(aws_byte_cursor_from_c_str("")));
+    return AWS_OP_SUCCESS;
+}
@@ -0,0 +1,142 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/http/private/mpsc_queue.h>
+
+#include <aws/common/thread.h>
+#include <aws/testing/aws_test_harness.h>
+
+struct test_item {
+    struct aws_mpsc_queue_node node;
+    size_t producer;
+    size_t seq;
+};
+
+static struct test_item *s_pop_item(struct aws_mpsc_queue *queue) {
+    struct aws_mpsc_queue_node *node = aws_mpsc_queue_pop(queue);
+    return node ? AWS_CONTAINER_OF(node, struct test_item, node) : NULL;
+}
+
+static int s_mpsc_queue_fifo_and_close_fn(struct aws_allocator *allocator, void *ctx) {
+    (void)allocator;
+    (void)ctx;
+
+    struct aws_mpsc_queue queue;
+    aws_mpsc_queue_init(&queue);
+    ASSERT_NULL(aws_mpsc_queue_pop(&queue));
+
+    struct test_item items[5];
+    for (size_t i = 0; i < AWS_ARRAY_SIZE(items); ++i) {
+        items[i].seq = i;
+    }
+
+    /* Single item in and out, then do it again, since the stub moves around */
+    for (size_t round = 0; round < 2; ++round) {
+        ASSERT_TRUE(aws_mpsc_queue_try_push(&queue, &items[0].node));
+        ASSERT_PTR_EQUALS(&items[0], s_pop_item(&queue));
+        ASSERT_NULL(aws_mpsc_queue_pop(&queue));
+    }
+
+    /* Come out in the order they went in, even when pushes and pops interleave */
+    ASSERT_TRUE(aws_mpsc_queue_try_push(&queue, &items[0].node));
+    ASSERT_TRUE(aws_mpsc_queue_try_push(&queue, &items[1].node));
+    ASSERT_PTR_EQUALS(&items[0], s_pop_item(&queue));
+    ASSERT_TRUE(aws_mpsc_queue_try_push(&queue, &items[2].node));
+    ASSERT_TRUE(aws_mpsc_queue_try_push(&queue, &items[3].node));
+    ASSERT_PTR_EQUALS(&items[1], s_pop_item(&queue));
+    ASSERT_PTR_EQUALS(&items[2], s_pop_item(&queue));
+
+    /* Once closed, pushes fail but what's already in the queue can still be popped */
+    aws_mpsc_queue_close(&queue);
+    ASSERT_FALSE(aws_mpsc_queue_try_push(&queue, &items[4].node));
+    aws_mpsc_queue_close(&queue);
+    ASSERT_PTR_EQUALS(&items[3], s_pop_item(&queue));
+    ASSERT_NULL(aws_mpsc_queue_pop(&queue));
+
+    return AWS_OP_SUCCESS;
+}
+AWS_TEST_CASE(mpsc_queue_fifo_and_close, s_mpsc_queue_fifo_and_close_fn)
+
+enum {
+    MT_PRODUCER_COUNT = 8,
+    MT_ITEMS_PER_PRODUCER = 20000,
+};
+
+struct mt_producer {
+    struct aws_mpsc_queue *queue;
+    struct test_item *items;
+    size_t pushed_count;
+};
+
+static void s_mt_producer_fn(void *arg) {
+    struct mt_producer *producer = arg;
+    for (size_t i = 0; i < MT_ITEMS_PER_PRODUCER; ++i) {
+        if (!aws_mpsc_queue_try_push(producer->queue, &producer->items[i].node)) {
+            break;
+        }
+        ++producer->pushed_count;
+    }
+}
+
+/* Many threads push while one pops and then closes the queue part way through.
+ * Every item pushed must be popped exactly once, in the order its producer pushed it. */
+static int s_mpsc_queue_multi_threaded_fn(struct aws_allocator *allocator, void *ctx) {
+    (void)ctx;
+
+    struct aws_mpsc_queue queue;
+    aws_mpsc_queue_init(&queue);
+
+    const size_t total_items = (size_t)MT_PRODUCER_COUNT * MT_ITEMS_PER_PRODUCER;
+    struct test_item *items = aws_mem_calloc(allocator, total_items, sizeof(struct test_item));
+    ASSERT_NOT_NULL(items);
+
+    struct mt_producer producers[MT_PRODUCER_COUNT];
+    struct aws_thread threads[MT_PRODUCER_COUNT];
+    for (size_t p = 0; p < MT_PRODUCER_COUNT; ++p) {
+        producers[p].queue = &queue;
+        producers[p].items = items + p * MT_ITEMS_PER_PRODUCER;
+        producers[p].pushed_count = 0;
+        for (size_t i = 0; i < MT_ITEMS_PER_PRODUCER; ++i) {
+            producers[p].items[i].producer = p;
+            producers[p].items[i].seq = i;
+        }
+    }
+    for (size_t p = 0; p < MT_PRODUCER_COUNT; ++p) {
+        ASSERT_SUCCESS(aws_thread_init(&threads[p], allocator));
+        ASSERT_SUCCESS(aws_thread_launch(&threads[p], s_mt_producer_fn, &producers[p], NULL));
+    }
+
+    size_t next_seq[MT_PRODUCER_COUNT] = {0};
+    size_t popped_count = 0;
+    while (popped_count < total_items / 2) {
+        struct test_item *item = s_pop_item(&queue);
+        if (item) {
+            ASSERT_UINT_EQUALS(next_seq[item->producer], item->seq);
+            ++next_seq[item->producer];
+            ++popped_count;
+        }
+    }
+
+    /* After close, nothing new shows up, so one more pass gets everything */
+    aws_mpsc_queue_close(&queue);
+    for (struct test_item *item = s_pop_item(&queue); item != NULL; item = s_pop_item(&queue)) {
+        ASSERT_UINT_EQUALS(next_seq[item->producer], item->seq);
+        ++next_seq[item->producer];
+        ++popped_count;
+    }
+
+    size_t pushed_count = 0;
+    for (size_t p = 0; p < MT_PRODUCER_COUNT; ++p) {
+        ASSERT_SUCCESS(aws_thread_join(&threads[p]));
+        aws_thread_clean_up(&threads[p]);
+        ASSERT_UINT_EQUALS(producers[p].pushed_count, next_seq[p]);
+        pushed_count += producers[p].pushed_count;
+    }
+    ASSERT_UINT_EQUALS(pushed_count, popped_count);
+
+    aws_mem_release(allocator, items);
+    return AWS_OP_SUCCESS;
+}
+AWS_TEST_CASE(mpsc_queue_multi_threaded, s_mpsc_queue_multi_threaded_fn)